@@ -2,8 +2,8 @@
  ****************************************************************************************************
  * @file        24cxx.h
  * @author      ԭŶ(ALIENTEK)
- * @version     V1.0
- * @date        2021-10-23
+ * @version     V1.1
+ * @date        2026-10-18
  * @brief       24CXX 
  * @license     Copyright (c) 2020-2032, ӿƼ޹˾
  ****************************************************************************************************
@@ -18,6 +18,9 @@
  * ޸˵
  * V1.0 20211023
  * һη
+ * V1.1 20261018
+ * 1ҳд(ҳ), д겻ٹ̶ʱ10ms, һηǰACKѯдڽ
+ * 2һεַ׶ζ, дǷӦ
  *
  ****************************************************************************************************
  */
@@ -41,12 +44,17 @@
 
 #define EE_TYPE     AT24C02
 
+/* ҳС: 24C01/02Ϊ8ֽ, 24C04/08/16Ϊ16ֽ, 24C32/64Ϊ32ֽ, 24C128/256Ϊ64ֽ */
+#define EE_PAGE_SIZE    ((EE_TYPE <= AT24C02) ? 8 : (EE_TYPE <= AT24C16) ? 16 : (EE_TYPE <= AT24C64) ? 32 : 64)
+#define EE_POLL_MS      11      /* ACKѯʱ(ms), д10ms */
+
 void at24cxx_init(void);        /* ʼIIC */
 uint8_t at24cxx_check(void);    /*  */
 uint8_t at24cxx_read_one_byte(uint16_t addr);                       /* ַָȡһֽ */
 void at24cxx_write_one_byte(uint16_t addr,uint8_t data);            /* ַָдһֽ */
-void at24cxx_write(uint16_t addr, uint8_t *pbuf, uint16_t datalen); /* ַָʼдָȵ */
-void at24cxx_read(uint16_t addr, uint8_t *pbuf, uint16_t datalen);  /* ַָʼָȵ */
+uint8_t at24cxx_write(uint16_t addr, uint8_t *pbuf, uint16_t datalen);  /* ַָʼдָȵ(ҳ) */
+uint8_t at24cxx_read(uint16_t addr, uint8_t *pbuf, uint16_t datalen);   /* ַָʼָȵ */
+uint8_t at24cxx_wait(void);     /* ACKѯ, һдڽ */
 
 #endif
 
@@ -0,0 +1,79 @@
+/**
+ ****************************************************************************************************
+ * @file        asset.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ѹͼƬֿԴ: RLE/LZ ͼƬ߽дGRAM, ģַ
+ ****************************************************************************************************
+ * @attention
+ *
+ * Դϵ Host/asset_pack.c Cͷļ, ʽ:
+ *   ͼƬ(RGB565, С,  lcd_show_pic ͬ):
+ *     ASSET_RAW  ѹ
+ *     ASSET_RLE  ֽ c: c<0x80  c+1 ԭ; c>=0x80 1ظ (c&0x7F)+2 
+ *     ASSET_LZ   ֽ c: c<0x80  c+1 ԭ; c>=0x80 1ֽ d,
+ *                 d+1 ֮ǰ (c&0x7F)+2 (d=0ظһ, ص)
+ *   ģ(lcdfont.h 1bppиʽ):
+ *     ASSET_RAW  ѹ
+ *     ASSET_RLE  ÿģѹ, 4λһγ, 0ʼ0/1; 15ʾ15ɫ,
+ *                β0. offs ÿģʼƫ(96, һǽβ)
+ *
+ * ͼƬ벻ҪͼĻ: һ, һдһ, LZֻ ASSET_LZ_WINDOW 
+ * ʷ. ѹͼƬCPUдGRAM, DMA; ѹͼƬ lcd_show_pic DMA.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __ASSET_H
+#define __ASSET_H
+
+#ifdef HOST_SIM
+#include "host_sim.h"
+#else
+#include "main.h"
+#endif
+
+
+/******************************************************************************************/
+/* Դʽ */
+
+#define ASSET_RAW           0
+#define ASSET_RLE           1
+#define ASSET_LZ            2
+
+#define ASSET_LZ_WINDOW     256         /* LZõԶ(), 뻺 2*256 ֽ */
+#define ASSET_RUN_MAX       129         /* һظ/ƶĵ */
+#define ASSET_LIT_MAX       128         /* һԭĵ */
+#define ASSET_GLYPH_MAX     64          /* ģ(3216)ֽ */
+#define ASSET_GLYPH_NUM     95          /* ַֿ, ' ' ~ '~' */
+
+/* ͼƬ */
+typedef struct
+{
+    uint16_t w;
+    uint16_t h;
+    uint8_t codec;                      /* ASSET_RAW/ASSET_RLE/ASSET_LZ */
+    uint32_t len;                       /* data ֽ */
+    const uint8_t *data;
+} asset_img_t;
+
+/* ֿ */
+typedef struct
+{
+    uint8_t size;                       /* С 12/16/24/32 */
+    uint8_t bytes;                      /* ÿģֽ */
+    uint8_t codec;                      /* ASSET_RAW/ASSET_RLE */
+    const uint16_t *offs;               /* ASSET_RLE: ÿģʼƫ, ASSET_GLYPH_NUM+1  */
+    const uint8_t *data;
+} asset_font_t;
+
+/******************************************************************************************/
+/*  */
+
+uint8_t asset_show_img(uint16_t x, uint16_t y, const asset_img_t *img);    /* (x,y)ʾͼƬ */
+uint8_t asset_glyph(const asset_font_t *font, uint8_t index, uint8_t *buf); /* indexģ */
+
+uint32_t asset_pack_img(uint8_t codec, const uint16_t *px, uint32_t n, uint8_t *out, uint32_t cap); /* ѹͼƬ */
+uint16_t asset_pack_glyph(const uint8_t *raw, uint8_t bytes, uint8_t *out);   /* ѹһģ, out bytes*4 ֽ */
+
+#endif
@@ -0,0 +1,64 @@
+/**
+ ****************************************************************************************************
+ * @file        bar.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʮʵͼ: סÿĳ, ֻˢ±仯һ
+ ****************************************************************************************************
+ * @attention
+ *
+ * ͼ dirty.c һͼ, ڽÿһֱǩұ. ÿĳȰ,
+ * ʱ仯һʱʲôд; ʱֻǼ¾ɳ֮ľ,  dirty_flush() ˢ.
+ * Ǹһɫ, ֵʱػ.
+ *
+ * bar_set() ֻµĸ, bar_poll() ÿ BAR_FRAME_MS ύһ(Ļˢ),
+ * ˢ¿ʱмĽֱӶ, д.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __BAR_H
+#define __BAR_H
+
+#ifdef HOST_SIM
+#include "host_sim.h"
+#else
+#include "main.h"
+#endif
+#include "panel.h"
+
+
+/******************************************************************************************/
+/* ͼ */
+
+#define BAR_NUM             PANEL_PROB_NUM
+#define BAR_X               (PANEL_X + (PANEL_PROB_TEXT ? 12 : 2) * PANEL_SIZE / 2)    /* ǩ()ұ */
+#define BAR_Y               PANEL_Y     /* ж, ÿ PANEL_SIZE */
+#define BAR_PAD             6           /* ±ߵľ */
+#define BAR_MARGIN          16          /* 󳤶Ļұߵľ */
+#define BAR_FRAME_MS        16          /* ύ, Լ60Hz */
+
+#define BAR_COLOR           BLUE
+#define BAR_TOP_COLOR       RED         /* Ǹ */
+#define BAR_TRACK_COLOR     LGRAY       /* ĵɫ, ʾ̶ */
+
+/* ͳ */
+typedef struct
+{
+    uint32_t sets;                      /* bar_set  */
+    uint32_t commits;                   /* ύ */
+    uint32_t dropped;                   /* ûύͱ½ǵĴ */
+    uint32_t rects;                     /* Ǽǵľ(ۼ) */
+    uint32_t pixels;                    /* Ǽǵ(ۼ) */
+} bar_stats_t;
+
+/******************************************************************************************/
+/*  */
+
+void bar_init(void);                                                    /* ʼעͼ(dirty_init֮) */
+void bar_set(const float *prob);                                        /* µ BAR_NUM  */
+uint8_t bar_commit(void);                                               /* ύ, صǼǵľ */
+uint8_t bar_poll(void);                                                 /* ϴύ BAR_FRAME_MS ύ */
+const bar_stats_t *bar_get_stats(void);                                 /* ȡͳ */
+
+#endif
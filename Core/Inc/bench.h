@@ -0,0 +1,88 @@
+/**
+ ****************************************************************************************************
+ * @file        bench.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ׼עʹڿ̨
+ ****************************************************************************************************
+ * @attention
+ *
+ * ÿ׼һ void fn(void *arg) , עʱÿεдֽ.
+ * ʱԤһ, ٰDWTڼͳ min/avg/max,  /  MB/.
+ *
+ * ̨(USART1, Эֽ֡, Իس):
+ *   list                   гл׼
+ *   run <|ǰ׺|all> [n]  л׼, nΪ(Ĭ BENCH_DEF_ITERS)
+ *   report                 л׼һν
+ *   help                   ˵
+ *
+ * bench.c  nn_ref.c Ӳ,  HOST_SIM Linuxϱ( Host/bench_host.c),
+ * רеĻ׼(ai_network_run/LCD/) bench_board.c ע.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __BENCH_H
+#define __BENCH_H
+
+#ifdef HOST_SIM
+#include "host_sim.h"
+#define bench_now()         host_cycles()
+#else
+#include "main.h"
+#define bench_now()         (DWT->CYCCNT)   /* DWTlog_initʹ */
+#endif
+
+
+/******************************************************************************************/
+/* ׼ */
+
+#define BENCH_MAX_NUM       48          /* עĻ׼ */
+#define BENCH_LINE_SIZE     40          /* ̨г */
+#define BENCH_DEF_ITERS     10          /* Ĭϵ */
+#define BENCH_MAX_ITERS     10000       /*  */
+
+typedef void (*bench_fn_t)(void *arg);
+
+/* һн */
+typedef struct
+{
+    uint32_t iters;                     /* , 0ʾûй */
+    uint32_t min;                       /*  */
+    uint32_t avg;
+    uint32_t max;
+} bench_result_t;
+
+/* һ׼ */
+typedef struct
+{
+    const char *name;
+    bench_fn_t fn;
+    void *arg;
+    uint32_t bytes;                     /* ÿεдֽ */
+    bench_result_t res;
+} bench_t;
+
+/******************************************************************************************/
+/*  */
+
+void bench_init(void *scratch);                                 /* ʼע, scratch NN_REF_SCRATCH ֽ */
+uint8_t bench_add(const char *name, bench_fn_t fn, void *arg, uint32_t bytes); /* עһ׼ */
+bench_t *bench_find(const char *name);                          /* ֲ */
+void *bench_scratch(void);                                      /* bench_init ʱ */
+uint8_t bench_run(bench_t *b, uint32_t iters);                  /* һ׼ */
+void bench_list(void);                                          /* г׼ */
+void bench_report(void);                                        /*  */
+void bench_exec(const char *line);                              /* ִһ */
+void bench_rx(uint8_t ch);                                      /* յһַ̨(ж) */
+void bench_poll(void);                                          /* ִյ(ѭ) */
+
+void bench_enter(void);                                         /* ʼǰĻص() */
+void bench_exit(void);                                          /* нĻص() */
+uint8_t bench_cmd(const char *cmd, const char *name, const char *arg);  /* ̨(), ˷1 */
+
+#ifndef HOST_SIM
+void bench_board_init(uint32_t (*infer)(const float *in, float *out)); /* ערеĻ׼(bench_board.c) */
+#endif
+
+#endif
@@ -0,0 +1,54 @@
+/**
+ ****************************************************************************************************
+ * @file        boot.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ¼: ÿһɵʱ, LCD/ICǷϴμĽ, һʱ
+ ****************************************************************************************************
+ * @attention
+ *
+ * main ÿһ boot_mark(), ÿһֻǵһ(DWT->CYCCNT, log_init ֮ʼ),
+ * BOOT_START ʱ HAL_GetTick(), ʱ䶼ǴӸλ(HAL_Init)us.
+ * һɿʱŽ g_q_ink һοջ(), ʾԺ
+ * boot_poll(־)һο¼, ̨ "boot" (bench_cmd).
+ * ʱ LCD  cfg.h  CFG_LCD ¼ID(lcd_init_start_hint), ICԼ¼(tp_set_hint),
+ * ˾Ͳð˳̽; ¼ͼĽͬʱһ֮֡д¼.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __BOOT_H
+#define __BOOT_H
+
+#include "main.h"
+
+
+/******************************************************************************************/
+/*  */
+
+#define BOOT_START          0           /* log_init ֮ */
+#define BOOT_CFG            1           /* cfg_load  */
+#define BOOT_LCD_ID         2           /* LCD ID, ʼִгʼ */
+#define BOOT_TP             3           /* tp_dev.init  */
+#define BOOT_AI             4           /* AI_Init  */
+#define BOOT_LCD_READY      5           /* LCDʼִ */
+#define BOOT_FRAME          6           /* һ֡(Ի) */
+#define BOOT_INFER          7           /* һ */
+#define BOOT_SHOWN          8           /* һνʾ */
+#define BOOT_STEP_NUM       9
+
+/* ϴμ(cfg.h  CFG_LCD ¼)ʹ */
+#define BOOT_HINT_NONE      0           /* ûм¼, ˳̽ */
+#define BOOT_HINT_HIT       1           /* ¼, û̽ */
+#define BOOT_HINT_MISS      2           /* ¼(), ˳̽ */
+
+/******************************************************************************************/
+/*  */
+
+void boot_mark(uint8_t step);                                   /* ¼һɵʱ */
+void boot_hint(uint8_t lcd, uint8_t tp);                        /* ¼ LCD/IC  BOOT_HINT_xx */
+uint32_t boot_us(uint8_t step);                                 /* һɵʱ(λus), 0ʾû */
+void boot_poll(void);                                           /* һνʾһ */
+void boot_report(void);                                         /* ¼ */
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ ****************************************************************************************************
+ * @file        cfg.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       EEPROM(24C02)ü¼: 汾CRC, ÿ¼д
+ ****************************************************************************************************
+ * @attention
+ *
+ * 洢 CFG_ADDR ʼ,  CFG_SIZE ֽ, ÿ¼̶Ĳ(A/B), ۰ҳ.
+ * һ(С):
+ *   [0] ¼ID  [1] 汾  [2] ݳ  [3] д
+ *   [4..]       , 04ֽڶ
+ *   [..+4]      CRC32(ӲCRC,  proto.h ͬ), ǰе
+ * дʱдûõǸ(ż1), дһʱֻµһ, ɵһݻ.
+ * ʱ۶Чȡµ; ID/汾/Ⱥ cfg.c ıĵû(ʽҪӰ汾).
+ *
+ *  cfg_load() һ洢(һַ׶), ڴ, cfg_get() ٶEEPROM.
+ * cfg_set() ֻдһ(ҳд, д), ʱͿʱ cfg_report() .
+ * ԭ 40~52 ַϵĵУ׼(0X0A)û CFG_TP_CAL ¼ʱһ, ¼¼.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __CFG_H
+#define __CFG_H
+
+#include "main.h"
+
+
+/******************************************************************************************/
+/* 洢 */
+
+#define CFG_ADDR            64          /* ʼַ(ҳ), ܿԭУ׼(40~52) at24cxx_check õĩַ */
+#define CFG_SIZE            128         /* 洢ֽ */
+#define CFG_HDR_SIZE        4           /* ID + 汾 +  +  */
+
+/* ¼ID */
+#define CFG_TP_CAL          1           /* У׼: tp_dev.xfac/yfac/xc/yc, 12ֽ */
+#define CFG_LCD             2           /* ⵽LCDʹIC: cfg_lcd_t, ID */
+#define CFG_UI              3           /* : cfg_ui_t */
+#define CFG_NUM             3
+
+/* CFG_LCD */
+typedef struct
+{
+    uint16_t id;                        /* lcddev.id */
+    uint8_t dir;                        /* lcddev.dir */
+    uint8_t tp;                         /* IC, touch.h  TP_CTRL_xx(汾2) */
+} cfg_lcd_t;
+
+/* CFG_UI */
+typedef struct
+{
+    uint8_t fmap;                       /* 1, ʱͼ(fmap.h) */
+    uint8_t reserved[3];
+} cfg_ui_t;
+
+/* ͳ */
+typedef struct
+{
+    uint32_t load_us;                   /* 洢ʱ */
+    uint8_t load_ok;                    /* Чļ¼ */
+    uint8_t load_bad;                   /* CRC/ʽԵĲ(ղ۲) */
+    uint8_t ee_err;                     /* 1, EEPROM Ӧ */
+    uint8_t reserved;
+    uint32_t saves;                     /* cfg_set д */
+    uint32_t save_us;                   /* һ cfg_set ʱ(һҳд) */
+    uint32_t save_bytes;                /* һдֽ */
+} cfg_stats_t;
+
+/******************************************************************************************/
+/*  */
+
+uint8_t cfg_load(void);                                         /* 洢, Ч¼ */
+uint8_t cfg_get(uint8_t id, void *data, uint8_t len);           /* һ¼, 0ɹ */
+uint8_t cfg_set(uint8_t id, const void *data, uint8_t len);     /* дһ¼, 0ɹ */
+void cfg_erase(void);                                           /* м¼ */
+const cfg_stats_t *cfg_get_stats(void);                         /* ȡͳ */
+void cfg_report(void);                                          /* ¼ʱ */
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ ****************************************************************************************************
+ * @file        dirty.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       LCDιӳٺϳ
+ ****************************************************************************************************
+ * @attention
+ *
+ * Ļɼͼ(ɫ + ע˳µϵͼ), ݱ仯ʱֻǼǱ˵ľ(dirty_add),
+ * ֱдLCD. dirty_flush() һ֡Ǽǵľΰ˳ˢ: ÿ(Լ DIRTY_BAND_PIXELS )һδ,
+ * еøͼ paint ϳһ, дGRAM.
+ *
+ * Ǽʱ: оΰֱӶ; ཻĺϲ; ཻϲСڿڵĿʱҲϲ.
+ *  DIRTY_RECT_NUM ʱϲٵǸ.
+ *
+ * ʻ(ī), ֱӻ, ӳС; ʱǼīӾ, ͼºϳ.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __DIRTY_H
+#define __DIRTY_H
+
+#ifdef HOST_SIM
+#include "host_sim.h"
+#else
+#include "main.h"
+#endif
+
+
+/******************************************************************************************/
+/*  */
+
+#define DIRTY_RECT_NUM      16          /* һ֡ľ */
+#define DIRTY_LAYER_NUM     4           /* ͼ */
+#define DIRTY_LINE_MAX      800         /* һ(Ļ) */
+#define DIRTY_BAND_PIXELS   8192        /* һڵˢµĵ(), ֮䴥ɨռ */
+#define DIRTY_MERGE_COST    64          /* һδڵĿ, ۺ; ϲСͺϲ */
+#define DIRTY_REPORT_MS     10000       /* dirty_poll ͳƵļ, 0ʾֶֻ */
+
+/* ,  */
+typedef struct
+{
+    uint16_t x0;
+    uint16_t y0;
+    uint16_t x1;
+    uint16_t y1;
+} dirty_rect_t;
+
+/* ͼ: ѵy [x0, x1] ﱾͼػ line[0 ~ x1-x0] (͸ĵ㸲ͼ) */
+typedef void (*dirty_paint_t)(uint16_t y, uint16_t x0, uint16_t x1, uint16_t *line);
+
+/* ͳ */
+typedef struct
+{
+    uint32_t frames;                    /* dirty_flush (ֻоε) */
+    uint32_t rects;                     /* һ֡ˢµľ */
+    uint32_t pixels;                    /* һ֡д */
+    uint32_t bytes;                     /* һ֡FSMCֽ() */
+    uint32_t added;                     /* һ֡Ǽǵľ */
+    uint32_t merged;                    /* һ֡ϲľ */
+    uint32_t skipped;                   /* һ֡򱻰ľ */
+    uint32_t total_rects;               /* Ϊͳƴڵۼ */
+    uint64_t total_bytes;
+    uint32_t max_bytes;                 /* ֽ֡ */
+} dirty_stats_t;
+
+/******************************************************************************************/
+/*  */
+
+void dirty_init(uint16_t bg);                                           /* ʼ, bgΪɫ */
+uint8_t dirty_layer_add(dirty_paint_t paint);                           /* עͼ, ע */
+void dirty_add(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);     /* Ǽһ() */
+void dirty_add_all(void);                                               /* Ļ */
+uint8_t dirty_flush(void);                                              /* ˢһ֡, ˢµľ */
+const dirty_stats_t *dirty_get_stats(void);                             /* ȡͳ */
+void dirty_poll(void);                                                  /* ʱͳ */
+
+#endif
@@ -0,0 +1,58 @@
+/**
+ ****************************************************************************************************
+ * @file        fmap.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ͼӻ: ͨ X-CUBE-AI  observer ص, ʱѾͼ
+ ****************************************************************************************************
+ * @attention
+ *
+ *  ai_platform_observer_register_s עص, conv0/conv3/conv6 ִʱõ(HWC),
+ * ÿͨԼС/ֵ8λ, 256ɫɫ, һͨһдGRAM.
+ * ͨƴ, ڻĿհ(FMAP_Y ʼ,  FMAP_H), ŲµĲ㲻(ʱ),
+ * Ĳλ. 480ʱһ: 28 + 2 + 14 + 2 + 7 = 53; 240ʱ conv0 ҪзŲ.
+ *
+ * : ÿӻʱ䲻һ(ӻ) FMAP_BUDGET_PCT%,
+ * ÿ㻭һƽ, Ԥͣ, ´ûͨŻ.
+ * , ͼҪȫ.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __FMAP_H
+#define __FMAP_H
+
+#include "main.h"
+#include "ai_platform.h"
+
+
+/******************************************************************************************/
+/* ӻ */
+
+#define FMAP_BUDGET_PCT     10          /* ӻռʱ(%), 0ʾر */
+#define FMAP_MARGIN         8           /* ĻұߵС */
+#define FMAP_Y              18          /* հϱ("RST") */
+#define FMAP_H              53          /* հ߶, ߿(PREP_Y0)һ */
+#define FMAP_GAP            2           /* Ͳ֮ļ */
+#define FMAP_REPORT_MS      10000       /* fmap_poll ͳƵļ, 0ʾֶֻ */
+
+/* ͳ */
+typedef struct
+{
+    uint32_t runs;                      /*  */
+    uint32_t tiles;                     /* ͨ(ۼ) */
+    uint32_t skipped;                   /* Ԥ´εͨ(ۼ) */
+    uint32_t net_cycles;                /* һ(ӻ) */
+    uint32_t viz_cycles;                /* һӻ */
+} fmap_stats_t;
+
+/******************************************************************************************/
+/*  */
+
+uint8_t fmap_init(ai_handle network);                                   /* עobserver(ʼlcd_init֮) */
+void fmap_pause(uint8_t pause);                                         /* ͣ/ָ */
+void fmap_enable(uint8_t on);                                           /* /ر() */
+const fmap_stats_t *fmap_get_stats(void);                               /* ȡͳ */
+void fmap_poll(void);                                                   /* ʱͳ */
+
+#endif
@@ -24,6 +24,10 @@
  * V1.1 20230529
  * 1, ST7796 3.5/ILI9806 4.3GT1151֧
  * 2, gt9xxx_initӴICжضICͷ1ʾʼʧ
+ * V1.2 20261018
+ * 1, INTжϷʽ(GT9XXX_IRQ): INT˲Ŷ, ״̬ʹһ, ÿ10βһ
+ * 2, I2C1+DMAȡʽ(GT9XXX_HW_IIC), ȡ̲ռCPU
+ * 3, ȡͳ(/INTӳ/CPUռ), gt9xxx_poll 
  ****************************************************************************************************
  */
 
@@ -43,6 +47,34 @@
 #define GT9XXX_INT_GPIO_PORT            GPIOB
 #define GT9XXX_INT_GPIO_PIN             GPIO_PIN_1
 #define GT9XXX_INT_GPIO_CLK_ENABLE()    do{ __HAL_RCC_GPIOB_CLK_ENABLE(); }while(0)   /* PBʱʹ */
+#define GT9XXX_INT_IRQn                 EXTI1_IRQn
+
+/******************************************************************************************/
+/* ȡʽ */
+
+#define GT9XXX_IRQ          1           /* 1, INTжϴȡ; 0, ѯ(ÿ10ɨһ״̬) */
+
+/* 1, I2C1+DMA1 Stream0ȡ(ѴSCL/SDAߵPB8/PB9, ϵPB0/PF11ûI2Cù,
+ *     stm32f4xx_hal_conf.h  HAL_I2C_MODULE_ENABLED,  stm32f4xx_hal_i2c.c);
+ * 0,  ctiic.c I2C
+ */
+#define GT9XXX_HW_IIC       0
+
+#define GT9XXX_REPORT_MS    10000       /* gt9xxx_poll ͳƵļ, 0ʾֶֻ */
+
+#if GT9XXX_HW_IIC
+#define GT9XXX_IIC                      I2C1
+#define GT9XXX_IIC_CLK_ENABLE()         do{ __HAL_RCC_I2C1_CLK_ENABLE(); }while(0)
+#define GT9XXX_IIC_SPEED                400000                              /* 400KHz */
+#define GT9XXX_IIC_GPIO_PORT            GPIOB
+#define GT9XXX_IIC_SCL_GPIO_PIN         GPIO_PIN_8
+#define GT9XXX_IIC_SDA_GPIO_PIN         GPIO_PIN_9
+#define GT9XXX_IIC_GPIO_AF              GPIO_AF4_I2C1
+#define GT9XXX_IIC_GPIO_CLK_ENABLE()    do{ __HAL_RCC_GPIOB_CLK_ENABLE(); }while(0)
+#define GT9XXX_IIC_DMA_STREAM           DMA1_Stream0                        /* I2C1_RX: Stream0 Channel1 */
+#define GT9XXX_IIC_DMA_CHANNEL          DMA_CHANNEL_1
+#define GT9XXX_IIC_DMA_CLK_ENABLE()     do{ __HAL_RCC_DMA1_CLK_ENABLE(); }while(0)
+#endif
 
 /******************************************************************************************/
 
@@ -65,6 +97,7 @@
 #define GT9XXX_CFGS_REG     0X8047      /* GT9XXXʼַĴ */
 #define GT9XXX_CHECK_REG    0X80FF      /* GT9XXXУͼĴ */
 #define GT9XXX_PID_REG      0X8140      /* GT9XXXƷIDĴ */
+#define GT9XXX_MODSW1_REG   0X804D      /* GT9XXX: bit[1:0] INTʽ, 0 1½ 2͵ƽ 3ߵƽ */
 
 #define GT9XXX_GSTID_REG    0X814E      /* GT9XXXǰ⵽Ĵ */
 #define GT9XXX_TP1_REG      0X8150      /* һݵַ */
@@ -77,7 +110,26 @@
 #define GT9XXX_TP8_REG      0X8188      /* ڰ˸ݵַ */
 #define GT9XXX_TP9_REG      0X8190      /* ھŸݵַ */
 #define GT9XXX_TP10_REG     0X8198      /* ʮݵַ */
- 
+
+/*  GT9XXX_GSTID_REG ʼ: 1ֽ״̬, Ȼÿ8ֽ(track id, x, y, size, ),
+ * ixy 1 + 8 * i + 1 ,  GT9XXX_TPX_TBL ĵַһ
+ */
+#define GT9XXX_FRAME_LEN(n) (1 + 8 * (n))
+
+/* ȡͳ(ۼ, gt9xxx_poll ), DWT */
+typedef struct
+{
+    uint32_t irqs;                      /* INTжϴ */
+    uint32_t frames;                    /* ֡(״̬Ĵbit7=1) */
+    uint32_t reads;                     /* I2C */
+    uint32_t bytes;                     /* I2Cֽ */
+    uint32_t errors;                    /* I2C */
+    uint32_t busy;                      /* CPUȡ/ϵ */
+    uint32_t lat_sum;                   /* INTӳ()֮ */
+    uint32_t lat_max;
+    uint32_t lat_num;
+} gt9xxx_stats_t;
+
 /******************************************************************************************/
 /*  */
 
@@ -86,6 +138,17 @@ void gt9xxx_rd_reg(uint16_t reg,uint8_t *buf,uint8_t len);      /* 
 uint8_t gt9xxx_init(void);                                      /* ʼgt9xxx */
 uint8_t gt9xxx_scan(uint8_t mode);                              /* ɨ败 */
 
+uint8_t gt9xxx_irq_start(void (*notify)(void));                 /* INTж, ֡ʱnotify(ж) */
+uint8_t gt9xxx_irq_on(void);                                    /* 1, жϷʽڹ, öʱɨ */
+void gt9xxx_exti_isr(void);                                     /* INTŵEXTIжϵ */
+const gt9xxx_stats_t *gt9xxx_get_stats(void);                   /* ȡͳ */
+void gt9xxx_poll(void);                                         /* ʱͳ */
+
+#if GT9XXX_HW_IIC
+extern I2C_HandleTypeDef g_gt_iic_handle;                       /* жϷҪ */
+extern DMA_HandleTypeDef g_gt_dma_handle;
+#endif
+
 #endif
 
 
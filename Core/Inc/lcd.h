@@ -31,6 +31,10 @@
 
 #include "stdlib.h"
 
+#ifdef HOST_SIM
+#include "host_sim.h"
+#endif
+
 typedef unsigned char           uint8_t;  
 typedef unsigned short int      uint16_t; 
 typedef unsigned int            uint32_t;
@@ -102,10 +106,14 @@ extern uint32_t  g_point_color;     /* Ĭ
 extern uint32_t  g_back_color;      /* ɫ.ĬΪɫ */
 
 /* LCD */
+#ifdef HOST_SIM
+#define LCD_BL(x)   ((void)(x))
+#else
 #define LCD_BL(x)   do{ x ? \
                       HAL_GPIO_WritePin(LCD_BL_GPIO_PORT, LCD_BL_GPIO_PIN, GPIO_PIN_SET) : \
                       HAL_GPIO_WritePin(LCD_BL_GPIO_PORT, LCD_BL_GPIO_PIN, GPIO_PIN_RESET); \
                      }while(0)
+#endif
 
 /* LCDַṹ */
 typedef struct
@@ -141,6 +149,53 @@ typedef struct
 #define LCD_BASE        (uint32_t)((0x60000000 + (0x4000000 * (LCD_FSMC_NEX - 1))) | (((1 << LCD_FSMC_AX) * 2) -2))
 #define LCD             ((LCD_TypeDef *) LCD_BASE)
 
+/* LCD߷: дĴ, д/GRAM, .
+ *  HOST_SIM ʱ Host/lcd_sim.c Ŀģʵ(Cز˶ LCD->LCD_RAM Ķд),
+ * ͼLinuxвͳ߿,  Host/lcd_host.c.
+ */
+#ifdef HOST_SIM
+#include "lcd_sim.h"
+#define LCD_WR_REG(x)   lcd_sim_wr_reg(x)
+#define LCD_WR_RAM(x)   lcd_sim_wr_ram(x)
+#define LCD_RD_RAM()    lcd_sim_rd_ram()
+#else
+#define LCD_WR_REG(x)   (LCD->LCD_REG = (x))
+#define LCD_WR_RAM(x)   (LCD->LCD_RAM = (x))
+#define LCD_RD_RAM()    (LCD->LCD_RAM)
+#endif
+
+/* FSMCд: ÿдĴ//GRAM1, ڱȽϸͼ߿.
+ * ѭۼ, ÿϼ. Ϊ0ͳ.
+ */
+#define LCD_BUS_STATS   1
+
+#if LCD_BUS_STATS
+extern uint32_t g_lcd_bus_writes;
+#define LCD_BUS_ADD(n)  (g_lcd_bus_writes += (n))
+#else
+#define LCD_BUS_ADD(n)
+#endif
+
+/* lcd_clear/lcd_fill/lcd_color_fill/lcd_show_pic ĴдDMA2Ŷ첽(lcd_dma.c), Ϊ0CPUд.
+ * DMAдʱCPULCD, дĴǰȵDMAд. lcd_color_fill/lcd_show_pic ԴRAMʱ
+ * DMAдŷ(ߵĻ), Flashʱ; Ҫ첽дRAMĻֱ lcd_dma_blit.
+ */
+#ifdef HOST_SIM
+#define LCD_DMA         0           /* ûDMA */
+#else
+#define LCD_DMA         1
+#endif
+
+#if LCD_DMA
+extern volatile uint8_t g_lcd_dma_busy;
+#define LCD_DMA_WAIT()  while (g_lcd_dma_busy)
+#else
+#define LCD_DMA_WAIT()
+#endif
+
+#define LCD_GLYPH_CACHE_NUM     24  /* ģַ(ÿ68ֽ), Ҳһдַ */
+#define LCD_FONT_PACK           1   /* 1, ʹѹֿ lcdfont_pack.h(Host/asset_pack.c ); 0, ʹ lcdfont.h */
+
 /******************************************************************************************/
 /* LCDɨ跽ɫ  */
 
@@ -209,6 +264,9 @@ void lcd_wr_regno(volatile uint16_t regno);          /* LCDд
 void lcd_write_reg(uint16_t regno, uint16_t data);   /* LCDдĴֵ */
 
 void lcd_init(void);                        /* ʼLCD */ 
+void lcd_init_start(void);                  /* ʼʼLCD(ID, ѡʼ) */
+uint8_t lcd_init_start_hint(uint16_t hint);  /* ʼʼLCD, ϴμ⵽ID, 0ʾ */
+uint8_t lcd_init_poll(void);                /* ųʼ, 0ʾLCD */
 void lcd_display_on(void);                  /* ʾ */ 
 void lcd_display_off(void);                 /* ʾ */
 void lcd_scan_dir(uint8_t dir);             /* ɨ跽 */ 
@@ -236,8 +294,11 @@ void lcd_show_char(uint16_t x, uint16_t y, char chr, uint8_t size, uint8_t mode,
 void lcd_show_num(uint16_t x, uint16_t y, uint32_t num, uint8_t len, uint8_t size, uint16_t color);                     /* ʾ */
 void lcd_show_xnum(uint16_t x, uint16_t y, uint32_t num, uint8_t len, uint8_t size, uint8_t mode, uint16_t color);      /* չʾ */
 void lcd_show_string(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t size, char *p, uint16_t color);   /* ʾַ */
+void lcd_show_chars(uint16_t x, uint16_t y, const char *p, uint8_t n, uint8_t size, uint16_t color);                   /* ʾһnַ */
+const uint16_t *lcd_glyph_get(char chr, uint8_t size);                                                                  /* еģ(ģ) */
 
-void lcd_draw_bline(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t size, uint16_t color);
+void lcd_draw_bline(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t size, uint16_t color);                 /*  */
+void lcd_draw_bline_join(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t size, uint16_t color); /* , һصĲ */
 
 #endif
 
@@ -0,0 +1,58 @@
+/**
+ ****************************************************************************************************
+ * @file        lcd_dma.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       DMA2 ڴ浽ڴдLCD GRAM, Ŷӵ첽д
+ ****************************************************************************************************
+ * @attention
+ *
+ * DMA2 Stream0 ڴ浽ڴģʽ, Դ(ͼƬ, ַ)һɫ(, ַ),
+ * Ŀǹ̶ LCD->LCD_RAM(ַ). ÿдһδ, ŶӺ,
+ * ɴжϿһĴڲ, дڼCPUԼ.
+ *
+ * DMAдʱCPULCD: lcd.c дĴǰDMAд(LCD_DMA_WAIT), ͼ
+ * ø, ֻǻδɵĿʱȴ. ɫڶ; ͼƬǰܸ.
+ * ɻصDMAж.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __LCD_DMA_H
+#define __LCD_DMA_H
+
+#include "main.h"
+
+
+/******************************************************************************************/
+/*  */
+
+#define LCD_DMA_QUEUE_NUM   8           /* ŶӵĿ, ʱȴ */
+#define LCD_DMA_MIN         256         /* ôĿCPUд, DMAжϵĿ */
+#define LCD_DMA_CHUNK       65535       /* һδĵ(NDTR 16λ), ּδ */
+
+typedef void (*lcd_dma_cb_t)(void *arg);
+
+/* ͳ */
+typedef struct
+{
+    uint32_t blits;                     /* ŶӵĿ */
+    uint32_t pixels;                    /* DMAдĵ */
+    uint32_t full;                      /* ȴĴ */
+    uint32_t errors;                    /* (TE/DME), Ŀ鶪 */
+    uint32_t fifo_errors;               /* FIFO(FE), ûͣ,  */
+} lcd_dma_stats_t;
+
+/******************************************************************************************/
+/*  */
+
+void lcd_dma_init(void);                                                /* ʼ, MX_DMA_Init֮ */
+uint8_t lcd_dma_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color,
+                     lcd_dma_cb_t cb, void *arg);                       /* Ŷһɫ */
+uint8_t lcd_dma_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *src,
+                     lcd_dma_cb_t cb, void *arg);                       /* ŶһͼƬ */
+void lcd_dma_wait(void);                                                /* пд */
+uint8_t lcd_dma_pending(void);                                          /* ûдĿ */
+const lcd_dma_stats_t *lcd_dma_get_stats(void);                         /* ȡͳ */
+
+#endif
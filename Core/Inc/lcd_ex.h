@@ -1,11 +1,53 @@
+/**
+ ****************************************************************************************************
+ * @file        lcd_ex.h
+ * @version     V1.2
+ * @date        2026-10-18
+ * @brief       LCDICļĴʼ, ԼִĽ
+ ****************************************************************************************************
+ * @attention
+ *
+ * ʼһֽ, ÿָһֽڿͷ:
+ *   LCD_CMD(reg, n)    0x00|n, reg               д8λ, n
+ *   LCD_CMD16(reg, n)  0x40|n, regH, regL        д16λ, n(NT35510)
+ *   LCD_SEQ(reg, n)    0x80|n, regH, regL         reg, reg+1 ... дһ(NT35510)
+ *   LCD_DELAY(ms)      0xFE, ms                  ȴms(1~255)
+ *   LCD_END            0xFF                      
+ * n 63. lcd_ex_run ʱͷ, , lcd_init_poll ȵںٽִ.
+ *
+ ****************************************************************************************************
+ */
+
 #ifndef __LCD_EX_H
 #define __LCD_EX_H
 
-void lcd_ex_st7789_reginit(void);
-void lcd_ex_ili9341_reginit(void);
-void lcd_ex_nt35310_reginit(void);
-void lcd_ex_st7796_reginit(void);
-void lcd_ex_nt35510_reginit(void);
-void lcd_ex_ili9806_reginit(void);
-void lcd_ex_ssd1963_reginit(void);
-#endif
\ No newline at end of file
+#ifdef HOST_SIM
+#include "host_sim.h"
+#else
+#include "main.h"
+#endif
+
+
+/******************************************************************************************/
+/* ʼֽ */
+
+#define LCD_OP_CMD          0x00
+#define LCD_OP_CMD16        0x40
+#define LCD_OP_SEQ          0x80
+#define LCD_OP_LEN          0x3F        /* 6λǲ */
+#define LCD_OP_DELAY        0xFE
+#define LCD_OP_END          0xFF
+
+#define LCD_CMD(reg, n)     (LCD_OP_CMD | (n)), (reg)
+#define LCD_CMD16(reg, n)   (LCD_OP_CMD16 | (n)), ((reg) >> 8), ((reg) & 0xFF)
+#define LCD_SEQ(reg, n)     (LCD_OP_SEQ | (n)), ((reg) >> 8), ((reg) & 0xFF)
+#define LCD_DELAY(ms)       LCD_OP_DELAY, (ms)
+#define LCD_END             LCD_OP_END
+
+/******************************************************************************************/
+/*  */
+
+const uint8_t *lcd_ex_init_code(uint16_t id);                           /* ȡICĳʼ */
+uint8_t lcd_ex_run(const uint8_t **pc);                                 /* ִеһʱ, ms, 0ʾ */
+
+#endif
@@ -0,0 +1,491 @@
+/**
+ * @file        lcdfont_pack.h
+ * @brief       ѹ lcdfont.h ֿ(asset.h ʽ),  Host/asset_pack.c , Ҫֹ޸:
+ *                ./asset_pack font > Core/Inc/lcdfont_pack.h
+ *              ֻܱ lcd.c 
+ */
+
+#ifndef __LCDFONT_PACK_H
+#define __LCDFONT_PACK_H
+
+#include "asset.h"
+
+/* 12x6: 1140 -> 972 ֽ(ƫƱ 192) */
+const uint16_t asc2_1206_offs[96] =
+{
+    0, 0, 3, 8, 20, 31, 43, 55, 57, 64, 70, 77,
+    83, 85, 92, 94, 99, 107, 112, 125, 137, 145, 158, 169,
+    176, 189, 200, 203, 206, 216, 226, 236, 245, 257, 265, 276,
+    285, 293, 304, 313, 324, 333, 342, 351, 363, 372, 378, 387,
+    395, 404, 415, 427, 440, 447, 455, 462, 468, 477, 485, 496,
+    502, 508, 514, 518, 527, 529, 540, 548, 556, 565, 575, 586,
+    602, 611, 617, 624, 634, 642, 648, 657, 664, 673, 682, 690,
+    701, 707, 716, 724, 730, 739, 748, 757, 763, 766, 772, 780,
+};
+const uint8_t asc2_1206_pack[780] =
+{
+    0xFF,0x46,0x11,0xF3,0x2D,0x1F,0x12,0xD1,0x41,0x21,0xC1,0x14,0x84,0x11,0xC1,0x14,
+    0x84,0x11,0xC1,0x21,0x32,0x32,0x81,0x21,0x31,0x7A,0x71,0x31,0x21,0x82,0x32,0x32,
+    0xD1,0x21,0x22,0x92,0x12,0xC2,0x12,0x92,0x21,0x21,0xD2,0x63,0xA3,0x31,0x81,0x23,
+    0x11,0x93,0x21,0xC3,0x11,0xF0,0x10,0x31,0xD2,0xFF,0xF6,0x69,0x16,0x17,0x18,0x10,
+    0xF2,0x18,0x17,0x16,0x19,0x60,0x41,0x21,0xD2,0xC6,0xC2,0xD1,0x21,0x51,0xF0,0x1C,
+    0x7C,0x1F,0x01,0xB1,0xD2,0x51,0xF0,0x1F,0x01,0xF0,0x1F,0x01,0xFA,0x10,0xA1,0xC3,
+    0xB2,0xB3,0xC1,0x36,0x91,0x61,0x81,0x61,0x81,0x61,0x96,0xF4,0x15,0x18,0x8F,0x01,
+    0x32,0x32,0x81,0x41,0x11,0x81,0x31,0x21,0x81,0x21,0x31,0x92,0x41,0x31,0x41,0x91,
+    0x61,0x81,0x21,0x31,0x81,0x21,0x31,0x92,0x13,0x61,0xD2,0x11,0xB1,0x31,0xA8,0xD1,
+    0x11,0x24,0x21,0x91,0x21,0x31,0x81,0x21,0x31,0x81,0x21,0x31,0x81,0x33,0x36,0x91,
+    0x21,0x31,0x81,0x21,0x31,0x82,0x11,0x31,0xC3,0x22,0xE1,0xF0,0x12,0x58,0x3D,0x10,
+    0x32,0x13,0x91,0x21,0x31,0x81,0x21,0x31,0x81,0x21,0x31,0x92,0x13,0x33,0xC1,0x31,
+    0x12,0x81,0x31,0x21,0x81,0x31,0x21,0x96,0xFF,0x61,0x41,0xFF,0x71,0x32,0xF6,0x1E,
+    0x11,0x1C,0x13,0x1A,0x15,0x18,0x17,0x10,0x41,0x21,0xC1,0x21,0xC1,0x21,0xC1,0x21,
+    0xC1,0x21,0xF2,0x17,0x18,0x15,0x1A,0x13,0x1C,0x11,0x1E,0x10,0x32,0xD1,0xF0,0x13,
+    0x21,0x18,0x12,0x1D,0x20,0x36,0x91,0x61,0x81,0x23,0x11,0x81,0x11,0x21,0x11,0x95,
+    0x11,0x91,0xB5,0x83,0x21,0xC4,0xF0,0x3F,0x01,0x21,0x61,0x88,0x81,0x21,0x31,0x81,
+    0x21,0x31,0x92,0x13,0x36,0x91,0x61,0x81,0x61,0x81,0x61,0x82,0x41,0x21,0x61,0x88,
+    0x81,0x61,0x81,0x61,0x96,0x21,0x61,0x88,0x81,0x21,0x31,0x81,0x13,0x21,0x82,0x42,
+    0x21,0x61,0x88,0x81,0x21,0x31,0x81,0x13,0xB2,0x44,0xB1,0x41,0x91,0x61,0x81,0x31,
+    0x21,0x82,0x23,0xD1,0x21,0x61,0x88,0xB1,0xF0,0x1C,0x88,0x16,0x10,0x21,0x61,0x81,
+    0x61,0x88,0x81,0x61,0x81,0x61,0x92,0x71,0x71,0x71,0x71,0x78,0x81,0xF0,0x10,0x21,
+    0x61,0x88,0x81,0x21,0x31,0xA1,0x12,0xA2,0x42,0x81,0x61,0x21,0x61,0x88,0x81,0x61,
+    0xF0,0x1F,0x01,0xE2,0x28,0x84,0xF1,0x48,0x4C,0x80,0x21,0x61,0x88,0xA2,0x31,0x81,
+    0x32,0xA8,0x81,0x36,0x91,0x61,0x81,0x61,0x81,0x61,0x96,0x21,0x61,0x88,0x81,0x21,
+    0x31,0x81,0x21,0xD2,0x36,0x91,0x41,0x11,0x81,0x41,0x11,0x81,0x53,0x86,0x11,0x21,
+    0x61,0x88,0x81,0x21,0x31,0x81,0x22,0xC2,0x23,0xF0,0x10,0x32,0x32,0x81,0x21,0x31,
+    0x81,0x21,0x31,0x81,0x31,0x21,0x82,0x32,0x22,0xE1,0x61,0x88,0x81,0x61,0x82,0x21,
+    0xF0,0x7F,0x11,0xF0,0x18,0x79,0x10,0x21,0xF0,0x5F,0x13,0xB3,0xA3,0xD1,0x23,0xF1,
+    0x58,0x4F,0x05,0x83,0x21,0x61,0x83,0x23,0xB2,0xB3,0x23,0x81,0x61,0x21,0xF0,0x34,
+    0x1B,0x58,0x34,0x18,0x10,0x22,0x51,0x81,0x43,0x81,0x22,0x21,0x83,0x41,0x81,0x52,
+    0xFF,0x3A,0x61,0x81,0x61,0x81,0xF2,0x3F,0x12,0xF1,0x3F,0x11,0xF2,0x18,0x16,0x18,
+    0x16,0xA0,0xF3,0x1E,0x1F,0x11,0xB1,0xF0,0x1F,0x01,0xF0,0x1F,0x01,0xF0,0x10,0xFF,
+    0x31,0xF7,0x11,0x1C,0x11,0x11,0x1B,0x11,0x11,0x1C,0x4F,0x01,0x21,0xF0,0x8B,0x13,
+    0x1B,0x13,0x1C,0x30,0xF7,0x3C,0x13,0x1B,0x13,0x1B,0x22,0x10,0xF7,0x3C,0x13,0x18,
+    0x12,0x13,0x18,0x8F,0x01,0xF7,0x3C,0x11,0x11,0x1B,0x11,0x11,0x1C,0x21,0x10,0xF6,
+    0x13,0x19,0x78,0x12,0x13,0x18,0x12,0x13,0x18,0x10,0xF7,0x11,0x3A,0x11,0x11,0x11,
+    0x19,0x11,0x11,0x11,0x19,0x22,0x11,0x19,0x14,0x10,0x21,0x61,0x88,0xB1,0x31,0xB1,
+    0xF1,0x4F,0x01,0xF6,0x13,0x18,0x12,0x5F,0x01,0xB1,0xF0,0x19,0x15,0x16,0x12,0x60,
+    0x21,0x61,0x88,0xD1,0x11,0xB3,0xD1,0x22,0xB1,0x31,0x21,0x61,0x81,0x61,0x88,0xF0,
+    0x1F,0x01,0x55,0xB1,0xF0,0x5B,0x1F,0x14,0x51,0x31,0xB5,0xB1,0x31,0xB1,0xF1,0x4F,
+    0x01,0xF7,0x3C,0x13,0x1B,0x13,0x1C,0x30,0x51,0x51,0x97,0x91,0x31,0x11,0x91,0x31,
+    0xC3,0xF7,0x3C,0x13,0x1B,0x13,0x11,0x19,0x7F,0x01,0x51,0x31,0xB5,0xC1,0x21,0xB1,
+    0xF0,0x10,0xF6,0x22,0x1B,0x11,0x11,0x1B,0x11,0x11,0x1B,0x12,0x20,0xF6,0x1D,0x6C,
+    0x13,0x1F,0x01,0x51,0xF0,0x4F,0x11,0xB1,0x31,0xB5,0xF0,0x10,0x51,0xF0,0x3D,0x12,
+    0x2D,0x2C,0x2E,0x10,0x52,0xF1,0x3B,0x3F,0x03,0xB2,0x51,0x31,0xB2,0x12,0xD1,0xD2,
+    0x12,0xB1,0x31,0x51,0x51,0x93,0x31,0x91,0x23,0xC2,0xC2,0xE1,0xF6,0x13,0x1B,0x11,
+    0x3B,0x22,0x1B,0x13,0x10,0xFF,0x71,0xB4,0x15,0x61,0x81,0xFF,0xF3,0xC0,0xF2,0x18,
+    0x16,0x41,0x5A,0x10,0x11,0xE1,0xF1,0x1F,0x11,0xF0,0x1E,0x10,
+};
+const asset_font_t g_font_1206 = {12, 12, ASSET_RLE, asc2_1206_offs, asc2_1206_pack};
+
+/* 16x8: 1520 -> 1311 ֽ(ƫƱ 192) */
+const uint16_t asc2_1608_offs[96] =
+{
+    0, 0, 5, 12, 24, 36, 49, 67, 71, 80, 88, 99,
+    108, 113, 124, 127, 135, 146, 155, 172, 189, 202, 219, 234,
+    243, 262, 277, 283, 288, 300, 314, 326, 338, 356, 369, 385,
+    398, 410, 426, 439, 452, 467, 477, 487, 502, 513, 523, 535,
+    547, 560, 576, 593, 610, 620, 632, 643, 653, 671, 683, 700,
+    709, 718, 726, 734, 746, 751, 768, 780, 792, 805, 821, 836,
+    857, 870, 881, 892, 905, 914, 926, 939, 950, 963, 976, 988,
+    1005, 1013, 1025, 1036, 1047, 1060, 1073, 1088, 1097, 1101, 1109, 1119,
+};
+const uint8_t asc2_1608_pack[1119] =
+{
+    0xFF,0xF6,0x72,0x2E,0x20,0xF5,0x1D,0x2D,0x2F,0x21,0xD2,0xD2,0x61,0x31,0xB8,0x54,
+    0x31,0xB1,0x31,0xB8,0x54,0x31,0xB1,0x31,0xF5,0x34,0x26,0x13,0x15,0x14,0xE3,0x14,
+    0x14,0x16,0x23,0x40,0x44,0xB1,0x41,0x41,0x64,0x23,0xB2,0xB3,0x14,0x62,0x31,0x41,
+    0xB4,0x94,0x75,0x41,0x51,0x42,0x31,0x51,0x31,0x21,0x21,0x63,0x11,0x22,0xB3,0x21,
+    0xA1,0x41,0xE1,0x41,0xC2,0x11,0xC3,0xFF,0xF8,0x68,0x26,0x25,0x1A,0x13,0x1C,0x10,
+    0xF2,0x1C,0x13,0x1A,0x15,0x26,0x28,0x60,0x61,0x21,0xC1,0x21,0xD2,0xB8,0xB2,0xD1,
+    0x21,0xC1,0x21,0x81,0xF0,0x1F,0x01,0xB9,0xB1,0xF0,0x1F,0x01,0xF0,0x1C,0x21,0x1C,
+    0x30,0xF9,0x1F,0x01,0xF0,0x1F,0x01,0xF0,0x1F,0x01,0xF0,0x10,0xFD,0x2E,0x20,0xFE,
+    0x2C,0x2C,0x2C,0x2C,0x2C,0x2D,0x10,0xF6,0x78,0x17,0x16,0x19,0x15,0x19,0x16,0x17,
+    0x18,0x70,0xF5,0x18,0x16,0x18,0x15,0xBF,0x01,0xF0,0x10,0xF5,0x35,0x25,0x17,0x11,
+    0x15,0x16,0x12,0x15,0x15,0x13,0x15,0x13,0x24,0x16,0x35,0x20,0xF5,0x25,0x26,0x19,
+    0x15,0x13,0x15,0x15,0x13,0x15,0x15,0x12,0x11,0x13,0x17,0x23,0x30,0xF9,0x3B,0x22,
+    0x1A,0x14,0x12,0x16,0x15,0x12,0x15,0xBC,0x12,0x10,0xF4,0x62,0x26,0x14,0x14,0x15,
+    0x13,0x15,0x15,0x13,0x15,0x15,0x14,0x13,0x16,0x15,0x30,0xF6,0x78,0x13,0x13,0x16,
+    0x13,0x15,0x15,0x13,0x15,0x15,0x23,0x13,0x1C,0x30,0xF4,0x3D,0x1F,0x01,0x46,0x51,
+    0x22,0xB3,0xD1,0xF5,0x33,0x36,0x13,0x11,0x13,0x15,0x14,0x14,0x15,0x14,0x14,0x15,
+    0x13,0x11,0x13,0x16,0x33,0x30,0xF6,0x3C,0x13,0x13,0x25,0x15,0x13,0x15,0x15,0x13,
+    0x16,0x13,0x13,0x18,0x70,0xFF,0xF9,0x24,0x28,0x24,0x20,0xFF,0xF2,0x17,0x15,0x20,
+    0xF9,0x1E,0x11,0x1C,0x13,0x1A,0x15,0x18,0x17,0x16,0x19,0x10,0x61,0x31,0xB1,0x31,
+    0xB1,0x31,0xB1,0x31,0xB1,0x31,0xB1,0x31,0xB1,0x31,0xF4,0x19,0x16,0x17,0x18,0x15,
+    0x1A,0x13,0x1C,0x11,0x1E,0x10,0xF5,0x3C,0x12,0x1C,0x18,0x25,0x15,0x21,0x25,0x14,
+    0x1B,0x40,0x65,0x92,0x52,0x61,0x25,0x21,0x51,0x11,0x41,0x21,0x51,0x15,0x31,0x61,
+    0x51,0x11,0x85,0x11,0xD1,0xC4,0x84,0x31,0x53,0x31,0xB3,0x11,0xE3,0x21,0xD3,0xF0,
+    0x10,0x31,0x91,0x5B,0x51,0x31,0x51,0x51,0x31,0x51,0x51,0x31,0x51,0x63,0x11,0x31,
+    0xC3,0x65,0x92,0x52,0x61,0x91,0x51,0x91,0x51,0x91,0x51,0x81,0x63,0x51,0x31,0x91,
+    0x5B,0x51,0x91,0x51,0x91,0x51,0x91,0x61,0x71,0x87,0x31,0x91,0x5B,0x51,0x31,0x51,
+    0x51,0x31,0x51,0x51,0x15,0x31,0x51,0x91,0x61,0x62,0x31,0x91,0x5B,0x51,0x31,0x51,
+    0x51,0x31,0xB1,0x15,0x91,0xF1,0x10,0x65,0x92,0x52,0x61,0x91,0x51,0x91,0x51,0x51,
+    0x31,0x53,0x34,0xC1,0x31,0x91,0x5B,0x51,0x41,0x41,0xA1,0xF0,0x1A,0x14,0x14,0x15,
+    0xB5,0x19,0x10,0xF4,0x19,0x15,0x19,0x15,0xB5,0x19,0x15,0x19,0x10,0xE2,0xF0,0x13,
+    0x1B,0x13,0x1B,0x13,0xC4,0x1F,0x01,0x31,0x91,0x5B,0x51,0x31,0x51,0x83,0xA1,0x11,
+    0x32,0x21,0x52,0x63,0x51,0x91,0x31,0x91,0x5B,0x51,0x91,0xF0,0x1F,0x01,0xF0,0x1E,
+    0x20,0x31,0x91,0x5B,0x55,0xF1,0x65,0x5B,0xB5,0x19,0x10,0x31,0x91,0x5B,0x62,0x71,
+    0x82,0xF1,0x38,0x17,0x26,0xB5,0x10,0x57,0x81,0x71,0x61,0x91,0x51,0x91,0x51,0x91,
+    0x61,0x71,0x87,0x31,0x91,0x5B,0x51,0x41,0x41,0x51,0x41,0xA1,0x41,0xA1,0x41,0xB4,
+    0x57,0x81,0x62,0x61,0x61,0x21,0x51,0x61,0x21,0x51,0x73,0x61,0x71,0x11,0x67,0x21,
+    0x31,0x91,0x5B,0x51,0x31,0x51,0x51,0x31,0xB1,0x33,0x91,0x31,0x22,0x83,0x52,0xF0,
+    0x10,0xF5,0x34,0x35,0x13,0x15,0x15,0x14,0x14,0x15,0x14,0x14,0x15,0x15,0x13,0x15,
+    0x34,0x30,0x32,0xE1,0xF0,0x19,0x15,0xB5,0x19,0x15,0x1F,0x02,0x31,0xF0,0xA6,0x19,
+    0x1F,0x01,0xF0,0x15,0x19,0x15,0xA6,0x10,0x31,0xF0,0x4C,0x13,0x4F,0x13,0xB3,0x71,
+    0x23,0xA3,0xD1,0x37,0x91,0x64,0xA3,0x85,0xF1,0x38,0x16,0x45,0x70,0x31,0x91,0x52,
+    0x72,0x51,0x12,0x32,0x11,0x93,0xD3,0x91,0x12,0x32,0x11,0x52,0x72,0x51,0x91,0x31,
+    0xF0,0x3D,0x12,0x25,0x1A,0x65,0x12,0x25,0x15,0x3D,0x10,0x41,0x81,0x51,0x73,0x51,
+    0x52,0x21,0x51,0x41,0x41,0x51,0x22,0x51,0x53,0x71,0x51,0x72,0xFF,0xF4,0xE2,0x1C,
+    0x12,0x1C,0x12,0x1C,0x10,0xF3,0x2F,0x12,0xF1,0x3F,0x12,0xF1,0x3F,0x12,0xF2,0x1C,
+    0x12,0x1C,0x12,0x1C,0x12,0xE0,0xFF,0x41,0xE1,0xF0,0x1F,0x01,0xF1,0x10,0xF0,0x1F,
+    0x01,0xF0,0x1F,0x01,0xF0,0x1F,0x01,0xF0,0x1F,0x01,0xF2,0x1F,0x01,0xF1,0x10,0xF9,
+    0x12,0x2A,0x12,0x12,0x19,0x11,0x13,0x19,0x11,0x13,0x19,0x11,0x13,0x1A,0x6F,0x01,
+    0x31,0xF0,0xBA,0x13,0x1A,0x15,0x19,0x15,0x1A,0x13,0x1C,0x30,0xFA,0x3C,0x13,0x1A,
+    0x15,0x19,0x15,0x19,0x15,0x1A,0x13,0x10,0xFA,0x3C,0x13,0x1A,0x15,0x19,0x15,0x15,
+    0x13,0x14,0x16,0xBF,0x01,0xF9,0x5A,0x11,0x13,0x19,0x11,0x13,0x19,0x11,0x13,0x19,
+    0x11,0x13,0x1A,0x22,0x10,0xF8,0x15,0x19,0x15,0x16,0xA5,0x13,0x15,0x15,0x13,0x15,
+    0x15,0x13,0x1B,0x20,0xF9,0x21,0x11,0x28,0x12,0x11,0x12,0x17,0x12,0x11,0x12,0x17,
+    0x12,0x11,0x12,0x17,0x32,0x12,0x17,0x15,0x20,0x31,0x91,0x5B,0xA1,0x41,0x91,0xF0,
+    0x1F,0x01,0x51,0xA6,0xF0,0x10,0xF8,0x15,0x15,0x22,0x15,0x15,0x22,0x7F,0x01,0xF0,
+    0x10,0xFF,0x02,0xF0,0x17,0x17,0x13,0x22,0x17,0x13,0x22,0x80,0x31,0x91,0x5B,0xC1,
+    0x21,0xB1,0xD2,0x12,0x11,0x91,0x42,0x91,0x51,0xF4,0x19,0x15,0x19,0x15,0xBF,0x01,
+    0xF0,0x10,0x71,0x51,0x97,0x91,0x51,0x91,0xF0,0x79,0x15,0x19,0x1F,0x16,0x71,0x51,
+    0x97,0xA1,0x41,0x91,0xF0,0x1F,0x01,0x51,0xA6,0xF0,0x10,0xF9,0x5A,0x15,0x19,0x15,
+    0x19,0x15,0x19,0x15,0x1A,0x50,0x71,0x71,0x79,0x81,0x41,0x11,0x71,0x51,0x91,0x51,
+    0xA1,0x31,0xC3,0xFA,0x3C,0x13,0x1A,0x15,0x19,0x15,0x19,0x15,0x11,0x17,0x9F,0x01,
+    0x71,0x51,0x91,0x51,0x97,0xA1,0x41,0x91,0x51,0x91,0xF0,0x20,0xF9,0x22,0x29,0x12,
+    0x12,0x19,0x12,0x12,0x19,0x12,0x12,0x19,0x12,0x12,0x19,0x22,0x20,0xF8,0x1F,0x01,
+    0xD8,0xA1,0x51,0x91,0x51,0x71,0xF0,0x6F,0x11,0xF0,0x1F,0x01,0x91,0x41,0xA7,0xF0,
+    0x10,0x71,0xF0,0x2E,0x11,0x3F,0x12,0xD1,0xB1,0x12,0xC2,0xE1,0x75,0xB1,0x42,0xC2,
+    0xB3,0xF1,0x2B,0x14,0x29,0x5B,0x10,0xF8,0x15,0x19,0x23,0x2B,0x31,0x19,0x11,0x3B,
+    0x23,0x29,0x15,0x10,0x71,0x71,0x72,0x61,0x71,0x13,0x31,0xC3,0xC2,0xA1,0x12,0xC2,
+    0xE1,0xF8,0x24,0x19,0x14,0x29,0x12,0x21,0x19,0x11,0x13,0x19,0x24,0x19,0x14,0x20,
+    0xFF,0xFF,0xB1,0xA5,0x16,0x31,0xC1,0x21,0xC1,0xFF,0xFF,0x4F,0x10,0xF2,0x1C,0x12,
+    0x1C,0x13,0x51,0x69,0x10,0xF2,0x2D,0x1F,0x01,0xF1,0x1F,0x01,0xF1,0x1F,0x01,
+};
+const asset_font_t g_font_1608 = {16, 16, ASSET_RLE, asc2_1608_offs, asc2_1608_pack};
+
+/* 24x12: 3420 -> 2016 ֽ(ƫƱ 192) */
+const uint16_t asc2_2412_offs[96] =
+{
+    0, 0, 10, 26, 51, 71, 98, 124, 133, 149, 161, 184,
+    201, 210, 226, 232, 248, 265, 280, 306, 329, 353, 377, 402,
+    420, 449, 474, 484, 493, 515, 541, 562, 584, 617, 638, 665,
+    684, 703, 729, 751, 773, 796, 813, 833, 858, 876, 896, 915,
+    932, 955, 977, 1004, 1031, 1050, 1068, 1086, 1105, 1128, 1149, 1174,
+    1192, 1207, 1223, 1236, 1254, 1262, 1287, 1305, 1323, 1342, 1367, 1389,
+    1421, 1437, 1453, 1468, 1488, 1503, 1520, 1536, 1555, 1575, 1594, 1613,
+    1638, 1654, 1669, 1688, 1709, 1733, 1753, 1774, 1789, 1795, 1807, 1824,
+};
+const uint8_t asc2_2412_pack[1824] =
+{
+    0xFF,0xFF,0xFF,0xFF,0x45,0x93,0x7B,0x33,0x75,0x93,0xFF,0xFA,0x1F,0x62,0xF6,0x2F,
+    0x53,0xF6,0x23,0x1F,0x62,0xF6,0x2F,0x53,0xF6,0x20,0xFF,0x32,0x42,0xF1,0x22,0x88,
+    0x82,0x2F,0x12,0x42,0xF1,0x24,0x2F,0x12,0x42,0xF1,0x24,0x2F,0x12,0x28,0x88,0x22,
+    0xF1,0x24,0x20,0xFF,0xFA,0x36,0x3B,0x55,0x49,0x23,0x28,0x18,0x15,0x27,0x16,0xF5,
+    0x61,0x63,0x51,0x84,0x47,0xA3,0x64,0x75,0xF2,0x25,0x2F,0x01,0x71,0x61,0x82,0x52,
+    0x33,0xB6,0x23,0xF3,0x3F,0x43,0x15,0xD3,0x12,0x52,0x83,0x41,0x71,0x81,0x62,0x52,
+    0xF2,0x50,0xF0,0x4F,0x37,0xA7,0x62,0x81,0x53,0x61,0x81,0x51,0x13,0x41,0x86,0x43,
+    0x11,0xA4,0x63,0xF0,0x13,0x31,0x2E,0x46,0x1D,0x19,0x1F,0x71,0xFF,0x11,0xF3,0x23,
+    0x1F,0x32,0x21,0xF5,0x30,0xFF,0xFF,0xFF,0xFF,0x97,0xF0,0xBB,0x47,0x48,0x2D,0x26,
+    0x1F,0x21,0x41,0xF4,0x10,0xFB,0x1F,0x41,0x41,0xF2,0x16,0x2D,0x28,0x47,0x4B,0xBF,
+    0x07,0xFF,0x31,0x41,0xF3,0x22,0x2F,0x32,0x22,0xF4,0x4F,0x62,0xF2,0xCF,0x22,0xF6,
+    0x4F,0x42,0x22,0xF3,0x22,0x2F,0x31,0x41,0xFF,0x61,0xF8,0x1F,0x81,0xF8,0x1F,0x81,
+    0xF3,0xBF,0x31,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xFF,0xF2,0x1F,0x32,0x31,0xF3,0x22,
+    0x1F,0x53,0xFF,0x61,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,
+    0xF8,0x10,0xFF,0xFF,0x63,0xF6,0x3F,0x63,0xFF,0xF0,0x2F,0x53,0xF4,0x3F,0x42,0xF4,
+    0x3F,0x43,0xF4,0x2F,0x43,0xF4,0x3F,0x52,0xFF,0x38,0xEC,0xB3,0x83,0x92,0xC2,0x81,
+    0xE1,0x81,0xE1,0x82,0xC2,0x93,0x83,0xBC,0xE8,0xFF,0xFA,0x1C,0x1A,0x1C,0x1A,0x1C,
+    0x19,0xF0,0x8F,0x1F,0x81,0xF8,0x1F,0x81,0xFF,0x13,0x83,0x91,0x12,0x71,0x12,0x81,
+    0xA1,0x22,0x81,0x91,0x32,0x81,0x81,0x42,0x81,0x71,0x52,0x82,0x43,0x52,0x97,0x62,
+    0xA4,0x55,0xFF,0x13,0x63,0xB4,0x64,0x91,0xE1,0x81,0x61,0x71,0x81,0x61,0x71,0x82,
+    0x42,0x71,0x96,0x11,0x52,0xA4,0x27,0xF4,0x40,0xFF,0x82,0xF5,0x21,0x1F,0x41,0x31,
+    0xF2,0x24,0x1F,0x11,0x61,0x41,0x92,0x71,0x41,0x8F,0x17,0xF2,0xF3,0x14,0x1F,0x31,
+    0x41,0xFF,0xA3,0xA9,0x22,0x11,0x92,0x51,0x71,0x82,0x41,0x81,0x82,0x41,0x81,0x82,
+    0x41,0x81,0x82,0x42,0x53,0x82,0x58,0x92,0x65,0xFF,0x47,0xEC,0xB3,0x41,0x42,0xA1,
+    0x51,0x62,0x81,0x51,0x81,0x81,0x51,0x81,0x81,0x51,0x81,0x83,0x32,0x61,0xA2,0x48,
+    0xF2,0x50,0xFF,0xF9,0x4F,0x43,0xF6,0x2F,0x72,0x95,0x82,0x68,0x82,0x42,0xF1,0x21,
+    0x3F,0x33,0xF6,0x20,0xFF,0x14,0x44,0xB6,0x17,0x92,0x32,0x11,0x51,0x91,0x52,0x71,
+    0x81,0x52,0x71,0x81,0x62,0x61,0x81,0x62,0x61,0x82,0x41,0x12,0x42,0x96,0x26,0xB3,
+    0x54,0xFF,0x25,0xF2,0x84,0x2A,0x25,0x23,0x38,0x18,0x15,0x18,0x18,0x15,0x18,0x18,
+    0x15,0x18,0x17,0x15,0x1A,0x24,0x13,0x4B,0xBF,0x07,0xFF,0xFF,0xFF,0xFF,0x93,0x63,
+    0xC3,0x63,0xC3,0x63,0xFF,0xFF,0xFF,0xFF,0xA2,0x72,0x11,0xB2,0x73,0xFF,0xFF,0x01,
+    0xF7,0x11,0x1F,0x51,0x31,0xF3,0x15,0x1F,0x11,0x71,0xE1,0x91,0xC1,0xB1,0xA1,0xD1,
+    0x81,0xF0,0x10,0xFF,0x41,0x41,0xF3,0x14,0x1F,0x31,0x41,0xF3,0x14,0x1F,0x31,0x41,
+    0xF3,0x14,0x1F,0x31,0x41,0xF3,0x14,0x1F,0x31,0x41,0xF3,0x14,0x10,0xFF,0xF7,0x1F,
+    0x01,0x81,0xD1,0xA1,0xB1,0xC1,0x91,0xE1,0x71,0xF1,0x15,0x1F,0x31,0x31,0xF5,0x11,
+    0x1F,0x71,0xFF,0x04,0xF4,0x12,0x2F,0x41,0xF7,0x1D,0x37,0x17,0x42,0x37,0x17,0x15,
+    0x37,0x16,0x1F,0x12,0x42,0xF2,0x6F,0x44,0xFF,0x47,0xF0,0xBB,0x38,0x3A,0x15,0x43,
+    0x19,0x22,0x34,0x13,0x18,0x12,0x26,0x13,0x18,0x12,0x15,0x24,0x18,0x13,0x83,0x19,
+    0x11,0x26,0x12,0x1A,0x27,0x12,0x1D,0x72,0x10,0xF5,0x1F,0x72,0xF3,0x6D,0x55,0x1A,
+    0x34,0x1E,0x36,0x1E,0x63,0x1F,0x27,0xF5,0x72,0x1F,0x36,0xF6,0x3F,0x81,0x51,0xE1,
+    0x8F,0x18,0xF1,0x81,0x61,0x71,0x81,0x61,0x71,0x81,0x61,0x71,0x81,0x61,0x71,0x82,
+    0x42,0x71,0x96,0x11,0x52,0xA4,0x27,0xF4,0x40,0xFF,0x47,0xEC,0xB3,0x83,0xA1,0xC2,
+    0x81,0xE1,0x81,0xE1,0x81,0xE1,0x81,0xD1,0x92,0xB1,0xA4,0x72,0x51,0xE1,0x8F,0x18,
+    0xF1,0x81,0xE1,0x81,0xE1,0x81,0xE1,0x81,0xD2,0x91,0xC1,0xA3,0x83,0xBC,0xE8,0x51,
+    0xE1,0x8F,0x18,0xF1,0x81,0x61,0x71,0x81,0x61,0x71,0x81,0x61,0x71,0x81,0x61,0x71,
+    0x81,0x45,0x51,0x81,0xE1,0x82,0xC2,0xA1,0x92,0x51,0xE1,0x8F,0x18,0xF1,0x81,0x61,
+    0x71,0x81,0x61,0xF1,0x16,0x1F,0x11,0x61,0xF1,0x14,0x5E,0x2F,0x72,0xF9,0x20,0xFF,
+    0x47,0xEC,0xB3,0x83,0x92,0xC2,0x81,0xE1,0x81,0x81,0x51,0x81,0x81,0x51,0x91,0x76,
+    0x94,0x56,0xF3,0x1F,0x81,0x51,0xE1,0x8F,0x18,0xF1,0x81,0x61,0x71,0xF0,0x1F,0x81,
+    0xF8,0x1F,0x81,0xF1,0x16,0x17,0x18,0xF1,0x8F,0x18,0x1E,0x10,0xFF,0xF8,0x1E,0x18,
+    0x1E,0x18,0x1E,0x18,0xF1,0x8F,0x18,0x1E,0x18,0x1E,0x18,0x1E,0x10,0xFF,0xF0,0x2F,
+    0x73,0xF8,0x15,0x1F,0x21,0x51,0xF2,0x15,0x1F,0x12,0x5F,0x36,0xF2,0x71,0xF8,0x1F,
+    0x81,0x51,0xE1,0x8F,0x18,0xF1,0x81,0x62,0x61,0xE2,0xF6,0x5E,0x12,0x23,0x4C,0x11,
+    0x16,0x42,0x18,0x29,0x58,0x1C,0x38,0x1D,0x2F,0x81,0x51,0xE1,0x8F,0x18,0xF1,0x81,
+    0xE1,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x72,0xF5,0x20,0x51,0xE1,0x8F,0x18,
+    0x4B,0x18,0x9F,0x49,0xF5,0x7F,0x15,0xF0,0x4F,0x14,0xB1,0x8F,0x18,0xF1,0x81,0xE1,
+    0x51,0xE1,0x8F,0x18,0x3C,0x19,0x4F,0x73,0xF8,0x3F,0x74,0xF7,0x3F,0x83,0xB1,0xA4,
+    0x9F,0x18,0x10,0xFF,0x38,0xEC,0xB3,0x83,0x92,0xC2,0x81,0xE1,0x81,0xE1,0x82,0xC2,
+    0x92,0xA2,0xBC,0xE8,0x51,0xE1,0x8F,0x18,0xF1,0x81,0x71,0x61,0x81,0x71,0xF0,0x17,
+    0x1F,0x01,0x71,0xF0,0x17,0x1F,0x02,0x52,0xF1,0x7F,0x35,0xFF,0x38,0xEC,0xB3,0x83,
+    0x92,0x91,0x31,0x81,0xA1,0x31,0x81,0xA2,0x21,0x82,0xB4,0x82,0xA5,0x8C,0x22,0xA8,
+    0x41,0x51,0xE1,0x8F,0x18,0xF1,0x81,0x61,0x71,0x81,0x61,0xF1,0x16,0x2F,0x01,0x64,
+    0xD1,0x61,0x14,0xB2,0x41,0x44,0xA6,0x63,0xA4,0x91,0xF8,0x10,0xFF,0x14,0x55,0x96,
+    0x62,0x92,0x32,0x71,0x91,0x52,0x71,0x81,0x52,0x71,0x81,0x62,0x61,0x81,0x62,0x61,
+    0x91,0x62,0x42,0x91,0x67,0x94,0x64,0x72,0xF5,0x2F,0x71,0xF8,0x1F,0x81,0xE1,0x8F,
+    0x18,0xF1,0x81,0xE1,0x81,0xF8,0x1F,0x82,0xF9,0x20,0x51,0xF8,0xEA,0xF0,0x91,0xD2,
+    0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x18,0x1D,0x19,0xEA,0x10,0x51,0xF8,0x2F,0x76,
+    0xF3,0xAE,0x15,0x8F,0x56,0xF6,0x3F,0x34,0xA1,0x45,0xE5,0xF4,0x2F,0x71,0x51,0xF8,
+    0x6F,0x3D,0xB1,0x5A,0xF1,0x5B,0x8F,0x1C,0xC1,0x4B,0xF1,0x5B,0x12,0x5F,0x13,0xF6,
+    0x10,0xFE,0x1E,0x18,0x2C,0x28,0x57,0x48,0x11,0x53,0x32,0x1D,0x5F,0x56,0xC1,0x32,
+    0x35,0x11,0x84,0x75,0x82,0xC2,0x81,0xE1,0x51,0xF8,0x2F,0x74,0xF5,0x69,0x18,0x13,
+    0x56,0x1E,0xAF,0x18,0xE2,0x71,0x81,0x23,0x91,0x83,0xF6,0x2F,0x71,0xFF,0x11,0xC1,
+    0x82,0xB3,0x81,0xA5,0x81,0x85,0x11,0x81,0x64,0x41,0x81,0x35,0x61,0x81,0x15,0x81,
+    0x85,0xA1,0x83,0xB2,0x81,0xB2,0xFF,0xFF,0xFF,0xFF,0x2F,0x63,0x1F,0x41,0x31,0xF4,
+    0x13,0x1F,0x41,0x31,0xF4,0x13,0x1F,0x41,0xFF,0xF7,0x1F,0x93,0xF9,0x2F,0x93,0xF9,
+    0x2F,0x93,0xF9,0x2F,0x93,0xF9,0x10,0xFF,0xF5,0x1F,0x41,0x31,0xF4,0x13,0x1F,0x41,
+    0x31,0xF4,0x13,0x1F,0x41,0x3F,0x60,0xFF,0xFF,0xF1,0x1F,0x71,0xF7,0x2F,0x71,0xF8,
+    0x2F,0x81,0xF9,0x10,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xF8,0x1F,0x81,
+    0xF8,0x1F,0x81,0xF8,0x1F,0x81,0xFF,0xFF,0xE1,0xF8,0x1F,0x91,0xF8,0x10,0xFF,0xA4,
+    0xF0,0x22,0x6E,0x21,0x23,0x2D,0x13,0x15,0x1D,0x12,0x25,0x1D,0x12,0x16,0x1D,0x12,
+    0x15,0x1E,0xBE,0xAF,0x81,0xF7,0x20,0xFE,0x1F,0x8F,0x17,0xF1,0xF0,0x26,0x2E,0x18,
+    0x1D,0x19,0x1D,0x19,0x1D,0x27,0x2E,0x9F,0x16,0xFF,0x75,0xF2,0x9F,0x02,0x52,0xE1,
+    0x91,0xD1,0x91,0xD1,0x91,0xD4,0x61,0xE3,0x51,0xF6,0x20,0xFF,0x75,0xF2,0x9E,0x36,
+    0x2D,0x19,0x1D,0x19,0x1D,0x19,0x18,0x15,0x17,0x19,0xF1,0x7F,0x1F,0x81,0xFF,0xFF,
+    0x15,0xF2,0x9F,0x01,0x21,0x32,0xE1,0x31,0x42,0xD1,0x31,0x51,0xD1,0x31,0x51,0xD2,
+    0x21,0x51,0xE4,0x41,0xF1,0x33,0x10,0xFF,0x41,0xF8,0x19,0x1D,0x19,0x1A,0xE9,0xF0,
+    0x82,0x31,0x91,0x81,0x41,0x91,0x81,0x41,0x91,0x83,0x21,0xF4,0x20,0xFF,0xE3,0xD3,
+    0x22,0x13,0xC9,0x22,0xA2,0x32,0x12,0x31,0xA1,0x51,0x12,0x31,0xA1,0x51,0x12,0x31,
+    0xA2,0x32,0x21,0x31,0xB5,0x31,0x22,0xA1,0x13,0x44,0xB1,0x93,0xB2,0xFE,0x1E,0x18,
+    0xF1,0x7F,0x2E,0x18,0x1D,0x1F,0x81,0xF8,0x19,0x1D,0xBE,0xAF,0x81,0xFF,0xFD,0x19,
+    0x1D,0x19,0x1D,0x19,0x18,0x23,0xB8,0x23,0xBF,0x81,0xF8,0x1F,0x81,0xFF,0xFF,0xA2,
+    0xF7,0x2A,0x1C,0x1A,0x1C,0x1A,0x1B,0x25,0x23,0xD6,0x23,0xC0,0xFE,0x1E,0x18,0xF1,
+    0x7F,0x2F,0x32,0x31,0xF2,0x2F,0x31,0x16,0xF1,0x33,0x5D,0x17,0x3D,0x19,0x1F,0x81,
+    0xFF,0xF8,0x1E,0x18,0x1E,0x18,0x1E,0x18,0xF1,0x7F,0x2F,0x81,0xF8,0x1F,0x81,0xA1,
+    0x91,0xDB,0xDB,0xE1,0x81,0xD1,0xF8,0xBD,0xBE,0x18,0x1D,0x1F,0x8B,0xDB,0xF8,0x10,
+    0xFF,0x41,0x91,0xDB,0xDB,0xE1,0x81,0xE1,0xF7,0x1F,0x81,0x91,0xDB,0xEA,0xF8,0x10,
+    0xFF,0x75,0xF3,0x8F,0x02,0x52,0xE2,0x81,0xD1,0x91,0xD1,0x91,0xD2,0x81,0xE2,0x52,
+    0xF1,0x8F,0x25,0xFF,0x41,0xC1,0xAE,0xAE,0xB1,0x71,0x31,0xA1,0x91,0x21,0xA1,0x91,
+    0xD1,0x91,0xD2,0x63,0xE9,0xF1,0x60,0xFF,0x75,0xF2,0x9E,0x36,0x2D,0x19,0x1D,0x19,
+    0x1D,0x19,0x12,0x1B,0x17,0x13,0x1B,0xDA,0xEF,0x81,0xA1,0x91,0xD1,0x91,0xD1,0x91,
+    0xDB,0xDB,0xF0,0x17,0x1E,0x18,0x1D,0x19,0x1D,0x1F,0x82,0xF7,0x20,0xFF,0xFF,0x02,
+    0x34,0xE4,0x42,0xD2,0x22,0x41,0xD1,0x32,0x41,0xD1,0x41,0x41,0xD1,0x42,0x31,0xD1,
+    0x42,0x22,0xD2,0x44,0xE3,0x42,0xFF,0x41,0xF8,0x1F,0x81,0xF6,0xCA,0xF0,0xD1,0x91,
+    0xD1,0x91,0xD1,0x91,0xF6,0x20,0xFF,0x41,0xF8,0xAD,0xCF,0x72,0xF8,0x1F,0x81,0xD1,
+    0x81,0xEB,0xCB,0xF8,0x10,0xFF,0x41,0xF8,0x2F,0x74,0xF5,0x7F,0x21,0x36,0xF6,0x4F,
+    0x53,0xE1,0x33,0xF2,0x4F,0x52,0xF7,0x10,0xA1,0xF8,0x4F,0x59,0xF0,0x13,0x7F,0x43,
+    0xF0,0x12,0x3F,0x35,0xF4,0x9F,0x01,0x46,0xF3,0x4F,0x05,0xF4,0x10,0xFF,0x41,0x91,
+    0xD1,0x91,0xD3,0x53,0xD5,0x22,0x11,0xD1,0x24,0xF6,0x42,0x1D,0x11,0x22,0x5D,0x35,
+    0x3D,0x18,0x2D,0x19,0x10,0xFF,0x41,0xF8,0x2A,0x2A,0x49,0x1A,0x75,0x2A,0x13,0x51,
+    0x2F,0x43,0xE1,0x33,0xF2,0x4F,0x51,0xF8,0x10,0xFF,0xFD,0x37,0x1D,0x17,0x3D,0x15,
+    0x5D,0x13,0x51,0x1D,0x11,0x53,0x1D,0x55,0x1D,0x37,0x1D,0x18,0x2F,0x53,0xFF,0xFF,
+    0xFF,0xFF,0xC1,0xF7,0x11,0x1D,0x91,0x94,0x2F,0x22,0x31,0xF4,0x10,0xFF,0xFF,0xFF,
+    0xFF,0xF9,0xF9,0xFF,0xF5,0x1F,0x41,0x32,0xF2,0x24,0x91,0x9D,0x11,0x1F,0x71,0xFC,
+    0x2F,0x52,0xF7,0x1F,0x81,0xF9,0x1F,0x91,0xF9,0x1F,0x91,0xF8,0x1F,0x72,0xF6,0x10,
+};
+const asset_font_t g_font_2412 = {24, 36, ASSET_RLE, asc2_2412_offs, asc2_2412_pack};
+
+/* 32x16: 6080 -> 2986 ֽ(ƫƱ 192) */
+const uint16_t asc2_3216_offs[96] =
+{
+    0, 0, 14, 33, 67, 101, 136, 175, 185, 210, 228, 266,
+    293, 304, 333, 341, 364, 395, 419, 455, 489, 522, 557, 594,
+    619, 658, 693, 709, 721, 752, 788, 818, 849, 891, 922, 960,
+    994, 1026, 1063, 1098, 1133, 1167, 1193, 1221, 1258, 1287, 1319, 1346,
+    1377, 1410, 1446, 1481, 1518, 1546, 1576, 1604, 1634, 1673, 1703, 1738,
+    1764, 1788, 1809, 1830, 1862, 1876, 1914, 1945, 1974, 2005, 2043, 2077,
+    2123, 2155, 2181, 2208, 2242, 2266, 2295, 2328, 2359, 2393, 2427, 2460,
+    2498, 2525, 2555, 2580, 2610, 2649, 2679, 2715, 2739, 2750, 2768, 2794,
+};
+const uint8_t asc2_3216_pack[2794] =
+{
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x7C,0x2B,0xE4,0x4A,0x7B,0x4F,0xE2,0xFF,0xFF,
+    0xE1,0xFD,0x3F,0xC4,0xFB,0x5F,0xC4,0xFD,0x34,0x1F,0xD3,0xFC,0x4F,0xB5,0xFC,0x4F,
+    0xD3,0xFF,0xD2,0x72,0xF6,0x27,0x2F,0x62,0x77,0xF1,0xBF,0x17,0x72,0xF6,0x27,0x2F,
+    0x62,0x72,0xF6,0x27,0x2F,0x62,0x72,0xF6,0x27,0x7F,0x1B,0xF1,0x77,0x2F,0x62,0x72,
+    0xF6,0x27,0x20,0xFF,0xFF,0xFA,0x4F,0x14,0x85,0xE6,0x72,0x21,0xD1,0x43,0xB1,0xB2,
+    0x53,0xA1,0xB1,0x73,0x91,0x9F,0xB8,0x18,0x38,0x1B,0x19,0x36,0x2C,0x12,0x25,0x35,
+    0x1D,0x56,0x7F,0x04,0x75,0x87,0xF9,0x9F,0x72,0x72,0xF6,0x19,0x18,0x2B,0x27,0x26,
+    0x3D,0x95,0x3F,0x17,0x42,0xFC,0x3F,0xC3,0x16,0xF5,0x22,0xAF,0x03,0x32,0x82,0xC3,
+    0x51,0xA1,0xB2,0x72,0x82,0xF6,0xAF,0x96,0xF4,0x5F,0xA9,0xE6,0x22,0x62,0xDA,0x82,
+    0xB2,0x65,0x71,0xB1,0x71,0x24,0x51,0xB1,0x62,0x44,0x31,0xB8,0x73,0x11,0xD5,0xA3,
+    0xF7,0x16,0x4F,0x61,0x33,0x32,0xF5,0x47,0x1F,0x51,0xA1,0xF5,0x19,0x1F,0xE2,0xFF,
+    0xC1,0xF9,0x33,0x2F,0x93,0x31,0xFA,0x6F,0xC4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFC,0x8F,0x6E,0xF2,0x48,0x5D,0x3E,0x3B,0x2F,0x32,0x91,0xF7,0x17,0x1F,0x91,0x51,
+    0xFB,0x10,0xFF,0x51,0xFB,0x15,0x1F,0x91,0x71,0xF7,0x19,0x2F,0x32,0xB3,0xE3,0xE4,
+    0x85,0xF1,0xEF,0x68,0xFF,0xFF,0xF1,0x25,0x2F,0x83,0x33,0xF8,0x33,0x3F,0x92,0x32,
+    0xFB,0x21,0x2F,0x72,0x41,0x11,0x43,0xF0,0xF2,0xF1,0x24,0x11,0x14,0x2F,0x72,0x12,
+    0xFB,0x23,0x2F,0x93,0x33,0xF8,0x33,0x3F,0x82,0x52,0xFF,0xFF,0xF5,0x1F,0xF1,0x1F,
+    0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0x9F,0x0F,0x91,0xFF,0x11,0xFF,0x11,0xFF,
+    0x11,0xFF,0x11,0xFF,0x11,0xFF,0xFF,0x31,0xF9,0x33,0x2F,0x93,0x31,0xFA,0x6F,0xC4,
+    0xFF,0xF3,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,
+    0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x10,0xFF,0xFF,0xFD,
+    0x2F,0xE4,0xFD,0x4F,0xE2,0xFF,0xFF,0x02,0xFD,0x3F,0xC3,0xFC,0x3F,0xC3,0xFC,0x3F,
+    0xC3,0xFC,0x3F,0xC3,0xFC,0x3F,0xC3,0xFC,0x3F,0xC3,0xFD,0x20,0xFF,0xFF,0xF1,0x9F,
+    0x5F,0x0F,0x14,0x94,0xE2,0xF0,0x2C,0x2F,0x22,0xB1,0xF4,0x1B,0x1F,0x41,0xB1,0xF4,
+    0x1B,0x2F,0x22,0xC2,0xF0,0x2E,0x3B,0x3F,0x1F,0x0F,0x59,0xFF,0xFF,0xFF,0xE1,0xF2,
+    0x1D,0x1F,0x21,0xD1,0xF2,0x1D,0x1F,0x12,0xCF,0x5B,0xF6,0xFF,0x02,0xFF,0x11,0xFF,
+    0x11,0xFF,0x11,0xFF,0xFF,0xD4,0xB3,0xD1,0x22,0xA1,0x12,0xC1,0xE1,0x22,0xB1,0xE1,
+    0x32,0xB1,0xD1,0x42,0xB1,0xC1,0x52,0xB1,0xB1,0x62,0xB1,0xA1,0x72,0xB2,0x81,0x82,
+    0xC2,0x52,0x92,0xC8,0x93,0xE5,0x74,0xFF,0xFF,0xC4,0x94,0xE5,0x95,0xD1,0xF2,0x1C,
+    0x1F,0x41,0xB1,0x81,0xA1,0xB1,0x81,0xA1,0xB1,0x81,0xA1,0xB2,0x63,0x91,0xC2,0x42,
+    0x11,0x81,0xD7,0x22,0x62,0xF0,0x44,0x8F,0xB4,0xFF,0xF7,0x1F,0xE3,0xFD,0x12,0x1F,
+    0xB2,0x31,0xF9,0x25,0x1F,0x82,0x61,0x61,0xE2,0x81,0x61,0xD1,0xA1,0x61,0xBF,0x6A,
+    0xF7,0xAF,0x7F,0x91,0x61,0xF9,0x16,0x1F,0x91,0x61,0xFF,0xFF,0xFA,0x4F,0x36,0x42,
+    0x21,0xC5,0x41,0xA1,0xB2,0x61,0xB1,0xB2,0x51,0xC1,0xB2,0x51,0xC1,0xB2,0x51,0xC1,
+    0xB2,0x51,0xC1,0xB2,0x52,0xA1,0xC2,0x62,0x73,0xC2,0x7A,0xD2,0x96,0xFF,0xFF,0xF2,
+    0x9F,0x5E,0xF2,0x34,0x24,0x3F,0x01,0x62,0x72,0xD1,0x71,0x92,0xB2,0x61,0xB1,0xB1,
+    0x71,0xB1,0xB1,0x71,0xB1,0xB1,0x71,0xB1,0xB1,0x72,0x91,0xD3,0x52,0x72,0xE2,0x69,
+    0xF9,0x60,0xFF,0xFF,0xC4,0xFB,0x4F,0xD3,0xFE,0x2F,0xF0,0x2D,0x6B,0x2A,0x9B,0x27,
+    0x3F,0x52,0x52,0xF8,0x23,0x2F,0xA2,0x12,0xFC,0x3F,0xE2,0xFF,0xF6,0x5F,0x24,0x57,
+    0xF0,0x63,0x25,0x2D,0x23,0x31,0x27,0x1C,0x25,0x49,0x1B,0x17,0x2A,0x1B,0x18,0x29,
+    0x1B,0x18,0x29,0x1B,0x18,0x38,0x1B,0x27,0x46,0x1D,0x24,0x22,0x34,0x2E,0x64,0x7F,
+    0x14,0x65,0xFF,0xC6,0xF9,0x96,0x3D,0x36,0x25,0x3D,0x19,0x27,0x1B,0x1B,0x17,0x1B,
+    0x1B,0x17,0x1B,0x1B,0x17,0x1B,0x1B,0x16,0x2B,0x1A,0x16,0x2D,0x18,0x25,0x2F,0x02,
+    0x52,0x34,0xF2,0xEF,0x59,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x28,0x2F,0x44,0x64,
+    0xF3,0x46,0x4F,0x42,0x82,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x2A,0x22,0x2E,0x2A,
+    0x40,0xFF,0xFF,0xF5,0x1F,0xF0,0x3F,0xD2,0x12,0xFB,0x23,0x2F,0x92,0x52,0xF7,0x27,
+    0x2F,0x52,0x92,0xF3,0x2B,0x2F,0x12,0xD2,0xE1,0xF2,0x1C,0x1F,0x41,0xA1,0xF6,0x10,
+    0xFF,0xF0,0x15,0x1F,0xA1,0x51,0xFA,0x15,0x1F,0xA1,0x51,0xFA,0x15,0x1F,0xA1,0x51,
+    0xFA,0x15,0x1F,0xA1,0x51,0xFA,0x15,0x1F,0xA1,0x51,0xFA,0x15,0x1F,0xA1,0x51,0xFA,
+    0x15,0x1F,0xA1,0x51,0xFF,0xFF,0x91,0xF6,0x1A,0x1F,0x41,0xC1,0xF2,0x1E,0x2D,0x2F,
+    0x12,0xB2,0xF3,0x29,0x2F,0x52,0x72,0xF7,0x25,0x2F,0x92,0x32,0xFB,0x21,0x2F,0xD3,
+    0xFF,0x01,0xFF,0xFF,0xD4,0xFB,0x6F,0xA1,0x33,0xFA,0x1F,0xF0,0x1F,0x32,0xB1,0xB4,
+    0x24,0xA1,0xA1,0x64,0xA1,0x91,0x82,0xB1,0x82,0xF7,0x17,0x1F,0x82,0x52,0xF9,0x7F,
+    0xB5,0xFF,0xE9,0xF6,0xDF,0x33,0x94,0xF0,0x2E,0x2D,0x17,0x64,0x1C,0x25,0x94,0x1B,
+    0x14,0x46,0x14,0x1B,0x13,0x28,0x15,0x1B,0x13,0x17,0x26,0x1B,0x13,0xC4,0x1C,0x12,
+    0x65,0x13,0x1D,0x2B,0x22,0x2E,0x37,0x23,0x2F,0x37,0x41,0xFB,0x1F,0xF0,0x2F,0xC5,
+    0xF8,0x53,0x1F,0x45,0x71,0xF0,0x53,0x1F,0x45,0x71,0xF4,0x39,0x1F,0x39,0x41,0xF8,
+    0x9F,0xC9,0x31,0xF8,0x9F,0xD4,0xFF,0x11,0xFF,0x11,0xFF,0x81,0xF4,0x1B,0x1F,0x41,
+    0xBF,0x6B,0xF6,0xB1,0x81,0xA1,0xB1,0x81,0xA1,0xB1,0x81,0xA1,0xB1,0x81,0xA1,0xB1,
+    0x81,0xA1,0xB2,0x62,0xA1,0xC2,0x42,0x11,0x82,0xC7,0x22,0x62,0xE5,0x48,0xFB,0x50,
+    0xFF,0xF0,0x8F,0x6E,0xF2,0x39,0x4F,0x02,0xE2,0xD1,0xF2,0x1C,0x2F,0x31,0xB1,0xF4,
+    0x1B,0x1F,0x41,0xB1,0xF4,0x1B,0x1F,0x41,0xC1,0xF2,0x1D,0x2F,0x02,0xC4,0xD2,0xF2,
+    0x29,0x20,0xFF,0x81,0xF4,0x1B,0x1F,0x41,0xBF,0x6B,0xF6,0xB1,0xF4,0x1B,0x1F,0x41,
+    0xB1,0xF4,0x1B,0x1F,0x41,0xB2,0xF2,0x2C,0x1F,0x21,0xD2,0xF0,0x2E,0x49,0x4F,0x1E,
+    0xF6,0x90,0xFF,0x81,0xF4,0x1B,0x1F,0x41,0xBF,0x6B,0xF6,0xB1,0x81,0xA1,0xB1,0x81,
+    0xA1,0xB1,0x81,0xA1,0xB1,0x81,0xA1,0xB1,0x81,0xA1,0xB1,0x73,0x91,0xB1,0x57,0x71,
+    0xB2,0xF2,0x2B,0x4E,0x3E,0x2B,0x20,0xFF,0x81,0xF4,0x1B,0x1F,0x41,0xBF,0x6B,0xF6,
+    0xB1,0x81,0xA1,0xB1,0x81,0xA1,0xB1,0x81,0xF7,0x18,0x1F,0x71,0x81,0xF7,0x18,0x1F,
+    0x71,0x73,0xF6,0x24,0x7F,0x42,0xFF,0x04,0xFF,0x12,0xFF,0xF0,0x8F,0x6D,0xF3,0x39,
+    0x4E,0x3D,0x3D,0x1F,0x21,0xC2,0xF3,0x1B,0x1F,0x41,0xB1,0xF4,0x1B,0x1F,0x41,0xC1,
+    0xA1,0x71,0xC1,0xA1,0x61,0xC4,0x87,0xF2,0x26,0x7F,0xA1,0xFF,0x11,0x61,0xF4,0x1B,
+    0x1F,0x41,0xBF,0x6B,0xF6,0xB1,0x91,0x91,0xB1,0x91,0x91,0xF6,0x1F,0xF1,0x1F,0xF1,
+    0x1F,0x61,0x91,0x91,0xB1,0x91,0x91,0xBF,0x6B,0xF6,0xB1,0xF4,0x1B,0x1F,0x41,0xFF,
+    0xFF,0xFF,0xC1,0xF4,0x1B,0x1F,0x41,0xB1,0xF4,0x1B,0x1F,0x41,0xBF,0x6B,0xF6,0xB1,
+    0xF4,0x1B,0x1F,0x41,0xB1,0xF4,0x1B,0x1F,0x41,0xFF,0xFF,0x03,0xFE,0x4F,0xD4,0xFF,
+    0x11,0x61,0xF9,0x16,0x1F,0x91,0x61,0xF8,0x26,0x1F,0x72,0x7F,0x98,0xF8,0x91,0xFF,
+    0x11,0xFF,0x11,0xFF,0x11,0xFF,0x81,0xF4,0x1B,0x1F,0x41,0xBF,0x6B,0xF6,0xB1,0x92,
+    0x81,0xB1,0x81,0xA1,0xF3,0x4F,0xC7,0xF8,0x24,0x5F,0x21,0x22,0x75,0x31,0xB3,0xB4,
+    0x21,0xB2,0xE5,0xB1,0xF2,0x3B,0x1F,0x41,0xFF,0x11,0xFF,0x81,0xF4,0x1B,0x1F,0x41,
+    0xBF,0x6B,0xF6,0xB1,0xF4,0x1B,0x1F,0x41,0xFF,0x11,0xFF,0x11,0xFF,0x11,0xFF,0x11,
+    0xFF,0x11,0xFF,0x02,0xFE,0x3F,0xC2,0x61,0xF4,0x1B,0x1F,0x41,0xBF,0x6B,0x5F,0x01,
+    0xBA,0xA1,0xF1,0x9F,0xCA,0xFC,0x7F,0x94,0xF8,0x5F,0x85,0xB1,0xB5,0xF0,0x1B,0xF6,
+    0xBF,0x6B,0x1F,0x41,0xB1,0xF4,0x10,0x61,0xF4,0x1B,0x1F,0x41,0xBF,0x6B,0x3F,0x21,
+    0xB6,0xE1,0xD6,0xFE,0x5F,0xE5,0xFE,0x5F,0xE5,0xF1,0x1C,0x6D,0x1E,0x6B,0xF6,0xB1,
+    0xFF,0x11,0xFF,0xE9,0xF6,0xDF,0x24,0x94,0xE2,0xF0,0x2D,0x1F,0x21,0xC1,0xF4,0x1B,
+    0x1F,0x41,0xB1,0xF4,0x1B,0x1F,0x41,0xC1,0xF2,0x1D,0x2F,0x02,0xE4,0xA3,0xF2,0xDF,
+    0x69,0xFF,0x81,0xF4,0x1B,0x1F,0x41,0xBF,0x6B,0xF6,0xB1,0x91,0x91,0xB1,0x91,0x91,
+    0xB1,0x91,0xF6,0x19,0x1F,0x61,0x91,0xF6,0x19,0x1F,0x62,0x72,0xF7,0x25,0x2F,0x97,
+    0xFB,0x50,0xFF,0xE9,0xF5,0xF0,0xF1,0x4A,0x3E,0x2E,0x3D,0x1D,0x22,0x1C,0x1E,0x14,
+    0x1B,0x1E,0x14,0x1B,0x1E,0x23,0x1B,0x1F,0x05,0xC1,0xF1,0x5A,0x2F,0x11,0x13,0xA3,
+    0xB3,0x32,0xCE,0x42,0xEA,0x52,0xFF,0x81,0xF4,0x1B,0x1F,0x41,0xBF,0x6B,0xF6,0xB1,
+    0x81,0xA1,0xB1,0x81,0xA1,0xB1,0x82,0xF6,0x18,0x4F,0x41,0x87,0xF1,0x26,0x22,0x7E,
+    0x24,0x26,0x6C,0x7A,0x3D,0x5D,0x1F,0xF1,0x10,0xFF,0xFF,0xD4,0x82,0xF2,0x78,0x4C,
+    0x24,0x29,0x2C,0x26,0x29,0x1C,0x17,0x2A,0x1B,0x18,0x29,0x1B,0x18,0x29,0x1B,0x18,
+    0x38,0x1B,0x19,0x28,0x1C,0x18,0x36,0x2C,0x28,0x34,0x2C,0x57,0x7F,0xB5,0xFF,0xB2,
+    0xFC,0x3F,0xE2,0xFF,0x01,0xFF,0x11,0xF4,0x1B,0x1F,0x41,0xBF,0x6B,0xF6,0xB1,0xF4,
+    0x1B,0x1F,0x41,0xB1,0xFF,0x11,0xFF,0x13,0xFF,0x13,0x61,0xFF,0x11,0xFF,0x1F,0x3E,
+    0xF5,0xC1,0xF3,0x1C,0x1F,0x32,0xFF,0x11,0xFF,0x11,0xFF,0x11,0xFF,0x11,0xB1,0xF3,
+    0x1C,0x1F,0x21,0xDF,0x3E,0x1F,0xF1,0x10,0xFF,0x81,0xFF,0x11,0xFF,0x14,0xFD,0x8F,
+    0x91,0x38,0xFD,0x7F,0xD8,0xFD,0x6F,0xB4,0xF9,0x4F,0x21,0x74,0xF5,0x13,0x4F,0x94,
+    0xFD,0x1F,0xF1,0x10,0x61,0xFF,0x14,0xFD,0xBF,0x61,0x3D,0xF0,0x1A,0xAF,0xA4,0xE1,
+    0x94,0xF3,0x51,0x4F,0x7B,0xF6,0x15,0xBF,0xC9,0xF9,0x5E,0x16,0x6F,0x47,0xFA,0x2F,
+    0xF0,0x10,0xFF,0x81,0xF4,0x1B,0x1F,0x41,0xB3,0xF0,0x3B,0x6A,0x22,0x1B,0x11,0x66,
+    0x24,0x1B,0x14,0x52,0x2F,0xA5,0xFC,0x7F,0x31,0x42,0x45,0xF1,0x12,0x28,0x52,0x1B,
+    0x3D,0x5B,0x1F,0x23,0xB1,0xF4,0x1F,0xF1,0x10,0xFF,0x81,0xFF,0x12,0xFF,0x04,0xFD,
+    0x7F,0xA1,0x35,0xB1,0xB1,0x56,0x81,0xF5,0xCF,0x7A,0xF4,0x39,0x1B,0x14,0x3C,0x1B,
+    0x12,0x3F,0xB3,0xFE,0x1F,0xF1,0x10,0xFF,0xFD,0x1E,0x2D,0x3B,0x3D,0x5B,0x2C,0x51,
+    0x1B,0x1B,0x53,0x1B,0x19,0x55,0x1B,0x17,0x57,0x1B,0x15,0x59,0x1B,0x13,0x5B,0x1B,
+    0x12,0x4D,0x1B,0x5E,0x2B,0x3F,0x03,0xB1,0xF0,0x20,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xF0,0xFC,0x51,0xFA,0x15,0x1F,0xA1,0x51,0xFA,0x15,0x1F,0xA1,0x51,0xFA,0x15,0x1F,
+    0xA1,0x51,0xFA,0x10,0xFF,0xFF,0xFF,0xB3,0xFF,0x04,0xFF,0x14,0xFF,0x04,0xFF,0x14,
+    0xFF,0x04,0xFF,0x14,0xFF,0x04,0xFF,0x14,0xFF,0x04,0xFF,0x12,0xFF,0xFF,0x71,0xFA,
+    0x15,0x1F,0xA1,0x51,0xFA,0x15,0x1F,0xA1,0x51,0xFA,0x15,0x1F,0xA1,0x51,0xFA,0x15,
+    0xFC,0xFF,0xFF,0xFF,0xFF,0xE1,0xFF,0x01,0xFF,0x01,0xFF,0x02,0xFF,0x01,0xFF,0x12,
+    0xFF,0x02,0xFF,0x21,0xFF,0x21,0xFF,0x11,0xFF,0x11,0xFF,0x11,0xFF,0x11,0xFF,0x11,
+    0xFF,0x11,0xFF,0x11,0xFF,0x11,0xFF,0x11,0xFF,0x11,0xFF,0x11,0xFF,0x11,0xFF,0x11,
+    0xFF,0x11,0xFF,0x11,0xFF,0x11,0xFF,0xFF,0xFF,0x91,0xFF,0x11,0xFF,0x11,0xFF,0x12,
+    0xFF,0x11,0xFF,0x21,0xFF,0xF9,0x3F,0x72,0x36,0xF5,0x33,0x23,0x2F,0x32,0x42,0x51,
+    0xF3,0x15,0x16,0x1F,0x31,0x51,0x61,0xF3,0x14,0x17,0x1F,0x31,0x41,0x61,0xF4,0x23,
+    0x16,0x1F,0x5C,0xF6,0xCF,0xF1,0x1F,0xF1,0x1F,0xE2,0xFF,0x81,0xFF,0x11,0xFF,0x1F,
+    0x6A,0xF6,0xF6,0x27,0x2F,0x51,0xA2,0xF4,0x1B,0x1F,0x31,0xC1,0xF3,0x1C,0x1F,0x31,
+    0xC1,0xF3,0x2A,0x1F,0x52,0x82,0xF6,0xAF,0x87,0xFF,0xFF,0xF6,0x6F,0x9A,0xF6,0x36,
+    0x3F,0x51,0xA1,0xF4,0x2B,0x1F,0x31,0xC1,0xF3,0x1C,0x1F,0x31,0xC1,0xF3,0x2B,0x1F,
+    0x44,0x71,0xF6,0x36,0x1F,0xE2,0xFF,0xFF,0xF6,0x6F,0x9A,0xF6,0x37,0x2F,0x42,0xA2,
+    0xF3,0x1C,0x1F,0x31,0xC1,0xF3,0x1C,0x1B,0x16,0x1B,0x1C,0x17,0x19,0x1D,0xF6,0xAF,
+    0x6F,0xF1,0x1F,0xF1,0x10,0xFF,0xFF,0xF6,0x6F,0x9A,0xF6,0x23,0x13,0x3F,0x51,0x41,
+    0x51,0xF4,0x15,0x15,0x2F,0x31,0x51,0x61,0xF3,0x15,0x16,0x1F,0x31,0x51,0x61,0xF3,
+    0x24,0x16,0x1F,0x42,0x31,0x51,0xF6,0x54,0x2F,0x83,0x31,0xFF,0xFF,0xF2,0x1F,0xF1,
+    0x1C,0x1F,0x31,0xC1,0xF3,0x1C,0x1E,0xF3,0xCF,0x5C,0x15,0x1C,0x1B,0x25,0x1C,0x1B,
+    0x16,0x1C,0x1B,0x16,0x1C,0x1B,0x16,0x1F,0x91,0xFF,0x23,0xFE,0x30,0xFF,0xFF,0xFF,
+    0x13,0xF3,0x33,0x22,0x5F,0x0C,0x41,0xF0,0x15,0x22,0x24,0x2D,0x17,0x12,0x25,0x1D,
+    0x17,0x12,0x25,0x1D,0x17,0x12,0x25,0x1D,0x17,0x12,0x25,0x1D,0x25,0x22,0x25,0x1E,
+    0x73,0x24,0x2D,0x11,0x55,0x23,0x1E,0x2A,0x6E,0x2B,0x40,0xFF,0x81,0xF4,0x1B,0x1F,
+    0x41,0xBF,0x6A,0xF7,0xF5,0x1A,0x1F,0x41,0xB1,0xF3,0x2F,0xF0,0x1F,0xF1,0x1F,0xF1,
+    0x1C,0x1F,0x32,0xB1,0xF4,0xDF,0x5C,0xFF,0x11,0xFF,0x11,0xFF,0xFF,0xFF,0xF4,0x1C,
+    0x1F,0x31,0xC1,0xF3,0x1C,0x1F,0x31,0xC1,0xB3,0x4E,0xB3,0x3F,0x0B,0x3F,0x21,0xFF,
+    0x11,0xFF,0x11,0xFF,0x11,0xFF,0xFF,0xFF,0xFF,0x52,0xFF,0x03,0xFF,0x11,0xFF,0x11,
+    0xD1,0xF2,0x1D,0x1F,0x21,0xD1,0xF1,0x2D,0x1F,0x02,0x73,0x4F,0x28,0x33,0xF2,0x93,
+    0xFF,0x81,0xF4,0x1B,0x1F,0x41,0xBF,0x6A,0xF7,0xFA,0x15,0x1F,0x91,0x61,0xF8,0x2F,
+    0xD6,0xF8,0x11,0x23,0x3F,0x73,0x54,0x11,0xF3,0x28,0x4F,0x31,0xA3,0xF3,0x1C,0x1F,
+    0xF1,0x10,0xFF,0xFF,0xFF,0xC1,0xF4,0x1B,0x1F,0x41,0xB1,0xF4,0x1B,0x1F,0x41,0xBF,
+    0x6A,0xF7,0xFF,0x11,0xFF,0x11,0xFF,0x11,0xFF,0x11,0xFF,0xF0,0x1C,0x1F,0x3E,0xF2,
+    0xF0,0xF4,0x1B,0x1F,0x31,0xFF,0x11,0xC1,0xF3,0xEF,0x4D,0xF4,0x1B,0x1F,0x31,0xFF,
+    0x11,0xC1,0xF3,0xEF,0x4D,0xFF,0x11,0xFF,0xF0,0x1C,0x1F,0x31,0xC1,0xF3,0xEF,0x2F,
+    0x0F,0x51,0xA1,0xF4,0x1B,0x1F,0x41,0xFF,0x01,0xFF,0x11,0xFF,0x11,0xC1,0xF3,0x2B,
+    0x1F,0x4D,0xF5,0xCF,0xF1,0x1F,0xF1,0x10,0xFF,0xFF,0xF6,0x6F,0xA9,0xF6,0x36,0x3F,
+    0x51,0xA1,0xF4,0x2B,0x1F,0x31,0xC1,0xF3,0x1C,0x1F,0x31,0xC1,0xF3,0x2B,0x1F,0x41,
+    0xA1,0xF5,0x36,0x3F,0x6A,0xF9,0x60,0xFF,0xF0,0x1F,0x21,0xD1,0xF2,0x1D,0xF4,0xCF,
+    0x5F,0x01,0x82,0x51,0xE1,0xA1,0x51,0xD1,0xC1,0xF3,0x1C,0x1F,0x31,0xC1,0xF3,0x1C,
+    0x1F,0x32,0xA1,0xF5,0x27,0x3F,0x6A,0xF9,0x60,0xFF,0xFF,0xF6,0x6F,0x9A,0xF6,0x37,
+    0x2F,0x51,0xA2,0xF3,0x1C,0x1F,0x31,0xC1,0xF3,0x1C,0x1F,0x31,0xC1,0xF4,0x1A,0x15,
+    0x1E,0x28,0x25,0x1E,0xF3,0xDF,0x4F,0xF1,0x1F,0xF1,0x10,0xFF,0xF0,0x1C,0x1F,0x31,
+    0xC1,0xF3,0x1C,0x1F,0x31,0xC1,0xF2,0xF0,0xF2,0xF0,0xF6,0x28,0x1F,0x51,0xA1,0xF4,
+    0x1B,0x1F,0x32,0xB1,0xF3,0x1F,0xF1,0x1F,0xF1,0x3F,0xF0,0x20,0xFF,0xFF,0xFB,0x5F,
+    0x53,0x63,0xF4,0x56,0x1F,0x42,0x32,0x61,0xF3,0x14,0x26,0x1F,0x31,0x52,0x51,0xF3,
+    0x15,0x25,0x1F,0x31,0x52,0x51,0xF3,0x16,0x24,0x1F,0x41,0x52,0x32,0xF4,0x25,0x5F,
+    0x44,0x53,0xFF,0xFF,0xF2,0x1F,0xF1,0x1F,0xF1,0x1F,0xF0,0x2F,0xEE,0xF0,0xF3,0xF4,
+    0x1B,0x2F,0x31,0xC1,0xF3,0x1C,0x1F,0x31,0xC1,0xF3,0x1B,0x1F,0xE2,0xFF,0xF0,0x1F,
+    0xF1,0x1F,0xF1,0xCF,0x4E,0xFF,0x12,0xFF,0x11,0xFF,0x11,0xFF,0x11,0xFF,0x11,0xF3,
+    0x1B,0x1F,0x41,0xA1,0xF5,0xEF,0x2E,0xFF,0x11,0xFF,0x11,0xFF,0xF0,0x1F,0xF1,0x1F,
+    0xF1,0x4F,0xD7,0xFA,0x12,0x7F,0x71,0x57,0xFD,0x5F,0xC3,0xFB,0x3F,0x81,0x32,0xFB,
+    0x4F,0xD2,0xFF,0x01,0xD1,0xFF,0x12,0xFF,0x05,0xFC,0x9F,0x81,0x47,0xFE,0x5F,0x31,
+    0x65,0xF5,0x21,0x4F,0xA7,0xFA,0xCF,0x51,0x67,0xFC,0x3F,0x51,0x44,0xF8,0x5F,0xC2,
+    0xFF,0x01,0xFF,0xFD,0x1F,0x31,0xC1,0xF3,0x1B,0x2F,0x33,0x83,0xF3,0x45,0x22,0x1F,
+    0x36,0x22,0xF7,0x12,0x5F,0xE4,0xF8,0x13,0x11,0x43,0x1F,0x31,0x12,0x44,0x11,0xF3,
+    0x28,0x4F,0x31,0xB2,0xF3,0x1C,0x1F,0xF1,0x10,0xFF,0xF0,0x1F,0xF1,0x1F,0x12,0xD3,
+    0xE2,0xD6,0xC1,0xD1,0x25,0xA1,0xD1,0x55,0x61,0xF7,0x9F,0xB3,0xFB,0x3F,0x61,0x43,
+    0xF9,0x5F,0xC2,0xFF,0x01,0xFF,0x11,0xFF,0xFF,0xF2,0x48,0x2F,0x32,0x93,0xF3,0x18,
+    0x5F,0x31,0x74,0x11,0xF3,0x16,0x33,0x1F,0x31,0x44,0x41,0xF3,0x13,0x36,0x1F,0x31,
+    0x14,0x71,0xF3,0x49,0x1F,0x33,0x92,0xF3,0x1A,0x3F,0xC3,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0x01,0xFF,0x11,0xFF,0x01,0x11,0xF4,0xA3,0xB7,0x1F,0x91,0x51,0xFB,
+    0x14,0x1F,0xB1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xFF,0x20,0xFF,0xFF,
+    0x71,0xFB,0x14,0x1F,0xB1,0x51,0xF9,0x17,0xA3,0xBF,0x31,0x11,0xFF,0x01,0xFF,0x11,
+    0xFF,0x52,0xFE,0x2F,0xE1,0xFF,0x11,0xFF,0x11,0xFF,0x21,0xFF,0x12,0xFF,0x21,0xFF,
+    0x21,0xFF,0x21,0xFF,0x11,0xFF,0x11,0xFE,0x2F,0xE2,
+};
+const asset_font_t g_font_3216 = {32, 64, ASSET_RLE, asc2_3216_offs, asc2_3216_pack};
+
+/* ϼ 12160 -> 7285 ֽ */
+
+#endif
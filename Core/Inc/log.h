@@ -0,0 +1,96 @@
+/**
+ ****************************************************************************************************
+ * @file        log.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       USART1 첽־(DMA, λ, ѡƼ¼ʽ)
+ ****************************************************************************************************
+ * @attention
+ *
+ *  LOG_SLOT_NUM , ÿ־ռһ():
+ * 1, д־һ(ѭ/ж) LDREX/STREX ռλ, ú READY, ж;
+ * 2, USART1 TX DMA ˳ READY Ĳ۷ȥ, жͷŲλһ;
+ * 3, ʱֱӶ־(dropped), д־һԶȴ.
+ *
+ * Ƽ¼(LOG_BIN)̶24ֽ, ֻID432λ, κθʽ, ÿε
+ * CPUʱǳ. ¼ʽ(С):
+ *   [0]     LOG_BIN_SYNC(0xA5)
+ *   [1..2]  ¼ID,  log_ids.h
+ *   [3..6]  DWT->CYCCNT ʱ
+ *   [7..22] 432λ
+ *   [23]    [1..22]У
+ *  Tools/log_decode.py , ıͶƼ¼Իͬһ.
+ * //·ֻ LOG_BIN; log_printf Ҫڵ÷ vsnprintf, ֻڱͿ̨.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __LOG_H
+#define __LOG_H
+
+#include "main.h"
+
+
+/******************************************************************************************/
+/* ־ */
+
+#define LOG_SLOT_SIZE       64          /* ÿ۵ֽ(2ֽڲͷ) */
+#define LOG_SLOT_NUM        32          /* , 2 */
+#define LOG_SLOT_PAYLOAD    (LOG_SLOT_SIZE - 2)
+
+#define LOG_BIN_SYNC        0xA5        /* Ƽ¼ֽͬ(ASCII, ı) */
+#define LOG_BIN_SIZE        24          /* Ƽ¼ */
+
+/* LOG_USE_BINARY: 1, LOG_BIN()Ƽ¼, Ҫ Tools/log_decode.py ;
+ *                 0, LOG_BIN()豸˸ʽı, ֱܿ, ÿεõʱʽ仯
+ */
+#ifndef LOG_USE_BINARY
+#define LOG_USE_BINARY      1
+#endif
+
+/******************************************************************************************/
+
+/* ¼ID */
+#define LOG_ID(name, fmt)   LOG_ID_##name,
+typedef enum
+{
+#include "log_ids.h"
+    LOG_ID_NUM
+} log_id_t;
+#undef LOG_ID
+
+/* ־ͳ */
+typedef struct
+{
+    uint32_t written;       /* ɹд뻺־ */
+    uint32_t dropped;       /* ־ */
+    uint32_t truncated;     /* ıһ۱ضϵĴ */
+    uint32_t bytes;         /* ѾDMAֽ */
+    uint32_t peak;          /* ռõˮλ() */
+} log_stats_t;
+
+/* floatλģʽLOG_BIN, ˰%f */
+static inline uint32_t LOG_F2U(float f)
+{
+    union { float f; uint32_t u; } v;
+    v.f = f;
+    return v.u;
+}
+
+#define LOG_BIN(id, a0, a1, a2, a3) \
+    log_record(LOG_ID_##id, (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2), (uint32_t)(a3))
+
+/******************************************************************************************/
+/*  */
+
+void log_init(void);                                        /* ʼ־(MX_USART1_UART_Init֮) */
+void log_putc(char ch);                                     /* лһַ(fputcʹ, ѭ) */
+int log_printf(const char *fmt, ...);                       /* ʽһı־ */
+uint8_t log_write(const uint8_t *buf, uint16_t len);        /* ԭдһ, ֤ڴ */
+void log_record(uint16_t id, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3); /* дһ¼ */
+void log_flush(uint32_t timeout);                           /* ȴ(ms) */
+void log_poll(void);                                        /* DMA(ڱռʱ) */
+void log_get_stats(log_stats_t *stats);                     /* ȡͳƼ */
+void log_report(void);                                      /* ͳƼ */
+
+#endif
@@ -0,0 +1,27 @@
+/**
+ ****************************************************************************************************
+ * @file        log_ids.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ־¼ID
+ *   @note      ÿһ LOG_ID(, "ʽ") һ¼:
+ *              - 豸չΪö LOG_ID_, ģʽֻID432λ
+ *              -  Tools/log_decode.py ֱӽļ, øʽԭı
+ *              һɰ32λ, ʽֻ %d/%u/%x/%X/%c/%%,  %f ʾ
+ *              ò LOG_F2U() ת float λģʽ, ̶ӡ6λС.
+ *              ¼ֻ׷ĩβ, ɵ־ץ޷ٽ.
+ ****************************************************************************************************
+ */
+
+LOG_ID(BOOT,            "boot, SystemCoreClock=%u")
+LOG_ID(LCD_ID,          "LCD ID:%x")
+LOG_ID(AI_INIT_OK,      "AI init success!")
+LOG_ID(AI_CREATE_ERR,   "ai_network_create error - type=%d code=%d")
+LOG_ID(AI_RUN_ERR,      "AI ai_network_run error - type=%d code=%d")
+LOG_ID(AI_RESULT,       "result=%d prob=%f cycles=%u")
+LOG_ID(LOG_STATS,       "log written=%u dropped=%u truncated=%u bytes=%u")
+LOG_ID(BOOT_TIME,       "boot: lcd ready at %u ms, first frame at %u ms")
+LOG_ID(AI_NUMBER,       "number=%u digits=%u min prob=%f cycles=%u")
+LOG_ID(TOUCH_REC,       "touch %x %x %x %x")
+LOG_ID(CFG_LOAD,        "cfg: %u records in %u us, %u bad slots")
+LOG_ID(BOOT_FIRST,      "boot: lcd ready %u us, first frame %u us, first inference %u us, hints %x")
@@ -53,6 +53,7 @@ extern "C" {
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
+void load_draw_dialog(void);
 
 /* USER CODE END EFP */
 
@@ -0,0 +1,94 @@
+/**
+ ****************************************************************************************************
+ * @file        nn_ref.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       дĲοʵ(C, Ӻܱ)
+ ****************************************************************************************************
+ * @attention
+ *
+ * ֱʹ X-CUBE-AI ɵȨ s_network_weights_array_u64, ṹŲ
+ * network.c / network_generate_report.txt һ:
+ *   conv0 3x3 1->16 (28x28, same) -> relu -> maxpool 2x2
+ *   conv3 3x3 16->32 (14x14, same) -> relu -> maxpool 2x2
+ *   conv6 3x3 32->64 (7x7, same) -> relu -> HWCתCHWչƽ(3136)
+ *   dense9 3136->128 (LUT8ѹȨ) -> relu -> dense11 128->10 -> softmax
+ * HWC; Ȩذ [cout][kh][kw][cin]; ȫȨذ [out][in].
+ *
+ * ;: ܺͰһµ, Լÿһ׼.
+ * ϵʽȻ ai_network_run.
+ *
+ * (nn_ref_strip): ͬȨصȫ, 28xW /ػֻһ,
+ * ͼ(7)ÿһ( NN_STRIP_STEP )һ7x7ڽ dense9/dense11,
+ * õÿλõ10,  strip.c ִ.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __NN_REF_H
+#define __NN_REF_H
+
+#include <stdint.h>
+
+
+/******************************************************************************************/
+/* ״ */
+
+#define NN_IN_H             28
+#define NN_IN_W             28
+#define NN_OUT_NUM          10
+#define NN_REF_SCRATCH      53312       /* Ҫʱֽ(X-CUBE-AIͬ) */
+#define NN_STRIP_STEP       4           /* ڴڵļ(), γػͼһ */
+#define NN_STRIP_SCRATCH    38480       /* Ҫʱֽ, ޹ */
+
+/* ,  X-CUBE-AI Ĳһ(network_generate_report.txt) */
+enum
+{
+    NN_L_CONV0 = 0,
+    NN_L_RELU1,
+    NN_L_POOL2,
+    NN_L_CONV3,
+    NN_L_RELU4,
+    NN_L_POOL5,
+    NN_L_CONV6,
+    NN_L_RELU7,
+    NN_L_FLAT8,
+    NN_L_DENSE9,
+    NN_L_RELU10,
+    NN_L_DENSE11,
+    NN_L_SOFTMAX12,
+    NN_LAYER_NUM
+};
+
+/* Ϣ */
+typedef struct
+{
+    const char *name;
+    uint16_t in_num;                /* Ԫ */
+    uint16_t out_num;               /* Ԫ */
+    uint32_t weight_bytes;          /* Ȩ+ƫֽ */
+    uint32_t macc;                  /* ˼Ӵ */
+} nn_layer_info_t;
+
+extern const nn_layer_info_t g_nn_layer[NN_LAYER_NUM];
+
+/******************************************************************************************/
+/*  */
+
+void nn_conv3x3_f32(const float *in, uint16_t h, uint16_t w, uint16_t cin,
+                    const float *wt, const float *bias, uint16_t cout, float *out);     /* 3x3, same */
+void nn_relu_f32(float *x, uint32_t n);                                                 /* relu(ԭ) */
+void nn_maxpool2_f32(const float *in, uint16_t h, uint16_t w, uint16_t c, float *out);  /* 2x2ػ */
+void nn_hwc2chw_f32(const float *in, uint16_t h, uint16_t w, uint16_t c, float *out);   /* HWCתCHW */
+void nn_dense_f32(const float *in, uint16_t nin, const float *wt, const float *bias,
+                  uint16_t nout, float *out);                                           /* ȫ */
+void nn_dense_lut8(const float *in, uint16_t nin, const uint8_t *idx, const float *lut,
+                   const float *bias, uint16_t nout, float *out);                       /* ȫ, LUT8Ȩ */
+void nn_softmax_f32(float *x, uint16_t n);                                              /* softmax(ԭ) */
+void nn_ref_layer(uint8_t layer, const float *in, float *out);                          /* еһ(relu/softmaxԭ) */
+void nn_ref_run(const float *in, float *out, void *scratch);                            /*  */
+uint16_t nn_ref_strip(const uint8_t *in, uint16_t w, const uint8_t *gate,
+                      float (*out)[NN_OUT_NUM], void *scratch);                         /* , ش */
+uint32_t nn_ref_strip_macc(uint16_t w, uint16_t heads);                                 /* ĳ˼Ӵ */
+
+#endif
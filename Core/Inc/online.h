@@ -0,0 +1,77 @@
+/**
+ ****************************************************************************************************
+ * @file        online.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʶ: ֱñʼ(դ), GRU д߸, ̧ʱн
+ ****************************************************************************************************
+ * @attention
+ *
+ *  prep_add һն߶(ʵյͬһ), ÿ ONLINE_STEP ²
+ * һ(ʹɨֵ޹), ÿһ (dx, dy, pen), һʵû:
+ *   дʱ  dx, dy = һλ / ONLINE_STEP(ԼΪλ, ֻз, ܴС),
+ *             pen = 0
+ *   ̧ƶ  dx, dy = һĩ˵һλ / дӿĳ, pen = 1(һ)
+ * ÿһ GRU(ONLINE_UNITS Ԫ), ״̬һֱ; online_result ֻ
+ * ȫӺ softmax(ONLINE_UNITS x 10), ̧ʵҪʱ, õCNN.
+ *
+ * GRU  Keras Ķ(reset_after, ˳ z, r, n, n Ǻѡ״̬):
+ *   z = sigmoid(x Wz + bz + h Uz + bz'), r = sigmoid(x Wr + br + h Ur + br')
+ *   n = tanh(x Wn + bn + r * (h Un + bn')), h = z * h + (1 - z) * n
+ * Ȩذ Keras Ų [][3*Ԫ][Ԫ][3*Ԫ] , ƫ(/ѭ).
+ * ʱ forward_lite_gru_if32of32wf32 Ƕһǰ(״̬һ), ÿ
+ * һ, ﵥԼʵ( nn_ref һǴC), ÿ 3*U*(U+3) γ˼.
+ *  [10][ONLINE_UNITS]  nn_dense_f32 / nn_softmax_f32.
+ *
+ * Ȩ online_data.c,  Host/online_train.c  Host/digit_sim.c ɵıʼѵ
+ * ( stroke.c, Ҳ online_feat , Ͱһ). Host/online_host.c Ƚ
+ * CNN(prep + nn_ref)ʶʺӳ, Ҳ¼Ƶıʼ. (ϳɱʼ, ѵͬ):
+ * дʱ߶ 99.8%~100%; ÿ߶ online_add Լ400(ƽ0.7, ÿԼ560), prep_add Լ170;
+ * ̧ʵ online_result Լ100, CNN(ָ + 28x28 + )Լ44. ϳɱʼֻһд,
+ * ʵд׵ö, ʵʶҪ¼Ƶıʼ; дıʻѵʱӹ, ı˳
+ * (缸ʵȺ)û.
+ *
+ * ֻһ(бʻһ). ONLINE_MODE Ϊ1ʱ main.c 
+ * ָ + CNN;  GRU ڻ涨߶θ, ֻȡ.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __ONLINE_H
+#define __ONLINE_H
+
+#ifdef HOST_SIM
+#include "host_sim.h"
+#else
+#include "main.h"
+#endif
+#include "nn_ref.h"
+
+
+/******************************************************************************************/
+/* ʶ */
+
+#define ONLINE_MODE         0           /* 1: ʶָ + CNN */
+#define ONLINE_IN           3           /* ÿ: dx, dy, pen */
+#define ONLINE_UNITS        32          /* GRU Ԫ(Ҫѵ online_data.c) */
+#define ONLINE_GATES        (3 * ONLINE_UNITS)
+#define ONLINE_STEP         10          /* ²Ļ() */
+#define ONLINE_FEAT_MAX     64          /* һ߶(ԽԼ550) */
+
+/* Ȩ(online_data.c) */
+extern const float g_online_kernel[ONLINE_IN * ONLINE_GATES];       /* [][z r n] */
+extern const float g_online_recurrent[ONLINE_UNITS * ONLINE_GATES]; /* [Ԫ][z r n] */
+extern const float g_online_bias[2 * ONLINE_GATES];                 /* , ѭ */
+extern const float g_online_dense[NN_OUT_NUM * ONLINE_UNITS];       /* [][Ԫ] */
+extern const float g_online_dense_bias[NN_OUT_NUM];
+
+/******************************************************************************************/
+/*  */
+
+void online_clear(void);                                                /* ʼ GRU ״̬ */
+void online_add(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);    /* һζ߶(ͬ prep_add) */
+uint16_t online_feat(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, float (*f)[ONLINE_IN]);    /* ֻ, ظ */
+void online_step(const float *f);                                       /* GRU һ */
+uint16_t online_result(float *prob);                                    /* ǰ10, ߵĲ */
+
+#endif
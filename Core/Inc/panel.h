@@ -0,0 +1,68 @@
+/**
+ ****************************************************************************************************
+ * @file        panel.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʶ: ʽ, ֻػ˵ַ
+ ****************************************************************************************************
+ * @attention
+ *
+ * ǻ1132: 10 "  ", 1 "current number is x"(λʱ).
+ * PANEL_PROB_TEXT Ϊ0ʱʲʾ,  bar.c ڱǩұ߻ͼ.
+ * ÿһıֶ, ʽֱдֶεַ(sprintf, printf).
+ * panel_field_commit() ϴύַȽ, ֻѱ˵ַǼΪ,
+ *  dirty_flush() ϳˢ( dirty.c һͼ).
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __PANEL_H
+#define __PANEL_H
+
+#ifdef HOST_SIM
+#include "host_sim.h"
+#else
+#include "main.h"
+#endif
+
+
+/******************************************************************************************/
+/*  */
+
+#define PANEL_X             72          /* Ͻ, 뻭߶ */
+#define PANEL_Y             (72 + 336)  /*  */
+#define PANEL_SIZE          32          /* С */
+#define PANEL_PROB_NUM      10          /*  */
+#define PANEL_FIELD_NUM     (PANEL_PROB_NUM + 1)
+#define PANEL_TEXT_MAX      24          /* ֶַ */
+#define PANEL_THRESHOLD     0.5f        /* ʵʾ none(λʱһλʾ '?') */
+#define PANEL_NUM_MAX       6           /* ʾλ("current number is " ʣµַ) */
+#define PANEL_PROB_TEXT     0           /* 1, ʾΪ; 0, ֻʾֱǩ, ͼ(bar.c) */
+
+/* һıֶ */
+typedef struct
+{
+    uint16_t x;
+    uint16_t y;
+    uint8_t size;                       /* С */
+    uint8_t len;                        /* ַ */
+    uint16_t color;
+    char text[PANEL_TEXT_MAX];          /* Ҫʾ */
+    char shown[PANEL_TEXT_MAX];         /* ύ, ͼ㰴ϳ */
+} panel_field_t;
+
+/******************************************************************************************/
+/*  */
+
+uint8_t fmt_uint(char *buf, uint32_t v, uint8_t width);                 /* ޷, Ҷ */
+uint8_t fmt_fixed(char *buf, float v, uint8_t width, uint8_t decimals); /* С, Ҷ */
+uint8_t fmt_pct(char *buf, float p, uint8_t width, uint8_t decimals);   /* ٷ(p=1Ϊ100%), Ҷ */
+
+void panel_field_init(panel_field_t *f, uint16_t x, uint16_t y, uint8_t size, uint8_t len, uint16_t color);
+void panel_field_set(panel_field_t *f, uint8_t pos, const char *s);     /* posʼдַ */
+uint8_t panel_field_commit(panel_field_t *f);                           /* ύǼǱ˵ַ, ر˵ַ */
+
+void panel_init(void);                                                  /* ʼ(dirty_init֮) */
+uint8_t panel_update(const float *prob, const uint8_t *num, const float *conf, uint8_t count);  /* ύһʶ, ر˵ַ */
+
+#endif
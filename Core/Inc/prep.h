@@ -0,0 +1,63 @@
+/**
+ ****************************************************************************************************
+ * @file        prep.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       Ԥ: MNISTѻϵıʻ28x28
+ ****************************************************************************************************
+ * @attention
+ *
+ * MNIST ǿݵĻҶͼ, ӿȱŵ 20x20 , ٰƽƵ 28x28 .
+ * ԭ尴 /12 ֱӳ䵽 28x28 д 1, ʻϸо, дС˻дƫϲ.
+ *
+ * ʱ: ÿζıʻ(뾶 PREP_RADIUS Ľ)ĵ߶εľ㸲(0~255),
+ *         Ե PREP_CELL һȦԹ(), ͸ԭֵȡ.  PREP_NW x PREP_NH,
+ *         һ PREP_CELL (Ҫ 140KB, RAM Ų), ͬʱάӿ,
+ *         ÿиǵĸӽ seg_add ͨ(seg.h).
+ * ʱ: prep_segment īֳɴҵļ, prep_run һȡӿ(ֻȡī),
+ *         ߰ƽŵ PREP_FIT(Q16Դ, һά),
+ *         (CMSIS  SIMD ָ __USADA8/__UXTB16/__SMLAD һδ4)ƽƵ, ת.
+ * ԭ 336x336 , дλ; ֻдһʱԭһ.
+ * (strip.h ): prep_strip ָ, ӿ򰴸߶ŵ PREP_FIT(ͬһ),
+ *         Ҹ PREP_STRIP_PAD Ŀհ, ľ, õ 28xW ĻҶ.
+ * ͸ʶ, ֻתFPU.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __PREP_H
+#define __PREP_H
+
+#ifdef HOST_SIM
+#include "host_sim.h"
+#else
+#include "main.h"
+#endif
+
+
+/******************************************************************************************/
+/* Ԥ */
+
+#define PREP_X0             24          /* Ͻ(main.c ߿մ) */
+#define PREP_Y0             72
+#define PREP_W              432         /* (), 480Ҹ24 */
+#define PREP_H              336         /* ߶() */
+#define PREP_CELL           4           /* һ */
+#define PREP_NW             (PREP_W / PREP_CELL)
+#define PREP_NH             (PREP_H / PREP_CELL)
+#define PREP_RADIUS         10          /* ʻ뾶(, 뻭ͬ) */
+#define PREP_FIT            20          /* ӿ򳤱ŵĵ */
+#define PREP_OUT            28          /* ߳ */
+#define PREP_STRIP_PAD      12          /* Ŀհ(), ôܶ׼ϵ */
+
+/******************************************************************************************/
+/*  */
+
+void prep_clear(void);                                                  /*  */
+void prep_add(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);      /* һαʻ(Ļ) */
+uint8_t prep_segment(void);                                             /* ָ, () */
+void prep_run(uint8_t s, float *out);                                   /* ɵsֵ28x28(0~1) */
+const uint8_t *prep_image(void);                                        /* ϴ prep_run 28x28Ҷ(Ԥ) */
+uint16_t prep_strip(uint8_t *out, uint16_t wmax);                       /* 28xWҶ, W(4ı) */
+
+#endif
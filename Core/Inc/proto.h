@@ -0,0 +1,100 @@
+/**
+ ****************************************************************************************************
+ * @file        proto.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       USART1 Э(ѭDMA + ж + ӲCRC)
+ ****************************************************************************************************
+ * @attention
+ *
+ * ֡ʽ(ֶֽξΪС):
+ *   [0..1]  PROTO_SOF0 PROTO_SOF1 (0xAA 0x55)
+ *   [2]      type
+ *   [3]      seq, Ӧ֡ԭ
+ *   [4..5]  س len,  PROTO_MAX_PAYLOAD
+ *   [6..]   
+ *   [..+4]  CRC32,  type/seq/len/
+ * CRCʹSTM32CRC: ʽ0x04C11DB7, ֵ0xFFFFFFFF, ת, , ݰС
+ * 32λ, 4ֽڵβ0. ʵּ Tools/proto_common.py.
+ *
+ * 豸໺ PROTO_FRAME_NUM ֡, ԲӦô֡: 豸ǰ֡
+ * ͬʱDMAպ֡. ʱ֡ PROTO_E_BUSY.
+ * ֡ASCIIֽڽ proto_text_rx(), ıͶ֡ԹUSART1.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __PROTO_H
+#define __PROTO_H
+
+#include "main.h"
+
+
+/******************************************************************************************/
+/* Э */
+
+#define PROTO_SOF0          0xAA
+#define PROTO_SOF1          0x55
+#define PROTO_HDR_SIZE      4           /* type + seq + len */
+#define PROTO_MAX_PAYLOAD   784         /* 28*28 Ҷͼ */
+#define PROTO_FRAME_NUM     4           /* ;֡, 2 */
+#define PROTO_RX_DMA_SIZE   1024        /* ѭDMAջС */
+#define PROTO_RX_TIMEOUT    50          /* ֽ֡ڼ50msΪ֡, ͬ */
+#define PROTO_VERSION       1
+
+/* ֡, Ӧ֡Ϊ | PROTO_T_ACK */
+#define PROTO_T_PING        0x01        /* , Ӧ proto_ping_t */
+#define PROTO_T_INFER       0x02        /* Ϊ784ֽڻҶͼ(0~255, ), Ӧ proto_result_t */
+#define PROTO_T_TRACE       0x03        /* Ϊ2ֽƫ + һδ켣(tprec.h), ƫ0¿ʼ, Ӧ4ֽճ */
+#define PROTO_T_ACK         0x80
+#define PROTO_T_ERR         0xFF        /* 1ֽڴ */
+
+/*  */
+#define PROTO_E_CRC         1           /* CRC */
+#define PROTO_E_LEN         2           /* ȳ޻Ͳ */
+#define PROTO_E_BUSY        3           /* ֡ */
+#define PROTO_E_TYPE        4           /* δ֪ */
+
+/******************************************************************************************/
+
+/* PINGӦ */
+typedef struct
+{
+    uint8_t version;                    /* PROTO_VERSION */
+    uint8_t frame_num;                  /* PROTO_FRAME_NUM */
+    uint16_t max_payload;               /* PROTO_MAX_PAYLOAD */
+    uint32_t clock;                     /* SystemCoreClock */
+} proto_ping_t;
+
+/* INFERӦ */
+typedef struct
+{
+    uint8_t result;                     /*  */
+    uint8_t reserved[3];
+    uint32_t cycles;                    /* ai_network_run ʱ */
+    float prob[10];                     /* softmax */
+} proto_result_t;
+
+/* ͳ */
+typedef struct
+{
+    uint32_t frames;                    /* յ֡ */
+    uint32_t crc_err;                   /* CRC */
+    uint32_t len_err;                   /* ȴ */
+    uint32_t busy;                      /*  */
+    uint32_t resync;                    /* ֡жϺͬ */
+    uint32_t uart_err;                  /* ڴ(//֡) */
+} proto_stats_t;
+
+/* : 784float, 10float, ʱ */
+typedef uint32_t (*proto_infer_t)(const float *in, float *out);
+
+/******************************************************************************************/
+/*  */
+
+void proto_init(proto_infer_t infer);           /* ѭDMA(log_init֮) */
+uint8_t proto_poll(void);                       /* յ֡, ѭ, 1ʾһ֡ */
+void proto_get_stats(proto_stats_t *stats);     /* ȡͳƼ */
+void proto_text_rx(uint8_t ch);                 /* ֽ֡(, ж) */
+
+#endif
@@ -0,0 +1,107 @@
+/**
+ ****************************************************************************************************
+ * @file        sched.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ȼȵϢ(///ʾ/־)
+ ****************************************************************************************************
+ * @attention
+ *
+ * ÿȼһ, 0. еĺ, ûжջ:
+ *   ȼ <  SCHED_PRIO_THREAD PendSV(жȼ), ռѭ;
+ *   ȼ >= SCHED_PRIO_THREAD ѭ sched_run() ȼ(Эʽ).
+ *  sched_release()(жҲԵ)ϢյϢͷ.
+ *
+ * ͳÿͷŵʼӳ١ͷŵӦʱ䡢ֹʱĴ,
+ * Լѭʱ,  sched_poll() .
+ *
+ *  HOST_SIM Linuxϱ, PendSVģṩ( Host/sched_sim.c).
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __SCHED_H
+#define __SCHED_H
+
+#ifdef HOST_SIM
+#include "host_sim.h"
+#define sched_now()         host_cycles()
+void sched_port_pend(void);             /* "PendSV", ģʵ */
+void sched_port_idle(void);             /* ʱһ, ģʵ */
+#else
+#include "main.h"
+#define sched_now()         (DWT->CYCCNT)   /* DWTlog_initʹ */
+#define sched_port_pend()   (SCB->ICSR = SCB_ICSR_PENDSVSET_Msk)
+#define sched_port_idle()   __NOP()     /* WFI: ˯ʱCYCCNTֹͣ, ʱ */
+#endif
+
+
+/******************************************************************************************/
+/*  */
+
+#define SCHED_TASK_NUM      8           /* ȼ() */
+#define SCHED_PRIO_THREAD   2           /* СȼPendSV */
+#define SCHED_REPORT_MS     10000       /* sched_poll ļ, 0ʾֶֻ */
+
+/* sched_create  flags */
+#define SCHED_EXT           0x01        /* ⲿ(ʱж)ͷ, period ֻͳڶ */
+
+typedef void (*sched_fn_t)(void *arg);
+
+/*  */
+typedef struct
+{
+    const char *name;
+    sched_fn_t fn;
+    void *arg;
+    uint16_t period;                    /* (ms), 0ʾֻ¼ͷ */
+    uint8_t flags;
+    uint8_t reserved;
+    uint32_t deadline;                  /* ֹʱ(), 0ʾ */
+    uint32_t next;                      /* һͷŵʱ(ms) */
+    volatile uint32_t release;          /* һͷŵʱ() */
+    uint32_t last_start;                /* һοʼеʱ() */
+
+    /* ͳ, ÿα */
+    uint32_t runs;                      /* д */
+    volatile uint32_t lost;             /* ûֱͷŵĴ */
+    uint32_t misses;                    /* ֹʱĴ */
+    uint32_t max_lat;                   /* ͷŵʼ() */
+    uint32_t max_resp;                  /* ͷŵ() */
+    uint32_t max_jitter;                /* οʼ֮() */
+    uint64_t busy;                      /* ʱ(, ռʱ) */
+} sched_task_t;
+
+/* Ϣ, ߵ, ߿ж */
+typedef struct
+{
+    uint8_t *buf;
+    uint16_t size;                      /* Ϣֽ */
+    uint16_t num;                       /* Ϣ, 2 */
+    volatile uint16_t wr;
+    volatile uint16_t rd;
+    uint8_t task;                       /* յϢʱͷŵ, 0xFFʾͷ */
+    uint32_t drops;                     /* Ϣ */
+} sched_queue_t;
+
+/******************************************************************************************/
+/*  */
+
+void sched_init(void);                                                  /* ʼ */
+uint8_t sched_create(uint8_t prio, const char *name, sched_fn_t fn, void *arg,
+                     uint16_t period_ms, uint32_t deadline_us, uint8_t flags); /*  */
+void sched_release(uint8_t prio);                                       /* ͷ(жҲԵ) */
+void sched_isr(void);                                                   /* пռ, PendSV_Handler */
+void sched_run(void);                                                   /* һЭ߿һ, ѭ */
+void sched_lock(void);                                                  /* ͣPendSV(LCD) */
+void sched_unlock(void);                                                /* ָ */
+const sched_task_t *sched_get(uint8_t prio);                            /* ȡͳ */
+
+void sched_queue_init(sched_queue_t *q, void *buf, uint16_t size, uint16_t num, uint8_t task); /* ʼ */
+uint8_t sched_queue_put(sched_queue_t *q, const void *msg);             /* Ϣ */
+uint8_t sched_queue_get(sched_queue_t *q, void *msg);                   /* Ϣ */
+
+void sched_poll(void);                                                  /* ʱ */
+void sched_report(void);                                                /* 沢ͳ */
+
+#endif
@@ -0,0 +1,57 @@
+/**
+ ****************************************************************************************************
+ * @file        seg.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       λָ: γ + 鼯ͨ
+ ****************************************************************************************************
+ * @attention
+ *
+ * īԤĸ(prep.h, һ PREP_CELL )ǳÿеγ(һīĸ),
+ * ÿһx. prep_add ÿһ, ǵÿһеһ seg_add:
+ *   ͬһγӵγ̺ϲһ, ٺ(б)γڲ鼯ϲ.
+ * Աűʻɵ, ֻīй, ͻ޹.
+ *
+ * ǰ seg_run ͨ(鼯ĸ): , صխһ
+ * SEG_OVERLAP% ͬһ("5"ĺ°벿û), Сͨ()
+ * ,  SEG_MAX ʱѼСϲ. ÿγ̼Լڵڼ,
+ * seg_mask ȡһĳһе, ӿī.
+ *
+ * γ̳(SEG_SPAN_MAX)Ժٷָ, seg_run 0, seg_mask ȫ1, ɵߵһ.
+ * ʱ seg_clear һ.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __SEG_H
+#define __SEG_H
+
+#include "prep.h"
+
+
+/******************************************************************************************/
+/* ָ */
+
+#define SEG_ROWS            PREP_NH     /* () */
+#define SEG_SPAN_MAX        512         /* γ̳شС, һԼ100 */
+#define SEG_COMP_MAX        16          /* ദͨ, Ĳһ */
+#define SEG_MAX             6           /* ֳ */
+#define SEG_OVERLAP         50          /* صխһĿȵٷֱ, ͬһ */
+#define SEG_MIN_SIZE        8           /* ӿ򳤱Сͨ򲢵(ʵԼ6) */
+
+/* һֵӿ() */
+typedef struct
+{
+    uint8_t x0, y0;
+    uint8_t x1, y1;
+} seg_box_t;
+
+/******************************************************************************************/
+/*  */
+
+void seg_clear(void);                                                   /*  */
+void seg_add(uint8_t row, uint8_t x0, uint8_t x1);                      /* һī: rowе [x0, x1]  */
+uint8_t seg_run(seg_box_t *box, uint8_t max);                           /* ָ, () */
+void seg_mask(uint8_t s, uint8_t row, uint8_t x0, uint8_t w, uint8_t *mask);   /* sһ [x0, x0+w) (0/0xFF) */
+
+#endif
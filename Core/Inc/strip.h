@@ -0,0 +1,78 @@
+/**
+ ****************************************************************************************************
+ * @file        strip.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʶ: һ 28xW , (ȫ)ʶλ, ÷ָ
+ ****************************************************************************************************
+ * @attention
+ *
+ * prep_strip ѻϵī߶ų 28xW , nn_ref_strip ϰ/ػ
+ * ֻһ, ÿ NN_STRIP_STEP(4) һڽȫ, õÿλõ10.
+ * (, Ҫѵ):
+ *   : ÿīֱͶӰ, īһ;  STRIP_SPLIT Ķһ
+ *           ,  STRIP_PITCH Ƹ, ھֵ㸽Ĺȵп; ÿȡī.
+ *           ֻī֮䶼ͬһ, ԿϵĴҲа,
+ *           λò.
+ *   : (4)ĸʰֵ, һ.
+ * ֻī, ȫ֮ǰ, strip_run  gated=1 ʱֻõõĴȫ
+ * (ÿ1~2), ÿڶʱȫһ.
+ *
+ * (˼): ְ, ÿ4Լ28; ȫÿԼ40;
+ * һ28x28ڵԼ236. strip_result_t.macc ε.
+ * (Host/strip_host.c)ÿ: ָ 236, ÿ4صһԼ1120,
+ * ÿڶԼ380, ֻõõĴԼ258; ʶʱȷָͼٷֵ
+ * (ڱܿھ, ǰܿհ׵ĵѵ).
+ *
+ * STRIP_MODE Ϊ1ʱ main.c ʶָ( X-CUBE-AI,  nn_ref ĸʵ),
+ * ʱ X-CUBE-AI ļ(ͬһ, ͬʱ).
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __STRIP_H
+#define __STRIP_H
+
+#include "prep.h"
+#include "seg.h"
+#include "nn_ref.h"
+
+
+/******************************************************************************************/
+/* ʶ */
+
+#define STRIP_MODE          0           /* 1, main.c ʶָ() */
+#define STRIP_W_MAX         192         /* (, 4ı) */
+#define STRIP_POS_MAX       (STRIP_W_MAX / NN_STRIP_STEP - 6)   /* Ĵ */
+#define STRIP_INK           255         /* һеī(ҶȺ)ī */
+#define STRIP_MIN           10          /* īһεİٷ֮Ķζ(ǵĵ) */
+#define STRIP_SPLIT         28          /* һο()һļ */
+#define STRIP_PITCH         14          /* һʱÿִԼĿ() */
+#define STRIP_VALLEY        6           /* ھֵ߼ҹȵп */
+
+/* ʱ: nn_ref_strip õ, ÿڵĸ, Ҷ, ſ */
+#define STRIP_SCRATCH       (NN_STRIP_SCRATCH + STRIP_POS_MAX * (NN_OUT_NUM * 4 + 1) + PREP_OUT * STRIP_W_MAX)
+
+/* һʶĽ */
+typedef struct
+{
+    uint16_t w;                         /* () */
+    uint16_t pos;                       /*  */
+    uint16_t heads;                     /* ȫӵĴ */
+    uint8_t count;                      /* ʶ */
+    uint8_t num[SEG_MAX];               /* ҵ */
+    uint8_t at[SEG_MAX];                /* ÿֵ(ϵ) */
+    float conf[SEG_MAX];                /* ÿֵĸ */
+    float prob[NN_OUT_NUM];             /* ұһֵ10 */
+    uint32_t macc;                      /* εĳ˼Ӵ */
+} strip_result_t;
+
+/******************************************************************************************/
+/*  */
+
+uint8_t *strip_image(void *scratch);                                    /* Ҷʱλ( prep_strip д) */
+const float *strip_prob(void *scratch, uint16_t k);                     /* kڵĸ */
+uint8_t strip_run(void *scratch, uint16_t w, uint8_t gated, strip_result_t *r);    /* ʶ,  */
+void strip_decode(void *scratch, strip_result_t *r);                    /*  strip_prob ĸ½ */
+
+#endif
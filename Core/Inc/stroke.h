@@ -0,0 +1,70 @@
+/**
+ ****************************************************************************************************
+ * @file        stroke.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʻ: 1-euro ˲, Ԥʼ, Catmull-Rom ֵ
+ ****************************************************************************************************
+ * @attention
+ *
+ * ÿһ stroke_t. ʱ(us)ͽ,  1-euro Ӧͨ(ʱֹƵʵ, ѹ;
+ * ʱֹƵʸ, β), ͬʱõ˲ٶ.
+ *
+ * : Catmull-Rom Ҫõ߶κһ, ²ʱŶǰһ(p1 -> p2),
+ * ҳС STROKE_CURVE_MIN ʱö(Q4, t Q8)ֵ STROKE_CURVE_MAX ,
+ * ٱʻһֱ. ĵ㻭, Ҳդ28x28.
+ *
+ * Ԥ: ûһ(ĩ -> ˲)Ͱٶ STROKE_PREDICT_MS ıʼʱ,
+ * һʱػ(ʵ), ̧ʱȫ. ƻƫ켣,
+ * ԰εļн, չ90Ȳ; ʹʼƫ켣ǱȲԤһ, ӻξͰ
+ * STROKE_PREDICT_MS 0.
+ *
+ * ˲ø(F407FPU), , ͻ/դһ.
+ *  HOST_SIM ʱLinuxϱ, Host/stroke_host.c ¼ƵĹ켣ӳٺͶ.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __STROKE_H
+#define __STROKE_H
+
+#ifdef HOST_SIM
+#include "host_sim.h"
+#else
+#include "main.h"
+#endif
+
+
+/******************************************************************************************/
+/* ʻ */
+
+#define STROKE_MIN_CUTOFF   1.0f        /* 1-euro: ֹʱĽֹƵ(Hz) */
+#define STROKE_BETA         0.08f       /* 1-euro: ֹƵٶ(/)ӵϵ */
+#define STROKE_D_CUTOFF     8.0f        /* 1-euro: ٶȵĽֹƵ(Hz) */
+#define STROKE_PREDICT_MS   20          /* ʼʱ, 0ʾԤ */
+#define STROKE_PREDICT_MAX  20          /* ƾ() */
+#define STROKE_PREDICT_VMIN 150         /* ٶ(/, ȡx/yϴ)ʱ */
+#define STROKE_CURVE_MIN    12          /* ҳ(, ȡx/yϴ)Сʱֵ */
+#define STROKE_CURVE_STEP   6           /* ֵÿεҳ() */
+#define STROKE_CURVE_MAX    8           /* һֵɼ */
+
+/* һıʻ */
+typedef struct
+{
+    float x, y;                         /* ˲λ() */
+    float vx, vy;                       /* ˲ٶ(/) */
+    uint16_t rx, ry;                    /* һ */
+    int32_t p[4][2];                    /* 4˲(Q4), p[3] */
+    uint8_t n;                          /* p Чĵ(4) */
+} stroke_t;
+
+/******************************************************************************************/
+/*  */
+
+void stroke_begin(stroke_t *s, uint16_t x, uint16_t y);                 /* : һ */
+uint8_t stroke_add(stroke_t *s, uint16_t x, uint16_t y, uint32_t dt_us, uint16_t out[][2]);    /* һ, ضĵ */
+uint8_t stroke_end(stroke_t *s, uint16_t out[][2]);                     /* ̧: ʣµһ */
+void stroke_last(const stroke_t *s, uint16_t *x, uint16_t *y);          /* µ˲ */
+void stroke_predict(const stroke_t *s, uint16_t ms, uint16_t *x, uint16_t *y);  /*  ms ıʼ */
+
+#endif
@@ -2,8 +2,8 @@
  ****************************************************************************************************
  * @file        touch.h
  * @author      ԭŶ(ALIENTEK)
- * @version     V1.1
- * @date        2023-05-29
+ * @version     V1.2
+ * @date        2026-10-18
  * @brief        
  *   @note      ֵ֧/ʽ
  *              ֧ADS7843/7846/UH7843/7846/XPT2046/TSC2046/GT9147/GT9271/FT5206/GT1151ȣ
@@ -24,6 +24,10 @@
  * V1.1 20230529
  * 1ST7796 3.5 GT1151֧
  * 2ILI9806 4.3 GT1151֧
+ * V1.2 20261018
+ * 1X, YһƬѡｻ(16ʱһת), ѡӲSPI(TP_HW_SPI)
+ * 2ðΪ޷֧βƽ
+ * 3 tp_set_hint/tp_get_ctrl: ϴμ⵽ĴIC(cfg.h  CFG_LCD ¼)
  ****************************************************************************************************
  */
 
@@ -79,11 +83,39 @@
                           HAL_GPIO_WritePin(T_CS_GPIO_PORT, T_CS_GPIO_PIN, GPIO_PIN_RESET); \
                       }while(0)     /* T_CS */
 
+/* ӲSPI(ѡ). T_CLK(PB0)/T_MOSI(PF11)/T_MISO(PB2)ûSPIù, ǰҪ
+ * ɵSPI2: SCK PB13, MISO PB14, MOSI PB15(AF5), T_CS/T_PEN; Ҫ stm32f4xx_hal_conf.h
+ *  HAL_SPI_MODULE_ENABLED  stm32f4xx_hal_spi.c ӽ.
+ * APB1 42MHz / 32 = 1.31MHz, XPT2046  2.5MHz(DCLK), 125kHz .
+ * һ˲ֻ21ֽ(Լ130us), Ҫ, 䲻DMA.
+ */
+#define TP_HW_SPI                       0           /* 1, SPI2; 0, SPI */
+
+#if TP_HW_SPI
+#define TP_SPI                          SPI2
+#define TP_SPI_CLK_ENABLE()             do{ __HAL_RCC_SPI2_CLK_ENABLE(); }while(0)
+#define TP_SPI_PRESCALER                SPI_BAUDRATEPRESCALER_32
+#define TP_SPI_GPIO_PORT                GPIOB
+#define TP_SPI_GPIO_CLK_ENABLE()        do{ __HAL_RCC_GPIOB_CLK_ENABLE(); }while(0)
+#define TP_SPI_SCK_GPIO_PIN             GPIO_PIN_13
+#define TP_SPI_MISO_GPIO_PIN            GPIO_PIN_14
+#define TP_SPI_MOSI_GPIO_PIN            GPIO_PIN_15
+#define TP_SPI_GPIO_AF                  GPIO_AF5_SPI2
+
+extern SPI_HandleTypeDef g_tp_spi_handle;
+#endif
+
 
 #define TP_PRES_DOWN    0x8000  /*  */
 #define TP_CATH_PRES    0x4000  /* а */
 #define CT_MAX_TOUCH    10      /* ֵ֧ĵ,̶Ϊ5 */
 
+/* IC( cfg.h  CFG_LCD ¼) */
+#define TP_CTRL_RES     0       /*  */
+#define TP_CTRL_GT      1       /* GT9xxx */
+#define TP_CTRL_FT      2       /* FT5206 */
+#define TP_CTRL_NONE    0xFF    /* ֪(ûм¼) */
+
 /*  */
 typedef struct
 {
@@ -123,15 +155,16 @@ extern _m_tp_dev tp_dev;        /* 
 
 /*  */
 
-static void tp_write_byte(uint8_t data);                /* оƬдһ */
-static uint16_t tp_read_ad(uint8_t cmd);                /* ȡADתֵ */
-static uint16_t tp_read_xoy(uint8_t cmd);               /* ˲ȡ(X/Y) */
-static void tp_read_xy(uint16_t *x, uint16_t *y);       /* ˫ȡ(X+Y) */
-static uint8_t tp_read_xy2(uint16_t *x, uint16_t *y);   /* ǿ˲˫ȡ */
+static void tp_xfer(const uint8_t *tx, uint8_t *rx, uint8_t len);  /* ѡпоƬ, lenֽ */
+static uint16_t tp_trim_mean(int32_t *v);               /* βƽ */
+static void tp_read_xy(uint16_t *x, uint16_t *y);       /* ˫(X+Y) */
+uint8_t tp_read_xy2(uint16_t *x, uint16_t *y);          /* ǿ˲˫ȡ */
 static void tp_draw_touch_point(uint16_t x, uint16_t y, uint16_t color);    /* һУ׼ */
 static void tp_adjust_info_show(uint16_t xy[5][2], double px, double py);   /* ʾУ׼Ϣ */
 
 uint8_t tp_init(void);                 /* ʼ */
+void tp_set_hint(uint8_t ctrl);        /* tp_init ԵĴIC(TP_CTRL_xx) */
+uint8_t tp_get_ctrl(void);             /* ⵽ĴIC(TP_CTRL_xx) */
 static uint8_t tp_scan(uint8_t mode);  /* ɨ */
 void tp_adjust(void);                  /* У׼ */
 void tp_save_adjust_data(void);        /* У׼ */
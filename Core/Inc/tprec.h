@@ -0,0 +1,95 @@
+/**
+ ****************************************************************************************************
+ * @file        tprec.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       켣¼/ط: յĶƹ켣ʽ, ¼(), طŴ tp_dev.scan
+ ****************************************************************************************************
+ * @attention
+ *
+ * 켣ļ(.tpr, С):
+ *   ͷ TPREC_HDR_SIZE ֽ: 'T' 'P' 'R' 汾, LCD, LCD(2ֽ, ¼ʱ lcddev )
+ *   ֡: dt(2ֽ, һ֡, λ TPREC_DT_US,  0xFFFF ض), mask(1ֽ, bit0~4 µĴ),
+ *       ȻÿµĴ3ֽ: x 8λ, x 4λ | y 4λ << 4, y 8λ(12λ)
+ *   mask Ϊ0֡ȫɿ. дÿ֡6ֽ, 100Hz д10Լ6KB.
+ * ֡ touch_task ÿ tp_dev.scan(0) ֮󿴵 tp_dev.sta/x/y(ֻǰ TPREC_PT_MAX ),
+ * ֻ¼д㰴µɨͰ֮ĵһȫɿ, ûдɨ費¼.
+ *
+ * ¼(̨ "tp rec", "tp stop"): ÿ֡һ24ֽ LOG_BIN ʽļ¼(ID TOUCH_REC,
+ * ʱ DWT->CYCCNT),  log_write ֱд־,  LOG_USE_BINARY ޹.
+ * 16ֽ: [0] mask | (3λ) << 5, [1..15] 53ֽ. 
+ *   python3 Tools/log_decode.py /dev/ttyUSB0 --touch out.tpr
+ * Ѽ¼ԭ .tpr, Ų˵־֡(log_decode ʾ).
+ * CYCCNT 25.6һ, ֡ʱʱ dt (ֻӰеʱ).
+ *
+ * ط(Tools/proto_client.py --replay x.tpr): PROTO_T_TRACE ֡ѹ켣 TPREC_BUF_SIZE Ļ,
+ * Ȼ̨ "tp play":  trace ͳ, tp_dev.scan  tprec_scan, 켣ʱÿɨһ֡,
+ * Ĵ///ʾ·, ָ tp_dev.scan  trace (˵ӳ).
+ * ÿɨһ֡, ɨ(TIM2 20ms)¼ʱĲʱ˳ƺ( late),
+ * ʻĵ㲻ᶪ, ֻʱ.
+ *
+ * /뺯Ӳ,  HOST_SIM ʱLinuxϱ: Host/replay_host.c ͬ
+ * 켣  -> /դ ->  -> ʾ, ظӳ/±.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __TPREC_H
+#define __TPREC_H
+
+#ifdef HOST_SIM
+#include "host_sim.h"
+#else
+#include "main.h"
+#endif
+
+
+/******************************************************************************************/
+/* 켣 */
+
+#define TPREC_VERSION       1
+#define TPREC_HDR_SIZE      8           /* 'T' 'P' 'R' 汾   */
+#define TPREC_PT_MAX        5           /* ¼ƵĴ(touch_task ֻǰ5) */
+#define TPREC_FRAME_MAX     (3 + 3 * TPREC_PT_MAX)  /* һ֡ֽ */
+#define TPREC_DT_US         100         /* dt ĵλ(us), 2ֽ6.5 */
+#define TPREC_BUF_SIZE      4096        /* ϻطŻ(ֽ), Լ680֡ */
+
+/* һ֡ */
+typedef struct
+{
+    uint32_t t;                         /* 켣ʼʱ(us) */
+    uint8_t mask;                       /* bit0~4: µĴ */
+    uint8_t reserved[3];
+    uint16_t x[TPREC_PT_MAX];           /* µĴ, ûµΪ0 */
+    uint16_t y[TPREC_PT_MAX];
+} tprec_frame_t;
+
+/* ״̬ */
+typedef struct
+{
+    const uint8_t *buf;
+    uint32_t len;
+    uint32_t pos;                       /* һ֡λ */
+    uint32_t t;                         /* һ֡ʱ(us) */
+} tprec_reader_t;
+
+/******************************************************************************************/
+/*  */
+
+uint8_t tprec_header(uint8_t *buf, uint16_t w, uint16_t h);                 /* дļͷ, ֽ */
+uint8_t tprec_encode(uint8_t *buf, uint32_t dt, const tprec_frame_t *f);    /* һ֡(dt: us), ֽ */
+uint8_t tprec_open(tprec_reader_t *r, const uint8_t *buf, uint32_t len, uint16_t *w, uint16_t *h);  /* ļͷ */
+uint8_t tprec_next(tprec_reader_t *r, tprec_frame_t *f);                    /* һ֡, 0ɹ */
+
+#ifndef HOST_SIM
+void tprec_record(uint8_t on);                                              /* ʼ/ֹͣ¼ */
+void tprec_sample(void);                                                    /* ɨ: ¼ tp_dev ״̬ */
+uint8_t tprec_load(uint16_t off, const uint8_t *data, uint16_t len);        /* дطŻ(offΪ0ʱ¿ʼ) */
+uint32_t tprec_size(void);                                                  /* طŻֽ */
+uint8_t tprec_play(void);                                                   /* ʼط, 0ɹ */
+uint8_t tprec_playing(void);                                                /* 1, ڻط */
+void tprec_poll(void);                                                      /* (־) */
+void tprec_report(void);                                                    /* ¼/ط״̬ */
+#endif
+
+#endif
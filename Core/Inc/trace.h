@@ -0,0 +1,112 @@
+/**
+ ****************************************************************************************************
+ * @file        trace.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʶķֽ׶κʱ(DWTڼ)
+ ****************************************************************************************************
+ * @attention
+ *
+ * ÿ׶ TRACE_BEGIN/TRACE_END , ʱ (¼, ׶, ) дλ,
+ * ѭ trace_poll() ٰۼӵÿ׶εֱͼ(ÿƵ8, <6.25%).
+ *
+ * ¼: ÿδɨ軭˱ʻ͵ trace_touch() һ¼, ɨ迪ʼʱ.
+ * AI_Run ʼʱ trace_frame_begin() ȡǰ¼, ʾ trace_frame_end() 
+ * ֮ǰĴ¼ɶ˵ӳ(TRACE_E2E), Ҳ
+ * "ָ -> current number is N ʾ" ʱ.
+ *
+ * trace_report() ͨ־ÿ׶ε n/p50/p95/max(us).
+ *  HOST_SIM ʱʹ Host/host_sim.h ʱ, Linuxϱ.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __TRACE_H
+#define __TRACE_H
+
+#ifdef HOST_SIM
+#include "host_sim.h"
+#define trace_now()         host_cycles()
+#else
+#include "main.h"
+#define trace_now()         (DWT->CYCCNT)   /* DWTlog_initʹ */
+#endif
+
+
+/******************************************************************************************/
+/*  */
+
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE        1           /* 0, иٺΪ */
+#endif
+
+#define TRACE_RING_NUM      128         /* λ¼, 2 */
+#define TRACE_EVT_NUM       64          /* δĴ¼, 2 */
+#define TRACE_HIST_NUM      240         /* ֱͼ, 32λڷΧ */
+#define TRACE_REPORT_MS     5000        /* Զļ, 0ʾֶֻ */
+
+/* ׶ */
+typedef enum
+{
+    TRACE_TOUCH_SCAN = 0,               /* tp_dev.scan(gt9xxx_scan) */
+    TRACE_DRAW_LINE,                    /* lcd_draw_bline */
+    TRACE_PROCESS,                      /* prep_add */
+    TRACE_AI_RUN,                       /* ai_network_run */
+    TRACE_ARGMAX,                       /* softmaxȡֵ */
+    TRACE_SHOW_TEXT,                    /* 11lcd_show_string */
+    TRACE_E2E,                          /* ʾ */
+    TRACE_STAGE_NUM
+} trace_stage_t;
+
+/* λһ¼ */
+typedef struct
+{
+    uint32_t cycles;                    /* ʱ */
+    uint16_t evt;                       /* ¼ */
+    uint8_t stage;                      /* trace_stage_t */
+    uint8_t reserved;
+} trace_rec_t;
+
+/* ׶εͳ */
+typedef struct
+{
+    uint32_t n;                         /*  */
+    uint32_t p50;                       /*  */
+    uint32_t p95;
+    uint32_t max;
+} trace_summary_t;
+
+#if TRACE_ENABLE
+#define TRACE_BEGIN(s)      uint32_t trace_t0_##s = trace_now()
+#define TRACE_END(s)        trace_stage(TRACE_##s, trace_now() - trace_t0_##s)
+#define TRACE_TOUCH(s)      trace_touch(trace_t0_##s)           /* Խ׶sĿʼʱ򿪴¼ */
+#define TRACE_FRAME_BEGIN() uint16_t trace_evt = trace_frame_begin()
+#define TRACE_FRAME_END()   trace_frame_end(trace_evt)
+#define TRACE_TOUCH_AT(t0)  trace_touch(t0)                     /* ɨͻ߲ͬһʱ, ɨʼʱ */
+#define TRACE_FRAME_MARK()  trace_frame_begin()                 /* ʾͬһʱ, ¼ */
+#define TRACE_FRAME_DONE(e) trace_frame_end(e)
+#else
+#define TRACE_BEGIN(s)
+#define TRACE_END(s)
+#define TRACE_TOUCH(s)
+#define TRACE_FRAME_BEGIN()
+#define TRACE_FRAME_END()
+#define TRACE_TOUCH_AT(t0)  ((void)(t0))
+#define TRACE_FRAME_MARK()  0
+#define TRACE_FRAME_DONE(e) ((void)(e))
+#endif
+
+/******************************************************************************************/
+/*  */
+
+void trace_init(void);                                      /* ʼ */
+void trace_stage(uint8_t stage, uint32_t cycles);           /* ¼һ׶εĺʱ */
+void trace_touch(uint32_t start);                           /* ʼһ¼(start: ɨ迪ʼʱ) */
+uint16_t trace_frame_begin(void);                           /* ʼ, ذ¼ */
+void trace_frame_end(uint16_t evt);                         /* ʾ, ˵ӳ */
+void trace_poll(void);                                      /* ѻλۼӽֱͼ, ѭ */
+void trace_summary(uint8_t stage, trace_summary_t *sum);    /* ȡĳ׶εͳ */
+void trace_report(void);                                    /* ͳƱ */
+void trace_reset(void);                                     /* ͳ */
+
+#endif
@@ -2,8 +2,8 @@
  ****************************************************************************************************
  * @file        24cxx.c
  * @author      ԭŶ(ALIENTEK)
- * @version     V1.0
- * @date        2021-10-23
+ * @version     V1.1
+ * @date        2026-10-18
  * @brief       24CXX 
  * @license     Copyright (c) 2020-2032, ӿƼ޹˾
  ****************************************************************************************************
@@ -18,13 +18,18 @@
  * ޸˵
  * V1.0 20211023
  * һη
+ * V1.1 20261018
+ * 1at24cxx_write ҳд, һҳһʼ/ֹͣ, д겻ʱ10ms;
+ *    ÿηʵĵַ׶ACKѯ: дﲻӦַ, طֱӦ( HAL_GetTick ʱ,
+ *    û delay_init ʱ iic_delay ȴ, ѯһεʱ䲻̶),
+ *    дֻڽҪʱŵ, ֻʵҪʱ(һ3~5ms)
+ * 2at24cxx_read һεַ׶, ÿֻֽҪ9ʱ
  *
  ****************************************************************************************************
  */
 
 #include "myiic.h"
 #include "24cxx.h"
-#include "delay.h"
 
 
 /**
@@ -38,80 +43,101 @@ void at24cxx_init(void)
 }
 
 /**
- * @brief       AT24CXXַָһ
- * @param       readaddr: ʼĵַ
- * @retval      
+ * @brief       ַʹ洢ַ(д), дʱط(ACKѯ)
+ *   @note      24C16ϵͺ, 2ֽڷ͵ַ
+ *              24C16µͺ, 1ֽڵַ + ռַbit1~bit3λ ڱʾλַ, 11λַ
+ *              24C01/02, ַʽ(8bit)Ϊ: 1  0  1  0  A2  A1  A0  R/W
+ *              24C04,    ַʽ(8bit)Ϊ: 1  0  1  0  A2  A1  a8  R/W
+ *              24C08,    ַʽ(8bit)Ϊ: 1  0  1  0  A2  a9  a8  R/W
+ *              24C16,    ַʽ(8bit)Ϊ: 1  0  1  0  a10 a9  a8  R/W
+ *              R/W      : /дλ 0,ʾд; 1,ʾ;
+ *              A0/A1/A2 : Ӧ1,2,3(ֻ24C01/02/04/8Щ)
+ *              a8/a9/a10: Ӧ洢еĸλַ, 11bitַԱʾ2048λ, Ѱַ24C16ڵͺ
+ * @param       addr: 洢ַ
+ * @retval      0, ɹ; 1, һֱӦ
  */
-uint8_t at24cxx_read_one_byte(uint16_t addr)
+static uint8_t at24cxx_send_addr(uint16_t addr)
 {
-    uint8_t temp = 0;
-    iic_start();    /* ʼź */
-
-    /* ݲͬ24CXXͺ, ͸λַ
-     * 1, 24C16ϵͺ, 2ֽڷ͵ַ
-     * 2, 24C16µͺ, 1ֽڵַ + ռַbit1~bit3λ ڱʾλַ, 11λַ
-     *    24C01/02, ַʽ(8bit)Ϊ: 1  0  1  0  A2  A1  A0  R/W
-     *    24C04,    ַʽ(8bit)Ϊ: 1  0  1  0  A2  A1  a8  R/W
-     *    24C08,    ַʽ(8bit)Ϊ: 1  0  1  0  A2  a9  a8  R/W
-     *    24C16,    ַʽ(8bit)Ϊ: 1  0  1  0  a10 a9  a8  R/W
-     *    R/W      : /дλ 0,ʾд; 1,ʾ;
-     *    A0/A1/A2 : Ӧ1,2,3(ֻ24C01/02/04/8Щ)
-     *    a8/a9/a10: Ӧ洢еĸλַ, 11bitַԱʾ2048λ, Ѱַ24C16ڵͺ
-     */    
+    uint8_t dev = (EE_TYPE > AT24C16) ? 0xA0 : 0xA0 + ((addr >> 8) << 1);
+    uint32_t t = HAL_GetTick();
+
+    while (1)
+    {
+        iic_start();            /* ʼź */
+        iic_send_byte(dev);     /* д, IIC涨λ0, ʾд */
+
+        if (iic_wait_ack() == 0)
+        {
+            break;              /* Ӧ, һдѾ; ûӦʱ iic_wait_ack Ѿֹͣź */
+        }
+
+        if (HAL_GetTick() - t > EE_POLL_MS)
+        {
+            return 1;
+        }
+    }
+
     if (EE_TYPE > AT24C16)      /* 24C16ϵͺ, 2ֽڷ͵ַ */
     {
-        iic_send_byte(0xA0);    /* д, IIC涨λ0, ʾд */
-        iic_wait_ack();         /* ÿηһֽ,ҪȴACK */
         iic_send_byte(addr >> 8);   /* ͸ֽڵַ */
+        iic_wait_ack();
     }
-    else 
+
+    iic_send_byte(addr % 256);  /* ͵λַ */
+    return iic_wait_ack();      /* ȴACK, ʱַ */
+}
+
+/**
+ * @brief       ACKѯ: һдڽ
+ *   @note      ддͷ, дĵַ׶λԼ; ҪȷѾдȥ(ʱϵǰ)ʱ
+ * @param       
+ * @retval      0, ; 1, һֱӦ
+ */
+uint8_t at24cxx_wait(void)
+{
+    uint32_t t = HAL_GetTick();
+
+    while (1)
     {
-        iic_send_byte(0xA0 + ((addr >> 8) << 1));   /*  0xA0 + λa8/a9/a10ַ,д */
+        iic_start();
+        iic_send_byte(0xA0);
+
+        if (iic_wait_ack() == 0)
+        {
+            iic_stop();
+            return 0;
+        }
+
+        if (HAL_GetTick() - t > EE_POLL_MS)
+        {
+            return 1;
+        }
     }
-    
-    iic_wait_ack();             /* ÿηһֽ,ҪȴACK */
-    iic_send_byte(addr % 256);  /* ͵λַ */
-    iic_wait_ack();             /* ȴACK, ʱַ */
-    
-    iic_start();                /* ·ʼź */ 
-    iic_send_byte(0xA1);        /* ģʽ, IIC涨λ1, ʾȡ */
-    iic_wait_ack();             /* ÿηһֽ,ҪȴACK */
-    temp = iic_read_byte(0);    /* һֽ */
-    iic_stop();                 /* һֹͣ */
+}
+
+/**
+ * @brief       AT24CXXַָһ
+ * @param       readaddr: ʼĵַ
+ * @retval      
+ */
+uint8_t at24cxx_read_one_byte(uint16_t addr)
+{
+    uint8_t temp = 0;
+
+    at24cxx_read(addr, &temp, 1);
     return temp;
 }
 
 /**
  * @brief       AT24CXXַָдһ
+ *   @note      ٵдڽ(һηʱACKѯ)
  * @param       addr: дݵĿĵַ
  * @param       data: Ҫд
  * @retval      
  */
 void at24cxx_write_one_byte(uint16_t addr, uint8_t data)
 {
-    /* ԭ˵:at24cxx_read_one_byte, ȫ */
-    iic_start();    /* ʼź */
-
-    if (EE_TYPE > AT24C16)      /* 24C16ϵͺ, 2ֽڷ͵ַ */
-    {
-        iic_send_byte(0xA0);    /* д, IIC涨λ0, ʾд */
-        iic_wait_ack();         /* ÿηһֽ,ҪȴACK */
-        iic_send_byte(addr >> 8);   /* ͸ֽڵַ */
-    }
-    else
-    {
-        iic_send_byte(0xA0 + ((addr >> 8) << 1));   /*  0xA0 + λa8/a9/a10ַ,д */
-    }
-    
-    iic_wait_ack();             /* ÿηһֽ,ҪȴACK */
-    iic_send_byte(addr % 256);  /* ͵λַ */
-    iic_wait_ack();             /* ȴACK, ʱַ */
-    
-    /* Ϊдݵʱ,Ҫģʽ,ﲻ·ʼź */
-    iic_send_byte(data);        /* 1ֽ */
-    iic_wait_ack();             /* ȴACK */
-    iic_stop();                 /* һֹͣ */
-    delay_ms(10);               /* ע: EEPROM дȽ,ȵ10msдһֽ */
+    at24cxx_write(addr, &data, 1);
 }
  
 /**
@@ -137,7 +163,7 @@ uint8_t at24cxx_check(void)
     else    /* ųһγʼ */
     {
         at24cxx_write_one_byte(addr, 0x55); /* д */
-        temp = at24cxx_read_one_byte(255);  /* ٶȡ */
+        temp = at24cxx_read_one_byte(addr); /* ٶȡ(ַ׶εдڽ) */
 
         if (temp == 0x55)return 0;
     }
@@ -147,38 +173,71 @@ uint8_t at24cxx_check(void)
 
 /**
  * @brief       AT24CXXַָʼָ
+ *   @note      λ֮, ڲַԶ1, һֽڻnACK
  * @param       addr    : ʼĵַ 24c02Ϊ0~255
  * @param       pbuf    : ׵ַ
  * @param       datalen : Ҫݵĸ
- * @retval      
+ * @retval      0, ɹ; 1, Ӧ
  */
-void at24cxx_read(uint16_t addr, uint8_t *pbuf, uint16_t datalen)
+uint8_t at24cxx_read(uint16_t addr, uint8_t *pbuf, uint16_t datalen)
 {
+    if (datalen == 0)
+    {
+        return 0;
+    }
+
+    if (at24cxx_send_addr(addr))
+    {
+        return 1;
+    }
+
+    iic_start();                /* ·ʼź */
+    iic_send_byte((EE_TYPE > AT24C16) ? 0xA1 : 0xA1 + ((addr >> 8) << 1));  /* ģʽ, IIC涨λ1, ʾȡ */
+    iic_wait_ack();
+
     while (datalen--)
     {
-        *pbuf++ = at24cxx_read_one_byte(addr++);
+        *pbuf++ = iic_read_byte(datalen ? 1 : 0);   /* һֽڷnACK */
     }
+
+    iic_stop();                 /* һֹͣ */
+    return 0;
 }
 
 /**
  * @brief       AT24CXXַָʼдָ
+ *   @note      ҳ(EE_PAGE_SIZE)п, ÿҳһҳд; ҳдҳ߽ؾǱҳͷ, Բܿҳ.
+ *              ֹͣź֮ʼд, ﲻ, һҳĵַ׶ACKѯ
  * @param       addr    : ʼдĵַ 24c02Ϊ0~255
  * @param       pbuf    : ׵ַ
  * @param       datalen : Ҫдݵĸ
- * @retval      
+ * @retval      0, ɹ; 1, Ӧ
  */
-void at24cxx_write(uint16_t addr, uint8_t *pbuf, uint16_t datalen)
+uint8_t at24cxx_write(uint16_t addr, uint8_t *pbuf, uint16_t datalen)
 {
-    while (datalen--)
-    {
-        at24cxx_write_one_byte(addr, *pbuf);
-        addr++;
-        pbuf++;
-    }
-}
+    uint16_t n;
 
+    while (datalen)
+    {
+        n = EE_PAGE_SIZE - addr % EE_PAGE_SIZE;     /* ҳβֽ */
+        n = (n > datalen) ? datalen : n;
 
+        if (at24cxx_send_addr(addr))
+        {
+            return 1;
+        }
 
+        addr += n;
+        datalen -= n;
 
+        while (n--)
+        {
+            iic_send_byte(*pbuf++);
+            iic_wait_ack();
+        }
 
+        iic_stop();             /* һֹͣ, ʼд */
+    }
 
+    return 0;
+}
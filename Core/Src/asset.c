@@ -0,0 +1,178 @@
+/**
+ ****************************************************************************************************
+ * @file        asset.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ѹͼƬֿԴ: RLE/LZ ͼƬ߽дGRAM, ģַ
+ ****************************************************************************************************
+ * @attention
+ *
+ * ʽ asset.h, ѹ asset_enc.c.
+ *
+ ****************************************************************************************************
+ */
+
+#include "string.h"
+#include "asset.h"
+#include "lcd.h"
+
+
+static uint16_t g_asset_hist[ASSET_LZ_WINDOW];      /* LZʷ, ±uint8_tȻ */
+
+/**
+ * @brief       (x,y)ʾͼƬ, ѹͼƬһڱ߽дGRAM
+ * @param       x,y: Ͻ
+ * @param       img: ͼƬ
+ * @retval      0, ɹ; 1, Ļݴ(ʣµĵдɫ);
+ */
+uint8_t asset_show_img(uint16_t x, uint16_t y, const asset_img_t *img)
+{
+    const uint8_t *p = img->data;
+    const uint8_t *end = p + img->len;
+    uint32_t left = (uint32_t)img->w * img->h;
+    uint8_t lz = (img->codec == ASSET_LZ);
+    uint8_t pos = 0;
+    uint16_t n, k, c;
+    uint8_t ctl, d;
+
+    if (left == 0 || x + img->w > lcddev.width || y + img->h > lcddev.height)
+    {
+        return 1;
+    }
+
+    if (img->codec == ASSET_RAW)
+    {
+        if (img->len < left * 2)
+        {
+            return 1;
+        }
+
+        lcd_show_pic(x, y, x + img->w - 1, y + img->h - 1, (uint8_t *)img->data);
+        return 0;
+    }
+
+    memset(g_asset_hist, 0, sizeof(g_asset_hist));
+    lcd_set_window(x, y, img->w, img->h);
+    lcd_write_ram_prepare();
+    LCD_BUS_ADD(left);
+
+    while (left && p < end)
+    {
+        ctl = *p++;
+
+        if (ctl < 0x80)                 /* ԭĵ */
+        {
+            n = ctl + 1;
+
+            if (n > left || p + n * 2 > end)
+            {
+                break;
+            }
+
+            for (k = 0; k < n; k++, p += 2)
+            {
+                c = p[0] | (p[1] << 8);
+                g_asset_hist[pos++] = c;
+                LCD_WR_RAM(c);
+            }
+        }
+        else if (!lz)                   /* RLE: ظһ */
+        {
+            n = (ctl & 0x7F) + 2;
+
+            if (n > left || p + 2 > end)
+            {
+                break;
+            }
+
+            c = p[0] | (p[1] << 8);
+            p += 2;
+
+            for (k = 0; k < n; k++)
+            {
+                LCD_WR_RAM(c);
+            }
+        }
+        else                            /* LZ:  d+1 ֮ǰ */
+        {
+            n = (ctl & 0x7F) + 2;
+
+            if (n > left || p >= end)
+            {
+                break;
+            }
+
+            d = *p++ + 1;
+
+            for (k = 0; k < n; k++)
+            {
+                c = g_asset_hist[(uint8_t)(pos - d)];
+                g_asset_hist[pos++] = c;
+                LCD_WR_RAM(c);
+            }
+        }
+
+        left -= n;
+    }
+
+    if (left == 0)
+    {
+        return 0;
+    }
+
+    while (left--)                      /* ݲ, Ѵд, ӰĻͼ */
+    {
+        LCD_WR_RAM(BLACK);
+    }
+
+    return 1;
+}
+
+/**
+ * @brief       һģ, õ lcdfont.h ʽĵ
+ * @param       font : ֿ
+ * @param       index: ַ - ' '
+ * @param       buf  : , font->bytes ֽ
+ * @retval      0, ɹ; 1, ַΧ;
+ */
+uint8_t asset_glyph(const asset_font_t *font, uint8_t index, uint8_t *buf)
+{
+    const uint8_t *p, *end;
+    uint16_t bits = font->bytes * 8;
+    uint16_t pos = 0;
+    uint8_t color = 0;
+    uint8_t i, n, j;
+
+    if (index >= ASSET_GLYPH_NUM || font->bytes > ASSET_GLYPH_MAX)
+    {
+        return 1;
+    }
+
+    if (font->codec == ASSET_RAW)
+    {
+        memcpy(buf, font->data + index * font->bytes, font->bytes);
+        return 0;
+    }
+
+    memset(buf, 0, font->bytes);
+    p = font->data + font->offs[index];
+    end = font->data + font->offs[index + 1];
+
+    for (; p < end && pos < bits; p++)
+    {
+        for (i = 0; i < 2; i++)
+        {
+            n = i ? (*p & 0x0F) : (*p >> 4);
+
+            for (j = 0; color && j < n && pos + j < bits; j++)
+            {
+                buf[(pos + j) >> 3] |= 0x80 >> ((pos + j) & 7);
+            }
+
+            pos += n;
+            color ^= (n < 15);
+        }
+    }
+
+    return 0;
+}
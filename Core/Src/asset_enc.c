@@ -0,0 +1,174 @@
+/**
+ ****************************************************************************************************
+ * @file        asset_enc.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ѹͼƬģ(asset.h ʽ)
+ ****************************************************************************************************
+ * @attention
+ *
+ * (Host/asset_pack.c)Ͱϻ׼ѹ, ֤ߵĸʽһ.
+ * LCD,  HOST_SIM Linuxϱ.
+ * LZѹ̰ĵ: ÿλڴƥ, ֻʺߴСͼƬ.
+ *
+ ****************************************************************************************************
+ */
+
+#include "asset.h"
+
+
+#define ASSET_PUT(b)    do { if (len < cap) { out[len] = (b); } len++; } while (0)
+
+/**
+ * @brief       һԭĵ
+ * @param       px      : 
+ * @param       from, to: Χ [from, to),  ASSET_LIT_MAX 
+ * @param       out, cap: ֽ
+ * @param       len     : ֽ(Գcap)
+ * @retval      µ len
+ */
+static uint32_t asset_put_lit(const uint16_t *px, uint32_t from, uint32_t to, uint8_t *out, uint32_t cap, uint32_t len)
+{
+    if (to > from)
+    {
+        ASSET_PUT(to - from - 1);
+
+        for (; from < to; from++)
+        {
+            ASSET_PUT(px[from] & 0xFF);
+            ASSET_PUT(px[from] >> 8);
+        }
+    }
+
+    return len;
+}
+
+/**
+ * @brief       ѹͼƬ
+ * @param       codec: ASSET_RAW/ASSET_RLE/ASSET_LZ
+ * @param       px   : , 
+ * @param       n    : 
+ * @param       out  : 
+ * @param       cap  : out ֽ
+ * @retval      ѹֽ, 0ʾ out Ų
+ */
+uint32_t asset_pack_img(uint8_t codec, const uint16_t *px, uint32_t n, uint8_t *out, uint32_t cap)
+{
+    uint32_t len = 0, lit = 0, i = 0;   /* lit: ûԭ */
+    uint32_t best, dist, d, k;
+
+    if (codec == ASSET_RAW)
+    {
+        for (i = 0; i < n; i++)
+        {
+            ASSET_PUT(px[i] & 0xFF);
+            ASSET_PUT(px[i] >> 8);
+        }
+
+        return (len > cap) ? 0 : len;
+    }
+
+    while (i < n)
+    {
+        best = 0;
+        dist = 0;
+
+        if (codec == ASSET_RLE)
+        {
+            for (best = 1; i + best < n && best < ASSET_RUN_MAX && px[i + best] == px[i]; best++);
+        }
+        else
+        {
+            for (d = 1; d <= ASSET_LZ_WINDOW && d <= i && best < ASSET_RUN_MAX; d++)
+            {
+                for (k = 0; i + k < n && k < ASSET_RUN_MAX && px[i + k] == px[i + k - d]; k++);
+
+                if (k > best)
+                {
+                    best = k;
+                    dist = d;
+                }
+            }
+        }
+
+        if (best < 2)                   /* ԭ */
+        {
+            if (++i - lit == ASSET_LIT_MAX)
+            {
+                len = asset_put_lit(px, lit, i, out, cap, len);
+                lit = i;
+            }
+
+            continue;
+        }
+
+        len = asset_put_lit(px, lit, i, out, cap, len);
+        ASSET_PUT(0x80 | (best - 2));
+
+        if (codec == ASSET_RLE)
+        {
+            ASSET_PUT(px[i] & 0xFF);
+            ASSET_PUT(px[i] >> 8);
+        }
+        else
+        {
+            ASSET_PUT(dist - 1);
+        }
+
+        i += best;
+        lit = i;
+    }
+
+    len = asset_put_lit(px, lit, n, out, cap, len);
+    return (len > cap) ? 0 : len;
+}
+
+/**
+ * @brief       ѹһģ(ASSET_RLE)
+ * @param       raw  : lcdfont.h ʽĵ
+ * @param       bytes: ֽ
+ * @param       out  : ,  bytes*4 ֽ
+ * @retval      ѹֽ
+ */
+uint16_t asset_pack_glyph(const uint8_t *raw, uint8_t bytes, uint8_t *out)
+{
+    uint16_t bits = bytes * 8;
+    uint16_t nib = 0, run = 0, i;
+    uint8_t color = 0, v;
+
+    for (i = 0; i <= bits; i++)
+    {
+        if (i < bits && ((raw[i >> 3] >> (7 - (i & 7))) & 1) == color)
+        {
+            run++;
+            continue;
+        }
+
+        if (i == bits && color == 0)
+        {
+            break;                      /* β0 */
+        }
+
+        do                              /* 15: 15, ɫ */
+        {
+            v = (run >= 15) ? 15 : run;
+            run -= v;
+
+            if (nib & 1)
+            {
+                out[nib >> 1] |= v;
+            }
+            else
+            {
+                out[nib >> 1] = v << 4;
+            }
+
+            nib++;
+        } while (v == 15);
+
+        color ^= 1;
+        run = 1;
+    }
+
+    return (nib + 1) >> 1;
+}
@@ -0,0 +1,206 @@
+/**
+ ****************************************************************************************************
+ * @file        bar.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʮʵͼ: סÿĳ, ֻˢ±仯һ
+ ****************************************************************************************************
+ * @attention
+ *
+ * ԭÿػ10 "%8.6f", һҪдʮ32ַ. ͼÿĳ,
+ * ύʱѻĳ(g_bar_len)Ƚ, 䳤ʱǼһ, ʱǼصһ(ɵɫ),
+ * زʲôд. ͼ㰴 g_bar_len ϳ, ˢҲܻ.
+ *
+ * ʾ(ѭ)ύ, (PendSV)мˢ,  g_bar_len ͵ǼǾζڵ.
+ *
+ ****************************************************************************************************
+ */
+
+#include "string.h"
+#include "bar.h"
+#include "lcd.h"
+#include "dirty.h"
+#include "sched.h"
+
+
+static float g_bar_prob[BAR_NUM];       /* µĸ, ûύ */
+static uint16_t g_bar_len[BAR_NUM];     /* ύ(ͼ㻭)ĳ */
+static uint8_t g_bar_top = 0;           /* ύǸ */
+static uint16_t g_bar_max = 0;          /* ̶ȳ */
+static uint8_t g_bar_pending = 0;       /* ûύ¸ */
+static uint32_t g_bar_tick = 0;         /* ϴύʱ(ms) */
+static bar_stats_t g_bar_stats;
+
+/**
+ * @brief       iϱ
+ * @param       i: ڼ
+ * @retval      y
+ */
+static uint16_t bar_y(uint8_t i)
+{
+    return BAR_Y + i * PANEL_SIZE + BAR_PAD;
+}
+
+/**
+ * @brief       Ǽǵi [s, e) һ
+ * @param       i   : ڼ
+ * @param       s, e: ˵ֹ(e)
+ * @retval      
+ */
+static void bar_dirty(uint8_t i, uint16_t s, uint16_t e)
+{
+    uint16_t y = bar_y(i);
+
+    dirty_add(BAR_X + s, y, BAR_X + e - 1, y + PANEL_SIZE - 2 * BAR_PAD - 1);
+    g_bar_stats.rects++;
+    g_bar_stats.pixels += (uint32_t)(e - s) * (PANEL_SIZE - 2 * BAR_PAD);
+}
+
+/**
+ * @brief       ͼͼ:  BAR_COLOR/BAR_TOP_COLOR, ̶ʣµ BAR_TRACK_COLOR
+ * @param       y, x0, x1: кзΧ
+ * @param       line     : л, line[0] Ӧ x0
+ * @retval      
+ */
+static void bar_paint(uint16_t y, uint16_t x0, uint16_t x1, uint16_t *line)
+{
+    uint16_t x, s, e, end, color;
+    uint8_t i;
+
+    if (y < BAR_Y || y >= BAR_Y + BAR_NUM * PANEL_SIZE || g_bar_max == 0)
+    {
+        return;
+    }
+
+    i = (y - BAR_Y) / PANEL_SIZE;
+
+    if (y < bar_y(i) || y >= bar_y(i) + PANEL_SIZE - 2 * BAR_PAD)
+    {
+        return;
+    }
+
+    s = (x0 > BAR_X) ? x0 : BAR_X;
+    e = (x1 < BAR_X + g_bar_max - 1) ? x1 : BAR_X + g_bar_max - 1;
+    end = BAR_X + g_bar_len[i];
+    color = (i == g_bar_top) ? BAR_TOP_COLOR : BAR_COLOR;
+
+    for (x = s; x <= e; x++)
+    {
+        line[x - x0] = (x < end) ? color : BAR_TRACK_COLOR;
+    }
+}
+
+/**
+ * @brief       ʼͼ, עΪ dirty.c ͼ
+ *   @note       dirty_init  lcd_init ֮; һʾˢ»(ȫǵɫ)
+ * @param       
+ * @retval      
+ */
+void bar_init(void)
+{
+    memset(g_bar_len, 0, sizeof(g_bar_len));
+    memset(&g_bar_stats, 0, sizeof(g_bar_stats));
+    g_bar_top = 0;
+    g_bar_pending = 0;
+    g_bar_max = (lcddev.width > BAR_X + BAR_MARGIN) ? lcddev.width - BAR_X - BAR_MARGIN : 0;
+    g_bar_tick = HAL_GetTick();
+    dirty_layer_add(bar_paint);
+}
+
+/**
+ * @brief       µĸ, дLCD
+ * @param       prob: BAR_NUM (0 ~ 1)
+ * @retval      
+ */
+void bar_set(const float *prob)
+{
+    if (g_bar_pending)
+    {
+        g_bar_stats.dropped++;          /* һûü */
+    }
+
+    memcpy(g_bar_prob, prob, sizeof(g_bar_prob));
+    g_bar_pending = 1;
+    g_bar_stats.sets++;
+}
+
+/**
+ * @brief       ύµĸ, ֻǼǳȱ仯һ, ɵ dirty_flush() ˢ
+ * @param       
+ * @retval      Ǽǵľ
+ */
+uint8_t bar_commit(void)
+{
+    uint16_t len[BAR_NUM];
+    uint16_t s, e;
+    uint8_t i, top = 0, n = 0, recolor;
+    float p;
+
+    if (!g_bar_pending)
+    {
+        return 0;
+    }
+
+    for (i = 0; i < BAR_NUM; i++)
+    {
+        p = g_bar_prob[i];
+        p = (p < 0.0f) ? 0.0f : (p > 1.0f) ? 1.0f : p;
+        len[i] = (uint16_t)(p * g_bar_max + 0.5f);
+
+        if (g_bar_prob[i] > g_bar_prob[top])
+        {
+            top = i;
+        }
+    }
+
+    sched_lock();
+
+    for (i = 0; i < BAR_NUM; i++)
+    {
+        /* 䳤ʱһ, ʱصһ; Ǹʱɫ, ػ */
+        recolor = (top != g_bar_top) && (i == top || i == g_bar_top);
+        s = recolor ? 0 : (len[i] < g_bar_len[i]) ? len[i] : g_bar_len[i];
+        e = (len[i] > g_bar_len[i]) ? len[i] : g_bar_len[i];
+
+        if (e > s)
+        {
+            bar_dirty(i, s, e);
+            n++;
+        }
+
+        g_bar_len[i] = len[i];
+    }
+
+    g_bar_top = top;
+    g_bar_pending = 0;
+    sched_unlock();
+
+    g_bar_tick = HAL_GetTick();
+    g_bar_stats.commits++;
+    return n;
+}
+
+/**
+ * @brief       ˢύ: ϴύ BAR_FRAME_MS ʱȲ, ´
+ * @param       
+ * @retval      Ǽǵľ
+ */
+uint8_t bar_poll(void)
+{
+    if (!g_bar_pending || HAL_GetTick() - g_bar_tick < BAR_FRAME_MS)
+    {
+        return 0;
+    }
+
+    return bar_commit();
+}
+
+/**
+ * @brief       ȡͳ
+ * @param       
+ * @retval      ͳ
+ */
+const bar_stats_t *bar_get_stats(void)
+{
+    return &g_bar_stats;
+}
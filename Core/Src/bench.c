@@ -0,0 +1,436 @@
+/**
+ ****************************************************************************************************
+ * @file        bench.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ׼עʹڿ̨
+ ****************************************************************************************************
+ * @attention
+ *
+ *  nn_ref.c ĲοʵֺʵȨصʱ(X-CUBE-AIпⲻֻһ),
+ *  ai_network_run ʱ bench_board.c עΪ "ai_net", Ժ "ref_net" .
+ *
+ *  bench_rx() USART1жƴ, bench_poll() ѭִ,
+ * ִڼյֱַӶ.
+ *
+ ****************************************************************************************************
+ */
+
+#include "string.h"
+#include "stdlib.h"
+#include "bench.h"
+#include "nn_ref.h"
+
+#ifndef HOST_SIM
+#include "log.h"
+#endif
+
+
+static bench_t g_bench[BENCH_MAX_NUM];
+static uint8_t g_bench_num = 0;
+static float *g_bench_scratch;                      /*  */
+static float g_bench_out[NN_OUT_NUM];
+
+static char g_bench_line[BENCH_LINE_SIZE];          /* ̨ */
+static volatile uint8_t g_bench_line_len = 0;
+static volatile uint8_t g_bench_ready = 0;          /* 1, һȴִ */
+
+/**
+ * @brief       ʼǰĻص, 弶ʵ(صж)
+ * @param       
+ * @retval      
+ */
+__weak void bench_enter(void)
+{
+}
+
+/**
+ * @brief       нĻص, 弶ʵ
+ * @param       
+ * @retval      
+ */
+__weak void bench_exit(void)
+{
+}
+
+/**
+ * @brief       bench Ŀ̨, 弶ʵ
+ * @param       cmd : 
+ * @param       name: һ, ΪNULL
+ * @param       arg : ڶ, ΪNULL
+ * @retval      1, ; 0, ʶ;
+ */
+__weak uint8_t bench_cmd(const char *cmd, const char *name, const char *arg)
+{
+    UNUSED(cmd);
+    UNUSED(name);
+    UNUSED(arg);
+    return 0;
+}
+
+/**
+ * @brief       絥׼
+ *   @note      relu/pool/softmax ԭ(X-CUBE-AIһ), 
+ * @param       arg: 
+ * @retval      
+ */
+static void bench_layer(void *arg)
+{
+    uint8_t layer = (uint8_t)(uintptr_t)arg;
+    float *in = g_bench_scratch;
+
+    switch (layer)
+    {
+        case NN_L_RELU1:
+        case NN_L_POOL2:
+        case NN_L_RELU4:
+        case NN_L_POOL5:
+        case NN_L_RELU7:
+        case NN_L_RELU10:
+        case NN_L_SOFTMAX12:
+            nn_ref_layer(layer, in, in);
+            break;
+
+        default:
+            nn_ref_layer(layer, in, in + g_nn_layer[layer].in_num);
+            break;
+    }
+}
+
+/**
+ * @brief       οʵ׼
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_ref_net(void *arg)
+{
+    UNUSED(arg);
+    nn_ref_run(g_bench_scratch, g_bench_out, g_bench_scratch);
+}
+
+/**
+ * @brief       ʼ, עͲο
+ * @param       scratch: ʱ,  NN_REF_SCRATCH ֽ, 4ֽڶ.
+ *                       ϽX-CUBE-AIļ, ֻ֮л׼
+ * @retval      
+ */
+void bench_init(void *scratch)
+{
+    const nn_layer_info_t *info;
+    uint32_t weights = 0;
+    uint32_t seed = 1;
+    uint32_t i;
+
+    g_bench_num = 0;
+    g_bench_scratch = (float *)scratch;
+
+    /* ̶α, ȫ0߳ʵĿ· */
+    for (i = 0; i < NN_REF_SCRATCH / sizeof(float); i++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        g_bench_scratch[i] = (float)(seed >> 8) / 16777216.0f;
+    }
+
+    for (i = 0; i < NN_LAYER_NUM; i++)
+    {
+        info = &g_nn_layer[i];
+        bench_add(info->name, bench_layer, (void *)(uintptr_t)i,
+                  (info->in_num + info->out_num) * sizeof(float) + info->weight_bytes);
+        weights += info->weight_bytes;
+    }
+
+    /* ͼƬscratchͷ, ᱻһ㸲, ʱֻķô */
+    bench_add("ref_net", bench_ref_net, NULL, (NN_IN_H * NN_IN_W + NN_OUT_NUM) * sizeof(float) + weights);
+}
+
+/**
+ * @brief       עһ׼
+ * @param       name : (пո, ַҪһֱЧ)
+ * @param       fn   : 
+ * @param       arg  : 
+ * @param       bytes: ÿεдֽ, 0ʾͳƴ
+ * @retval      0, ɹ; 1, ע();
+ */
+uint8_t bench_add(const char *name, bench_fn_t fn, void *arg, uint32_t bytes)
+{
+    bench_t *b;
+
+    if (g_bench_num >= BENCH_MAX_NUM)
+    {
+        log_printf("bench: table full (BENCH_MAX_NUM %u), '%s' dropped\r\n", BENCH_MAX_NUM, name);
+        return 1;
+    }
+
+    b = &g_bench[g_bench_num++];
+    b->name = name;
+    b->fn = fn;
+    b->arg = arg;
+    b->bytes = bytes;
+    memset(&b->res, 0, sizeof(b->res));
+    return 0;
+}
+
+/**
+ * @brief       ֲһ׼
+ * @param       name: 
+ * @retval      ׼, NULLʾû
+ */
+bench_t *bench_find(const char *name)
+{
+    uint8_t i;
+
+    for (i = 0; i < g_bench_num; i++)
+    {
+        if (strcmp(g_bench[i].name, name) == 0)
+        {
+            return &g_bench[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief       bench_init ʱ(ҪĻ׼)
+ * @param       
+ * @retval       NN_REF_SCRATCH ֽ
+ */
+void *bench_scratch(void)
+{
+    return g_bench_scratch;
+}
+
+/**
+ * @brief       һн:   ƽ С / MB/
+ * @param       b: ׼
+ * @retval      
+ */
+static void bench_print(const bench_t *b)
+{
+    uint32_t rate = (uint64_t)SystemCoreClock * 10 / b->res.avg;                            /* 0.1/ */
+    uint32_t mbps = (uint64_t)b->bytes * SystemCoreClock / b->res.avg / 100000;             /* 0.1MB/ */
+
+    log_printf("%-10s%5lu %9lu %9lu %8lu.%lu %5lu.%lu\r\n", b->name, (unsigned long)b->res.iters,
+               (unsigned long)b->res.avg, (unsigned long)b->res.min,
+               (unsigned long)(rate / 10), (unsigned long)(rate % 10),
+               (unsigned long)(mbps / 10), (unsigned long)(mbps % 10));
+}
+
+/**
+ * @brief       һ׼: Ԥһ, ټʱ iters 
+ * @param       b    : ׼
+ * @param       iters: (1 ~ BENCH_MAX_ITERS)
+ * @retval      0, ɹ; 1, ;
+ */
+uint8_t bench_run(bench_t *b, uint32_t iters)
+{
+    uint64_t sum = 0;
+    uint32_t min = 0xFFFFFFFF;
+    uint32_t max = 0;
+    uint32_t t, i;
+
+    if (b == NULL || iters == 0 || iters > BENCH_MAX_ITERS)
+    {
+        return 1;
+    }
+
+    b->fn(b->arg);                      /* Ԥ(/flashԤȡ/LCD) */
+
+    for (i = 0; i < iters; i++)
+    {
+        t = bench_now();
+        b->fn(b->arg);
+        t = bench_now() - t;
+        sum += t;
+        min = (t < min) ? t : min;
+        max = (t > max) ? t : max;
+    }
+
+    b->res.iters = iters;
+    b->res.min = min;
+    b->res.avg = (uint32_t)(sum / iters);
+    b->res.max = max;
+
+    if (b->res.avg == 0)
+    {
+        b->res.avg = 1;
+    }
+
+    bench_print(b);
+    return 0;
+}
+
+/**
+ * @brief       гл׼ÿεֽ
+ * @param       
+ * @retval      
+ */
+void bench_list(void)
+{
+    uint8_t i;
+
+    log_printf("bench: %u entries, name bytes/iter\r\n", g_bench_num);
+
+    for (i = 0; i < g_bench_num; i++)
+    {
+        log_printf("  %-10s %lu\r\n", g_bench[i].name, (unsigned long)g_bench[i].bytes);
+    }
+}
+
+/**
+ * @brief       л׼һν
+ * @param       
+ * @retval      
+ */
+void bench_report(void)
+{
+    uint8_t i;
+
+    log_printf("bench: name n avg min(cyc) it/s MB/s @%luMHz\r\n", (unsigned long)(SystemCoreClock / 1000000));
+
+    for (i = 0; i < g_bench_num; i++)
+    {
+        if (g_bench[i].res.iters)
+        {
+            bench_print(&g_bench[i]);
+        }
+    }
+}
+
+/**
+ * @brief       ƥĻ׼
+ * @param       name : , ǰ׺ "all"
+ * @param       iters: 
+ * @retval      еĻ׼
+ */
+static uint8_t bench_run_match(const char *name, uint32_t iters)
+{
+    bench_t *b = bench_find(name);
+    uint8_t len = strlen(name);
+    uint8_t all = (strcmp(name, "all") == 0);
+    uint8_t n = 0;
+    uint8_t i;
+
+    if (b)                              /* ȷƥ,  "conv0"  "conv0x" */
+    {
+        return bench_run(b, iters) == 0;
+    }
+
+    for (i = 0; i < g_bench_num; i++)
+    {
+        if (all || strncmp(g_bench[i].name, name, len) == 0)
+        {
+            n += bench_run(&g_bench[i], iters) == 0;
+        }
+    }
+
+    return n;
+}
+
+/**
+ * @brief       ִһ̨
+ * @param       line: (س)
+ * @retval      
+ */
+void bench_exec(const char *line)
+{
+    char buf[BENCH_LINE_SIZE];
+    char *cmd, *name, *arg;
+    uint32_t iters = BENCH_DEF_ITERS;
+
+    strncpy(buf, line, sizeof(buf) - 1);
+    buf[sizeof(buf) - 1] = 0;
+
+    cmd = strtok(buf, " \t");
+    name = strtok(NULL, " \t");
+    arg = strtok(NULL, " \t");
+
+    if (cmd == NULL)
+    {
+        return;
+    }
+
+    if (strcmp(cmd, "list") == 0)
+    {
+        bench_list();
+    }
+    else if (strcmp(cmd, "report") == 0)
+    {
+        bench_report();
+    }
+    else if (strcmp(cmd, "run") == 0 && name)
+    {
+        if (arg)
+        {
+            iters = strtoul(arg, NULL, 0);
+        }
+
+        if (iters == 0 || iters > BENCH_MAX_ITERS)
+        {
+            log_printf("bench: iters 1..%u\r\n", BENCH_MAX_ITERS);
+            return;
+        }
+
+        log_printf("bench: name n avg min(cyc) it/s MB/s\r\n");
+        bench_enter();
+
+        if (bench_run_match(name, iters) == 0)
+        {
+            log_printf("bench: no match '%s'\r\n", name);
+        }
+
+        bench_exit();
+    }
+    else if (bench_cmd(cmd, name, arg) == 0)
+    {
+        log_printf("bench: list | run <name|prefix|all> [n] | report\r\n");
+    }
+}
+
+/**
+ * @brief       յһַ̨, سнһ
+ * @param       ch: ַ
+ * @retval      
+ */
+void bench_rx(uint8_t ch)
+{
+    if (g_bench_ready)                  /* һûִ */
+    {
+        return;
+    }
+
+    if (ch == '\r' || ch == '\n')
+    {
+        if (g_bench_line_len)
+        {
+            g_bench_line[g_bench_line_len] = 0;
+            g_bench_ready = 1;
+        }
+    }
+    else if (ch == '\b' || ch == 0x7F)
+    {
+        if (g_bench_line_len)
+        {
+            g_bench_line_len--;
+        }
+    }
+    else if (ch >= ' ' && g_bench_line_len < BENCH_LINE_SIZE - 1)
+    {
+        g_bench_line[g_bench_line_len++] = ch;
+    }
+}
+
+/**
+ * @brief       ִյ, ѭ
+ * @param       
+ * @retval      
+ */
+void bench_poll(void)
+{
+    if (g_bench_ready)
+    {
+        bench_exec(g_bench_line);
+        g_bench_line_len = 0;
+        g_bench_ready = 0;
+    }
+}
@@ -0,0 +1,912 @@
+/**
+ ****************************************************************************************************
+ * @file        bench_board.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       רеĻ׼: ai_network_run , LCD//ʻ/ַ/, ɨ, DMAص
+ ****************************************************************************************************
+ * @attention
+ *
+ * л׼ڼرTIM2ж(ɨͻ), ʱ, Ҳ tp_scan ׼
+ * ͬʱʴIC. LCD׼Ḳǻ, »Ի.
+ * ַ̨ proto.c ֽ֡(proto_text_rx).
+ * ʻַ׼ bytes ǻһFSMCֽ(дx2), ʱһ.
+ * ׼֮л, bytes лһ(ϲ)ֽ.
+ * ͼ(PANEL_PROB_TEXT Ϊ0)ʱ panel ͼ, bars ֻͼ,  panel_old(ԭ10)Ƚ;
+ * Ҫֻˢ±˵ֱȽ,  PANEL_PROB_TEXT Ϊ1 panel.
+ * ׼ڼͣͼӻ(fmap.c), ai_fmap ֻʱ,  ai_net ȽϾǿӻĿ.
+ * DMA첽д, ׼DMAдŽ; clear_ai DMAͬʱһ,
+ *  lcd_clear + ai_net ֮ͱȽϾصʡµʱ.
+ * pic_raw/pic_rle/pic_lz ʾͬһͼƬ(ʻСһ), ֱǲѹ(DMA)RLE/LZ߽д,
+ * bytes ͼƬĵx2; ѹĴСʱ.
+ * GT9XXXINTжϷʽ(GT9XXX_IRQ)ʱ׼ڼҲINTж. tp_frame һ״̬1,
+ * tp_frame_old ԭȶ״̬ٶ, bytes I2Cֽ(ַͼĴַ).
+ * ʱ tp_point һ˲(X, Y5, Ƚ, 20ת), 20ÿתʱ(),
+ * tp_point_old ԭתð(ֻSPIʱ), bytes SPIʱ/8.
+ * prep_add ѻʻ׼"2"Ҵ3("222")ӵԤĸ(),
+ * prep_seg ֳ3(γ + 鼯), prep_run һ28x28(Ҳ ai_net 
+ * ׼); prep_add/3 + prep_seg/3 + prep_run  conv0 ȽϾÿԤһĿ.
+ * strip ͬ"222"(strip.h)ʶ, ֻõõĴڵȫ, strip_all ÿڶ;
+ *  3 x (prep_run + ref_net) ȽϾͷָʶһ3λĿ( nn_ref ĸʵ).
+ * online_add ѱʻ"2"͸ʶ(online.h,  + ÿ ONLINE_STEP һ GRU),  prep_add/3 Ƚ
+ * ǻʱĿ; online_res ̧ʺ(ֻ),  prep_seg/3 + prep_run + ai_net Ƚ.
+ * ̨ tp (bench_cmd)¼/طŴ켣(tprec.h), طŵĶ˵ӳټطŽʱ trace .
+ * cfg 鿴/޸EEPROMü¼(cfg.h): cfg [info] | fmap on|off | erase. boot ¼(boot.h).
+ * ee_read ô洢( cfg_load ), ee_read_old ֽֽͬ;
+ * cfg_save дһü¼дڽ(ҳд + ACKѯ), cal_save_old ԭ tp_save_adjust_data:
+ * 13ֽֽд, ÿֽڹ̶10ms(дԭλϵ, ). ֻEEPROMӦʱע.
+ *
+ ****************************************************************************************************
+ */
+
+#include "bench.h"
+#include "nn_ref.h"
+#include "tim.h"
+#include "lcd.h"
+#include "lcd_dma.h"
+#include "touch.h"
+#include "delay.h"
+#include "trace.h"
+#include "panel.h"
+#include "dirty.h"
+#include "bar.h"
+#include "fmap.h"
+#include "asset.h"
+#include "prep.h"
+#include "strip.h"
+#include "online.h"
+#include "tprec.h"
+#include "cfg.h"
+#include "24cxx.h"
+#include "boot.h"
+#include "log.h"
+#include "stdio.h"
+#include "string.h"
+
+
+#define BENCH_FILL_SIZE     100         /* lcd_fill ׼ķ߳ */
+#define BENCH_BLINE_SIZE    10          /* ʻ뾶, 뻭ͬ */
+#define BENCH_PIC_W         64          /* ͼƬ׼ͼƬС,  128x192 Сһ */
+#define BENCH_PIC_H         96
+#define BENCH_PIC_PACK      2048        /* ѹͼƬ */
+#define BENCH_PREP_STEP     120         /* Ԥ׼ "222" ļ() */
+#define BENCH_CAL_ADDR      40          /* ԭУ׼ĵַ(touch.c  TP_SAVE_ADDR_BASE), 13ֽ */
+
+/* ʻ׼õıʻ: һ"2", 20msһεĴ */
+static const uint16_t g_board_stroke[][2] =
+{
+    {150, 160}, {162, 150}, {178, 142}, {196, 140}, {214, 144}, {228, 154}, {236, 170},
+    {236, 188}, {230, 206}, {218, 224}, {202, 242}, {186, 260}, {170, 278}, {158, 294},
+    {150, 308}, {166, 310}, {186, 310}, {208, 310}, {230, 310}, {252, 312},
+};
+#define BENCH_STROKE_NUM    (sizeof(g_board_stroke) / sizeof(g_board_stroke[0]))
+
+static uint32_t (*g_board_infer)(const float *in, float *out);
+static float g_board_in[NN_IN_H * NN_IN_W];
+static float g_board_out[NN_OUT_NUM];
+static uint8_t g_board_lcd_dirty = 0;   /* 1, LCD׼д˻ */
+static uint16_t g_board_pic[BENCH_PIC_W * BENCH_PIC_H];
+static uint8_t g_board_pack[2][BENCH_PIC_PACK];
+static asset_img_t g_board_img[3];      /* ѹ, RLE, LZ */
+static uint8_t g_board_ee[CFG_SIZE];
+static uint8_t g_board_cal[13];        /* ԭλϵУ׼, cal_save_old ԭд */
+
+/**
+ * @brief       Э֡Ĵֽ, ׼̨
+ * @param       ch: ֽ
+ * @retval      
+ */
+void proto_text_rx(uint8_t ch)
+{
+    bench_rx(ch);
+}
+
+/**
+ * @brief       ʼл׼: رմɨж, ͣͼӻ
+ * @param       
+ * @retval      
+ */
+void bench_enter(void)
+{
+    HAL_NVIC_DisableIRQ(TIM2_IRQn);
+
+    if (gt9xxx_irq_on())
+    {
+        HAL_NVIC_DisableIRQ(GT9XXX_INT_IRQn);
+    }
+
+    fmap_pause(1);
+}
+
+/**
+ * @brief       ׼н: ָʹɨ
+ *   @note      ׼ͣĴ÷ֽ׶ͳʧ, һ
+ * @param       
+ * @retval      
+ */
+void bench_exit(void)
+{
+    if (g_board_lcd_dirty)
+    {
+        load_draw_dialog();
+        g_board_lcd_dirty = 0;
+    }
+
+    trace_reset();
+    fmap_pause(0);
+    HAL_NVIC_EnableIRQ(TIM2_IRQn);
+
+    if (gt9xxx_irq_on())
+    {
+        HAL_NVIC_EnableIRQ(GT9XXX_INT_IRQn);
+    }
+}
+
+/**
+ * @brief       ü¼(cfg.h): cfg [info] | fmap on|off | erase
+ * @param       name: 
+ * @param       arg : fmap  on/off
+ * @retval      1
+ */
+static uint8_t bench_cfg_cmd(const char *name, const char *arg)
+{
+    cfg_ui_t ui = {1, {0}};
+
+    if (name && strcmp(name, "fmap") == 0 && arg)
+    {
+        cfg_get(CFG_UI, &ui, sizeof(ui));   /* ûм¼ʱĬֵ */
+        ui.fmap = (strcmp(arg, "on") == 0);
+        fmap_enable(ui.fmap);
+        cfg_set(CFG_UI, &ui, sizeof(ui));
+    }
+    else if (name && strcmp(name, "erase") == 0)
+    {
+        cfg_erase();
+    }
+    else if (name && strcmp(name, "info") != 0)
+    {
+        log_printf("cfg: info | fmap on|off | erase\r\n");
+        return 1;
+    }
+
+    cfg_report();
+    return 1;
+}
+
+/**
+ * @brief       ̨: tp(켣, tprec.h) rec | stop | play | info; cfg(ü¼); boot(¼)
+ *   @note      طǰػԻջ, ÿλطŴͬĻ濪ʼ
+ * @param       cmd : 
+ * @param       name: 
+ * @param       arg : 
+ * @retval      1, ; 0,  tp/cfg/boot ;
+ */
+uint8_t bench_cmd(const char *cmd, const char *name, const char *arg)
+{
+    uint8_t res;
+
+    if (strcmp(cmd, "cfg") == 0)
+    {
+        return bench_cfg_cmd(name, arg);
+    }
+
+    if (strcmp(cmd, "boot") == 0)
+    {
+        boot_report();
+        return 1;
+    }
+
+    if (strcmp(cmd, "tp") != 0)
+    {
+        return 0;
+    }
+
+    if (name && strcmp(name, "rec") == 0)
+    {
+        tprec_record(1);
+    }
+    else if (name && strcmp(name, "stop") == 0)
+    {
+        tprec_record(0);
+    }
+    else if (name && strcmp(name, "play") == 0)
+    {
+        if (tprec_playing() == 0)
+        {
+            load_draw_dialog();
+        }
+
+        res = tprec_play();
+
+        if (res)
+        {
+            log_printf("tp: %s\r\n", (res == 2) ? "trace was recorded on another LCD size" : "no trace or already playing");
+            return 1;
+        }
+    }
+    else if (name == NULL || strcmp(name, "info") != 0)
+    {
+        log_printf("tp: rec | stop | play | info\r\n");
+        return 1;
+    }
+
+    tprec_report();
+    return 1;
+}
+
+/**
+ * @brief       X-CUBE-AI 
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_ai_net(void *arg)
+{
+    UNUSED(arg);
+    g_board_infer(g_board_in, g_board_out);
+}
+
+/**
+ * @brief       , ͬʱͼ( FMAP_BUDGET_PCT%)
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_ai_fmap(void *arg)
+{
+    UNUSED(arg);
+    fmap_pause(0);
+    g_board_infer(g_board_in, g_board_out);
+    fmap_pause(1);
+    g_board_lcd_dirty = 1;
+}
+
+/**
+ * @brief       , DMAд
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_lcd_clear(void *arg)
+{
+    static uint8_t flip = 0;
+
+    UNUSED(arg);
+    lcd_clear((flip ^= 1) ? WHITE : BLACK);
+    lcd_dma_wait();
+    g_board_lcd_dirty = 1;
+}
+
+/**
+ * @brief       DMAͬʱһ
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_clear_ai(void *arg)
+{
+    static uint8_t flip = 0;
+
+    UNUSED(arg);
+    lcd_clear((flip ^= 1) ? WHITE : BLACK);
+    g_board_infer(g_board_in, g_board_out);
+    lcd_dma_wait();
+    g_board_lcd_dirty = 1;
+}
+
+/**
+ * @brief        BENCH_FILL_SIZE x BENCH_FILL_SIZE ķ
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_lcd_fill(void *arg)
+{
+    static uint8_t flip = 0;
+
+    UNUSED(arg);
+    lcd_fill(0, 0, BENCH_FILL_SIZE - 1, BENCH_FILL_SIZE - 1, (flip ^= 1) ? RED : BLUE);
+    lcd_dma_wait();
+    g_board_lcd_dirty = 1;
+}
+
+/**
+ * @brief       һʻ: δβ, һصĲ(Ļ)
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_bline(void *arg)
+{
+    uint8_t i, p;
+
+    UNUSED(arg);
+    lcd_draw_bline(g_board_stroke[0][0], g_board_stroke[0][1], g_board_stroke[0][0], g_board_stroke[0][1],
+                   BENCH_BLINE_SIZE, RED);
+
+    for (i = 1; i < BENCH_STROKE_NUM; i++)
+    {
+        p = (i > 1) ? i - 2 : 0;                /* һε"һ"ǸԲ */
+        lcd_draw_bline_join(g_board_stroke[p][0], g_board_stroke[p][1],
+                            g_board_stroke[i - 1][0], g_board_stroke[i - 1][1],
+                            g_board_stroke[i][0], g_board_stroke[i][1], BENCH_BLINE_SIZE, RED);
+    }
+
+    g_board_lcd_dirty = 1;
+}
+
+/**
+ * @brief       ԭĻͬһʻ: ÿһһʵԲ, ΪԱ
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_bline_old(void *arg)
+{
+    int i, t, distance, delta_x, delta_y, xerr, yerr, incx, incy, row, col;
+
+    UNUSED(arg);
+
+    for (i = 1; i < BENCH_STROKE_NUM; i++)
+    {
+        row = g_board_stroke[i - 1][0];
+        col = g_board_stroke[i - 1][1];
+        delta_x = g_board_stroke[i][0] - row;
+        delta_y = g_board_stroke[i][1] - col;
+        incx = (delta_x > 0) ? 1 : ((delta_x < 0) ? -1 : 0);
+        incy = (delta_y > 0) ? 1 : ((delta_y < 0) ? -1 : 0);
+        delta_x = abs(delta_x);
+        delta_y = abs(delta_y);
+        distance = (delta_x > delta_y) ? delta_x : delta_y;
+        xerr = 0;
+        yerr = 0;
+
+        for (t = 0; t <= distance + 1; t++)
+        {
+            lcd_fill_circle(row, col, BENCH_BLINE_SIZE, BLUE);
+            xerr += delta_x;
+            yerr += delta_y;
+
+            if (xerr > distance)
+            {
+                xerr -= distance;
+                row += incx;
+            }
+
+            if (yerr > distance)
+            {
+                yerr -= distance;
+                col += incy;
+            }
+        }
+    }
+
+    g_board_lcd_dirty = 1;
+}
+
+/**
+ * @brief       ʾһʶСַ(32, 11ַ)
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_lcd_text(void *arg)
+{
+    UNUSED(arg);
+    lcd_show_string(0, 0, lcddev.width, 32, 32, "1  0.982113", BLACK);
+    g_board_lcd_dirty = 1;
+}
+
+/* ׼ʾ, Ĳ */
+static const float g_board_prob[2][PANEL_PROB_NUM] =
+{
+    {0.000012f, 0.982113f, 0.000301f, 0.004521f, 0.000009f, 0.001200f, 0.000044f, 0.011700f, 0.000090f, 0.000010f},
+    {0.000015f, 0.979420f, 0.000288f, 0.005102f, 0.000011f, 0.001391f, 0.000040f, 0.013612f, 0.000107f, 0.000014f},
+};
+
+/**
+ * @brief       һν(ʽͼ, ֻˢ±˵Ĳ)
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_panel(void *arg)
+{
+    static uint8_t flip = 0;
+    const uint8_t num = 1;
+
+    UNUSED(arg);
+    flip ^= 1;
+    panel_update(g_board_prob[flip], &num, &g_board_prob[flip][1], 1);
+    bar_commit();                       /* ͼʱˢ¼ */
+    dirty_flush();
+    g_board_lcd_dirty = 1;
+}
+
+#if !PANEL_PROB_TEXT
+/**
+ * @brief       һͼ(ֻˢ³ȱ˵һ)
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_bars(void *arg)
+{
+    static uint8_t flip = 0;
+
+    UNUSED(arg);
+    bar_set(g_board_prob[flip ^= 1]);
+    bar_commit();
+    dirty_flush();
+    g_board_lcd_dirty = 1;
+}
+#endif
+
+/**
+ * @brief       ԭķһν: sprintf("%8.6f"), ػ, ΪԱ
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_panel_old(void *arg)
+{
+    static uint8_t flip = 0;
+    const float *prob = g_board_prob[flip ^= 1];
+    char str[32];
+    uint8_t i;
+
+    UNUSED(arg);
+
+    for (i = 0; i < PANEL_PROB_NUM; i++)
+    {
+        sprintf(str, "%d  %8.6f\r\n", i, prob[i]);
+        lcd_show_string(PANEL_X, PANEL_Y + i * PANEL_SIZE, 336, PANEL_SIZE, PANEL_SIZE, str, BLACK);
+    }
+
+    sprintf(str, "current number is %d   \r\n", 1);
+    lcd_show_string(PANEL_X, PANEL_Y + i * PANEL_SIZE, 400, PANEL_SIZE, PANEL_SIZE, str, BLACK);
+    g_board_lcd_dirty = 1;
+}
+
+/**
+ * @brief       ʾһͼƬ
+ * @param       arg: ͼƬ(asset_img_t)
+ * @retval      
+ */
+static void bench_pic(void *arg)
+{
+    asset_show_img(0, 0, (const asset_img_t *)arg);
+    lcd_dma_wait();
+    g_board_lcd_dirty = 1;
+}
+
+/**
+ * @brief       ͼƬ׼ͼƬ: ׵׺ɫʻ,  (140,130) ʼ 128x192 Сһ
+ * @param       
+ * @retval      
+ */
+static void bench_pic_init(void)
+{
+    float px, py, dx, dy, t, d;
+    uint16_t u, v;
+    uint8_t i;
+
+    for (v = 0; v < BENCH_PIC_H; v++)
+    {
+        for (u = 0; u < BENCH_PIC_W; u++)
+        {
+            px = 140 + u * 2;
+            py = 130 + v * 2;
+            g_board_pic[v * BENCH_PIC_W + u] = WHITE;
+
+            for (i = 1; i < BENCH_STROKE_NUM; i++)      /* εľ */
+            {
+                dx = (float)g_board_stroke[i][0] - g_board_stroke[i - 1][0];
+                dy = (float)g_board_stroke[i][1] - g_board_stroke[i - 1][1];
+                t = ((px - g_board_stroke[i - 1][0]) * dx + (py - g_board_stroke[i - 1][1]) * dy) / (dx * dx + dy * dy);
+                t = (t < 0) ? 0 : (t > 1) ? 1 : t;
+                dx = g_board_stroke[i - 1][0] + t * dx - px;
+                dy = g_board_stroke[i - 1][1] + t * dy - py;
+                d = dx * dx + dy * dy;
+
+                if (d <= BENCH_BLINE_SIZE * BENCH_BLINE_SIZE)
+                {
+                    g_board_pic[v * BENCH_PIC_W + u] = RED;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+        g_board_img[i].w = BENCH_PIC_W;
+        g_board_img[i].h = BENCH_PIC_H;
+        g_board_img[i].codec = i;
+        g_board_img[i].data = i ? g_board_pack[i - 1] : (const uint8_t *)g_board_pic;
+        g_board_img[i].len = i ? asset_pack_img(i, g_board_pic, BENCH_PIC_W * BENCH_PIC_H, g_board_pack[i - 1], BENCH_PIC_PACK)
+                               : sizeof(g_board_pic);
+    }
+
+    log_printf("bench: pic %ux%u %u B, rle %lu B, lz %lu B\r\n", BENCH_PIC_W, BENCH_PIC_H, (unsigned)sizeof(g_board_pic),
+               (unsigned long)g_board_img[ASSET_RLE].len, (unsigned long)g_board_img[ASSET_LZ].len);
+}
+
+/**
+ * @brief       һλ׼FSMCֽ
+ * @param       fn: ׼
+ * @retval      ֽ(дx2)
+ */
+static uint32_t bench_bus_bytes(bench_fn_t fn)
+{
+    uint32_t w = g_lcd_bus_writes;
+
+    fn(NULL);
+    return (g_lcd_bus_writes - w) * 2;
+}
+
+/**
+ * @brief       ɨ
+ *   @note      gt9xxx_scan ѯʽʱÿ10βŶһIC, minʱĿ, ƽֵŷӳI2Cȡ;
+ *              INTжϷʽû֡ʱIC(׼ڼINT), ֻǼĿ
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_tp_scan(void *arg)
+{
+    UNUSED(arg);
+    tp_dev.scan(0);
+}
+
+/**
+ * @brief       һ֡(1): ״̬ʹһ, INTжϷʽĶ
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_tp_frame(void *arg)
+{
+    uint8_t buf[GT9XXX_FRAME_LEN(1)];
+
+    UNUSED(arg);
+    gt9xxx_rd_reg(GT9XXX_GSTID_REG, buf, GT9XXX_FRAME_LEN(1));
+}
+
+/**
+ * @brief       һ֡(1): ԭȶ״̬, ٶ
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_tp_frame_old(void *arg)
+{
+    uint8_t buf[4];
+
+    UNUSED(arg);
+    gt9xxx_rd_reg(GT9XXX_GSTID_REG, buf, 1);
+    gt9xxx_rd_reg(GT9XXX_TP1_REG, buf, 4);
+}
+
+/**
+ * @brief       һ˲: һƬѡX, Y, βƽ
+ *   @note      Ҳת, ȽʧܲӰʱ
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_tp_point(void *arg)
+{
+    uint16_t x, y;
+
+    UNUSED(arg);
+    tp_read_xy2(&x, &y);
+}
+
+#if !TP_HW_SPI
+/**
+ * @brief       ԭĵȡ: ÿתƬѡ, 6us, ð
+ * @param       cmd: ָ
+ * @retval      βƽ
+ */
+static uint16_t bench_tp_xoy_old(uint8_t cmd)
+{
+    uint16_t buf[5], num, temp;
+    uint32_t sum = 0;
+    uint8_t i, j, k, data;
+
+    for (i = 0; i < 5; i++)
+    {
+        T_CLK(0);
+        T_MOSI(0);
+        T_CS(0);
+        data = cmd;
+
+        for (k = 0; k < 8; k++)
+        {
+            T_MOSI(data & 0x80);
+            data <<= 1;
+            T_CLK(0);
+            delay_us(1);
+            T_CLK(1);
+        }
+
+        delay_us(6);
+        T_CLK(0);
+        delay_us(1);
+        T_CLK(1);
+        T_CLK(0);
+        num = 0;
+
+        for (k = 0; k < 16; k++)
+        {
+            num <<= 1;
+            T_CLK(0);
+            delay_us(1);
+            T_CLK(1);
+
+            if (T_MISO) num++;
+        }
+
+        T_CS(1);
+        buf[i] = (num >> 4) & 0X0FFF;
+    }
+
+    for (i = 0; i < 4; i++)
+    {
+        for (j = i + 1; j < 5; j++)
+        {
+            if (buf[i] > buf[j])
+            {
+                temp = buf[i];
+                buf[i] = buf[j];
+                buf[j] = temp;
+            }
+        }
+    }
+
+    for (i = 1; i < 4; i++)
+    {
+        sum += buf[i];
+    }
+
+    return sum / 3;
+}
+
+/**
+ * @brief       ԭĵһ˲(X, Y)
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_tp_point_old(void *arg)
+{
+    volatile uint16_t x, y;
+    uint8_t i;
+
+    UNUSED(arg);
+
+    for (i = 0; i < 2; i++)
+    {
+        x = bench_tp_xoy_old(0XD0);
+        y = bench_tp_xoy_old(0X90);
+    }
+
+    UNUSED(x);
+    UNUSED(y);
+}
+#endif
+
+/**
+ * @brief       Ԥ: ѱʻ"2"3("222")ӵ
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_prep_add(void *arg)
+{
+    uint16_t dx;
+    uint8_t i;
+
+    UNUSED(arg);
+    prep_clear();                       /* ǻ, Ҫ */
+
+    for (dx = 0; dx < 3 * BENCH_PREP_STEP; dx += BENCH_PREP_STEP)
+    {
+        prep_add(g_board_stroke[0][0] + dx - BENCH_PREP_STEP, g_board_stroke[0][1],
+                 g_board_stroke[0][0] + dx - BENCH_PREP_STEP, g_board_stroke[0][1]);
+
+        for (i = 1; i < BENCH_STROKE_NUM; i++)
+        {
+            prep_add(g_board_stroke[i - 1][0] + dx - BENCH_PREP_STEP, g_board_stroke[i - 1][1],
+                     g_board_stroke[i][0] + dx - BENCH_PREP_STEP, g_board_stroke[i][1]);
+        }
+    }
+
+    g_board_lcd_dirty = 1;
+}
+
+/**
+ * @brief       Ԥ: ָ( prep_add)
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_prep_seg(void *arg)
+{
+    UNUSED(arg);
+    prep_segment();
+}
+
+/**
+ * @brief       Ԥ: һֵ28x28( prep_add  prep_seg, ׼ͬ)
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_prep_run(void *arg)
+{
+    UNUSED(arg);
+    prep_run(0, g_board_in);
+}
+
+/**
+ * @brief       ʶ"222"( prep_add)
+ * @param       arg: NULLʱÿڶȫ
+ * @retval      
+ */
+static void bench_strip(void *arg)
+{
+    strip_result_t r;
+
+    strip_run(bench_scratch(), prep_strip(strip_image(bench_scratch()), STRIP_W_MAX), arg == NULL, &r);
+}
+
+/**
+ * @brief       ʶ: ѱʻ"2"߶͸ GRU
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_online_add(void *arg)
+{
+    uint8_t i;
+
+    UNUSED(arg);
+    online_clear();
+    online_add(g_board_stroke[0][0], g_board_stroke[0][1], g_board_stroke[0][0], g_board_stroke[0][1]);
+
+    for (i = 1; i < BENCH_STROKE_NUM; i++)
+    {
+        online_add(g_board_stroke[i - 1][0], g_board_stroke[i - 1][1], g_board_stroke[i][0], g_board_stroke[i][1]);
+    }
+}
+
+/**
+ * @brief       ʶ: ( online_add)
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_online_res(void *arg)
+{
+    float prob[NN_OUT_NUM];
+
+    UNUSED(arg);
+    online_result(prob);
+}
+
+/**
+ * @brief       ô洢
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_ee_read(void *arg)
+{
+    UNUSED(arg);
+    at24cxx_read(CFG_ADDR, g_board_ee, CFG_SIZE);
+}
+
+/**
+ * @brief       ֽô洢(ԭ at24cxx_read)
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_ee_read_old(void *arg)
+{
+    uint16_t i;
+
+    UNUSED(arg);
+
+    for (i = 0; i < CFG_SIZE; i++)
+    {
+        g_board_ee[i] = at24cxx_read_one_byte(CFG_ADDR + i);
+    }
+}
+
+/**
+ * @brief       дһü¼(, ݲ), дڽ
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_cfg_save(void *arg)
+{
+    cfg_ui_t ui = {1, {0}};
+
+    UNUSED(arg);
+    cfg_get(CFG_UI, &ui, sizeof(ui));
+    cfg_set(CFG_UI, &ui, sizeof(ui));
+    at24cxx_wait();
+}
+
+/**
+ * @brief       ԭУ׼: 13ֽֽд, ÿֽڵ10ms(дض)
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void bench_cal_save_old(void *arg)
+{
+    uint8_t i;
+
+    UNUSED(arg);
+
+    for (i = 0; i < 13; i++)
+    {
+        at24cxx_write_one_byte(BENCH_CAL_ADDR + i, g_board_cal[i]);
+        HAL_Delay(10);                  /* ԭ delay_ms(10); û delay_init ʱ delay_ms ȴ, ﰴ */
+    }
+}
+
+/**
+ * @brief       ערеĻ׼(lcd_init  AI_Init ֮, ֮ǰ)
+ * @param       infer: , 
+ * @retval      
+ */
+void bench_board_init(uint32_t (*infer)(const float *in, float *out))
+{
+    const bench_t *ref = bench_find("ref_net");
+    uint8_t i;
+
+    g_board_infer = infer;
+
+    bench_prep_add(NULL);               /* Ԥıʻ"2", ʵʻһ */
+    prep_segment();
+    prep_run(0, g_board_in);
+    prep_clear();
+    g_board_lcd_dirty = 0;
+
+    bench_add("ai_net", bench_ai_net, NULL, ref ? ref->bytes : 0);  /* ôͲοʵͬ */
+    bench_add("ai_fmap", bench_ai_fmap, NULL, ref ? ref->bytes : 0);
+    bench_add("lcd_clear", bench_lcd_clear, NULL, (uint32_t)lcddev.width * lcddev.height * 2);
+    bench_add("clear_ai", bench_clear_ai, NULL, (uint32_t)lcddev.width * lcddev.height * 2);
+    bench_add("lcd_fill", bench_lcd_fill, NULL, BENCH_FILL_SIZE * BENCH_FILL_SIZE * 2);
+    bench_add("bline", bench_bline, NULL, bench_bus_bytes(bench_bline));
+    bench_add("bline_old", bench_bline_old, NULL, bench_bus_bytes(bench_bline_old));
+    bench_add("lcd_text", bench_lcd_text, NULL, bench_bus_bytes(bench_lcd_text));
+    bench_panel(NULL);                  /* һ, лһεֽ */
+    bench_add("panel", bench_panel, NULL, bench_bus_bytes(bench_panel));
+#if !PANEL_PROB_TEXT
+    bench_add("bars", bench_bars, NULL, bench_bus_bytes(bench_bars));
+#endif
+    bench_add("panel_old", bench_panel_old, NULL, bench_bus_bytes(bench_panel_old));
+    bench_add("tp_scan", bench_tp_scan, NULL, 0);
+
+    if (tp_dev.scan == gt9xxx_scan)
+    {
+        bench_add("tp_frame", bench_tp_frame, NULL, 4 + GT9XXX_FRAME_LEN(1));  /* дַ+Ĵ, ַ+ */
+        bench_add("tp_frame_old", bench_tp_frame_old, NULL, (4 + 1) + (4 + 4));
+    }
+    else if (!(tp_dev.touchtype & 0X80))
+    {
+        bench_add("tp_point", bench_tp_point, NULL, 2 * (2 * 2 * 5 + 1));  /* , ÿ21ֽ */
+#if !TP_HW_SPI
+        bench_add("tp_point_old", bench_tp_point_old, NULL, 4 * 5 * (8 + 1 + 16) / 8);
+#endif
+    }
+
+    bench_add("prep_add", bench_prep_add, NULL, 0);
+    bench_add("prep_seg", bench_prep_seg, NULL, 0);
+    bench_add("prep_run", bench_prep_run, NULL, 0);
+    bench_add("strip", bench_strip, NULL, 0);
+    bench_add("strip_all", bench_strip, (void *)1, 0);
+    bench_add("online_add", bench_online_add, NULL, 0);
+    bench_add("online_res", bench_online_res, NULL, 0);
+
+    if (cfg_get_stats()->ee_err == 0 && at24cxx_read(BENCH_CAL_ADDR, g_board_cal, sizeof(g_board_cal)) == 0)
+    {
+        bench_add("ee_read", bench_ee_read, NULL, CFG_SIZE);
+        bench_add("ee_read_old", bench_ee_read_old, NULL, CFG_SIZE);
+        bench_add("cfg_save", bench_cfg_save, NULL, 4 + CFG_HDR_SIZE + sizeof(cfg_ui_t));   /* ͷ +  + CRC */
+        bench_add("cal_save_old", bench_cal_save_old, NULL, 13);
+    }
+
+    bench_pic_init();
+
+    for (i = 0; i < 3; i++)
+    {
+        if (g_board_img[i].len)         /* 0: ѹŲ */
+        {
+            bench_add((i == ASSET_RAW) ? "pic_raw" : (i == ASSET_RLE) ? "pic_rle" : "pic_lz", bench_pic,
+                      &g_board_img[i], BENCH_PIC_W * BENCH_PIC_H * 2);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+/**
+ ****************************************************************************************************
+ * @file        boot.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ¼: ÿһɵʱ, LCD/ICǷϴμĽ, һʱ
+ ****************************************************************************************************
+ * @attention
+ *
+ * boot_mark ֻѭͿʱ. CYCCNT 25.6һȦ, һ֮ǰ.
+ *
+ ****************************************************************************************************
+ */
+
+#include "boot.h"
+#include "log.h"
+
+
+static const char *const g_boot_name[BOOT_STEP_NUM] =
+{
+    "start", "cfg", "lcd_id", "tp", "ai", "lcd_ready", "frame", "infer", "shown"
+};
+
+static const char *const g_boot_hint_name[3] = {"none", "hit", "miss"};
+
+static uint32_t g_boot_cyc[BOOT_STEP_NUM];  /* ÿһʱ DWT->CYCCNT */
+static uint16_t g_boot_done = 0;            /* bit n: n¼ */
+static uint32_t g_boot_ms = 0;              /* BOOT_START ʱ HAL_GetTick() */
+static uint8_t g_boot_lcd_hint = BOOT_HINT_NONE;
+static uint8_t g_boot_tp_hint = BOOT_HINT_NONE;
+static uint8_t g_boot_reported = 0;
+
+/**
+ * @brief       ¼һɵʱ, ֻǵһ
+ * @param       step: BOOT_xx
+ * @retval      
+ */
+void boot_mark(uint8_t step)
+{
+    if (step >= BOOT_STEP_NUM || (g_boot_done & (1 << step)))
+    {
+        return;
+    }
+
+    g_boot_cyc[step] = DWT->CYCCNT;
+    g_boot_done |= 1 << step;
+
+    if (step == BOOT_START)
+    {
+        g_boot_ms = HAL_GetTick();
+    }
+}
+
+/**
+ * @brief       ¼ LCD/IC ǷϴμĽ
+ * @param       lcd: LCD ID  BOOT_HINT_xx
+ * @param       tp : IC BOOT_HINT_xx
+ * @retval      
+ */
+void boot_hint(uint8_t lcd, uint8_t tp)
+{
+    g_boot_lcd_hint = lcd;
+    g_boot_tp_hint = tp;
+}
+
+/**
+ * @brief       һɵʱ
+ * @param       step: BOOT_xx
+ * @retval      Ӹλ(HAL_Init)us, 0ʾûм¼
+ */
+uint32_t boot_us(uint8_t step)
+{
+    if (step >= BOOT_STEP_NUM || (g_boot_done & (1 << step)) == 0 || (g_boot_done & (1 << BOOT_START)) == 0)
+    {
+        return 0;
+    }
+
+    return g_boot_ms * 1000 + (g_boot_cyc[step] - g_boot_cyc[BOOT_START]) / (SystemCoreClock / 1000000);
+}
+
+/**
+ * @brief       һνʾԺһο¼(־)
+ * @param       
+ * @retval      
+ */
+void boot_poll(void)
+{
+    if (g_boot_reported || (g_boot_done & (1 << BOOT_SHOWN)) == 0)
+    {
+        return;
+    }
+
+    g_boot_reported = 1;
+    LOG_BIN(BOOT_FIRST, boot_us(BOOT_LCD_READY), boot_us(BOOT_FRAME), boot_us(BOOT_INFER),
+            g_boot_lcd_hint | (g_boot_tp_hint << 4));
+    boot_report();
+}
+
+/**
+ * @brief       ¼: ÿһʱ̺ʱ, ϴμʹ
+ * @param       
+ * @retval      
+ */
+void boot_report(void)
+{
+    uint32_t last = 0, t;
+    uint8_t i;
+
+    for (i = 0; i < BOOT_STEP_NUM; i++)
+    {
+        t = boot_us(i);
+
+        if (t == 0)
+        {
+            log_printf("boot: %-9s -\r\n", g_boot_name[i]);
+            continue;
+        }
+
+        log_printf("boot: %-9s %8lu us  +%lu\r\n", g_boot_name[i], (unsigned long)t, (unsigned long)(t - last));
+        last = t;
+    }
+
+    log_printf("boot: lcd hint %s, tp hint %s, first inference at %lu us\r\n", g_boot_hint_name[g_boot_lcd_hint],
+               g_boot_hint_name[g_boot_tp_hint], (unsigned long)boot_us(BOOT_INFER));
+}
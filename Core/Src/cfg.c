@@ -0,0 +1,290 @@
+/**
+ ****************************************************************************************************
+ * @file        cfg.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       EEPROM(24C02)ü¼: 汾CRC, ÿ¼д
+ ****************************************************************************************************
+ * @attention
+ *
+ * ۵ĴСҳ(EE_PAGE_SIZE)ȡ, ¼: A0 B0 A1 B1 ...
+ *  CFG_SIZE ֽԼ CFG_SIZE x 9 I2Cʱ, ԭֽÿֽҪټ4ֽڵѰַ.
+ * CRC proto.c CRC, ֻѭͿʱ, ͬʱ.
+ *
+ ****************************************************************************************************
+ */
+
+#include "cfg.h"
+#include "24cxx.h"
+#include "crc.h"
+#include "log.h"
+#include "string.h"
+
+
+#define CFG_ALIGN(n)        (((n) + 3) & ~3)
+#define CFG_SLOT_SIZE(len)  ((CFG_HDR_SIZE + CFG_ALIGN(len) + 4 + EE_PAGE_SIZE - 1) / EE_PAGE_SIZE * EE_PAGE_SIZE)
+#define CFG_NONE            0xFF        /* ûЧĲ */
+
+/* ¼ʽ, ݸʽ˾ͼӰ汾, ɵļ¼û */
+typedef struct
+{
+    uint8_t id;
+    uint8_t ver;
+    uint8_t len;                        /* ֽ */
+    uint8_t reserved;
+    const char *name;
+} cfg_def_t;
+
+static const cfg_def_t g_cfg_def[CFG_NUM] =
+{
+    {CFG_TP_CAL, 1, 12, 0, "tp_cal"},
+    {CFG_LCD, 2, sizeof(cfg_lcd_t), 0, "lcd"},     /* 汾2: reserved ĳ tp */
+    {CFG_UI, 1, sizeof(cfg_ui_t), 0, "ui"},
+};
+
+static uint32_t g_cfg_img[CFG_SIZE / 4];    /* 洢ڴĸ */
+static uint8_t g_cfg_off[CFG_NUM];          /* A۵ƫ, B۽ں; CFG_SIZE ʾŲ */
+static uint8_t g_cfg_cur[CFG_NUM];          /* ЧĲ(0/1), CFG_NONE ʾû */
+static cfg_stats_t g_cfg_stats;
+
+/**
+ * @brief       us
+ * @param       cyc: 
+ * @retval      us
+ */
+static uint32_t cfg_us(uint32_t cyc)
+{
+    return cyc / (SystemCoreClock / 1000000);
+}
+
+/**
+ * @brief       IDҼ¼
+ * @param       id: ¼ID
+ * @retval      ڱ, CFG_NUM ʾû
+ */
+static uint8_t cfg_find(uint8_t id)
+{
+    uint8_t i;
+
+    for (i = 0; i < CFG_NUM && g_cfg_def[i].id != id; i++);
+
+    return i;
+}
+
+/**
+ * @brief       ڸλ
+ * @param       i   : ¼
+ * @param       slot: 0, A; 1, B
+ * @retval      ۵׵ַ
+ */
+static uint8_t *cfg_slot(uint8_t i, uint8_t slot)
+{
+    return (uint8_t *)g_cfg_img + g_cfg_off[i] + slot * CFG_SLOT_SIZE(g_cfg_def[i].len);
+}
+
+/**
+ * @brief       һ
+ * @param       i: ¼
+ * @param       p: 
+ * @retval      0, Ч; 1, յ(ID¼); 2, (ʽCRC)
+ */
+static uint8_t cfg_check(uint8_t i, const uint8_t *p)
+{
+    const cfg_def_t *d = &g_cfg_def[i];
+    uint16_t n = (CFG_HDR_SIZE + CFG_ALIGN(d->len)) / 4;
+
+    if (p[0] != d->id)
+    {
+        return 1;
+    }
+
+    if (p[1] != d->ver || p[2] != d->len)
+    {
+        return 2;
+    }
+
+    return (HAL_CRC_Calculate(&hcrc, (uint32_t *)p, n) == ((const uint32_t *)p)[n]) ? 0 : 2;
+}
+
+/**
+ * @brief       洢, ÿ¼
+ * @param       
+ * @retval      Чļ¼
+ */
+uint8_t cfg_load(void)
+{
+    uint32_t t = DWT->CYCCNT;
+    uint16_t off = 0;
+    uint8_t i, a, b;
+
+    at24cxx_init();
+    memset(&g_cfg_stats, 0, sizeof(g_cfg_stats));
+    memset(g_cfg_cur, CFG_NONE, sizeof(g_cfg_cur));
+
+    if (at24cxx_read(CFG_ADDR, (uint8_t *)g_cfg_img, CFG_SIZE))
+    {
+        g_cfg_stats.ee_err = 1;
+        memset(g_cfg_img, 0xFF, sizeof(g_cfg_img));
+    }
+
+    for (i = 0; i < CFG_NUM; i++)
+    {
+        g_cfg_off[i] = off;
+        off += 2 * CFG_SLOT_SIZE(g_cfg_def[i].len);
+
+        if (off > CFG_SIZE)             /* ȴ洢, ¼ */
+        {
+            g_cfg_off[i] = CFG_SIZE;
+            continue;
+        }
+
+        a = cfg_check(i, cfg_slot(i, 0));
+        b = cfg_check(i, cfg_slot(i, 1));
+        g_cfg_stats.load_bad += (a == 2) + (b == 2);
+
+        if (a == 0 && b == 0)           /* Чȡµ */
+        {
+            g_cfg_cur[i] = ((int8_t)(cfg_slot(i, 1)[3] - cfg_slot(i, 0)[3]) > 0) ? 1 : 0;
+        }
+        else if (a == 0 || b == 0)
+        {
+            g_cfg_cur[i] = (a == 0) ? 0 : 1;
+        }
+
+        g_cfg_stats.load_ok += (g_cfg_cur[i] != CFG_NONE);
+    }
+
+    g_cfg_stats.load_us = cfg_us(DWT->CYCCNT - t);
+    return g_cfg_stats.load_ok;
+}
+
+/**
+ * @brief       һ¼(ڴĸ)
+ * @param       id  : ¼ID
+ * @param       data: 
+ * @param       len : ݳ, ͱͬ
+ * @retval      0, ɹ; 1, û¼򳤶Ȳ
+ */
+uint8_t cfg_get(uint8_t id, void *data, uint8_t len)
+{
+    uint8_t i = cfg_find(id);
+
+    if (i == CFG_NUM || len != g_cfg_def[i].len || g_cfg_cur[i] == CFG_NONE)
+    {
+        return 1;
+    }
+
+    memcpy(data, cfg_slot(i, g_cfg_cur[i]) + CFG_HDR_SIZE, len);
+    return 0;
+}
+
+/**
+ * @brief       дһ¼: дûõĲ, ż1
+ *   @note      ҳд, һҳд(һηEEPROMʱACKѯ)
+ * @param       id  : ¼ID
+ * @param       data: 
+ * @param       len : ݳ, ͱͬ
+ * @retval      0, ɹ; 1, û¼򳤶Ȳ; 2, EEPROM Ӧ
+ */
+uint8_t cfg_set(uint8_t id, const void *data, uint8_t len)
+{
+    uint32_t t = DWT->CYCCNT;
+    uint8_t i = cfg_find(id);
+    uint8_t slot, *p;
+    uint16_t n;
+
+    if (i == CFG_NUM || len != g_cfg_def[i].len || g_cfg_off[i] + 2 * CFG_SLOT_SIZE(len) > CFG_SIZE)
+    {
+        return 1;
+    }
+
+    slot = (g_cfg_cur[i] == 0) ? 1 : 0;
+    p = cfg_slot(i, slot);
+    n = (CFG_HDR_SIZE + CFG_ALIGN(len)) / 4;
+
+    memset(p, 0, n * 4);
+    p[0] = id;
+    p[1] = g_cfg_def[i].ver;
+    p[2] = len;
+    p[3] = (g_cfg_cur[i] == CFG_NONE) ? 0 : cfg_slot(i, g_cfg_cur[i])[3] + 1;
+    memcpy(p + CFG_HDR_SIZE, data, len);
+    ((uint32_t *)p)[n] = HAL_CRC_Calculate(&hcrc, (uint32_t *)p, n);
+
+    if (at24cxx_write(CFG_ADDR + (p - (uint8_t *)g_cfg_img), p, (n + 1) * 4))
+    {
+        g_cfg_stats.ee_err = 1;
+        return 2;
+    }
+
+    g_cfg_cur[i] = slot;
+    g_cfg_stats.saves++;
+    g_cfg_stats.save_bytes = (n + 1) * 4;
+    g_cfg_stats.save_us = cfg_us(DWT->CYCCNT - t);
+    return 0;
+}
+
+/**
+ * @brief       м¼(ÿ۵IDд0), ´οĬֵ, У׼
+ * @param       
+ * @retval      
+ */
+void cfg_erase(void)
+{
+    uint8_t i, slot, *p;
+
+    for (i = 0; i < CFG_NUM; i++)
+    {
+        if (g_cfg_off[i] + 2 * CFG_SLOT_SIZE(g_cfg_def[i].len) > CFG_SIZE)
+        {
+            continue;
+        }
+
+        for (slot = 0; slot < 2; slot++)
+        {
+            p = cfg_slot(i, slot);
+            p[0] = 0;
+            at24cxx_write(CFG_ADDR + (p - (uint8_t *)g_cfg_img), p, 1);
+        }
+
+        g_cfg_cur[i] = CFG_NONE;
+    }
+}
+
+/**
+ * @brief       ȡͳ
+ * @param       
+ * @retval      ͳ
+ */
+const cfg_stats_t *cfg_get_stats(void)
+{
+    return &g_cfg_stats;
+}
+
+/**
+ * @brief       ÿ¼״̬Ͷдʱ
+ * @param       
+ * @retval      
+ */
+void cfg_report(void)
+{
+    uint8_t i;
+
+    log_printf("cfg: load %u B in %lu us, %u records, %u bad slots%s\r\n", CFG_SIZE, (unsigned long)g_cfg_stats.load_us,
+               g_cfg_stats.load_ok, g_cfg_stats.load_bad, g_cfg_stats.ee_err ? ", EEPROM not responding" : "");
+
+    for (i = 0; i < CFG_NUM; i++)
+    {
+        if (g_cfg_cur[i] == CFG_NONE)
+        {
+            log_printf("cfg: %-6s none\r\n", g_cfg_def[i].name);
+        }
+        else
+        {
+            log_printf("cfg: %-6s v%u, slot %c at %u, seq %u\r\n", g_cfg_def[i].name, g_cfg_def[i].ver, 'A' + g_cfg_cur[i],
+                       CFG_ADDR + (unsigned)(cfg_slot(i, g_cfg_cur[i]) - (uint8_t *)g_cfg_img), cfg_slot(i, g_cfg_cur[i])[3]);
+        }
+    }
+
+    log_printf("cfg: %lu saves, last %lu B in %lu us\r\n", (unsigned long)g_cfg_stats.saves,
+               (unsigned long)g_cfg_stats.save_bytes, (unsigned long)g_cfg_stats.save_us);
+}
@@ -0,0 +1,339 @@
+/**
+ ****************************************************************************************************
+ * @file        dirty.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       LCDιӳٺϳ
+ ****************************************************************************************************
+ * @attention
+ *
+ * ֻѭǼǺˢ(ʾ, , ׼), PendSVĴ/񲻵,
+ * ֱӻī. α޸ĺÿһ(DIRTY_BAND_PIXELS )ˢ¶ڵ(ҲдLCD),
+ * ػҪʮms, ηſ, ɨ5ms޲ᱻס.
+ *
+ ****************************************************************************************************
+ */
+
+#include "string.h"
+#include "dirty.h"
+#include "lcd.h"
+#include "sched.h"
+
+#ifndef HOST_SIM
+#include "log.h"
+#endif
+
+
+static dirty_rect_t g_dirty_rect[DIRTY_RECT_NUM];
+static uint8_t g_dirty_num = 0;
+static dirty_paint_t g_dirty_layer[DIRTY_LAYER_NUM];
+static uint8_t g_dirty_layer_num = 0;
+static uint16_t g_dirty_bg = WHITE;
+static uint16_t g_dirty_line[DIRTY_LINE_MAX];       /* ϳһ */
+static dirty_stats_t g_dirty_stats;
+static uint32_t g_dirty_tick = 0;                   /* ͳƴڿʼʱ(ms) */
+
+/**
+ * @brief       
+ * @param       r: 
+ * @retval      
+ */
+static uint32_t dirty_area(const dirty_rect_t *r)
+{
+    return (uint32_t)(r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+/**
+ * @brief       εӾ
+ * @param       a, b: 
+ * @retval      Ӿ
+ */
+static dirty_rect_t dirty_union(const dirty_rect_t *a, const dirty_rect_t *b)
+{
+    dirty_rect_t u;
+
+    u.x0 = (a->x0 < b->x0) ? a->x0 : b->x0;
+    u.y0 = (a->y0 < b->y0) ? a->y0 : b->y0;
+    u.x1 = (a->x1 > b->x1) ? a->x1 : b->x1;
+    u.y1 = (a->y1 > b->y1) ? a->y1 : b->y1;
+    return u;
+}
+
+/**
+ * @brief       ʼ
+ * @param       bg: ɫ, һ
+ * @retval      
+ */
+void dirty_init(uint16_t bg)
+{
+    g_dirty_bg = bg;
+    g_dirty_num = 0;
+    g_dirty_layer_num = 0;
+    memset(&g_dirty_stats, 0, sizeof(g_dirty_stats));
+    g_dirty_tick = HAL_GetTick();
+}
+
+/**
+ * @brief       עͼ, ע
+ * @param       paint: һеĺ
+ * @retval      0, ɹ; 1, ͼ;
+ */
+uint8_t dirty_layer_add(dirty_paint_t paint)
+{
+    if (g_dirty_layer_num >= DIRTY_LAYER_NUM)
+    {
+        return 1;
+    }
+
+    g_dirty_layer[g_dirty_layer_num++] = paint;
+    return 0;
+}
+
+/**
+ * @brief       Ǽһ(), ĻĲֲõ
+ * @param       x0,y0: Ͻ
+ * @param       x1,y1: ½
+ * @retval      
+ */
+void dirty_add(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    dirty_rect_t r, u;
+    uint32_t cost, best_cost;
+    uint8_t i, best;
+
+    if (x0 > x1 || y0 > y1 || x0 >= lcddev.width || y0 >= lcddev.height)
+    {
+        return;
+    }
+
+    r.x0 = x0;
+    r.y0 = y0;
+    r.x1 = (x1 < lcddev.width) ? x1 : lcddev.width - 1;
+    r.y1 = (y1 < lcddev.height) ? y1 : lcddev.height - 1;
+
+    sched_lock();
+    g_dirty_stats.added++;
+
+again:
+    for (i = 0; i < g_dirty_num; i++)
+    {
+        if (g_dirty_rect[i].x0 <= r.x0 && g_dirty_rect[i].y0 <= r.y0 &&
+            g_dirty_rect[i].x1 >= r.x1 && g_dirty_rect[i].y1 >= r.y1)
+        {
+            g_dirty_stats.skipped++;        /* Ѿ */
+            sched_unlock();
+            return;
+        }
+
+        u = dirty_union(&g_dirty_rect[i], &r);
+
+        /* ཻ(ӾεĿ߶֮), ߺϲһδڵĿ */
+        if ((u.x1 - u.x0 <= (g_dirty_rect[i].x1 - g_dirty_rect[i].x0) + (r.x1 - r.x0) &&
+             u.y1 - u.y0 <= (g_dirty_rect[i].y1 - g_dirty_rect[i].y0) + (r.y1 - r.y0)) ||
+            dirty_area(&u) <= dirty_area(&g_dirty_rect[i]) + dirty_area(&r) + DIRTY_MERGE_COST)
+        {
+            g_dirty_rect[i] = g_dirty_rect[--g_dirty_num];
+            g_dirty_stats.merged++;
+            r = u;
+            goto again;                     /* , ܺͱľཻ */
+        }
+    }
+
+    if (g_dirty_num == DIRTY_RECT_NUM)      /* , ϲٵǸ */
+    {
+        best = 0;
+        best_cost = 0xFFFFFFFF;
+
+        for (i = 0; i < g_dirty_num; i++)
+        {
+            u = dirty_union(&g_dirty_rect[i], &r);
+            cost = dirty_area(&u) - dirty_area(&g_dirty_rect[i]);
+
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                best = i;
+            }
+        }
+
+        u = dirty_union(&g_dirty_rect[best], &r);
+        g_dirty_rect[best] = g_dirty_rect[--g_dirty_num];
+        g_dirty_stats.merged++;
+        r = u;
+        goto again;
+    }
+
+    g_dirty_rect[g_dirty_num++] = r;
+    sched_unlock();
+}
+
+/**
+ * @brief       ǼĻ(Ļδ֪ʱ)
+ * @param       
+ * @retval      
+ */
+void dirty_add_all(void)
+{
+    dirty_add(0, 0, lcddev.width - 1, lcddev.height - 1);
+}
+
+/**
+ * @brief       ˢһ: һδ, кϳɺд
+ * @param       r: 
+ * @retval      
+ */
+static void dirty_paint(const dirty_rect_t *r)
+{
+    uint16_t w = r->x1 - r->x0 + 1;
+    uint16_t x, y;
+    uint8_t k;
+
+    lcd_set_window(r->x0, r->y0, w, r->y1 - r->y0 + 1);
+    lcd_write_ram_prepare();
+
+    for (y = r->y0; y <= r->y1; y++)
+    {
+        for (x = 0; x < w; x++)
+        {
+            g_dirty_line[x] = g_dirty_bg;
+        }
+
+        for (k = 0; k < g_dirty_layer_num; k++)
+        {
+            g_dirty_layer[k](y, r->x0, r->x1, g_dirty_line);
+        }
+
+        for (x = 0; x < w; x++)
+        {
+            LCD_WR_RAM(g_dirty_line[x]);
+        }
+    }
+
+    LCD_BUS_ADD(dirty_area(r));
+}
+
+/**
+ * @brief       ˢһ֡Ǽǵо, ˳(ϵ, )
+ * @param       
+ * @retval      ˢµľ
+ */
+uint8_t dirty_flush(void)
+{
+    dirty_rect_t r, band;
+    uint32_t bytes = 0, pixels = 0;
+    uint16_t rows;
+#if LCD_BUS_STATS
+    uint32_t w;
+#endif
+    uint8_t i, first, n = 0;
+
+    while (1)
+    {
+        sched_lock();
+
+        if (g_dirty_num == 0)
+        {
+            sched_unlock();
+            break;
+        }
+
+        for (first = 0, i = 1; i < g_dirty_num; i++)
+        {
+            if (g_dirty_rect[i].y0 < g_dirty_rect[first].y0 ||
+                (g_dirty_rect[i].y0 == g_dirty_rect[first].y0 && g_dirty_rect[i].x0 < g_dirty_rect[first].x0))
+            {
+                first = i;
+            }
+        }
+
+        r = g_dirty_rect[first];
+        g_dirty_rect[first] = g_dirty_rect[--g_dirty_num];
+        pixels += dirty_area(&r);
+        n++;
+        band = r;
+        rows = DIRTY_BAND_PIXELS / (r.x1 - r.x0 + 1);
+        rows = rows ? rows : 1;
+
+        while (1)                       /* һһˢ, ֮ſ */
+        {
+            band.y1 = (r.y1 - band.y0 >= rows) ? band.y0 + rows - 1 : r.y1;
+#if LCD_BUS_STATS
+            w = g_lcd_bus_writes;
+            dirty_paint(&band);
+            bytes += (g_lcd_bus_writes - w) * 2;
+#else
+            dirty_paint(&band);
+            bytes += dirty_area(&band) * 2;
+#endif
+            sched_unlock();
+
+            if (band.y1 == r.y1)
+            {
+                break;
+            }
+
+            band.y0 = band.y1 + 1;
+            sched_lock();
+        }
+    }
+
+    if (n)
+    {
+        g_dirty_stats.frames++;
+        g_dirty_stats.rects = n;
+        g_dirty_stats.pixels = pixels;
+        g_dirty_stats.bytes = bytes;
+        g_dirty_stats.total_rects += n;
+        g_dirty_stats.total_bytes += bytes;
+        g_dirty_stats.max_bytes = (bytes > g_dirty_stats.max_bytes) ? bytes : g_dirty_stats.max_bytes;
+        g_dirty_stats.added = 0;
+        g_dirty_stats.merged = 0;
+        g_dirty_stats.skipped = 0;
+    }
+
+    return n;
+}
+
+/**
+ * @brief       ȡͳ
+ *   @note      rects/pixels/bytes һ֡; added/merged/skipped ڵǼǵһ֡
+ * @param       
+ * @retval      ͳ
+ */
+const dirty_stats_t *dirty_get_stats(void)
+{
+    return &g_dirty_stats;
+}
+
+/**
+ * @brief       ʱͳƲۼֵ
+ * @param       
+ * @retval      
+ */
+void dirty_poll(void)
+{
+#if DIRTY_REPORT_MS
+    dirty_stats_t *s = &g_dirty_stats;
+
+    if (HAL_GetTick() - g_dirty_tick < DIRTY_REPORT_MS)
+    {
+        return;
+    }
+
+    g_dirty_tick = HAL_GetTick();
+
+    if (s->frames == 0)
+    {
+        return;
+    }
+
+    log_printf("dirty: %lu frames %lu rects %lu B, max %lu B\r\n", (unsigned long)s->frames,
+               (unsigned long)s->total_rects, (unsigned long)s->total_bytes, (unsigned long)s->max_bytes);
+    log_printf("dirty: last %lu rects %lu px %lu B\r\n", (unsigned long)s->rects,
+               (unsigned long)s->pixels, (unsigned long)s->bytes);
+    s->frames = 0;
+    s->total_rects = 0;
+    s->total_bytes = 0;
+    s->max_bytes = 0;
+#endif
+}
@@ -0,0 +1,300 @@
+/**
+ ****************************************************************************************************
+ * @file        fmap.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ͼӻ: ͨ X-CUBE-AI  observer ص, ʱѾͼ
+ ****************************************************************************************************
+ * @attention
+ *
+ * ص(ai_network_run ڲ)ִ, һͨĴںضڵ,
+ * 񲻻мĴ. ڵ㰴ִ˳ c_idx ʶ,  nn_ref.h Ĳһ;
+ * ״ͱĲһʱ()һ㲻.
+ *
+ ****************************************************************************************************
+ */
+
+#include "fmap.h"
+#include "core_common.h"
+#include "ai_datatypes_internal.h"
+#include "lcd.h"
+#include "sched.h"
+#include "nn_ref.h"
+#include "log.h"
+
+
+/* Ҫʾһ */
+typedef struct
+{
+    uint8_t layer;                      /* c_idx */
+    uint8_t h;
+    uint8_t w;
+    uint8_t c;
+    uint16_t x;                         /* Ͻ */
+    uint16_t y;
+    uint8_t cols;                       /* ÿеͨ, 0ʾŲ */
+    uint8_t next;                       /* һҪͨ */
+    uint32_t cost;                      /* һͨ(ƽ) */
+} fmap_layer_t;
+
+static fmap_layer_t g_fmap_layer[] =
+{
+    {.layer = NN_L_CONV0, .h = 28, .w = 28, .c = 16},     /* ֶ fmap_init  */
+    {.layer = NN_L_CONV3, .h = 14, .w = 14, .c = 32},
+    {.layer = NN_L_CONV6, .h = 7, .w = 7, .c = 64},
+};
+#define FMAP_LAYER_NUM      (sizeof(g_fmap_layer) / sizeof(g_fmap_layer[0]))
+
+static uint16_t g_fmap_pal[256];                    /* ɫ:  ->  ->  ->  */
+static ai_observer_exec_ctx g_fmap_ctx;
+static uint32_t g_fmap_start;                       /* ʼ */
+static uint32_t g_fmap_spent;                       /* ӻõ */
+static uint32_t g_fmap_budget = 0;                  /* Ԥ, һֻʱ */
+static fmap_stats_t g_fmap_stats;
+static uint32_t g_fmap_tick = 0;                    /* ͳƴڿʼʱ(ms) */
+static uint8_t g_fmap_pause = 0;                    /* ͣʱصʲô */
+static uint8_t g_fmap_on = 1;                       /* (cfg.h  CFG_UI), 0ʾ */
+
+/**
+ * @brief       һͨ: С/ֵ8λ, ɫ, һд
+ * @param       l   : 
+ * @param       data: һ(HWC)
+ * @param       ch  : ͨ
+ * @retval      
+ */
+static void fmap_tile(const fmap_layer_t *l, const float *data, uint8_t ch)
+{
+    const float *p = data + ch;
+    uint16_t n = l->h * l->w;
+    uint16_t i;
+    float min = p[0], max = p[0], scale, v;
+
+    for (i = 1; i < n; i++)
+    {
+        v = p[i * l->c];
+        min = (v < min) ? v : min;
+        max = (v > max) ? v : max;
+    }
+
+    scale = (max > min) ? 255.0f / (max - min) : 0.0f;
+
+    sched_lock();
+    lcd_set_window(l->x + (ch % l->cols) * l->w, l->y + (ch / l->cols) * l->h, l->w, l->h);
+    lcd_write_ram_prepare();
+    LCD_BUS_ADD(n);
+
+    for (i = 0; i < n; i++)
+    {
+        LCD_WR_RAM(g_fmap_pal[(uint8_t)((p[i * l->c] - min) * scale)]);
+    }
+
+    sched_unlock();
+}
+
+/**
+ * @brief       һִ: ԤڴϴͣµͨŻ
+ * @param       l: 
+ * @param       t: 
+ * @retval      
+ */
+static void fmap_layer(fmap_layer_t *l, const ai_tensor *t)
+{
+    const float *data;
+    uint32_t c0, c;
+    uint8_t k;
+
+    if (l->cols == 0 || t == NULL || AI_SHAPE_H(&t->shape) != l->h || AI_SHAPE_W(&t->shape) != l->w ||
+        AI_SHAPE_CH(&t->shape) != l->c)
+    {
+        return;
+    }
+
+    data = (const float *)t->data->data;
+
+    for (k = 0; k < l->c; k++)
+    {
+        if (g_fmap_budget == 0 || g_fmap_spent + l->cost > g_fmap_budget)
+        {
+            g_fmap_stats.skipped += l->c - k;
+            break;
+        }
+
+        c0 = DWT->CYCCNT;
+        fmap_tile(l, data, l->next);
+        c = DWT->CYCCNT - c0;
+        g_fmap_spent += c;
+        l->cost = l->cost ? (l->cost * 3 + c) / 4 : c;
+        l->next = (l->next + 1) % l->c;
+        g_fmap_stats.tiles++;
+    }
+}
+
+/**
+ * @brief       observerص: һڵǰʼʱ, ҪʾĲִʱ, һڵ´εԤ
+ * @param       cookie: δʹ
+ * @param       flags : AI_OBSERVER_xx_EVT
+ * @param       node  : ڵ
+ * @retval      0
+ */
+static ai_u32 fmap_on_node(const ai_handle cookie, const ai_u32 flags, const ai_observer_node *node)
+{
+    uint32_t net;
+    uint8_t i;
+
+    UNUSED(cookie);
+
+    if (g_fmap_pause || !g_fmap_on)
+    {
+        return 0;
+    }
+
+    if (flags & AI_OBSERVER_PRE_EVT)
+    {
+        if (flags & AI_OBSERVER_FIRST_EVT)
+        {
+            g_fmap_start = DWT->CYCCNT;
+            g_fmap_spent = 0;
+        }
+
+        return 0;
+    }
+
+    for (i = 0; i < FMAP_LAYER_NUM; i++)
+    {
+        if (g_fmap_layer[i].layer == node->c_idx)
+        {
+            fmap_layer(&g_fmap_layer[i], GET_TENSOR_OUT(node->tensors, 0));
+            break;
+        }
+    }
+
+    if (flags & AI_OBSERVER_LAST_EVT)
+    {
+        net = DWT->CYCCNT - g_fmap_start - g_fmap_spent;
+        g_fmap_budget = net / 100 * FMAP_BUDGET_PCT;
+        g_fmap_stats.runs++;
+        g_fmap_stats.net_cycles = net;
+        g_fmap_stats.viz_cycles = g_fmap_spent;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       ź, ɵɫ, עobserver
+ * @param       network: ai_network_create_and_init õ
+ * @retval      0, ɹ; 1, رջעʧ;
+ */
+uint8_t fmap_init(ai_handle network)
+{
+    fmap_layer_t *l;
+    uint16_t y = FMAP_Y, rows, r, g, b;
+    uint8_t i;
+
+    for (i = 0; i < FMAP_LAYER_NUM; i++)
+    {
+        l = &g_fmap_layer[i];
+        l->cols = (lcddev.width - 2 * FMAP_MARGIN) / l->w;
+        l->cols = (l->cols > l->c) ? l->c : l->cols;
+        rows = l->cols ? (l->c + l->cols - 1) / l->cols : 0;
+
+        if (l->cols == 0 || y + rows * l->h > FMAP_Y + FMAP_H)
+        {
+            l->cols = 0;                /* Ų, һ㲻, Ĳ */
+            log_printf("fmap: %s (%u rows of %u) does not fit, not drawn\r\n", g_nn_layer[l->layer].name,
+                       rows, l->h);
+            continue;
+        }
+
+        l->x = (lcddev.width - l->cols * l->w) / 2;
+        l->y = y;
+        y += rows * l->h + FMAP_GAP;
+    }
+
+    for (i = 0; ; i++)                  /* "hot": , Ȼ,  */
+    {
+        r = (i < 85) ? i * 3 : 255;
+        g = (i < 85) ? 0 : (i < 170) ? (i - 85) * 3 : 255;
+        b = (i < 170) ? 0 : (i - 170) * 3;
+        g_fmap_pal[i] = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+
+        if (i == 255)
+        {
+            break;
+        }
+    }
+
+    if (FMAP_BUDGET_PCT == 0)
+    {
+        return 1;
+    }
+
+    g_fmap_ctx.on_node = fmap_on_node;
+    g_fmap_ctx.cookie = NULL;
+    g_fmap_ctx.flags = AI_OBSERVER_PRE_EVT | AI_OBSERVER_POST_EVT;
+    g_fmap_tick = HAL_GetTick();
+    return ai_platform_observer_register_s(network, &g_fmap_ctx) ? 0 : 1;
+}
+
+/**
+ * @brief       ͣ/ָӻ(׼ʱͣ)
+ * @param       pause: 1, ͣ; 0, ָ;
+ * @retval      
+ */
+void fmap_pause(uint8_t pause)
+{
+    g_fmap_pause = pause;
+}
+
+/**
+ * @brief       /رտӻ(), ͻ׼ԵͣӰ
+ *   @note      رʱѾͼĻ, ´
+ * @param       on: 1, ; 0, ر;
+ * @retval      
+ */
+void fmap_enable(uint8_t on)
+{
+    g_fmap_on = on;
+}
+
+/**
+ * @brief       ȡͳ
+ * @param       
+ * @retval      ͳ
+ */
+const fmap_stats_t *fmap_get_stats(void)
+{
+    return &g_fmap_stats;
+}
+
+/**
+ * @brief       ʱͳƲۼֵ
+ * @param       
+ * @retval      
+ */
+void fmap_poll(void)
+{
+#if FMAP_REPORT_MS
+    fmap_stats_t *s = &g_fmap_stats;
+
+    if (HAL_GetTick() - g_fmap_tick < FMAP_REPORT_MS)
+    {
+        return;
+    }
+
+    g_fmap_tick = HAL_GetTick();
+
+    if (s->runs == 0)
+    {
+        return;
+    }
+
+    log_printf("fmap: %lu runs %lu tiles, %lu deferred\r\n", (unsigned long)s->runs,
+               (unsigned long)s->tiles, (unsigned long)s->skipped);
+    log_printf("fmap: last net %lu cyc, viz %lu cyc\r\n", (unsigned long)s->net_cycles,
+               (unsigned long)s->viz_cycles);
+    s->runs = 0;
+    s->tiles = 0;
+    s->skipped = 0;
+#endif
+}
@@ -24,6 +24,12 @@
  * V1.1 20230529
  * 1, ST7796 3.5/ILI9806 4.3GT1151֧
  * 2, gt9xxx_initӴICжضICͷ1ʾʼʧ
+ * V1.2 20261018
+ * 1, INTжϷʽ(GT9XXX_IRQ): INT˲Ŷ, ״̬дһI2C,
+ *    ԭÿ㵥һζ, ΪʡCPUֻÿ10ɨŶһ״̬
+ * 2, I2C1+DMAȡʽ(GT9XXX_HW_IIC): INTжDMA, ж״̬֪ͨ,
+ *    ȡCPUֻж
+ * 3, ȡͳ: ʡINTӳ١CPUռ, ѯʽҲͳ(INTֻʱ), Ա
  ****************************************************************************************************
  */
 
@@ -34,11 +40,188 @@
 #include "gt9xxx.h"
 #include "usart.h"
 #include "delay.h"
+#include "log.h"
 
 
 /* ע: GT9271֧10㴥֮, оƬֻ֧ 5㴥 */
 uint8_t g_gt_tnum = 5;      /* Ĭֵ֧Ĵ(5㴥) */
 
+static uint8_t g_gt_ok = 0;                 /* gt9xxx_init ɹ */
+static uint8_t g_gt_int_mode = 0;           /* INTʽ(GT9XXX_MODSW1_REG2λ) */
+static void (*g_gt_notify)(void) = NULL;    /* ֡ʱ(ж) */
+static volatile uint8_t g_gt_pending = 0;   /* лûINT */
+static volatile uint32_t g_gt_int_cyc = 0;  /* һûINTʱ(DWT) */
+static gt9xxx_stats_t g_gt_stats;
+static uint32_t g_gt_tick = 0;              /* ͳƴڿʼʱ(ms) */
+
+#if GT9XXX_HW_IIC
+I2C_HandleTypeDef g_gt_iic_handle;
+DMA_HandleTypeDef g_gt_dma_handle;
+
+static uint8_t g_gt_rx[GT9XXX_FRAME_LEN(10)];       /* DMA */
+static uint8_t g_gt_frame[GT9XXX_FRAME_LEN(10)];    /* һ֡, ȴȡ */
+static volatile uint8_t g_gt_frame_ready = 0;
+static volatile uint8_t g_gt_iic_state = 0;         /* 0, ; 1, ֡; 2, ״̬ */
+static volatile uint8_t g_gt_again = 0;             /* æʱINT, кٶһ */
+static uint8_t g_gt_zero = 0;
+
+/**
+ * @brief       ʼI2C1ĽDMA
+ * @param       
+ * @retval      
+ */
+static void gt9xxx_iic_init(void)
+{
+    GPIO_InitTypeDef gpio_init_struct;
+
+    GT9XXX_IIC_GPIO_CLK_ENABLE();
+    GT9XXX_IIC_CLK_ENABLE();
+    GT9XXX_IIC_DMA_CLK_ENABLE();
+
+    gpio_init_struct.Pin = GT9XXX_IIC_SCL_GPIO_PIN | GT9XXX_IIC_SDA_GPIO_PIN;
+    gpio_init_struct.Mode = GPIO_MODE_AF_OD;                /* ÿ© */
+    gpio_init_struct.Pull = GPIO_PULLUP;                    /*  */
+    gpio_init_struct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;     /*  */
+    gpio_init_struct.Alternate = GT9XXX_IIC_GPIO_AF;
+    HAL_GPIO_Init(GT9XXX_IIC_GPIO_PORT, &gpio_init_struct);
+
+    g_gt_iic_handle.Instance = GT9XXX_IIC;
+    g_gt_iic_handle.Init.ClockSpeed = GT9XXX_IIC_SPEED;
+    g_gt_iic_handle.Init.DutyCycle = I2C_DUTYCYCLE_2;
+    g_gt_iic_handle.Init.OwnAddress1 = 0;
+    g_gt_iic_handle.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
+    g_gt_iic_handle.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
+    g_gt_iic_handle.Init.OwnAddress2 = 0;
+    g_gt_iic_handle.Init.GeneralCallMode = I2C_GENERALCALL_DISABLE;
+    g_gt_iic_handle.Init.NoStretchMode = I2C_NOSTRETCH_DISABLE;
+    HAL_I2C_Init(&g_gt_iic_handle);
+
+    g_gt_dma_handle.Instance = GT9XXX_IIC_DMA_STREAM;
+    g_gt_dma_handle.Init.Channel = GT9XXX_IIC_DMA_CHANNEL;
+    g_gt_dma_handle.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    g_gt_dma_handle.Init.PeriphInc = DMA_PINC_DISABLE;
+    g_gt_dma_handle.Init.MemInc = DMA_MINC_ENABLE;
+    g_gt_dma_handle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    g_gt_dma_handle.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    g_gt_dma_handle.Init.Mode = DMA_NORMAL;
+    g_gt_dma_handle.Init.Priority = DMA_PRIORITY_LOW;
+    g_gt_dma_handle.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    HAL_DMA_Init(&g_gt_dma_handle);
+    __HAL_LINKDMA(&g_gt_iic_handle, hdmarx, g_gt_dma_handle);
+
+    HAL_NVIC_SetPriority(I2C1_EV_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+    HAL_NVIC_SetPriority(I2C1_ER_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
+    HAL_NVIC_SetPriority(DMA1_Stream0_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Stream0_IRQn);
+}
+
+/**
+ * @brief       һDMA֡(״̬ + ȫ), ж
+ * @param       
+ * @retval      
+ */
+static void gt9xxx_iic_read(void)
+{
+    uint8_t len = GT9XXX_FRAME_LEN(g_gt_tnum);
+
+    if (HAL_I2C_Mem_Read_DMA(&g_gt_iic_handle, GT9XXX_CMD_WR, GT9XXX_GSTID_REG, I2C_MEMADD_SIZE_16BIT, g_gt_rx, len) == HAL_OK)
+    {
+        g_gt_iic_state = 1;
+        g_gt_stats.reads++;
+        g_gt_stats.bytes += len;
+    }
+    else
+    {
+        g_gt_iic_state = 0;
+        g_gt_stats.errors++;
+    }
+}
+
+/**
+ * @brief       ߿: ʱINTٶһ
+ * @param       
+ * @retval      
+ */
+static void gt9xxx_iic_idle(void)
+{
+    g_gt_iic_state = 0;
+
+    if (g_gt_again)
+    {
+        g_gt_again = 0;
+        gt9xxx_iic_read();
+    }
+}
+
+/**
+ * @brief       DMAһ֡: Чʹ״̬֪ͨ
+ * @param       hi2c: I2C
+ * @retval      
+ */
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    uint32_t c0 = DWT->CYCCNT;
+
+    if (hi2c != &g_gt_iic_handle)
+    {
+        return;
+    }
+
+    if (g_gt_rx[0] & 0X80)      /* ׼ */
+    {
+        memcpy(g_gt_frame, g_gt_rx, GT9XXX_FRAME_LEN(g_gt_tnum));
+        g_gt_frame_ready = 1;
+        g_gt_iic_state = 2;
+
+        if (HAL_I2C_Mem_Write_IT(hi2c, GT9XXX_CMD_WR, GT9XXX_GSTID_REG, I2C_MEMADD_SIZE_16BIT, &g_gt_zero, 1) != HAL_OK)
+        {
+            g_gt_stats.errors++;
+            gt9xxx_iic_idle();
+        }
+
+        if (g_gt_notify)
+        {
+            g_gt_notify();
+        }
+    }
+    else
+    {
+        gt9xxx_iic_idle();
+    }
+
+    g_gt_stats.busy += DWT->CYCCNT - c0;
+}
+
+/**
+ * @brief       ״̬д
+ * @param       hi2c: I2C
+ * @retval      
+ */
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c == &g_gt_iic_handle)
+    {
+        gt9xxx_iic_idle();
+    }
+}
+
+/**
+ * @brief       I2C, һ, һINT
+ * @param       hi2c: I2C
+ * @retval      
+ */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c == &g_gt_iic_handle)
+    {
+        g_gt_stats.errors++;
+        gt9xxx_iic_idle();
+    }
+}
+#endif
+
 /**
  * @brief       gt9xxxдһ
  * @param       reg : ʼĴַ
@@ -48,6 +231,9 @@ uint8_t g_gt_tnum = 5;      /* Ĭ
  */
 uint8_t gt9xxx_wr_reg(uint16_t reg, uint8_t *buf, uint8_t len)
 {
+#if GT9XXX_HW_IIC
+    return (HAL_I2C_Mem_Write(&g_gt_iic_handle, GT9XXX_CMD_WR, reg, I2C_MEMADD_SIZE_16BIT, buf, len, 10) == HAL_OK) ? 0 : 1;
+#else
     uint8_t i;
     uint8_t ret = 0;
 
@@ -69,6 +255,7 @@ uint8_t gt9xxx_wr_reg(uint16_t reg, uint8_t *buf, uint8_t len)
 
     ct_iic_stop();  /* һֹͣ */
     return ret;
+#endif
 }
 
 /**
@@ -80,6 +267,9 @@ uint8_t gt9xxx_wr_reg(uint16_t reg, uint8_t *buf, uint8_t len)
  */
 void gt9xxx_rd_reg(uint16_t reg, uint8_t *buf, uint8_t len)
 {
+#if GT9XXX_HW_IIC
+    HAL_I2C_Mem_Read(&g_gt_iic_handle, GT9XXX_CMD_WR, reg, I2C_MEMADD_SIZE_16BIT, buf, len, 10);
+#else
     uint8_t i;
 
     ct_iic_start();
@@ -99,6 +289,9 @@ void gt9xxx_rd_reg(uint16_t reg, uint8_t *buf, uint8_t len)
     }
 
     ct_iic_stop();  /* һֹͣ */
+#endif
+    g_gt_stats.reads++;
+    g_gt_stats.bytes += len;
 }
 
 /**
@@ -126,7 +319,11 @@ uint8_t gt9xxx_init(void)
     gpio_init_struct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;     /*  */
     HAL_GPIO_Init(GT9XXX_INT_GPIO_PORT, &gpio_init_struct); /* ʼINT */
 
+#if GT9XXX_HW_IIC
+    gt9xxx_iic_init();  /* ʼI2C1DMA */
+#else
     ct_iic_init();      /* ʼI2C */
+#endif
     GT9XXX_RST(0);      /* λ */
     delay_ms(10);
     GT9XXX_RST(1);      /* ͷŸλ */
@@ -164,6 +361,9 @@ uint8_t gt9xxx_init(void)
     temp[0] = 0X00;
     gt9xxx_wr_reg(GT9XXX_CTRL_REG, temp, 1);    /* λ, ״̬ */
 
+    gt9xxx_rd_reg(GT9XXX_MODSW1_REG, temp, 1);  /* INTʽ, gt9xxx_irq_start EXTI */
+    g_gt_int_mode = temp[0] & 0X03;
+    g_gt_ok = 1;
     return 0;
 }
 
@@ -174,6 +374,185 @@ const uint16_t GT9XXX_TPX_TBL[10] =
     GT9XXX_TP6_REG, GT9XXX_TP7_REG, GT9XXX_TP8_REG, GT9XXX_TP9_REG, GT9XXX_TP10_REG,
 };
 
+/**
+ * @brief       Ѵԭʼ껻Ļ
+ * @param       i  : ڼ
+ * @param       buf: ô x, x, y, y
+ * @retval      
+ */
+static void gt9xxx_point(uint8_t i, const uint8_t *buf)
+{
+    if (lcddev.id == 0X5510 || lcddev.id == 0X9806 || lcddev.id == 0X7796)     /* 4.3800*480  3.5480*320 MCU */
+    {
+        if (tp_dev.touchtype & 0X01)    /*  */
+        {
+            tp_dev.x[i] = lcddev.width - (((uint16_t)buf[3] << 8) + buf[2]);
+            tp_dev.y[i] = ((uint16_t)buf[1] << 8) + buf[0];
+        }
+        else
+        {
+            tp_dev.x[i] = ((uint16_t)buf[1] << 8) + buf[0];
+            tp_dev.y[i] = ((uint16_t)buf[3] << 8) + buf[2];
+        }
+    }
+    else    /* ͺ */
+    {
+        if (tp_dev.touchtype & 0X01)    /*  */
+        {
+            tp_dev.x[i] = ((uint16_t)buf[1] << 8) + buf[0];
+            tp_dev.y[i] = ((uint16_t)buf[3] << 8) + buf[2];
+        }
+        else
+        {
+            tp_dev.x[i] = lcddev.width - (((uint16_t)buf[3] << 8) + buf[2]);
+            tp_dev.y[i] = ((uint16_t)buf[1] << 8) + buf[0];
+        }
+    }
+}
+
+/**
+ * @brief       һ֡, ¼INTڵӳ
+ * @param       
+ * @retval      
+ */
+static void gt9xxx_latency(void)
+{
+    uint32_t lat;
+
+    if (!g_gt_pending)
+    {
+        return;
+    }
+
+    lat = DWT->CYCCNT - g_gt_int_cyc;
+    g_gt_pending = 0;
+    g_gt_stats.lat_sum += lat;
+    g_gt_stats.lat_num++;
+    g_gt_stats.lat_max = (lat > g_gt_stats.lat_max) ? lat : g_gt_stats.lat_max;
+}
+
+#if GT9XXX_IRQ
+
+/**
+ * @brief       ȡһ֡: ״̬ʹһζ(I2C), ȡDMAõ֡
+ * @param       buf: ֡, GT9XXX_FRAME_LEN(g_gt_tnum) ֽ
+ * @retval      0, û֡; 1, ;
+ */
+static uint8_t gt9xxx_frame_get(uint8_t *buf)
+{
+#if GT9XXX_HW_IIC
+    uint32_t primask;
+
+    if (!g_gt_frame_ready)
+    {
+        return 0;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    memcpy(buf, g_gt_frame, GT9XXX_FRAME_LEN(g_gt_tnum));
+    g_gt_frame_ready = 0;
+    __set_PRIMASK(primask);
+    return 1;
+#else
+    static uint8_t n = 1;   /* һ֡Ĵ, ٲ */
+    uint8_t i = 0;
+
+    if (!g_gt_pending)
+    {
+        return 0;
+    }
+
+    gt9xxx_rd_reg(GT9XXX_GSTID_REG, buf, GT9XXX_FRAME_LEN(n));
+
+    if ((buf[0] & 0X80) == 0)
+    {
+        return 0;           /* 껹û׼, һINT */
+    }
+
+    if ((buf[0] & 0XF) > n && (buf[0] & 0XF) <= g_gt_tnum)
+    {
+        gt9xxx_rd_reg(GT9XXX_GSTID_REG + GT9XXX_FRAME_LEN(n), buf + GT9XXX_FRAME_LEN(n), 8 * ((buf[0] & 0XF) - n));
+    }
+
+    gt9xxx_wr_reg(GT9XXX_GSTID_REG, &i, 1);     /* ־ */
+    n = ((buf[0] & 0XF) && (buf[0] & 0XF) <= g_gt_tnum) ? (buf[0] & 0XF) : 1;
+    return 1;
+#endif
+}
+
+/**
+ * @brief       ɨ败(INTжϷʽ)
+ *   @note      INT˲ɴ, û֡ʱI2C, tp_dev ֲ;
+ *              ûд֡(ɿ)һд, INTڶ
+ * @param       mode : δõβ, Ϊ˼ݵ
+ * @retval      ǰ״̬
+ *   @arg       0, ޴û֡;
+ *   @arg       1, д;
+ */
+uint8_t gt9xxx_scan(uint8_t mode)
+{
+    uint8_t buf[GT9XXX_FRAME_LEN(10)];
+    uint8_t i;
+    uint8_t n;
+    uint8_t res = 0;
+    uint16_t tempsta;
+    uint32_t c0 = DWT->CYCCNT;
+
+    if (!gt9xxx_frame_get(buf))
+    {
+        g_gt_stats.busy += DWT->CYCCNT - c0;
+        return 0;
+    }
+
+    mode = buf[0];
+    n = mode & 0XF;
+    g_gt_stats.frames++;
+
+    if (n && n <= g_gt_tnum)
+    {
+        tempsta = tp_dev.sta;           /* 浱ǰtp_dev.staֵ */
+        tp_dev.sta = (~(0XFFFF << n)) | TP_PRES_DOWN | TP_CATH_PRES;
+        tp_dev.x[g_gt_tnum - 1] = tp_dev.x[0];  /* 津0,һ */
+        tp_dev.y[g_gt_tnum - 1] = tp_dev.y[0];
+
+        for (i = 0; i < n; i++)
+        {
+            gt9xxx_point(i, buf + GT9XXX_FRAME_LEN(i) + 1);
+        }
+
+        res = 1;
+
+        if (tp_dev.x[0] > lcddev.width || tp_dev.y[0] > lcddev.height)  /* Ƿ(곬) */
+        {
+            if (n > 1)          /* ,򸴵ڶݵһ. */
+            {
+                tp_dev.x[0] = tp_dev.x[1];
+                tp_dev.y[0] = tp_dev.y[1];
+            }
+            else                /* Ƿ,Դ˴(ԭԭ) */
+            {
+                tp_dev.x[0] = tp_dev.x[g_gt_tnum - 1];
+                tp_dev.y[0] = tp_dev.y[g_gt_tnum - 1];
+                tp_dev.sta = tempsta;
+                res = 0;
+            }
+        }
+    }
+    else if (n == 0)            /* ޴㰴 */
+    {
+        tp_dev.x[0] = 0xffff;
+        tp_dev.y[0] = 0xffff;
+        tp_dev.sta &= ~TP_PRES_DOWN & 0XE000;   /* ɿ, Ч */
+    }
+
+    gt9xxx_latency();
+    g_gt_stats.busy += DWT->CYCCNT - c0;
+    return res;
+}
+
+#else
+
 /**
  * @brief       ɨ败(òѯʽ)
  * @param       mode : δõβ, Ϊ˼ݵ
@@ -183,9 +562,11 @@ const uint16_t GT9XXX_TPX_TBL[10] =
  */
 uint8_t gt9xxx_scan(uint8_t mode)
 {
+    uint32_t c0 = DWT->CYCCNT;
     uint8_t buf[4];
     uint8_t i = 0;
     uint8_t res = 0;
+    uint8_t fresh = 0;      /* ζ֡ */
     uint16_t temp;
     uint16_t tempsta;
     static uint8_t t = 0;   /* Ʋѯ,ӶCPUռ */
@@ -199,6 +580,8 @@ uint8_t gt9xxx_scan(uint8_t mode)
         {
             i = 0;
             gt9xxx_wr_reg(GT9XXX_GSTID_REG, &i, 1); /* ־ */
+            fresh = 1;
+            g_gt_stats.frames++;
         }
 
         if ((mode & 0XF) && ((mode & 0XF) <= g_gt_tnum))
@@ -214,33 +597,7 @@ uint8_t gt9xxx_scan(uint8_t mode)
                 if (tp_dev.sta & (1 << i))  /* Ч? */
                 {
                     gt9xxx_rd_reg(GT9XXX_TPX_TBL[i], buf, 4);   /* ȡXYֵ */
-
-                    if (lcddev.id == 0X5510 || lcddev.id == 0X9806 || lcddev.id == 0X7796)     /* 4.3800*480  3.5480*320 MCU */
-                    {
-                        if (tp_dev.touchtype & 0X01)    /*  */
-                        {
-                            tp_dev.x[i] = lcddev.width - (((uint16_t)buf[3] << 8) + buf[2]);
-                            tp_dev.y[i] = ((uint16_t)buf[1] << 8) + buf[0];
-                        }
-                        else
-                        {
-                            tp_dev.x[i] = ((uint16_t)buf[1] << 8) + buf[0];
-                            tp_dev.y[i] = ((uint16_t)buf[3] << 8) + buf[2];
-                        }
-                    }
-                    else    /* ͺ */
-                    {
-                        if (tp_dev.touchtype & 0X01)    /*  */
-                        {
-                            tp_dev.x[i] = ((uint16_t)buf[1] << 8) + buf[0];
-                            tp_dev.y[i] = ((uint16_t)buf[3] << 8) + buf[2];
-                        }
-                        else
-                        {
-                            tp_dev.x[i] = lcddev.width - (((uint16_t)buf[3] << 8) + buf[2]);
-                            tp_dev.y[i] = ((uint16_t)buf[1] << 8) + buf[0];
-                        }
-                    }
+                    gt9xxx_point(i, buf);
 
                     //printf("x[%d]:%d,y[%d]:%d\r\n", i, tp_dev.x[i], i, tp_dev.y[i]);
                 }
@@ -287,9 +644,131 @@ uint8_t gt9xxx_scan(uint8_t mode)
 
     if (t > 240)t = 10; /* ´10ʼ */
 
+    if (fresh)
+    {
+        gt9xxx_latency();
+    }
+
+    g_gt_stats.busy += DWT->CYCCNT - c0;
     return res;
 }
 
+#endif
+
+/**
+ * @brief       INTŵEXTIж
+ *   @note      INTʽIC(GT9XXX_MODSW1_REG)ѡػ½.
+ *              ѯʽҲ, ֻINTʱ, ͳӳ
+ * @param       notify: ֡ʱ(ж), һͷŴ
+ * @retval      0, ɹ; 1, gt9xxxûгʼɹ;
+ */
+uint8_t gt9xxx_irq_start(void (*notify)(void))
+{
+    GPIO_InitTypeDef gpio_init_struct;
+
+    if (!g_gt_ok)
+    {
+        return 1;
+    }
+
+    g_gt_notify = notify;
+    g_gt_tick = HAL_GetTick();
+
+    gpio_init_struct.Pin = GT9XXX_INT_GPIO_PIN;
+    gpio_init_struct.Mode = (g_gt_int_mode == 1 || g_gt_int_mode == 2) ? GPIO_MODE_IT_FALLING : GPIO_MODE_IT_RISING;
+    gpio_init_struct.Pull = GPIO_NOPULL;                    /* ģʽ */
+    gpio_init_struct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;     /*  */
+    HAL_GPIO_Init(GT9XXX_INT_GPIO_PORT, &gpio_init_struct);
+
+    HAL_NVIC_SetPriority(GT9XXX_INT_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(GT9XXX_INT_IRQn);
+    return 0;
+}
+
+/**
+ * @brief       жϷʽǷڹ
+ * @param       
+ * @retval      1, INTͷ, öʱɨ; 0, Ҫʱ tp_dev.scan;
+ */
+uint8_t gt9xxx_irq_on(void)
+{
+    return GT9XXX_IRQ && g_gt_ok;
+}
+
+/**
+ * @brief       INTж: ʱ, I2Cʱ֪ͨ, ӲI2CʱֱDMA
+ * @param       
+ * @retval      
+ */
+void gt9xxx_exti_isr(void)
+{
+    uint32_t c0 = DWT->CYCCNT;
+
+    g_gt_stats.irqs++;
+
+    if (!g_gt_pending)
+    {
+        g_gt_int_cyc = c0;
+        g_gt_pending = 1;
+    }
+
+#if GT9XXX_IRQ && GT9XXX_HW_IIC
+    if (g_gt_iic_state == 0)
+    {
+        gt9xxx_iic_read();
+    }
+    else
+    {
+        g_gt_again = 1;
+    }
+#elif GT9XXX_IRQ
+    if (g_gt_notify)
+    {
+        g_gt_notify();
+    }
+#endif
+
+    g_gt_stats.busy += DWT->CYCCNT - c0;
+}
+
+/**
+ * @brief       ȡͳ
+ * @param       
+ * @retval      ͳ
+ */
+const gt9xxx_stats_t *gt9xxx_get_stats(void)
+{
+    return &g_gt_stats;
+}
+
+/**
+ * @brief       ʱͳƲ: , INTӳ, CPUռ
+ * @param       
+ * @retval      
+ */
+void gt9xxx_poll(void)
+{
+#if GT9XXX_REPORT_MS
+    gt9xxx_stats_t *s = &g_gt_stats;
+    uint32_t ms = HAL_GetTick() - g_gt_tick;
+    uint32_t mhz = SystemCoreClock / 1000000;
+
+    if (!g_gt_ok || ms < GT9XXX_REPORT_MS)
+    {
+        return;
+    }
+
+    g_gt_tick = HAL_GetTick();
+    log_printf("ctp(%s): %lu frames/s, %lu irqs, %lu reads %lu bytes, %lu errors\r\n",
+               GT9XXX_IRQ ? (GT9XXX_HW_IIC ? "irq+dma" : "irq") : "poll", (unsigned long)(s->frames * 1000 / ms),
+               (unsigned long)s->irqs, (unsigned long)s->reads, (unsigned long)s->bytes, (unsigned long)s->errors);
+    log_printf("ctp: latency avg %lu us max %lu us, cpu %lu us/s\r\n",
+               (unsigned long)(s->lat_num ? s->lat_sum / s->lat_num / mhz : 0), (unsigned long)(s->lat_max / mhz),
+               (unsigned long)(s->busy / mhz * 1000 / ms));
+    memset(s, 0, sizeof(gt9xxx_stats_t));
+#endif
+}
+
 
 
 
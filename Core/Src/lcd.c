@@ -23,13 +23,38 @@
  * V1.1 20230529
  * 1ST7796ILI9806 IC֧
  * 2򻯲ִ룬ⳤж
+ * V1.2 20261018
+ * 1lcd_draw_blineΪɨ, ÿֻдһ, lcd_draw_bline_join
+ * 2FSMCдg_lcd_bus_writes
+ * 3lcd_show_char/lcd_show_stringΪд, ģ
+ * 4lcd_set_windowֲں, ´lcd_set_cursorǰԶָȫ
+ * 5lcd_clear/lcd_fill/lcd_color_fill/lcd_show_picĴдDMA2Ŷ첽(lcd_dma.c)
+ * 6߷ʸLCD_WR_REG/LCD_WR_RAM/LCD_RD_RAM, HOST_SIMʱLinuxϽӿģ
+ * 7LCD_FONT_PACKΪ1ʱʹѹֿlcdfont_pack.h(asset.c), ʡԼ4.8KB Flash
+ * 8lcd_initlcd_init_start/lcd_init_poll, ĴʼΪִlcd_ex.cֽ, ʱڼĳʼ
+ * 9ID̽Ϊ, lcd_init_start_hint: ֻϴμ⵽ICIDĴ
  ****************************************************************************************************
  */
 
 #include "stdlib.h"
+#include "math.h"
 #include "lcd.h"
+#if LCD_FONT_PACK
+#include "lcdfont_pack.h"
+#else
 #include "lcdfont.h"
+#endif
+#if LCD_DMA
+#include "lcd_dma.h"
+#endif
+#ifndef HOST_SIM
 #include "stm32f4xx_hal.h"
+#endif
+
+#if LCD_DMA
+/* ԴFlash(ͼƬ)ʱDMAŶӺֱӷ; RAMʱǵߵĻ(ջ), дŷ */
+#define LCD_DMA_SRC_CONST(p)    ((uint32_t)(p) >= FLASH_BASE && (uint32_t)(p) <= FLASH_END)
+#endif
 
 /* lcd_ex.cŸLCDICļĴʼִ,Լlcd.c,.cļ
  * ֱӼ뵽,ֻlcd.cõ,ͨincludeʽ.(Ҫ
@@ -38,7 +63,9 @@
 #include "lcd_ex.h"
 
 
+#ifndef HOST_SIM
 SRAM_HandleTypeDef g_sram_handle;   /* SRAM(ڿLCD) */
+#endif
 
 /* LCDĻɫͱɫ */
 uint32_t g_point_color = 0xF800;    /* ɫ */
@@ -47,6 +74,21 @@ uint32_t g_back_color  = 0xFFFF;    /* 
 /* LCDҪ */
 _lcd_dev lcddev;
 
+#if LCD_BUS_STATS
+uint32_t g_lcd_bus_writes = 0;      /* FSMCд(Ĵ+) */
+#endif
+
+/* 1, ǰlcd_set_windowľֲ; ùĺȫд, ùǰȻָ */
+static uint8_t g_lcd_win_part = 0;
+
+/* ̽IC˳, ԭжϵ˳ͬ(NT35510Կ0XC501SSD1963λ, Ҫں) */
+static const uint16_t g_lcd_probe_ids[] = {0x9341, 0x7789, 0x5310, 0x7796, 0x5510, 0x9806, 0x1963};
+
+/* lcd_init_start/lcd_init_poll ״̬: ʼִе, ڵȵʱ */
+static const uint8_t *g_lcd_init_pc = NULL;
+static uint32_t g_lcd_init_tick = 0;
+static uint32_t g_lcd_init_wait = 0;
+
 /**
  * @brief       LCDд
  * @param       data: Ҫд
@@ -55,7 +97,8 @@ _lcd_dev lcddev;
 void lcd_wr_data(volatile uint16_t data)
 {
     data = data;            /* ʹ-O2Żʱ,ʱ */
-    LCD->LCD_RAM = data;
+    LCD_WR_RAM(data);
+    LCD_BUS_ADD(1);
 }
 
 /**
@@ -66,7 +109,9 @@ void lcd_wr_data(volatile uint16_t data)
 void lcd_wr_regno(volatile uint16_t regno)
 {
     regno = regno;          /* ʹ-O2Żʱ,ʱ */
-    LCD->LCD_REG = regno;   /* дҪдļĴ */
+    LCD_DMA_WAIT();
+    LCD_WR_REG(regno);   /* дҪдļĴ */
+    LCD_BUS_ADD(1);
 }
 
 /**
@@ -77,8 +122,10 @@ void lcd_wr_regno(volatile uint16_t regno)
  */
 void lcd_write_reg(uint16_t regno, uint16_t data)
 {
-    LCD->LCD_REG = regno;   /* дҪдļĴ */
-    LCD->LCD_RAM = data;    /* д */
+    LCD_DMA_WAIT();
+    LCD_WR_REG(regno);   /* дҪдļĴ */
+    LCD_WR_RAM(data);    /* д */
+    LCD_BUS_ADD(2);
 }
 
 /**
@@ -100,7 +147,7 @@ static uint16_t lcd_rd_data(void)
 {
     volatile uint16_t ram;  /* ֹŻ */
     lcd_opt_delay(2);
-    ram = LCD->LCD_RAM;
+    ram = LCD_RD_RAM();
     return ram;
 }
 
@@ -111,7 +158,9 @@ static uint16_t lcd_rd_data(void)
  */
 void lcd_write_ram_prepare(void)
 {
-    LCD->LCD_REG = lcddev.wramcmd;
+    LCD_DMA_WAIT();
+    LCD_WR_REG(lcddev.wramcmd);
+    LCD_BUS_ADD(1);
 }
 
 /**
@@ -203,6 +252,11 @@ void lcd_display_off(void)
  */
 void lcd_set_cursor(uint16_t x, uint16_t y)
 {
+    if (g_lcd_win_part)
+    {
+        lcd_set_window(0, 0, lcddev.width, lcddev.height);
+    }
+
     if (lcddev.id == 0x1963)
     {
         if (lcddev.dir == 0)    /* ģʽ, xҪ任 */
@@ -414,6 +468,8 @@ void lcd_scan_dir(uint8_t dir)
         lcd_wr_data((lcddev.height - 1) >> 8);
         lcd_wr_data((lcddev.height - 1) & 0xFF);
     }
+
+    g_lcd_win_part = 0;
 }
 
 /**
@@ -426,7 +482,8 @@ void lcd_draw_point(uint16_t x, uint16_t y, uint32_t color)
 {
     lcd_set_cursor(x, y);       /* ùλ */
     lcd_write_ram_prepare();    /* ʼдGRAM */
-    LCD->LCD_RAM = color;
+    LCD_WR_RAM(color);
+    LCD_BUS_ADD(1);
 }
 
 /**
@@ -545,6 +602,7 @@ void lcd_set_window(uint16_t sx, uint16_t sy, uint16_t width, uint16_t height)
     uint16_t twidth, theight;
     twidth = sx + width - 1;
     theight = sy + height - 1;
+    g_lcd_win_part = (sx != 0 || sy != 0 || width != lcddev.width || height != lcddev.height);
 
    
    if (lcddev.id == 0x1963 && lcddev.dir != 1)     /* 1963⴦ */
@@ -627,15 +685,132 @@ void lcd_set_window(uint16_t sx, uint16_t sy, uint16_t width, uint16_t height)
 //}
 
 /**
- * @brief       ʼLCD
+ * @brief       һICIDĴ
+ * @param       id: IC(g_lcd_probe_ids һ)
+ * @retval      ID(ѻ lcddev.id д),  id ͬʾIC
+ */
+static uint16_t lcd_read_id(uint16_t id)
+{
+    uint16_t v;
+
+    if (id == 0x7789)
+    {
+        lcd_wr_regno(0x04);
+        v = lcd_rd_data();      /* dummy read */
+        v = lcd_rd_data();      /* 0x85 */
+        v = lcd_rd_data();      /* ȡ0x85 */
+        v <<= 8;
+        v |= lcd_rd_data();     /* ȡ0x52 */
+        return (v == 0x8552) ? 0x7789 : v;  /* 8552IDת7789 */
+    }
+    else if (id == 0x5310)
+    {
+        lcd_wr_regno(0xD4);
+        v = lcd_rd_data();      /* dummy read */
+        v = lcd_rd_data();      /* 0x01 */
+        v = lcd_rd_data();      /* 0x53 */
+        v <<= 8;
+        return v | lcd_rd_data();   /* 0x10 */
+    }
+    else if (id == 0x5510)
+    {
+        /* Կṩ */
+        lcd_write_reg(0xF000, 0x0055);
+        lcd_write_reg(0xF001, 0x00AA);
+        lcd_write_reg(0xF002, 0x0052);
+        lcd_write_reg(0xF003, 0x0008);
+        lcd_write_reg(0xF004, 0x0001);
+
+        lcd_wr_regno(0xC500);   /* ȡIDͰλ */
+        v = lcd_rd_data();      /* 0x80 */
+        v <<= 8;
+
+        lcd_wr_regno(0xC501);   /* ȡID߰λ */
+        v |= lcd_rd_data();     /* 0x00 */
+
+        if (v != 0x5510)
+        {
+            HAL_Delay(5);       /* ȴ5ms, Ϊ0XC501ָ1963˵λָ, ȴ5ms1963λٲ */
+        }
+
+        return v;
+    }
+    else if (id == 0x1963)
+    {
+        lcd_wr_regno(0xA1);
+        v = lcd_rd_data();
+        v = lcd_rd_data();      /* 0x57 */
+        v <<= 8;
+        v |= lcd_rd_data();     /* 0x61 */
+        return (v == 0x5761) ? 0x1963 : v;  /* SSD1963صID5761H,Ϊ,ǿΪ1963 */
+    }
+
+    /* 9341/7796/9806 Ƕ0XD3: dummy, 0X00, ߰λ, Ͱλ */
+    lcd_wr_regno(0xD3);
+    v = lcd_rd_data();          /* dummy read */
+    v = lcd_rd_data();          /* 0x00 */
+    v = lcd_rd_data();          /* ȡ93/77/98 */
+    v <<= 8;
+    return v | lcd_rd_data();   /* ȡ41/96/06 */
+}
+
+/**
+ * @brief       LCDID, д lcddev.id
+ *   @note      hint ϴμ⵽ID(cfg.h  CFG_LCD ¼): ֻICIDĴ, ˾Ͳ̽;
+ *               g_lcd_probe_ids ˳, ʱ lcddev.id һζֵ
+ * @param       hint: ϴμ⵽ID, 0ʾû
+ * @retval      0, hint ; 1, ̽
+ */
+static uint8_t lcd_probe_id(uint16_t hint)
+{
+    uint8_t i;
+
+    if (hint && lcd_read_id(hint) == hint)
+    {
+        lcddev.id = hint;
+        return 0;
+    }
+
+    for (i = 0; i < sizeof(g_lcd_probe_ids) / sizeof(g_lcd_probe_ids[0]); i++)
+    {
+        lcddev.id = lcd_read_id(g_lcd_probe_ids[i]);
+
+        if (lcddev.id == g_lcd_probe_ids[i])
+        {
+            break;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief       ʼʼLCD: ID, ѡICĳʼ
  *   @note      óʼԳʼͺŵLCD(.cļǰ)
+ *              غ lcddev.id  lcddev.dir ѾЧ(ʼҪ), ܻ,
+ *              Ҫ lcd_init_poll() ֱ0, ε֮ĳʼ
  *
  * @param       
  * @retval      
  */
-void lcd_init(void)
+void lcd_init_start(void)
 {
+    lcd_init_start_hint(0);
+}
+
+/**
+ * @brief       ʼʼLCD, ϴμ⵽ID
+ *   @note      hint ֻһIDĴ, ǰ漸IC̽( NT35510 ̽5msĵȴ);
+ *              ʱ lcd_init_start һ̽
+ * @param       hint: ϴμ⵽ID, 0ʾû
+ * @retval      0, hint ; 1, ̽
+ */
+uint8_t lcd_init_start_hint(uint16_t hint)
+{
+    uint8_t res;
+#ifndef HOST_SIM
     GPIO_InitTypeDef gpio_init_struct;
+#endif
 //    FSMC_NORSRAM_TimingTypeDef fsmc_read_handle;
 //    FSMC_NORSRAM_TimingTypeDef fsmc_write_handle;
 
@@ -697,88 +872,7 @@ void lcd_init(void)
 //    HAL_SRAM_Init(&g_sram_handle, &fsmc_read_handle, &fsmc_write_handle);
 //    HAL_Delay(50);
 
-    /* 9341 IDĶȡ */
-    lcd_wr_regno(0xD3);
-    lcddev.id = lcd_rd_data();  /* dummy read */
-    lcddev.id = lcd_rd_data();  /* 0x00 */
-    lcddev.id = lcd_rd_data();  /* ȡ93 */
-    lcddev.id <<= 8;
-    lcddev.id |= lcd_rd_data(); /* ȡ41 */
-
-    if (lcddev.id != 0x9341)    /*  9341 , Կǲ ST7789 */
-    {
-        lcd_wr_regno(0x04);
-        lcddev.id = lcd_rd_data();      /* dummy read */
-        lcddev.id = lcd_rd_data();      /* 0x85 */
-        lcddev.id = lcd_rd_data();      /* ȡ0x85 */
-        lcddev.id <<= 8;
-        lcddev.id |= lcd_rd_data();     /* ȡ0x52 */
-        
-        if (lcddev.id == 0x8552)        /* 8552IDת7789 */
-        {
-            lcddev.id = 0x7789;
-        }
-
-        if (lcddev.id != 0x7789)        /* ҲST7789, ǲ NT35310 */
-        {
-            lcd_wr_regno(0xD4);
-            lcddev.id = lcd_rd_data();  /* dummy read */
-            lcddev.id = lcd_rd_data();  /* 0x01 */
-            lcddev.id = lcd_rd_data();  /* 0x53 */
-            lcddev.id <<= 8;
-            lcddev.id |= lcd_rd_data(); /* 0x10 */
-
-            if (lcddev.id != 0x5310)    /* ҲNT35310,ԿǲST7796 */
-            {
-                lcd_wr_regno(0XD3);
-                lcddev.id = lcd_rd_data();  /* dummy read */
-                lcddev.id = lcd_rd_data();  /* 0X00 */
-                lcddev.id = lcd_rd_data();  /* ȡ0X77 */
-                lcddev.id <<= 8;
-                lcddev.id |= lcd_rd_data(); /* ȡ0X96 */
-                
-                if (lcddev.id != 0x7796)    /* ҲST7796,ԿǲNT35510 */
-                {
-                    /* Կṩ */
-                    lcd_write_reg(0xF000, 0x0055);
-                    lcd_write_reg(0xF001, 0x00AA);
-                    lcd_write_reg(0xF002, 0x0052);
-                    lcd_write_reg(0xF003, 0x0008);
-                    lcd_write_reg(0xF004, 0x0001);
-                    
-                    lcd_wr_regno(0xC500);       /* ȡIDͰλ */
-                    lcddev.id = lcd_rd_data();  /* 0x80 */
-                    lcddev.id <<= 8;
-
-                    lcd_wr_regno(0xC501);       /* ȡID߰λ */
-                    lcddev.id |= lcd_rd_data(); /* 0x00 */
-                    
-                    HAL_Delay(5);                /* ȴ5ms, Ϊ0XC501ָ1963˵λָ, ȴ5ms1963λٲ */
-
-                    if (lcddev.id != 0x5510)    /* ҲNT5510,ԿǲILI9806 */
-                    {
-                        lcd_wr_regno(0XD3);
-                        lcddev.id = lcd_rd_data();  /* dummy read */
-                        lcddev.id = lcd_rd_data();  /* 0X00 */
-                        lcddev.id = lcd_rd_data();  /* 0X98 */
-                        lcddev.id <<= 8;
-                        lcddev.id |= lcd_rd_data(); /* 0X06 */
-                        
-                        if (lcddev.id != 0x9806)    /* ҲILI9806,ԿǲSSD1963 */
-                        {
-                            lcd_wr_regno(0xA1);
-                            lcddev.id = lcd_rd_data();
-                            lcddev.id = lcd_rd_data();  /* 0x57 */
-                            lcddev.id <<= 8;
-                            lcddev.id |= lcd_rd_data(); /* 0x61 */
-
-                            if (lcddev.id == 0x5761) lcddev.id = 0x1963; /* SSD1963صID5761H,Ϊ,ǿΪ1963 */
-                        }
-                    }
-                }
-            }
-        }
-    }
+    res = lcd_probe_id(hint);
 
     /* رע, mainδ1ʼ, Ῠprintf
      * (f_putc), , ʼ1, ε
@@ -786,35 +880,9 @@ void lcd_init(void)
      */
 //    printf("LCD ID:%x\r\n", lcddev.id); /* ӡLCD ID */
 
-    if (lcddev.id == 0x7789)
-    {
-        lcd_ex_st7789_reginit();    /* ִST7789ʼ */
-    }
-    else if (lcddev.id == 0x9341)
-    {
-        lcd_ex_ili9341_reginit();   /* ִILI9341ʼ */
-    }
-    else if (lcddev.id == 0x5310)
-    {
-        lcd_ex_nt35310_reginit();   /* ִNT35310ʼ */
-    }
-    else if (lcddev.id == 0x7796)
-    {
-        lcd_ex_st7796_reginit();    /* ִST7796ʼ */
-    }
-    else if (lcddev.id == 0x5510)
-    {
-        lcd_ex_nt35510_reginit();   /* ִNT35510ʼ */
-    }
-    else if (lcddev.id == 0x9806)
-    {
-        lcd_ex_ili9806_reginit();   /* ִILI9806ʼ */
-    }
-    else if (lcddev.id == 0x1963)
-    {
-        lcd_ex_ssd1963_reginit();   /* ִSSD1963ʼ */
-        lcd_ssd_backlight_set(100); /* Ϊ */
-    }
+    g_lcd_init_pc = lcd_ex_init_code(lcddev.id);
+    g_lcd_init_wait = 0;
+    lcddev.dir = 0;             /* ĬΪ, lcd_init_poll ô */
 
     /* ڲͬĻдʱͬʱԸԼĻ޸
       ϳ߶ʱҲӰ죬ҪԼ޸ģ */
@@ -841,13 +909,66 @@ void lcd_init(void)
 //        FSMC_NORSRAM_Extended_Timing_Init(g_sram_handle.Extended, &fsmc_write_handle, g_sram_handle.Init.NSBank, g_sram_handle.Init.ExtendedMode);
 //    }
 
+    return res;
+}
+
+/**
+ * @brief       ִгʼ
+ *   @note      ʱ: ûֱӷ1; ִ÷򡢵Ⲣ, 0
+ * @param       
+ * @retval      1, û; 0, , LCDʹ;
+ */
+uint8_t lcd_init_poll(void)
+{
+    if (g_lcd_init_pc == NULL)
+    {
+        return 0;
+    }
+
+    if (HAL_GetTick() - g_lcd_init_tick <= g_lcd_init_wait)     /*  HAL_Delay һٶ1ms */
+    {
+        return 1;
+    }
+
+    g_lcd_init_wait = lcd_ex_run(&g_lcd_init_pc);
+
+    if (g_lcd_init_wait)
+    {
+        g_lcd_init_tick = HAL_GetTick();
+        return 1;
+    }
+
+    g_lcd_init_pc = NULL;
+
+    if (lcddev.id == 0x1963)
+    {
+        lcd_ssd_backlight_set(100); /* Ϊ */
+    }
+
     lcd_display_dir(0); /* ĬΪ */
     LCD_BL(1);          /*  */
+#if LCD_DMA
+    lcd_dma_init();
+#endif
     lcd_clear(WHITE);
+    return 0;
+}
+
+/**
+ * @brief       ʼLCD(, ȼ lcd_init_start һֱ lcd_init_poll)
+ * @param       
+ * @retval      
+ */
+void lcd_init(void)
+{
+    lcd_init_start();
+
+    while (lcd_init_poll());
 }
 
 /**
  * @brief       
+ *   @note      LCD_DMAΪ1ʱDMAд, ŶӺ
  * @param       color: Ҫɫ
  * @retval      
  */
@@ -856,18 +977,28 @@ void lcd_clear(uint16_t color)
     uint32_t index = 0;
     uint32_t totalpoint = lcddev.width;
 
+#if LCD_DMA
+    if (lcd_dma_fill(0, 0, lcddev.width, lcddev.height, color, NULL, NULL) == 0)
+    {
+        return;
+    }
+#endif
+
     totalpoint *= lcddev.height;    /* õܵ */
     lcd_set_cursor(0x00, 0x0000);   /* ùλ */
     lcd_write_ram_prepare();        /* ʼдGRAM */
 
     for (index = 0; index < totalpoint; index++)
     {
-        LCD->LCD_RAM = color;
+        LCD_WR_RAM(color);
     }
+
+    LCD_BUS_ADD(totalpoint);
 }
 
 /**
  * @brief       ָ䵥ɫ
+ *   @note      LCD_DMAΪ1ҲLCD_DMA_MINʱDMAд, ŶӺ
  * @param       (sx,sy),(ex,ey):ζԽ,СΪ:(ex - sx + 1) * (ey - sy + 1)
  * @param       color:  Ҫɫ(32λɫ,LTDC)
  * @retval      
@@ -878,6 +1009,14 @@ void lcd_fill(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint32_t color
     uint16_t xlen = 0;
     xlen = ex - sx + 1;
 
+#if LCD_DMA
+    if (ex >= sx && ey >= sy && (uint32_t)xlen * (ey - sy + 1) >= LCD_DMA_MIN &&
+        lcd_dma_fill(sx, sy, xlen, ey - sy + 1, color, NULL, NULL) == 0)
+    {
+        return;
+    }
+#endif
+
     for (i = sy; i <= ey; i++)
     {
         lcd_set_cursor(sx, i);      /* ùλ */
@@ -885,13 +1024,17 @@ void lcd_fill(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint32_t color
 
         for (j = 0; j < xlen; j++)
         {
-            LCD->LCD_RAM = color;   /* ʾɫ */
+            LCD_WR_RAM(color);   /* ʾɫ */
         }
+
+        LCD_BUS_ADD(xlen);
     }
 }
 
 /**
  * @brief       ָָɫ
+ *   @note      LCD_DMAΪ1ҲLCD_DMA_MINʱDMAд; colorRAMʱDMAдŷ,
+ *              FlashʱŶӺ
  * @param       (sx,sy),(ex,ey):ζԽ,СΪ:(ex - sx + 1) * (ey - sy + 1)
  * @param       color: Ҫɫ׵ַ
  * @retval      
@@ -904,6 +1047,19 @@ void lcd_color_fill(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t
     width = ex - sx + 1;            /* õĿ */
     height = ey - sy + 1;           /* ߶ */
 
+#if LCD_DMA
+    if (ex >= sx && ey >= sy && (uint32_t)width * height >= LCD_DMA_MIN &&
+        lcd_dma_blit(sx, sy, width, height, color, NULL, NULL) == 0)
+    {
+        if (!LCD_DMA_SRC_CONST(color))
+        {
+            LCD_DMA_WAIT();         /* غ߿ԸĻͷ color */
+        }
+
+        return;
+    }
+#endif
+
     for (i = 0; i < height; i++)
     {
         lcd_set_cursor(sx, sy + i); /* ùλ */
@@ -911,10 +1067,21 @@ void lcd_color_fill(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint16_t
 
         for (j = 0; j < width; j++)
         {
-            LCD->LCD_RAM = color[i * width + j]; /* д */
+            LCD_WR_RAM(color[i * width + j]); /* д */
         }
+
+        LCD_BUS_ADD(width);
     }
 }
+
+/**
+ * @brief       ʾͼƬ(ÿ2ֽ, ֽǰ)
+ *   @note      LCD_DMAΪ1ͼƬֶʱDMAд(С, ֽͰͬ); ͼƬFlashʱŶӺ,
+ *              RAMʱDMAдŷ
+ * @param       (sx,sy),(ex,ey):ͼƬԽ
+ * @param       color: ͼƬ
+ * @retval      
+ */
 void lcd_show_pic(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint8_t *color)
 {
     uint16_t height, width;
@@ -923,6 +1090,19 @@ void lcd_show_pic(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint8_t *c
     width = ex - sx + 1;            /* õĿ */
     height = ey - sy + 1;           /* ߶ */
 
+#if LCD_DMA
+    if (ex >= sx && ey >= sy && (uint32_t)width * height >= LCD_DMA_MIN &&
+        lcd_dma_blit(sx, sy, width, height, (const uint16_t *)color, NULL, NULL) == 0)
+    {
+        if (!LCD_DMA_SRC_CONST(color))
+        {
+            LCD_DMA_WAIT();
+        }
+
+        return;
+    }
+#endif
+
     for (i = 0; i < height; i++)
     {
         lcd_set_cursor(sx, sy + i); /* ùλ */
@@ -933,8 +1113,10 @@ void lcd_show_pic(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint8_t *c
 					
 					picL=*(color+(i * width + j)*2);
 				picH=*(color+(i * width + j)*2+1);				
-            LCD->LCD_RAM = picH<<8|picL; /* д */
+            LCD_WR_RAM(picH<<8|picL); /* д */
         }
+
+        LCD_BUS_ADD(width);
     }
 }
 int move_x,move_y=0;
@@ -970,13 +1152,13 @@ void lcd_show_move_pic(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint8
 			lcd_set_cursor(move_x+flag_x, move_y+flag_y+(flag_y+1)/2*height);
 			lcd_write_ram_prepare();
 			for(int i=0;i<width;i++){
-				LCD->LCD_RAM=WHITE;
+				LCD_WR_RAM(WHITE);
 			}
 
 			for(int i=0;i<height+1;i++){
 			lcd_set_cursor(move_x+flag_x+(flag_x+1)/2*width, move_y+flag_y+i);
 				lcd_write_ram_prepare();
-				LCD->LCD_RAM=WHITE;
+				LCD_WR_RAM(WHITE);
 			}
 				
 				
@@ -992,7 +1174,7 @@ void lcd_show_move_pic(uint16_t sx, uint16_t sy, uint16_t ex, uint16_t ey, uint8
 					
 					picL=*(color+(i * width + j)*2);
 				picH=*(color+(i * width + j)*2+1);				
-            LCD->LCD_RAM = picH<<8|picL; /* д */
+            LCD_WR_RAM(picH<<8|picL); /* д */
         }
     }
 
@@ -1192,79 +1374,277 @@ void lcd_fill_circle(uint16_t x, uint16_t y, uint16_t r, uint16_t color)
     }
 }
 
+/* ģ: ֿⰴд, ʾʱҪдGRAM, ַתɰеλͼ */
+typedef struct
+{
+    uint16_t rows[32];      /* ÿһλͼ, bit15ߵĵ */
+    char chr;
+    uint8_t size;           /* С, 0ʾ */
+    uint16_t used;          /* һʹõʱ, 滻ûõ */
+} lcd_glyph_t;
+
+static lcd_glyph_t g_lcd_glyph[LCD_GLYPH_CACHE_NUM];
+static uint16_t g_lcd_glyph_tick = 0;
+
 /**
- * @brief       ָλʾһַ
- * @param       x,y  : 
- * @param       chr  : Ҫʾַ:" "--->"~"
+ * @brief       ȡַĵ
+ * @param       chr  : ַ
  * @param       size : С 12/16/24/32
- * @param       mode : ӷʽ(1); ǵӷʽ(0);
- * @param       color : ַɫ;
- * @retval      
+ * @retval      ׵ַ, NULLʾֵַ֧
  */
-void lcd_show_char(uint16_t x, uint16_t y, char chr, uint8_t size, uint8_t mode, uint16_t color)
+static const uint8_t *lcd_font(char chr, uint8_t size)
 {
-    uint8_t temp, t1, t;
-    uint16_t y0 = y;
-    uint8_t csize = 0;
-    uint8_t *pfont = 0;
+#if LCD_FONT_PACK
+    static uint8_t glyph[ASSET_GLYPH_MAX];     /* ģ, תģ */
+    const asset_font_t *font;
+#endif
+
+    if (chr < ' ' || chr > '~')
+    {
+        return NULL;
+    }
 
-    csize = (size / 8 + ((size % 8) ? 1 : 0)) * (size / 2); /* õһַӦռֽ */
     chr = chr - ' ';    /* õƫƺֵASCIIֿǴӿոʼȡģ-' 'ǶӦַֿ⣩ */
 
+#if LCD_FONT_PACK
     switch (size)
     {
         case 12:
-            pfont = (uint8_t *)asc2_1206[chr];  /* 1206 */
+            font = &g_font_1206;
             break;
 
         case 16:
-            pfont = (uint8_t *)asc2_1608[chr];  /* 1608 */
+            font = &g_font_1608;
             break;
 
         case 24:
-            pfont = (uint8_t *)asc2_2412[chr];  /* 2412 */
+            font = &g_font_2412;
             break;
 
         case 32:
-            pfont = (uint8_t *)asc2_3216[chr];  /* 3216 */
+            font = &g_font_3216;
             break;
 
         default:
-            return ;
+            return NULL;
+    }
+
+    return asset_glyph(font, (uint8_t)chr, glyph) ? NULL : glyph;
+#else
+    switch (size)
+    {
+        case 12:
+            return asc2_1206[(uint8_t)chr];     /* 1206 */
+
+        case 16:
+            return asc2_1608[(uint8_t)chr];     /* 1608 */
+
+        case 24:
+            return asc2_2412[(uint8_t)chr];     /* 2412 */
+
+        case 32:
+            return asc2_3216[(uint8_t)chr];     /* 3216 */
+
+        default:
+            return NULL;
+    }
+#endif
+}
+
+/**
+ * @brief       ӻȡеģ, ûֿת滻ûõһ
+ * @param       chr  : ַ
+ * @param       size : С 12/16/24/32
+ * @retval      ÿеλͼ(size), NULLʾֵַ֧
+ */
+const uint16_t *lcd_glyph_get(char chr, uint8_t size)
+{
+    const uint8_t *pfont = lcd_font(chr, size);
+    lcd_glyph_t *g = &g_lcd_glyph[0];
+    uint8_t bpc = size / 8 + ((size % 8) ? 1 : 0);  /* ÿеֽ */
+    uint8_t i, x, y;
+    uint8_t temp;
+
+    if (pfont == NULL)
+    {
+        return NULL;
     }
 
-    for (t = 0; t < csize; t++)
+    g_lcd_glyph_tick++;
+
+    for (i = 0; i < LCD_GLYPH_CACHE_NUM; i++)
+    {
+        if (g_lcd_glyph[i].size == size && g_lcd_glyph[i].chr == chr)
+        {
+            g_lcd_glyph[i].used = g_lcd_glyph_tick;
+            return g_lcd_glyph[i].rows;
+        }
+
+        if ((uint16_t)(g_lcd_glyph_tick - g_lcd_glyph[i].used) > (uint16_t)(g_lcd_glyph_tick - g->used))
+        {
+            g = &g_lcd_glyph[i];
+        }
+    }
+
+    for (y = 0; y < size; y++)
     {
-        temp = pfont[t];                            /* ȡַĵ */
+        g->rows[y] = 0;
+    }
 
-        for (t1 = 0; t1 < 8; t1++)                  /* һֽ8 */
+    for (x = 0; x < size / 2; x++)      /* һ bpc ֽ, λ, λ */
+    {
+        for (y = 0; y < size; y++)
         {
-            if (temp & 0x80)                        /* Ч,Ҫʾ */
+            temp = pfont[x * bpc + y / 8];
+
+            if (temp & (0x80 >> (y % 8)))
             {
-                lcd_draw_point(x, y, color);        /* ,Ҫʾ */
+                g->rows[y] |= 0x8000 >> x;
             }
-            else if (mode == 0)                     /* Ч,ʾ */
+        }
+    }
+
+    g->chr = chr;
+    g->size = size;
+    g->used = g_lcd_glyph_tick;
+    return g->rows;
+}
+
+/**
+ * @brief       ǵӷʽʾһַ: һ, дַĵ(ǰɫ/ɫ)
+ *   @note      һ LCD_GLYPH_CACHE_NUM ַ, ֤ͬһеģڻ; ĻĲֲд
+ * @param       x,y  : ʼ
+ * @param       p    : ַ
+ * @param       n    : ַ
+ * @param       size : С 12/16/24/32
+ * @param       color: ַɫ
+ * @retval      
+ */
+static void lcd_show_glyphs(uint16_t x, uint16_t y, const char *p, uint8_t n, uint8_t size, uint16_t color)
+{
+    const uint16_t *rows[LCD_GLYPH_CACHE_NUM];
+    uint16_t bg = g_back_color;
+    uint16_t w = size / 2;
+    uint16_t width, height, cols, bits;
+    uint8_t i, j, r;
+
+    if (n == 0 || x >= lcddev.width || y >= lcddev.height)
+    {
+        return;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        rows[i] = lcd_glyph_get(p[i], size);
+
+        if (rows[i] == NULL)
+        {
+            return;
+        }
+    }
+
+    width = n * w;
+    width = (x + width > lcddev.width) ? lcddev.width - x : width;
+    height = (y + size > lcddev.height) ? lcddev.height - y : size;
+
+    lcd_set_window(x, y, width, height);
+    lcd_write_ram_prepare();
+
+    for (r = 0; r < height; r++)
+    {
+        cols = width;
+
+        for (i = 0; i < n && cols; i++)
+        {
+            bits = rows[i][r];
+
+            for (j = 0; j < w && cols; j++, cols--)
             {
-                lcd_draw_point(x, y, g_back_color); /* ɫ,൱㲻ʾ(עⱳɫȫֱ) */
+                LCD_WR_RAM((bits & 0x8000) ? color : bg);
+                bits <<= 1;
             }
+        }
+    }
+
+    LCD_BUS_ADD((uint32_t)width * height);
+}
 
-            temp <<= 1;                             /* λ, Աȡһλ״̬ */
-            y++;
+/**
+ * @brief       ǵӷʽʾһnַ(, ĻĲֲд)
+ * @param       x,y  : ʼ
+ * @param       p    : ַ, Ҫ
+ * @param       n    : ַ
+ * @param       size : С 12/16/24/32
+ * @param       color: ַɫ
+ * @retval      
+ */
+void lcd_show_chars(uint16_t x, uint16_t y, const char *p, uint8_t n, uint8_t size, uint16_t color)
+{
+    uint8_t k;
 
-            if (y >= lcddev.height)return;          /*  */
+    while (n)
+    {
+        k = (n > LCD_GLYPH_CACHE_NUM) ? LCD_GLYPH_CACHE_NUM : n;
+        lcd_show_glyphs(x, y, p, k, size, color);
+        x += k * (size / 2);
+        p += k;
+        n -= k;
+    }
+}
 
-            if ((y - y0) == size)                   /* ʾһ? */
+/**
+ * @brief       ָλʾһַ
+ *   @note      ǵӷʽд; ӷʽֻдЧ, ÿЧдһ
+ * @param       x,y  : 
+ * @param       chr  : Ҫʾַ:" "--->"~"
+ * @param       size : С 12/16/24/32
+ * @param       mode : ӷʽ(1); ǵӷʽ(0);
+ * @param       color : ַɫ;
+ * @retval      
+ */
+void lcd_show_char(uint16_t x, uint16_t y, char chr, uint8_t size, uint8_t mode, uint16_t color)
+{
+    const uint16_t *rows;
+    uint16_t bits;
+    uint8_t r, s, e;
+
+    if (mode == 0)
+    {
+        lcd_show_glyphs(x, y, &chr, 1, size, color);
+        return;
+    }
+
+    rows = lcd_glyph_get(chr, size);
+
+    if (rows == NULL)
+    {
+        return;
+    }
+
+    for (r = 0; r < size && y + r < lcddev.height; r++)
+    {
+        bits = rows[r];
+        s = 0;
+
+        while (bits)
+        {
+            while ((bits & 0x8000) == 0)    /* Ч */
             {
-                y = y0; /* y긴λ */
-                x++;    /* x */
+                bits <<= 1;
+                s++;
+            }
 
-                if (x >= lcddev.width)
-                {
-                    return;       /* x곬 */
-                }
+            for (e = s; bits & 0x8000; e++) /* Ч [s, e) */
+            {
+                bits <<= 1;
+            }
 
-                break;
+            if (x + s < lcddev.width)
+            {
+                lcd_fill(x + s, y + r, (x + e - 1 < lcddev.width) ? x + e - 1 : lcddev.width - 1, y + r, color);
             }
+
+            s = e;
         }
     }
 }
@@ -1372,6 +1752,7 @@ void lcd_show_xnum(uint16_t x, uint16_t y, uint32_t num, uint8_t len, uint8_t si
 
 /**
  * @brief       ʾַ
+ *   @note      ͬһַһһд
  * @param       x,y         : ʼ
  * @param       width,height: С
  * @param       size        : ѡ 12/16/24/32
@@ -1381,103 +1762,285 @@ void lcd_show_xnum(uint16_t x, uint16_t y, uint32_t num, uint8_t len, uint8_t si
  */
 void lcd_show_string(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t size, char *p, uint16_t color)
 {
-    uint8_t x0 = x;
-    
+    uint16_t x0 = x;
+    uint16_t sx = x;    /* ǰһεʼ */
+    char *s = p;        /* ǰһεĵһַ */
+
     width += x;
     height += y;
 
     while ((*p <= '~') && (*p >= ' '))   /* жǲǷǷַ! */
     {
-        if (x >= width)
+        if (x >= width || p - s == LCD_GLYPH_CACHE_NUM)
         {
-            x = x0;
-            y += size;
+            lcd_show_glyphs(sx, y, s, p - s, size, color);
+            s = p;
+
+            if (x >= width)
+            {
+                x = x0;
+                y += size;
+            }
+
+            sx = x;
         }
 
         if (y >= height)
         {
-            break;      /* ˳ */
+            return;     /* ˳ */
         }
 
-        lcd_show_char(x, y, *p, size, 0, color);
         x += size / 2;
         p++;
     }
+
+    if (p > s)
+    {
+        lcd_show_glyphs(sx, y, s, p - s, size, color);
+    }
 }
 
+/* ()ɨ: ߶˸һԲ, мһ, ÿеĸǷΧһx */
+typedef struct
+{
+    float x1, y1;           /*  */
+    float x2, y2;           /* յ */
+    float dx, dy;           /* յ -  */
+    float len2;             /* ߶γȵƽ */
+    float rl;               /* 뾶 * ߶γ */
+    float r2;               /* 뾶ƽ */
+} lcd_capsule_t;
+
+/* ϲɾεĴд, ͬʱһһд */
+static uint16_t g_lcd_span_x, g_lcd_span_y, g_lcd_span_w, g_lcd_span_h;
+
 /**
- * @brief       
+ * @brief       ʼҲ
+ * @param       c    : 
  * @param       x1,y1: 
  * @param       x2,y2: յ
- * @param       size : ϸ̶
- * @param       color: ߵɫ
+ * @param       r    : 뾶
  * @retval      
  */
-void lcd_draw_bline(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t size, uint16_t color)
+static void lcd_capsule_init(lcd_capsule_t *c, int x1, int y1, int x2, int y2, int r)
 {
-    uint16_t t;
-    int xerr = 0, yerr = 0, delta_x, delta_y, distance;
-    int incx, incy, row, col;
+    c->x1 = x1;
+    c->y1 = y1;
+    c->x2 = x2;
+    c->y2 = y2;
+    c->dx = x2 - x1;
+    c->dy = y2 - y1;
+    c->len2 = c->dx * c->dx + c->dy * c->dy;
+    c->rl = r * sqrtf(c->len2);
+    c->r2 = (float)r * r;
+}
 
-    if (x1 < size || x2 < size || y1 < size || y2 < size)
-        return;
+/**
+ * @brief       ĳһиǵx
+ *   @note      Բмθһν, ͹, Ĳһ
+ * @param       c  : 
+ * @param       y  : 
+ * @param       l,r: [l, r]
+ * @retval      0, и; 1, һûи;
+ */
+static uint8_t lcd_capsule_span(const lcd_capsule_t *c, int y, int *l, int *r)
+{
+    float lo = 1e9f, hi = -1e9f;
+    float a, b, t, v, h;
 
-    delta_x = x2 - x1; /*  */
-    delta_y = y2 - y1;
-    row = x1;
-    col = y1;
+    v = y - c->y1;                              /* Բ */
 
-    if (delta_x > 0)
+    if (v * v <= c->r2)
     {
-        incx = 1; /* õ */
+        h = sqrtf(c->r2 - v * v);
+        lo = c->x1 - h;
+        hi = c->x1 + h;
     }
-    else if (delta_x == 0)
+
+    v = y - c->y2;                              /* յԲ */
+
+    if (v * v <= c->r2)
     {
-        incx = 0; /* ֱ */
+        h = sqrtf(c->r2 - v * v);
+        lo = (c->x2 - h < lo) ? c->x2 - h : lo;
+        hi = (c->x2 + h > hi) ? c->x2 + h : hi;
     }
-    else
+
+    v = y - c->y1;
+
+    /* м: ֱߵľ |dx*v - dy*u| <= r*len, ͶӰ 0 <= dx*u + dy*v <= len^2, u = x - x1 */
+    if (c->len2 > 0)
     {
-        incx = -1;
-        delta_x = -delta_x;
+        a = -1e9f;
+        b = 1e9f;
+
+        if (c->dy != 0)
+        {
+            a = (c->dx * v - c->rl) / c->dy;
+            b = (c->dx * v + c->rl) / c->dy;
+
+            if (a > b)
+            {
+                t = a;
+                a = b;
+                b = t;
+            }
+        }
+        else if (fabsf(c->dx * v) > c->rl)
+        {
+            a = 1e9f;                           /* ˮƽ, һھ */
+        }
+
+        if (c->dx != 0)
+        {
+            h = -c->dy * v / c->dx;
+            t = (c->len2 - c->dy * v) / c->dx;
+
+            if (h > t)
+            {
+                v = h;
+                h = t;
+                t = v;
+            }
+
+            a = (h > a) ? h : a;
+            b = (t < b) ? t : b;
+        }
+        else if (c->dy * v < 0 || c->dy * v > c->len2)
+        {
+            a = 1e9f;                           /* ֱ, һھ */
+        }
+
+        if (a <= b)
+        {
+            lo = (c->x1 + a < lo) ? c->x1 + a : lo;
+            hi = (c->x1 + b > hi) ? c->x1 + b : hi;
+        }
     }
 
-    if (delta_y > 0)
+    *l = (int)ceilf(lo - 0.001f);               /* ݲ, ʹ߽ϵĵ㲻ʧ */
+    *r = (int)floorf(hi + 0.001f);
+    return (*l > *r);
+}
+
+/**
+ * @brief       ѴддGRAM: һ, д * 
+ * @param       color: ɫ
+ * @retval      
+ */
+static void lcd_span_flush(uint16_t color)
+{
+    uint32_t i, n;
+
+    if (g_lcd_span_h == 0)
     {
-        incy = 1;
+        return;
     }
-    else if (delta_y == 0)
+
+    n = (uint32_t)g_lcd_span_w * g_lcd_span_h;
+    lcd_set_window(g_lcd_span_x, g_lcd_span_y, g_lcd_span_w, g_lcd_span_h);
+    lcd_write_ram_prepare();
+
+    for (i = 0; i < n; i++)
     {
-        incy = 0; /* ˮƽ */
+        LCD_WR_RAM(color);
     }
-    else
+
+    LCD_BUS_ADD(n);
+    g_lcd_span_h = 0;
+}
+
+/**
+ * @brief       һˮƽ, һͬͬһ
+ * @param       l,r  : [l, r](ѲüĻ)
+ * @param       y    : 
+ * @param       color: ɫ
+ * @retval      
+ */
+static void lcd_span(int l, int r, int y, uint16_t color)
+{
+    if (g_lcd_span_h && g_lcd_span_x == l && g_lcd_span_w == r - l + 1 && g_lcd_span_y + g_lcd_span_h == y)
     {
-        incy = -1;
-        delta_y = -delta_y;
+        g_lcd_span_h++;
+        return;
     }
 
-    if (delta_x > delta_y)
-        distance = delta_x; /* ѡȡ */
-    else
-        distance = delta_y;
+    lcd_span_flush(color);
+    g_lcd_span_x = l;
+    g_lcd_span_y = y;
+    g_lcd_span_w = r - l + 1;
+    g_lcd_span_h = 1;
+}
+
+/**
+ * @brief       , һδصĲ
+ *   @note      ߰(˰Բ)ɨ, ÿֻдһ, ͬϲΪһ.
+ *              ʻɶδβ, һε, һνҸǹĵ㲻д.
+ * @param       x0,y0: һε(յ㼴), x0 = 0xFFFF ʾûһ
+ * @param       x1,y1: 
+ * @param       x2,y2: յ
+ * @param       size : ϸ̶(뾶)
+ * @param       color: ߵɫ
+ * @retval      
+ */
+void lcd_draw_bline_join(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t size, uint16_t color)
+{
+    lcd_capsule_t cur, prev;
+    int y, ys, ye, l, r, pl, pr;
+    uint8_t join = (x0 != 0xFFFF);
+
+    lcd_capsule_init(&cur, x1, y1, x2, y2, size);
 
-    for (t = 0; t <= distance + 1; t++) /*  */
+    if (join)
     {
-        lcd_fill_circle(row, col, size, color); /*  */
-        xerr += delta_x;
-        yerr += delta_y;
+        lcd_capsule_init(&prev, x0, y0, x1, y1, size);
+    }
 
-        if (xerr > distance)
+    ys = ((y1 < y2) ? y1 : y2) - size;
+    ye = ((y1 > y2) ? y1 : y2) + size;
+    ys = (ys < 0) ? 0 : ys;
+    ye = (ye > lcddev.height - 1) ? lcddev.height - 1 : ye;
+
+    for (y = ys; y <= ye; y++)
+    {
+        if (lcd_capsule_span(&cur, y, &l, &r))
         {
-            xerr -= distance;
-            row += incx;
+            continue;
         }
 
-        if (yerr > distance)
+        l = (l < 0) ? 0 : l;
+        r = (r > lcddev.width - 1) ? lcddev.width - 1 : r;
+
+        if (join && lcd_capsule_span(&prev, y, &pl, &pr) == 0)
         {
-            yerr -= distance;
-            col += incy;
+            if (l < pl)                         /* һߵĲ */
+            {
+                lcd_span(l, (r < pl - 1) ? r : pl - 1, y, color);
+            }
+
+            l = (pr + 1 > l) ? pr + 1 : l;      /* ʣһұߵĲ */
+        }
+
+        if (l <= r)
+        {
+            lcd_span(l, r, y, color);
         }
     }
+
+    lcd_span_flush(color);
+}
+
+/**
+ * @brief       
+ * @param       x1,y1: 
+ * @param       x2,y2: յ
+ * @param       size : ϸ̶(뾶)
+ * @param       color: ߵɫ
+ * @retval      
+ */
+void lcd_draw_bline(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t size, uint16_t color)
+{
+    lcd_draw_bline_join(0xFFFF, 0, x1, y1, x2, y2, size, color);
 }
 
 
@@ -0,0 +1,299 @@
+/**
+ ****************************************************************************************************
+ * @file        lcd_dma.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       DMA2 ڴ浽ڴдLCD GRAM, Ŷӵ첽д
+ ****************************************************************************************************
+ * @attention
+ *
+ * ڴ浽ڴģʽ˿Դ, 洢˿Ŀ: ԴַǷ(PINC),
+ * Ŀ LCD->LCD_RAM (MINC=0), ݿȶǰ. ģʽ뿪FIFO.
+ *
+ * g_lcd_dma_busy Ϊ1ʱDMAдGRAM. ֻڹжʱ޸; ʱŶӵĿɵֱ,
+ * ж. ж￪ʱ busy Ѿ, LCD_DMA_WAIT Ῠס.
+ * HAL ֻFIFO(FE)ʱҲôص, ûͣ, ֮ж, Դصֻ
+ * TE/DME, Ŀ, ٺʱһƽ. TEʱHALѾͣ; ֻDMEʱ HAL_DMA_Abort_IT
+ * EN, ж, ͣºжHALصREADYֹص, ƽ.
+ *
+ ****************************************************************************************************
+ */
+
+#include "string.h"
+#include "lcd_dma.h"
+#include "lcd.h"
+#include "dma.h"
+
+
+/* һ */
+typedef struct
+{
+    const uint16_t *src;                /* һδԴַ */
+    uint32_t num;                       /* ûдĵ */
+    uint16_t x, y, w, h;                /*  */
+    uint16_t color;                     /* ɫ,  src ָ */
+    uint8_t inc;                        /* 1, Դַ(ͼƬ) */
+    lcd_dma_cb_t cb;
+    void *arg;
+} lcd_dma_blit_t;
+
+volatile uint8_t g_lcd_dma_busy = 0;                /* 1, DMAдGRAM */
+
+static lcd_dma_blit_t g_lcd_dma_q[LCD_DMA_QUEUE_NUM];
+static volatile uint8_t g_lcd_dma_wr = 0;
+static volatile uint8_t g_lcd_dma_rd = 0;
+static uint32_t g_lcd_dma_chunk = 0;                /* ڽеĴĵ */
+static lcd_dma_stats_t g_lcd_dma_stats;
+
+/**
+ * @brief       ׿һδ(DMAʱ, жϻDMAж)
+ * @param       first: 1, ĵһδ, ȿ
+ * @retval      
+ */
+static void lcd_dma_start(uint8_t first)
+{
+    lcd_dma_blit_t *b = &g_lcd_dma_q[g_lcd_dma_rd % LCD_DMA_QUEUE_NUM];
+    DMA_HandleTypeDef *hdma = &hdma_memtomem_dma2_stream0;
+
+    if (first)
+    {
+        lcd_set_window(b->x, b->y, b->w, b->h);
+        lcd_write_ram_prepare();
+        MODIFY_REG(hdma->Instance->CR, DMA_SxCR_PINC, b->inc ? DMA_PINC_ENABLE : DMA_PINC_DISABLE);
+    }
+
+    g_lcd_dma_chunk = (b->num > LCD_DMA_CHUNK) ? LCD_DMA_CHUNK : b->num;
+    g_lcd_dma_busy = 1;
+
+    if (HAL_DMA_Start_IT(hdma, (uint32_t)b->src, (uint32_t)&LCD->LCD_RAM, g_lcd_dma_chunk) != HAL_OK)
+    {
+        g_lcd_dma_busy = 0;             /* ᷢ: ֻDMAʱ */
+        g_lcd_dma_stats.errors++;
+    }
+}
+
+/**
+ * @brief       һδ: ûдͽŴ, ӡصһ
+ * @param       drop: 1, , 
+ * @retval      
+ */
+static void lcd_dma_next(uint8_t drop)
+{
+    lcd_dma_blit_t *b = &g_lcd_dma_q[g_lcd_dma_rd % LCD_DMA_QUEUE_NUM];
+
+    g_lcd_dma_busy = 0;
+
+    if (drop)
+    {
+        b->num = 0;
+    }
+    else
+    {
+        b->num -= g_lcd_dma_chunk;
+
+        if (b->inc)
+        {
+            b->src += g_lcd_dma_chunk;
+        }
+    }
+
+    if (b->num)
+    {
+        lcd_dma_start(0);               /* ڲ, GRAMַһ */
+        return;
+    }
+
+    g_lcd_dma_rd++;
+
+    if (b->cb)
+    {
+        b->cb(b->arg);
+    }
+
+    if (g_lcd_dma_rd != g_lcd_dma_wr)
+    {
+        lcd_dma_start(1);
+    }
+}
+
+/**
+ * @brief       ɻص
+ * @param       hdma: DMA
+ * @retval      
+ */
+static void lcd_dma_done(DMA_HandleTypeDef *hdma)
+{
+    UNUSED(hdma);
+    lcd_dma_next(0);
+}
+
+/**
+ * @brief       ֹɻص(HAL_DMA_Abort_IT ֮ͣ)
+ * @param       hdma: DMA
+ * @retval      
+ */
+static void lcd_dma_abort(DMA_HandleTypeDef *hdma)
+{
+    UNUSED(hdma);
+    lcd_dma_next(1);
+}
+
+/**
+ * @brief       ص
+ *   @note      ֻFEʱ仹ڽ, ֻ; TEʱHALѾͣ˴, ;
+ *              DMEʱEN, ֹصٶ. ͬһжɻصѾƽʱֻ
+ * @param       hdma: DMA
+ * @retval      
+ */
+static void lcd_dma_error(DMA_HandleTypeDef *hdma)
+{
+    if ((hdma->ErrorCode & (HAL_DMA_ERROR_TE | HAL_DMA_ERROR_DME)) == 0)
+    {
+        g_lcd_dma_stats.fifo_errors++;
+        hdma->ErrorCode = HAL_DMA_ERROR_NONE;   /* Ļ HAL ֮жﻹ */
+        return;
+    }
+
+    g_lcd_dma_stats.errors++;
+
+    if (g_lcd_dma_busy == 0)            /* ɱ־ͬʱλ, δѾɻصƽ */
+    {
+        hdma->ErrorCode = HAL_DMA_ERROR_NONE;
+        return;
+    }
+
+    if (hdma->State == HAL_DMA_STATE_BUSY)
+    {
+        HAL_DMA_Abort_IT(hdma);         /* ֻDMEʱ HAL ûͣ: ENͷ, ж */
+        return;
+    }
+
+    lcd_dma_next(1);
+}
+
+/**
+ * @brief       ʼ: עɡֹص
+ * @param       
+ * @retval      
+ */
+void lcd_dma_init(void)
+{
+    memset(&g_lcd_dma_stats, 0, sizeof(g_lcd_dma_stats));
+    HAL_DMA_RegisterCallback(&hdma_memtomem_dma2_stream0, HAL_DMA_XFER_CPLT_CB_ID, lcd_dma_done);
+    HAL_DMA_RegisterCallback(&hdma_memtomem_dma2_stream0, HAL_DMA_XFER_ERROR_CB_ID, lcd_dma_error);
+    HAL_DMA_RegisterCallback(&hdma_memtomem_dma2_stream0, HAL_DMA_XFER_ABORT_CB_ID, lcd_dma_abort);
+}
+
+/**
+ * @brief       Ŷһ, DMAʱֱ
+ * @param       x,y,w,h: 
+ * @param       src    : , NULLʾ color
+ * @param       color  : ɫ
+ * @param       cb,arg : ɻص(DMAж), ΪNULL
+ * @retval      0, ɹ; 1, ;
+ */
+static uint8_t lcd_dma_submit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *src,
+                              uint16_t color, lcd_dma_cb_t cb, void *arg)
+{
+    lcd_dma_blit_t *b;
+    uint32_t primask;
+
+    if (w == 0 || h == 0 || x + w > lcddev.width || y + h > lcddev.height)
+    {
+        return 1;
+    }
+
+    if ((uint8_t)(g_lcd_dma_wr - g_lcd_dma_rd) >= LCD_DMA_QUEUE_NUM)
+    {
+        g_lcd_dma_stats.full++;
+
+        while ((uint8_t)(g_lcd_dma_wr - g_lcd_dma_rd) >= LCD_DMA_QUEUE_NUM);
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    b = &g_lcd_dma_q[g_lcd_dma_wr % LCD_DMA_QUEUE_NUM];
+    b->x = x;
+    b->y = y;
+    b->w = w;
+    b->h = h;
+    b->num = (uint32_t)w * h;
+    b->color = color;
+    b->inc = (src != NULL);
+    b->src = src ? src : &b->color;
+    b->cb = cb;
+    b->arg = arg;
+    g_lcd_dma_wr++;
+    g_lcd_dma_stats.blits++;
+    g_lcd_dma_stats.pixels += b->num;
+    LCD_BUS_ADD(b->num);                /* ڵд lcd_set_window  */
+
+    if (!g_lcd_dma_busy)
+    {
+        lcd_dma_start(1);
+    }
+
+    __set_PRIMASK(primask);
+    return 0;
+}
+
+/**
+ * @brief       Ŷһɫ
+ * @param       x,y   : Ͻ
+ * @param       w,h   : 
+ * @param       color : ɫ
+ * @param       cb,arg: ɻص(DMAж), ΪNULL
+ * @retval      0, ɹ; 1, ;
+ */
+uint8_t lcd_dma_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, lcd_dma_cb_t cb, void *arg)
+{
+    return lcd_dma_submit(x, y, w, h, NULL, color, cb, arg);
+}
+
+/**
+ * @brief       ŶһͼƬ
+ * @param       x,y   : Ͻ
+ * @param       w,h   : 
+ * @param       src   : w*h , ֶ, дǰܸ
+ * @param       cb,arg: ɻص(DMAж), ΪNULL
+ * @retval      0, ɹ; 1, ;
+ */
+uint8_t lcd_dma_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *src, lcd_dma_cb_t cb, void *arg)
+{
+    if (src == NULL || ((uint32_t)src & 1))
+    {
+        return 1;
+    }
+
+    return lcd_dma_submit(x, y, w, h, src, 0, cb, arg);
+}
+
+/**
+ * @brief       пд
+ * @param       
+ * @retval      
+ */
+void lcd_dma_wait(void)
+{
+    while (g_lcd_dma_busy);
+}
+
+/**
+ * @brief       ûдĿ
+ * @param       
+ * @retval      
+ */
+uint8_t lcd_dma_pending(void)
+{
+    return (uint8_t)(g_lcd_dma_wr - g_lcd_dma_rd);
+}
+
+/**
+ * @brief       ȡͳ
+ * @param       
+ * @retval      ͳ
+ */
+const lcd_dma_stats_t *lcd_dma_get_stats(void)
+{
+    return &g_lcd_dma_stats;
+}
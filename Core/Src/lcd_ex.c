@@ -2,11 +2,9 @@
  ****************************************************************************************************
  * @file        lcd_ex.c
  * @author      ԭŶ(ALIENTEK)
- * @version     V1.1
- * @date        2023-05-29
- * @brief       lcd_ex.cŸLCDICļĴʼִ,Լlcd.c,.cļ
- *              ֱӼ뵽,ֻlcd.cõ,ͨincludeʽ.(Ҫ
- *              ļٰ.cļ!!ᱨ!) 
+ * @version     V1.2
+ * @date        2026-10-18
+ * @brief       lcd_ex.cŸLCDICļĴʼִĽ,Լlcd.c
  * 
  * @license     Copyright (c) 2020-2032, ӿƼ޹˾
  ****************************************************************************************************
@@ -23,1683 +21,550 @@
  * һη
  * V1.1 20230529
  * 1ST7796ILI9806 IC֧
+ * V1.2 20261018
+ * 1߸ lcd_ex_xxx_reginit Ϊ const ֽ(//ʱ),  lcd_ex_run ִ,
+ *    ʱͷ,  lcd_init_poll ȵټ, мĳʼ
  ****************************************************************************************************
  */
 
 
 #include "lcd.h"
+#ifndef HOST_SIM
 #include "main.h"
+#endif
 #include "lcd_ex.h"
 
 
-/**
- * @brief       ST7789 Ĵʼ
- * @param       
- * @retval      
+/* ÿűĸʽ lcd_ex.h. ԭÿдһֽڶһ lcd_wr_data (Լ6ֽڴ),
+ * ĳɱÿֻֽռ1ֽFlash, SSD1963 Ĳ8λض(ԭ lcd_wr_data дҲֻе8λЧ)
  */
-void lcd_ex_st7789_reginit(void)
-{
-    lcd_wr_regno(0x11);
-
-    HAL_Delay(120); 
-
-    lcd_wr_regno(0x36);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0x3A);
-    lcd_wr_data(0x05);
-
-    lcd_wr_regno(0xB2);
-    lcd_wr_data(0x0C);
-    lcd_wr_data(0x0C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x33);
-    lcd_wr_data(0x33);
-
-    lcd_wr_regno(0xB7);
-    lcd_wr_data(0x35);
-
-    lcd_wr_regno(0xBB); /* vcom */
-    lcd_wr_data(0x32);  /* 30 */
-
-    lcd_wr_regno(0xC0);
-    lcd_wr_data(0x0C);
-
-    lcd_wr_regno(0xC2);
-    lcd_wr_data(0x01);
-
-    lcd_wr_regno(0xC3); /* vrh */
-    lcd_wr_data(0x10);  /* 17 0D */
-
-    lcd_wr_regno(0xC4); /* vdv */
-    lcd_wr_data(0x20);  /* 20 */
-
-    lcd_wr_regno(0xC6);
-    lcd_wr_data(0x0f);
-
-    lcd_wr_regno(0xD0);
-    lcd_wr_data(0xA4); 
-    lcd_wr_data(0xA1); 
-
-    lcd_wr_regno(0xE0); /* Set Gamma  */
-    lcd_wr_data(0xd0);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x02);
-    lcd_wr_data(0x07);
-    lcd_wr_data(0x0a);
-    lcd_wr_data(0x28);
-    lcd_wr_data(0x32);
-    lcd_wr_data(0x44);
-    lcd_wr_data(0x42);
-    lcd_wr_data(0x06);
-    lcd_wr_data(0x0e);
-    lcd_wr_data(0x12);
-    lcd_wr_data(0x14);
-    lcd_wr_data(0x17);
-
-
-    lcd_wr_regno(0xE1);  /* Set Gamma */
-    lcd_wr_data(0xd0);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x02);
-    lcd_wr_data(0x07);
-    lcd_wr_data(0x0a);
-    lcd_wr_data(0x28);
-    lcd_wr_data(0x31);
-    lcd_wr_data(0x54);
-    lcd_wr_data(0x47);
-    lcd_wr_data(0x0e);
-    lcd_wr_data(0x1c);
-    lcd_wr_data(0x17);
-    lcd_wr_data(0x1b); 
-    lcd_wr_data(0x1e);
-
 
-    lcd_wr_regno(0x2A);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xef);
-
-    lcd_wr_regno(0x2B);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0x3f);
-
-    lcd_wr_regno(0x29); /* display on */
-}
-
-/**
- * @brief       ILI9341Ĵʼ
- * @param       
- * @retval      
- */
-void lcd_ex_ili9341_reginit(void)
+/* ST7789 */
+static const uint8_t g_lcd_ex_st7789[] =
 {
-    lcd_wr_regno(0xCF);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xC1);
-    lcd_wr_data(0x30);
-    lcd_wr_regno(0xED);
-    lcd_wr_data(0x64);
-    lcd_wr_data(0x03);
-    lcd_wr_data(0x12);
-    lcd_wr_data(0x81);
-    lcd_wr_regno(0xE8);
-    lcd_wr_data(0x85);
-    lcd_wr_data(0x10);
-    lcd_wr_data(0x7A);
-    lcd_wr_regno(0xCB);
-    lcd_wr_data(0x39);
-    lcd_wr_data(0x2C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x34);
-    lcd_wr_data(0x02);
-    lcd_wr_regno(0xF7);
-    lcd_wr_data(0x20);
-    lcd_wr_regno(0xEA);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_regno(0xC0); /* Power control */
-    lcd_wr_data(0x1B);  /* VRH[5:0] */
-    lcd_wr_regno(0xC1); /* Power control */
-    lcd_wr_data(0x01);  /* SAP[2:0];BT[3:0] */
-    lcd_wr_regno(0xC5); /* VCM control */
-    lcd_wr_data(0x30);  /* 3F */
-    lcd_wr_data(0x30);  /* 3C */
-    lcd_wr_regno(0xC7); /* VCM control2 */
-    lcd_wr_data(0xB7);
-    lcd_wr_regno(0x36); /* Memory Access Control */
-    lcd_wr_data(0x48);
-    lcd_wr_regno(0x3A);
-    lcd_wr_data(0x55);
-    lcd_wr_regno(0xB1);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x1A);
-    lcd_wr_regno(0xB6); /* Display Function Control */
-    lcd_wr_data(0x0A);
-    lcd_wr_data(0xA2);
-    lcd_wr_regno(0xF2); /* 3Gamma Function Disable */
-    lcd_wr_data(0x00);
-    lcd_wr_regno(0x26); /* Gamma curve selected */
-    lcd_wr_data(0x01);
-    lcd_wr_regno(0xE0); /* Set Gamma */
-    lcd_wr_data(0x0F);
-    lcd_wr_data(0x2A);
-    lcd_wr_data(0x28);
-    lcd_wr_data(0x08);
-    lcd_wr_data(0x0E);
-    lcd_wr_data(0x08);
-    lcd_wr_data(0x54);
-    lcd_wr_data(0xA9);
-    lcd_wr_data(0x43);
-    lcd_wr_data(0x0A);
-    lcd_wr_data(0x0F);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_regno(0xE1); /* Set Gamma */
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x15);
-    lcd_wr_data(0x17);
-    lcd_wr_data(0x07);
-    lcd_wr_data(0x11);
-    lcd_wr_data(0x06);
-    lcd_wr_data(0x2B);
-    lcd_wr_data(0x56);
-    lcd_wr_data(0x3C);
-    lcd_wr_data(0x05);
-    lcd_wr_data(0x10);
-    lcd_wr_data(0x0F);
-    lcd_wr_data(0x3F);
-    lcd_wr_data(0x3F);
-    lcd_wr_data(0x0F);
-    lcd_wr_regno(0x2B);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0x3f);
-    lcd_wr_regno(0x2A);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xef);
-    lcd_wr_regno(0x11); /* Exit Sleep */
-    HAL_Delay(120);
-    lcd_wr_regno(0x29); /* display on */
- }
- 
-
-/**
- * @brief       NT35310Ĵʼ 
- * @param       
- * @retval      
- */
-void lcd_ex_nt35310_reginit(void)
+    LCD_CMD(0x11, 0),
+    LCD_DELAY(120),
+    LCD_CMD(0x36, 1), 0x00,
+    LCD_CMD(0x3A, 1), 0x05,
+    LCD_CMD(0xB2, 5), 0x0C, 0x0C, 0x00, 0x33, 0x33,
+    LCD_CMD(0xB7, 1), 0x35,
+    LCD_CMD(0xBB, 1),                                   /* vcom */
+        0x32,                                           /* 30 */
+    LCD_CMD(0xC0, 1), 0x0C,
+    LCD_CMD(0xC2, 1), 0x01,
+    LCD_CMD(0xC3, 1),                                   /* vrh */
+        0x10,                                           /* 17 0D */
+    LCD_CMD(0xC4, 1),                                   /* vdv */
+        0x20,                                           /* 20 */
+    LCD_CMD(0xC6, 1), 0x0F,
+    LCD_CMD(0xD0, 2), 0xA4, 0xA1,
+    /* Set Gamma */
+    LCD_CMD(0xE0, 14),
+        0xD0, 0x00, 0x02, 0x07, 0x0A, 0x28, 0x32, 0x44, 0x42, 0x06, 0x0E, 0x12, 0x14, 0x17,
+    /* Set Gamma */
+    LCD_CMD(0xE1, 14),
+        0xD0, 0x00, 0x02, 0x07, 0x0A, 0x28, 0x31, 0x54, 0x47, 0x0E, 0x1C, 0x17, 0x1B, 0x1E,
+    LCD_CMD(0x2A, 4), 0x00, 0x00, 0x00, 0xEF,
+    LCD_CMD(0x2B, 4), 0x00, 0x00, 0x01, 0x3F,
+    LCD_CMD(0x29, 0),                                   /* display on */
+    LCD_END
+};
+
+/* ILI9341 */
+static const uint8_t g_lcd_ex_ili9341[] =
 {
-    lcd_wr_regno(0xED);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0xFE);
-
-    lcd_wr_regno(0xEE);
-    lcd_wr_data(0xDE);
-    lcd_wr_data(0x21);
-
-    lcd_wr_regno(0xF1);
-    lcd_wr_data(0x01);
-    lcd_wr_regno(0xDF);
-    lcd_wr_data(0x10);
-
+    LCD_CMD(0xCF, 3), 0x00, 0xC1, 0x30,
+    LCD_CMD(0xED, 4), 0x64, 0x03, 0x12, 0x81,
+    LCD_CMD(0xE8, 3), 0x85, 0x10, 0x7A,
+    LCD_CMD(0xCB, 5), 0x39, 0x2C, 0x00, 0x34, 0x02,
+    LCD_CMD(0xF7, 1), 0x20,
+    LCD_CMD(0xEA, 2), 0x00, 0x00,
+    LCD_CMD(0xC0, 1),                                   /* Power control */
+        0x1B,                                           /* VRH[5:0] */
+    LCD_CMD(0xC1, 1),                                   /* Power control */
+        0x01,                                           /* SAP[2:0];BT[3:0] */
+    LCD_CMD(0xC5, 2),                                   /* VCM control */
+        0x30,                                           /* 3F */
+        0x30,                                           /* 3C */
+    LCD_CMD(0xC7, 1), 0xB7,                             /* VCM control2 */
+    LCD_CMD(0x36, 1), 0x48,                             /* Memory Access Control */
+    LCD_CMD(0x3A, 1), 0x55,
+    LCD_CMD(0xB1, 2), 0x00, 0x1A,
+    LCD_CMD(0xB6, 2), 0x0A, 0xA2,                       /* Display Function Control */
+    LCD_CMD(0xF2, 1), 0x00,                             /* 3Gamma Function Disable */
+    LCD_CMD(0x26, 1), 0x01,                             /* Gamma curve selected */
+    /* Set Gamma */
+    LCD_CMD(0xE0, 15),
+        0x0F, 0x2A, 0x28, 0x08, 0x0E, 0x08, 0x54, 0xA9, 0x43, 0x0A, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    /* Set Gamma */
+    LCD_CMD(0xE1, 15),
+        0x00, 0x15, 0x17, 0x07, 0x11, 0x06, 0x2B, 0x56, 0x3C, 0x05, 0x10, 0x0F, 0x3F, 0x3F, 0x0F,
+    LCD_CMD(0x2B, 4), 0x00, 0x00, 0x01, 0x3F,
+    LCD_CMD(0x2A, 4), 0x00, 0x00, 0x00, 0xEF,
+    LCD_CMD(0x11, 0),                                   /* Exit Sleep */
+    LCD_DELAY(120),
+    LCD_CMD(0x29, 0),                                   /* display on */
+    LCD_END
+};
+
+/* NT35310 */
+static const uint8_t g_lcd_ex_nt35310[] =
+{
+    LCD_CMD(0xED, 2), 0x01, 0xFE,
+    LCD_CMD(0xEE, 2), 0xDE, 0x21,
+    LCD_CMD(0xF1, 1), 0x01,
+    LCD_CMD(0xDF, 1), 0x10,
     /* VCOMvoltage */
-    lcd_wr_regno(0xC4);
-    lcd_wr_data(0x8F);  /* 5f */
-
-    lcd_wr_regno(0xC6);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xE2);
-    lcd_wr_data(0xE2);
-    lcd_wr_data(0xE2);
-    lcd_wr_regno(0xBF);
-    lcd_wr_data(0xAA);
-
-    lcd_wr_regno(0xB0);
-    lcd_wr_data(0x0D);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x0D);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x11);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x19);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x21);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x2D);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x3D);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x5D);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x5D);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xB1);
-    lcd_wr_data(0x80);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x8B);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x96);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xB2);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x02);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x03);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xB3);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xB4);
-    lcd_wr_data(0x8B);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x96);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xA1);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xB5);
-    lcd_wr_data(0x02);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x03);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x04);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xB6);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xB7);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x3F);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x5E);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x64);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x8C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xAC);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xDC);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x70);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x90);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xEB);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xDC);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xB8);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xBA);
-    lcd_wr_data(0x24);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xC1);
-    lcd_wr_data(0x20);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x54);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xFF);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xC2);
-    lcd_wr_data(0x0A);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x04);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xC3);
-    lcd_wr_data(0x3C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x3A);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x39);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x37);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x3C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x36);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x32);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x2F);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x2C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x29);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x26);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x24);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x24);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x23);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x3C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x36);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x32);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x2F);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x2C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x29);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x26);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x24);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x24);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x23);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xC4);
-    lcd_wr_data(0x62);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x05);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x84);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xF0);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x18);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xA4);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x18);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x50);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x0C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x17);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x95);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xF3);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xE6);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xC5);
-    lcd_wr_data(0x32);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x44);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x65);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x76);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x88);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xC6);
-    lcd_wr_data(0x20);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x17);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xC7);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xC8);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xC9);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xE0);
-    lcd_wr_data(0x16);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x1C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x21);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x36);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x46);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x52);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x64);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x7A);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x8B);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x99);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xA8);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xB9);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xC4);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xCA);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xD2);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xD9);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xE0);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xF3);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xE1);
-    lcd_wr_data(0x16);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x1C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x22);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x36);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x45);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x52);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x64);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x7A);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x8B);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x99);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xA8);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xB9);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xC4);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xCA);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xD2);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xD8);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xE0);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xF3);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xE2);
-    lcd_wr_data(0x05);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x0B);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x1B);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x34);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x44);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x4F);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x61);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x79);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x88);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x97);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xA6);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xB7);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xC2);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xC7);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xD1);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xD6);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xDD);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xF3);
-    lcd_wr_data(0x00);
-    lcd_wr_regno(0xE3);
-    lcd_wr_data(0x05);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xA);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x1C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x33);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x44);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x50);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x62);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x78);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x88);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x97);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xA6);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xB7);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xC2);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xC7);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xD1);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xD5);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xDD);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xF3);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xE4);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x02);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x2A);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x3C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x4B);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x5D);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x74);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x84);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x93);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xA2);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xB3);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xBE);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xC4);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xCD);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xD3);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xDD);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xF3);
-    lcd_wr_data(0x00);
-    lcd_wr_regno(0xE5);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x02);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x29);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x3C);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x4B);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x5D);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x74);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x84);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x93);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xA2);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xB3);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xBE);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xC4);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xCD);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xD3);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xDC);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xF3);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xE6);
-    lcd_wr_data(0x11);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x34);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x56);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x76);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x77);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x66);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x88);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x99);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xBB);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x99);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x66);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x55);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x55);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x45);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x43);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x44);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xE7);
-    lcd_wr_data(0x32);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x55);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x76);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x66);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x67);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x67);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x87);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x99);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xBB);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x99);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x77);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x44);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x56);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x23);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x33);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x45);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xE8);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x99);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x87);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x88);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x77);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x66);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x88);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xAA);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xBB);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x99);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x66);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x55);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x55);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x44);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x44);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x55);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xE9);
-    lcd_wr_data(0xAA);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0x00);
-    lcd_wr_data(0xAA);
-
-    lcd_wr_regno(0xCF);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xF0);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x50);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xF3);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xF9);
-    lcd_wr_data(0x06);
-    lcd_wr_data(0x10);
-    lcd_wr_data(0x29);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0x3A);
-    lcd_wr_data(0x55);  /* 66 */
-
-    lcd_wr_regno(0x11);
-    HAL_Delay(100);
-    lcd_wr_regno(0x29);
-    lcd_wr_regno(0x35);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0x51);
-    lcd_wr_data(0xFF);
-    lcd_wr_regno(0x53);
-    lcd_wr_data(0x2C);
-    lcd_wr_regno(0x55);
-    lcd_wr_data(0x82);
-    lcd_wr_regno(0x2c);
-}
-
-/**
- * @brief       ST7796Ĵʼ 
- * @param       
- * @retval      
- */
-void lcd_ex_st7796_reginit(void)
+    LCD_CMD(0xC4, 1),
+        0x8F,                                           /* 5f */
+    LCD_CMD(0xC6, 4), 0x00, 0xE2, 0xE2, 0xE2,
+    LCD_CMD(0xBF, 1), 0xAA,
+    LCD_CMD(0xB0, 18),
+        0x0D, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x19, 0x00, 0x21, 0x00, 0x2D, 0x00, 0x3D, 0x00, 0x5D, 0x00,
+        0x5D, 0x00,
+    LCD_CMD(0xB1, 6), 0x80, 0x00, 0x8B, 0x00, 0x96, 0x00,
+    LCD_CMD(0xB2, 6), 0x00, 0x00, 0x02, 0x00, 0x03, 0x00,
+    LCD_CMD(0xB3, 24),
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    LCD_CMD(0xB4, 6), 0x8B, 0x00, 0x96, 0x00, 0xA1, 0x00,
+    LCD_CMD(0xB5, 6), 0x02, 0x00, 0x03, 0x00, 0x04, 0x00,
+    LCD_CMD(0xB6, 2), 0x00, 0x00,
+    LCD_CMD(0xB7, 22),
+        0x00, 0x00, 0x3F, 0x00, 0x5E, 0x00, 0x64, 0x00, 0x8C, 0x00, 0xAC, 0x00, 0xDC, 0x00, 0x70, 0x00,
+        0x90, 0x00, 0xEB, 0x00, 0xDC, 0x00,
+    LCD_CMD(0xB8, 8), 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    LCD_CMD(0xBA, 4), 0x24, 0x00, 0x00, 0x00,
+    LCD_CMD(0xC1, 6), 0x20, 0x00, 0x54, 0x00, 0xFF, 0x00,
+    LCD_CMD(0xC2, 4), 0x0A, 0x00, 0x04, 0x00,
+    LCD_CMD(0xC3, 48),
+        0x3C, 0x00, 0x3A, 0x00, 0x39, 0x00, 0x37, 0x00, 0x3C, 0x00, 0x36, 0x00, 0x32, 0x00, 0x2F, 0x00,
+        0x2C, 0x00, 0x29, 0x00, 0x26, 0x00, 0x24, 0x00, 0x24, 0x00, 0x23, 0x00, 0x3C, 0x00, 0x36, 0x00,
+        0x32, 0x00, 0x2F, 0x00, 0x2C, 0x00, 0x29, 0x00, 0x26, 0x00, 0x24, 0x00, 0x24, 0x00, 0x23, 0x00,
+    LCD_CMD(0xC4, 26),
+        0x62, 0x00, 0x05, 0x00, 0x84, 0x00, 0xF0, 0x00, 0x18, 0x00, 0xA4, 0x00, 0x18, 0x00, 0x50, 0x00,
+        0x0C, 0x00, 0x17, 0x00, 0x95, 0x00, 0xF3, 0x00, 0xE6, 0x00,
+    LCD_CMD(0xC5, 10), 0x32, 0x00, 0x44, 0x00, 0x65, 0x00, 0x76, 0x00, 0x88, 0x00,
+    LCD_CMD(0xC6, 6), 0x20, 0x00, 0x17, 0x00, 0x01, 0x00,
+    LCD_CMD(0xC7, 4), 0x00, 0x00, 0x00, 0x00,
+    LCD_CMD(0xC8, 4), 0x00, 0x00, 0x00, 0x00,
+    LCD_CMD(0xC9, 16),
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    LCD_CMD(0xE0, 36),
+        0x16, 0x00, 0x1C, 0x00, 0x21, 0x00, 0x36, 0x00, 0x46, 0x00, 0x52, 0x00, 0x64, 0x00, 0x7A, 0x00,
+        0x8B, 0x00, 0x99, 0x00, 0xA8, 0x00, 0xB9, 0x00, 0xC4, 0x00, 0xCA, 0x00, 0xD2, 0x00, 0xD9, 0x00,
+        0xE0, 0x00, 0xF3, 0x00,
+    LCD_CMD(0xE1, 36),
+        0x16, 0x00, 0x1C, 0x00, 0x22, 0x00, 0x36, 0x00, 0x45, 0x00, 0x52, 0x00, 0x64, 0x00, 0x7A, 0x00,
+        0x8B, 0x00, 0x99, 0x00, 0xA8, 0x00, 0xB9, 0x00, 0xC4, 0x00, 0xCA, 0x00, 0xD2, 0x00, 0xD8, 0x00,
+        0xE0, 0x00, 0xF3, 0x00,
+    LCD_CMD(0xE2, 36),
+        0x05, 0x00, 0x0B, 0x00, 0x1B, 0x00, 0x34, 0x00, 0x44, 0x00, 0x4F, 0x00, 0x61, 0x00, 0x79, 0x00,
+        0x88, 0x00, 0x97, 0x00, 0xA6, 0x00, 0xB7, 0x00, 0xC2, 0x00, 0xC7, 0x00, 0xD1, 0x00, 0xD6, 0x00,
+        0xDD, 0x00, 0xF3, 0x00,
+    LCD_CMD(0xE3, 36),
+        0x05, 0x00, 0x0A, 0x00, 0x1C, 0x00, 0x33, 0x00, 0x44, 0x00, 0x50, 0x00, 0x62, 0x00, 0x78, 0x00,
+        0x88, 0x00, 0x97, 0x00, 0xA6, 0x00, 0xB7, 0x00, 0xC2, 0x00, 0xC7, 0x00, 0xD1, 0x00, 0xD5, 0x00,
+        0xDD, 0x00, 0xF3, 0x00,
+    LCD_CMD(0xE4, 36),
+        0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x2A, 0x00, 0x3C, 0x00, 0x4B, 0x00, 0x5D, 0x00, 0x74, 0x00,
+        0x84, 0x00, 0x93, 0x00, 0xA2, 0x00, 0xB3, 0x00, 0xBE, 0x00, 0xC4, 0x00, 0xCD, 0x00, 0xD3, 0x00,
+        0xDD, 0x00, 0xF3, 0x00,
+    LCD_CMD(0xE5, 36),
+        0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x29, 0x00, 0x3C, 0x00, 0x4B, 0x00, 0x5D, 0x00, 0x74, 0x00,
+        0x84, 0x00, 0x93, 0x00, 0xA2, 0x00, 0xB3, 0x00, 0xBE, 0x00, 0xC4, 0x00, 0xCD, 0x00, 0xD3, 0x00,
+        0xDC, 0x00, 0xF3, 0x00,
+    LCD_CMD(0xE6, 32),
+        0x11, 0x00, 0x34, 0x00, 0x56, 0x00, 0x76, 0x00, 0x77, 0x00, 0x66, 0x00, 0x88, 0x00, 0x99, 0x00,
+        0xBB, 0x00, 0x99, 0x00, 0x66, 0x00, 0x55, 0x00, 0x55, 0x00, 0x45, 0x00, 0x43, 0x00, 0x44, 0x00,
+    LCD_CMD(0xE7, 32),
+        0x32, 0x00, 0x55, 0x00, 0x76, 0x00, 0x66, 0x00, 0x67, 0x00, 0x67, 0x00, 0x87, 0x00, 0x99, 0x00,
+        0xBB, 0x00, 0x99, 0x00, 0x77, 0x00, 0x44, 0x00, 0x56, 0x00, 0x23, 0x00, 0x33, 0x00, 0x45, 0x00,
+    LCD_CMD(0xE8, 32),
+        0x00, 0x00, 0x99, 0x00, 0x87, 0x00, 0x88, 0x00, 0x77, 0x00, 0x66, 0x00, 0x88, 0x00, 0xAA, 0x00,
+        0xBB, 0x00, 0x99, 0x00, 0x66, 0x00, 0x55, 0x00, 0x55, 0x00, 0x44, 0x00, 0x44, 0x00, 0x55, 0x00,
+    LCD_CMD(0xE9, 4), 0xAA, 0x00, 0x00, 0x00,
+    LCD_CMD(0x00, 1), 0xAA,
+    LCD_CMD(0xCF, 17),
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00,
+    LCD_CMD(0xF0, 5), 0x00, 0x50, 0x00, 0x00, 0x00,
+    LCD_CMD(0xF3, 1), 0x00,
+    LCD_CMD(0xF9, 4), 0x06, 0x10, 0x29, 0x00,
+    LCD_CMD(0x3A, 1),
+        0x55,                                           /* 66 */
+    LCD_CMD(0x11, 0),
+    LCD_DELAY(100),
+    LCD_CMD(0x29, 0),
+    LCD_CMD(0x35, 1), 0x00,
+    LCD_CMD(0x51, 1), 0xFF,
+    LCD_CMD(0x53, 1), 0x2C,
+    LCD_CMD(0x55, 1), 0x82,
+    LCD_CMD(0x2C, 0),
+    LCD_END
+};
+
+/* ST7796 */
+static const uint8_t g_lcd_ex_st7796[] =
 {
-    lcd_wr_regno(0x11);
-
-    HAL_Delay(120); 
-
-    lcd_wr_regno(0x36); /* Memory Data Access Control MY,MX~~ */
-    lcd_wr_data(0x48);
-    
-    lcd_wr_regno(0x3A);
-    lcd_wr_data(0x55);
-    
-    lcd_wr_regno(0xF0);
-    lcd_wr_data(0xC3);
-    
-    lcd_wr_regno(0xF0);
-    lcd_wr_data(0x96);
-
-    lcd_wr_regno(0xB4);
-    lcd_wr_data(0x01);
-    
-    lcd_wr_regno(0xB6); /* Display Function Control */
-    lcd_wr_data(0x0A);
-    lcd_wr_data(0xA2);
-
-    lcd_wr_regno(0xB7);
-    lcd_wr_data(0xC6);
-
-    lcd_wr_regno(0xB9);
-    lcd_wr_data(0x02);
-    lcd_wr_data(0xE0);
-
-    lcd_wr_regno(0xC0);
-    lcd_wr_data(0x80);
-    lcd_wr_data(0x16);
-
-    lcd_wr_regno(0xC1);
-    lcd_wr_data(0x19);
-
-    lcd_wr_regno(0xC2);
-    lcd_wr_data(0xA7);
-
-    lcd_wr_regno(0xC5);
-    lcd_wr_data(0x16);   
-
-    lcd_wr_regno(0xE8);
-    lcd_wr_data(0x40);
-    lcd_wr_data(0x8A);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x29);
-    lcd_wr_data(0x19);
-    lcd_wr_data(0xA5);
-    lcd_wr_data(0x33);
-
-    lcd_wr_regno(0xE0);
-    lcd_wr_data(0xF0);
-    lcd_wr_data(0x07);
-    lcd_wr_data(0x0D);
-    lcd_wr_data(0x04);
-    lcd_wr_data(0x05);
-    lcd_wr_data(0x14);
-    lcd_wr_data(0x36);
-    lcd_wr_data(0x54);
-    lcd_wr_data(0x4C);
-    lcd_wr_data(0x38);
-    lcd_wr_data(0x13);
-    lcd_wr_data(0x14);
-    lcd_wr_data(0x2E);
-    lcd_wr_data(0x34);
-
-    lcd_wr_regno(0xE1);
-    lcd_wr_data(0xF0);
-    lcd_wr_data(0x10);
-    lcd_wr_data(0x14);
-    lcd_wr_data(0x0E);
-    lcd_wr_data(0x0C);
-    lcd_wr_data(0x08);
-    lcd_wr_data(0x35);
-    lcd_wr_data(0x44);
-    lcd_wr_data(0x4C);
-    lcd_wr_data(0x26);
-    lcd_wr_data(0x10);
-    lcd_wr_data(0x12);
-    lcd_wr_data(0x2C);
-    lcd_wr_data(0x32);
-
-    lcd_wr_regno(0xF0);
-    lcd_wr_data(0x3C);
-
-    lcd_wr_regno(0xF0);
-    lcd_wr_data(0x69);
-
-    HAL_Delay(120);
-
-    lcd_wr_regno(0x21);
-    lcd_wr_regno(0x29);
-}
-
-/**
- * @brief       NT35510Ĵʼ 
- * @param       
- * @retval      
- */
-void lcd_ex_nt35510_reginit(void)
+    LCD_CMD(0x11, 0),
+    LCD_DELAY(120),
+    LCD_CMD(0x36, 1), 0x48,                             /* Memory Data Access Control MY,MX~~ */
+    LCD_CMD(0x3A, 1), 0x55,
+    LCD_CMD(0xF0, 1), 0xC3,
+    LCD_CMD(0xF0, 1), 0x96,
+    LCD_CMD(0xB4, 1), 0x01,
+    LCD_CMD(0xB6, 2), 0x0A, 0xA2,                       /* Display Function Control */
+    LCD_CMD(0xB7, 1), 0xC6,
+    LCD_CMD(0xB9, 2), 0x02, 0xE0,
+    LCD_CMD(0xC0, 2), 0x80, 0x16,
+    LCD_CMD(0xC1, 1), 0x19,
+    LCD_CMD(0xC2, 1), 0xA7,
+    LCD_CMD(0xC5, 1), 0x16,
+    LCD_CMD(0xE8, 8), 0x40, 0x8A, 0x00, 0x00, 0x29, 0x19, 0xA5, 0x33,
+    LCD_CMD(0xE0, 14),
+        0xF0, 0x07, 0x0D, 0x04, 0x05, 0x14, 0x36, 0x54, 0x4C, 0x38, 0x13, 0x14, 0x2E, 0x34,
+    LCD_CMD(0xE1, 14),
+        0xF0, 0x10, 0x14, 0x0E, 0x0C, 0x08, 0x35, 0x44, 0x4C, 0x26, 0x10, 0x12, 0x2C, 0x32,
+    LCD_CMD(0xF0, 1), 0x3C,
+    LCD_CMD(0xF0, 1), 0x69,
+    LCD_DELAY(120),
+    LCD_CMD(0x21, 0),
+    LCD_CMD(0x29, 0),
+    LCD_END
+};
+
+/* NT35510 */
+static const uint8_t g_lcd_ex_nt35510[] =
 {
-    lcd_write_reg(0xF000, 0x55);
-    lcd_write_reg(0xF001, 0xAA);
-    lcd_write_reg(0xF002, 0x52);
-    lcd_write_reg(0xF003, 0x08);
-    lcd_write_reg(0xF004, 0x01);
+    LCD_SEQ(0xF000, 5), 0x55, 0xAA, 0x52, 0x08, 0x01,
     /* AVDD Set AVDD 5.2V */
-    lcd_write_reg(0xB000, 0x0D);
-    lcd_write_reg(0xB001, 0x0D);
-    lcd_write_reg(0xB002, 0x0D);
+    LCD_SEQ(0xB000, 3), 0x0D, 0x0D, 0x0D,
     /* AVDD ratio */
-    lcd_write_reg(0xB600, 0x34);
-    lcd_write_reg(0xB601, 0x34);
-    lcd_write_reg(0xB602, 0x34);
+    LCD_SEQ(0xB600, 3), 0x34, 0x34, 0x34,
     /* AVEE -5.2V */
-    lcd_write_reg(0xB100, 0x0D);
-    lcd_write_reg(0xB101, 0x0D);
-    lcd_write_reg(0xB102, 0x0D);
+    LCD_SEQ(0xB100, 3), 0x0D, 0x0D, 0x0D,
     /* AVEE ratio */
-    lcd_write_reg(0xB700, 0x34);
-    lcd_write_reg(0xB701, 0x34);
-    lcd_write_reg(0xB702, 0x34);
+    LCD_SEQ(0xB700, 3), 0x34, 0x34, 0x34,
     /* VCL -2.5V */
-    lcd_write_reg(0xB200, 0x00);
-    lcd_write_reg(0xB201, 0x00);
-    lcd_write_reg(0xB202, 0x00);
+    LCD_SEQ(0xB200, 3), 0x00, 0x00, 0x00,
     /* VCL ratio */
-    lcd_write_reg(0xB800, 0x24);
-    lcd_write_reg(0xB801, 0x24);
-    lcd_write_reg(0xB802, 0x24);
+    LCD_SEQ(0xB800, 3), 0x24, 0x24, 0x24,
     /* VGH 15V (Free pump) */
-    lcd_write_reg(0xBF00, 0x01);
-    lcd_write_reg(0xB300, 0x0F);
-    lcd_write_reg(0xB301, 0x0F);
-    lcd_write_reg(0xB302, 0x0F);
+    LCD_SEQ(0xBF00, 1), 0x01,
+    LCD_SEQ(0xB300, 3), 0x0F, 0x0F, 0x0F,
     /* VGH ratio */
-    lcd_write_reg(0xB900, 0x34);
-    lcd_write_reg(0xB901, 0x34);
-    lcd_write_reg(0xB902, 0x34);
+    LCD_SEQ(0xB900, 3), 0x34, 0x34, 0x34,
     /* VGL_REG -10V */
-    lcd_write_reg(0xB500, 0x08);
-    lcd_write_reg(0xB501, 0x08);
-    lcd_write_reg(0xB502, 0x08);
-    lcd_write_reg(0xC200, 0x03);
+    LCD_SEQ(0xB500, 3), 0x08, 0x08, 0x08,
+    LCD_SEQ(0xC200, 1), 0x03,
     /* VGLX ratio */
-    lcd_write_reg(0xBA00, 0x24);
-    lcd_write_reg(0xBA01, 0x24);
-    lcd_write_reg(0xBA02, 0x24);
+    LCD_SEQ(0xBA00, 3), 0x24, 0x24, 0x24,
     /* VGMP/VGSP 4.5V/0V */
-    lcd_write_reg(0xBC00, 0x00);
-    lcd_write_reg(0xBC01, 0x78);
-    lcd_write_reg(0xBC02, 0x00);
+    LCD_SEQ(0xBC00, 3), 0x00, 0x78, 0x00,
     /* VGMN/VGSN -4.5V/0V */
-    lcd_write_reg(0xBD00, 0x00);
-    lcd_write_reg(0xBD01, 0x78);
-    lcd_write_reg(0xBD02, 0x00);
+    LCD_SEQ(0xBD00, 3), 0x00, 0x78, 0x00,
     /* VCOM */
-    lcd_write_reg(0xBE00, 0x00);
-    lcd_write_reg(0xBE01, 0x64);
+    LCD_SEQ(0xBE00, 2), 0x00, 0x64,
     /* Gamma Setting */
-    lcd_write_reg(0xD100, 0x00);
-    lcd_write_reg(0xD101, 0x33);
-    lcd_write_reg(0xD102, 0x00);
-    lcd_write_reg(0xD103, 0x34);
-    lcd_write_reg(0xD104, 0x00);
-    lcd_write_reg(0xD105, 0x3A);
-    lcd_write_reg(0xD106, 0x00);
-    lcd_write_reg(0xD107, 0x4A);
-    lcd_write_reg(0xD108, 0x00);
-    lcd_write_reg(0xD109, 0x5C);
-    lcd_write_reg(0xD10A, 0x00);
-    lcd_write_reg(0xD10B, 0x81);
-    lcd_write_reg(0xD10C, 0x00);
-    lcd_write_reg(0xD10D, 0xA6);
-    lcd_write_reg(0xD10E, 0x00);
-    lcd_write_reg(0xD10F, 0xE5);
-    lcd_write_reg(0xD110, 0x01);
-    lcd_write_reg(0xD111, 0x13);
-    lcd_write_reg(0xD112, 0x01);
-    lcd_write_reg(0xD113, 0x54);
-    lcd_write_reg(0xD114, 0x01);
-    lcd_write_reg(0xD115, 0x82);
-    lcd_write_reg(0xD116, 0x01);
-    lcd_write_reg(0xD117, 0xCA);
-    lcd_write_reg(0xD118, 0x02);
-    lcd_write_reg(0xD119, 0x00);
-    lcd_write_reg(0xD11A, 0x02);
-    lcd_write_reg(0xD11B, 0x01);
-    lcd_write_reg(0xD11C, 0x02);
-    lcd_write_reg(0xD11D, 0x34);
-    lcd_write_reg(0xD11E, 0x02);
-    lcd_write_reg(0xD11F, 0x67);
-    lcd_write_reg(0xD120, 0x02);
-    lcd_write_reg(0xD121, 0x84);
-    lcd_write_reg(0xD122, 0x02);
-    lcd_write_reg(0xD123, 0xA4);
-    lcd_write_reg(0xD124, 0x02);
-    lcd_write_reg(0xD125, 0xB7);
-    lcd_write_reg(0xD126, 0x02);
-    lcd_write_reg(0xD127, 0xCF);
-    lcd_write_reg(0xD128, 0x02);
-    lcd_write_reg(0xD129, 0xDE);
-    lcd_write_reg(0xD12A, 0x02);
-    lcd_write_reg(0xD12B, 0xF2);
-    lcd_write_reg(0xD12C, 0x02);
-    lcd_write_reg(0xD12D, 0xFE);
-    lcd_write_reg(0xD12E, 0x03);
-    lcd_write_reg(0xD12F, 0x10);
-    lcd_write_reg(0xD130, 0x03);
-    lcd_write_reg(0xD131, 0x33);
-    lcd_write_reg(0xD132, 0x03);
-    lcd_write_reg(0xD133, 0x6D);
-    lcd_write_reg(0xD200, 0x00);
-    lcd_write_reg(0xD201, 0x33);
-    lcd_write_reg(0xD202, 0x00);
-    lcd_write_reg(0xD203, 0x34);
-    lcd_write_reg(0xD204, 0x00);
-    lcd_write_reg(0xD205, 0x3A);
-    lcd_write_reg(0xD206, 0x00);
-    lcd_write_reg(0xD207, 0x4A);
-    lcd_write_reg(0xD208, 0x00);
-    lcd_write_reg(0xD209, 0x5C);
-    lcd_write_reg(0xD20A, 0x00);
-
-    lcd_write_reg(0xD20B, 0x81);
-    lcd_write_reg(0xD20C, 0x00);
-    lcd_write_reg(0xD20D, 0xA6);
-    lcd_write_reg(0xD20E, 0x00);
-    lcd_write_reg(0xD20F, 0xE5);
-    lcd_write_reg(0xD210, 0x01);
-    lcd_write_reg(0xD211, 0x13);
-    lcd_write_reg(0xD212, 0x01);
-    lcd_write_reg(0xD213, 0x54);
-    lcd_write_reg(0xD214, 0x01);
-    lcd_write_reg(0xD215, 0x82);
-    lcd_write_reg(0xD216, 0x01);
-    lcd_write_reg(0xD217, 0xCA);
-    lcd_write_reg(0xD218, 0x02);
-    lcd_write_reg(0xD219, 0x00);
-    lcd_write_reg(0xD21A, 0x02);
-    lcd_write_reg(0xD21B, 0x01);
-    lcd_write_reg(0xD21C, 0x02);
-    lcd_write_reg(0xD21D, 0x34);
-    lcd_write_reg(0xD21E, 0x02);
-    lcd_write_reg(0xD21F, 0x67);
-    lcd_write_reg(0xD220, 0x02);
-    lcd_write_reg(0xD221, 0x84);
-    lcd_write_reg(0xD222, 0x02);
-    lcd_write_reg(0xD223, 0xA4);
-    lcd_write_reg(0xD224, 0x02);
-    lcd_write_reg(0xD225, 0xB7);
-    lcd_write_reg(0xD226, 0x02);
-    lcd_write_reg(0xD227, 0xCF);
-    lcd_write_reg(0xD228, 0x02);
-    lcd_write_reg(0xD229, 0xDE);
-    lcd_write_reg(0xD22A, 0x02);
-    lcd_write_reg(0xD22B, 0xF2);
-    lcd_write_reg(0xD22C, 0x02);
-    lcd_write_reg(0xD22D, 0xFE);
-    lcd_write_reg(0xD22E, 0x03);
-    lcd_write_reg(0xD22F, 0x10);
-    lcd_write_reg(0xD230, 0x03);
-    lcd_write_reg(0xD231, 0x33);
-    lcd_write_reg(0xD232, 0x03);
-    lcd_write_reg(0xD233, 0x6D);
-    lcd_write_reg(0xD300, 0x00);
-    lcd_write_reg(0xD301, 0x33);
-    lcd_write_reg(0xD302, 0x00);
-    lcd_write_reg(0xD303, 0x34);
-    lcd_write_reg(0xD304, 0x00);
-    lcd_write_reg(0xD305, 0x3A);
-    lcd_write_reg(0xD306, 0x00);
-    lcd_write_reg(0xD307, 0x4A);
-    lcd_write_reg(0xD308, 0x00);
-    lcd_write_reg(0xD309, 0x5C);
-    lcd_write_reg(0xD30A, 0x00);
-
-    lcd_write_reg(0xD30B, 0x81);
-    lcd_write_reg(0xD30C, 0x00);
-    lcd_write_reg(0xD30D, 0xA6);
-    lcd_write_reg(0xD30E, 0x00);
-    lcd_write_reg(0xD30F, 0xE5);
-    lcd_write_reg(0xD310, 0x01);
-    lcd_write_reg(0xD311, 0x13);
-    lcd_write_reg(0xD312, 0x01);
-    lcd_write_reg(0xD313, 0x54);
-    lcd_write_reg(0xD314, 0x01);
-    lcd_write_reg(0xD315, 0x82);
-    lcd_write_reg(0xD316, 0x01);
-    lcd_write_reg(0xD317, 0xCA);
-    lcd_write_reg(0xD318, 0x02);
-    lcd_write_reg(0xD319, 0x00);
-    lcd_write_reg(0xD31A, 0x02);
-    lcd_write_reg(0xD31B, 0x01);
-    lcd_write_reg(0xD31C, 0x02);
-    lcd_write_reg(0xD31D, 0x34);
-    lcd_write_reg(0xD31E, 0x02);
-    lcd_write_reg(0xD31F, 0x67);
-    lcd_write_reg(0xD320, 0x02);
-    lcd_write_reg(0xD321, 0x84);
-    lcd_write_reg(0xD322, 0x02);
-    lcd_write_reg(0xD323, 0xA4);
-    lcd_write_reg(0xD324, 0x02);
-    lcd_write_reg(0xD325, 0xB7);
-    lcd_write_reg(0xD326, 0x02);
-    lcd_write_reg(0xD327, 0xCF);
-    lcd_write_reg(0xD328, 0x02);
-    lcd_write_reg(0xD329, 0xDE);
-    lcd_write_reg(0xD32A, 0x02);
-    lcd_write_reg(0xD32B, 0xF2);
-    lcd_write_reg(0xD32C, 0x02);
-    lcd_write_reg(0xD32D, 0xFE);
-    lcd_write_reg(0xD32E, 0x03);
-    lcd_write_reg(0xD32F, 0x10);
-    lcd_write_reg(0xD330, 0x03);
-    lcd_write_reg(0xD331, 0x33);
-    lcd_write_reg(0xD332, 0x03);
-    lcd_write_reg(0xD333, 0x6D);
-    lcd_write_reg(0xD400, 0x00);
-    lcd_write_reg(0xD401, 0x33);
-    lcd_write_reg(0xD402, 0x00);
-    lcd_write_reg(0xD403, 0x34);
-    lcd_write_reg(0xD404, 0x00);
-    lcd_write_reg(0xD405, 0x3A);
-    lcd_write_reg(0xD406, 0x00);
-    lcd_write_reg(0xD407, 0x4A);
-    lcd_write_reg(0xD408, 0x00);
-    lcd_write_reg(0xD409, 0x5C);
-    lcd_write_reg(0xD40A, 0x00);
-    lcd_write_reg(0xD40B, 0x81);
-
-    lcd_write_reg(0xD40C, 0x00);
-    lcd_write_reg(0xD40D, 0xA6);
-    lcd_write_reg(0xD40E, 0x00);
-    lcd_write_reg(0xD40F, 0xE5);
-    lcd_write_reg(0xD410, 0x01);
-    lcd_write_reg(0xD411, 0x13);
-    lcd_write_reg(0xD412, 0x01);
-    lcd_write_reg(0xD413, 0x54);
-    lcd_write_reg(0xD414, 0x01);
-    lcd_write_reg(0xD415, 0x82);
-    lcd_write_reg(0xD416, 0x01);
-    lcd_write_reg(0xD417, 0xCA);
-    lcd_write_reg(0xD418, 0x02);
-    lcd_write_reg(0xD419, 0x00);
-    lcd_write_reg(0xD41A, 0x02);
-    lcd_write_reg(0xD41B, 0x01);
-    lcd_write_reg(0xD41C, 0x02);
-    lcd_write_reg(0xD41D, 0x34);
-    lcd_write_reg(0xD41E, 0x02);
-    lcd_write_reg(0xD41F, 0x67);
-    lcd_write_reg(0xD420, 0x02);
-    lcd_write_reg(0xD421, 0x84);
-    lcd_write_reg(0xD422, 0x02);
-    lcd_write_reg(0xD423, 0xA4);
-    lcd_write_reg(0xD424, 0x02);
-    lcd_write_reg(0xD425, 0xB7);
-    lcd_write_reg(0xD426, 0x02);
-    lcd_write_reg(0xD427, 0xCF);
-    lcd_write_reg(0xD428, 0x02);
-    lcd_write_reg(0xD429, 0xDE);
-    lcd_write_reg(0xD42A, 0x02);
-    lcd_write_reg(0xD42B, 0xF2);
-    lcd_write_reg(0xD42C, 0x02);
-    lcd_write_reg(0xD42D, 0xFE);
-    lcd_write_reg(0xD42E, 0x03);
-    lcd_write_reg(0xD42F, 0x10);
-    lcd_write_reg(0xD430, 0x03);
-    lcd_write_reg(0xD431, 0x33);
-    lcd_write_reg(0xD432, 0x03);
-    lcd_write_reg(0xD433, 0x6D);
-    lcd_write_reg(0xD500, 0x00);
-    lcd_write_reg(0xD501, 0x33);
-    lcd_write_reg(0xD502, 0x00);
-    lcd_write_reg(0xD503, 0x34);
-    lcd_write_reg(0xD504, 0x00);
-    lcd_write_reg(0xD505, 0x3A);
-    lcd_write_reg(0xD506, 0x00);
-    lcd_write_reg(0xD507, 0x4A);
-    lcd_write_reg(0xD508, 0x00);
-    lcd_write_reg(0xD509, 0x5C);
-    lcd_write_reg(0xD50A, 0x00);
-    lcd_write_reg(0xD50B, 0x81);
-
-    lcd_write_reg(0xD50C, 0x00);
-    lcd_write_reg(0xD50D, 0xA6);
-    lcd_write_reg(0xD50E, 0x00);
-    lcd_write_reg(0xD50F, 0xE5);
-    lcd_write_reg(0xD510, 0x01);
-    lcd_write_reg(0xD511, 0x13);
-    lcd_write_reg(0xD512, 0x01);
-    lcd_write_reg(0xD513, 0x54);
-    lcd_write_reg(0xD514, 0x01);
-    lcd_write_reg(0xD515, 0x82);
-    lcd_write_reg(0xD516, 0x01);
-    lcd_write_reg(0xD517, 0xCA);
-    lcd_write_reg(0xD518, 0x02);
-    lcd_write_reg(0xD519, 0x00);
-    lcd_write_reg(0xD51A, 0x02);
-    lcd_write_reg(0xD51B, 0x01);
-    lcd_write_reg(0xD51C, 0x02);
-    lcd_write_reg(0xD51D, 0x34);
-    lcd_write_reg(0xD51E, 0x02);
-    lcd_write_reg(0xD51F, 0x67);
-    lcd_write_reg(0xD520, 0x02);
-    lcd_write_reg(0xD521, 0x84);
-    lcd_write_reg(0xD522, 0x02);
-    lcd_write_reg(0xD523, 0xA4);
-    lcd_write_reg(0xD524, 0x02);
-    lcd_write_reg(0xD525, 0xB7);
-    lcd_write_reg(0xD526, 0x02);
-    lcd_write_reg(0xD527, 0xCF);
-    lcd_write_reg(0xD528, 0x02);
-    lcd_write_reg(0xD529, 0xDE);
-    lcd_write_reg(0xD52A, 0x02);
-    lcd_write_reg(0xD52B, 0xF2);
-    lcd_write_reg(0xD52C, 0x02);
-    lcd_write_reg(0xD52D, 0xFE);
-    lcd_write_reg(0xD52E, 0x03);
-    lcd_write_reg(0xD52F, 0x10);
-    lcd_write_reg(0xD530, 0x03);
-    lcd_write_reg(0xD531, 0x33);
-    lcd_write_reg(0xD532, 0x03);
-    lcd_write_reg(0xD533, 0x6D);
-    lcd_write_reg(0xD600, 0x00);
-    lcd_write_reg(0xD601, 0x33);
-    lcd_write_reg(0xD602, 0x00);
-    lcd_write_reg(0xD603, 0x34);
-    lcd_write_reg(0xD604, 0x00);
-    lcd_write_reg(0xD605, 0x3A);
-    lcd_write_reg(0xD606, 0x00);
-    lcd_write_reg(0xD607, 0x4A);
-    lcd_write_reg(0xD608, 0x00);
-    lcd_write_reg(0xD609, 0x5C);
-    lcd_write_reg(0xD60A, 0x00);
-    lcd_write_reg(0xD60B, 0x81);
-
-    lcd_write_reg(0xD60C, 0x00);
-    lcd_write_reg(0xD60D, 0xA6);
-    lcd_write_reg(0xD60E, 0x00);
-    lcd_write_reg(0xD60F, 0xE5);
-    lcd_write_reg(0xD610, 0x01);
-    lcd_write_reg(0xD611, 0x13);
-    lcd_write_reg(0xD612, 0x01);
-    lcd_write_reg(0xD613, 0x54);
-    lcd_write_reg(0xD614, 0x01);
-    lcd_write_reg(0xD615, 0x82);
-    lcd_write_reg(0xD616, 0x01);
-    lcd_write_reg(0xD617, 0xCA);
-    lcd_write_reg(0xD618, 0x02);
-    lcd_write_reg(0xD619, 0x00);
-    lcd_write_reg(0xD61A, 0x02);
-    lcd_write_reg(0xD61B, 0x01);
-    lcd_write_reg(0xD61C, 0x02);
-    lcd_write_reg(0xD61D, 0x34);
-    lcd_write_reg(0xD61E, 0x02);
-    lcd_write_reg(0xD61F, 0x67);
-    lcd_write_reg(0xD620, 0x02);
-    lcd_write_reg(0xD621, 0x84);
-    lcd_write_reg(0xD622, 0x02);
-    lcd_write_reg(0xD623, 0xA4);
-    lcd_write_reg(0xD624, 0x02);
-    lcd_write_reg(0xD625, 0xB7);
-    lcd_write_reg(0xD626, 0x02);
-    lcd_write_reg(0xD627, 0xCF);
-    lcd_write_reg(0xD628, 0x02);
-    lcd_write_reg(0xD629, 0xDE);
-    lcd_write_reg(0xD62A, 0x02);
-    lcd_write_reg(0xD62B, 0xF2);
-    lcd_write_reg(0xD62C, 0x02);
-    lcd_write_reg(0xD62D, 0xFE);
-    lcd_write_reg(0xD62E, 0x03);
-    lcd_write_reg(0xD62F, 0x10);
-    lcd_write_reg(0xD630, 0x03);
-    lcd_write_reg(0xD631, 0x33);
-    lcd_write_reg(0xD632, 0x03);
-    lcd_write_reg(0xD633, 0x6D);
+    LCD_SEQ(0xD100, 52),
+        0x00, 0x33, 0x00, 0x34, 0x00, 0x3A, 0x00, 0x4A, 0x00, 0x5C, 0x00, 0x81, 0x00, 0xA6, 0x00, 0xE5,
+        0x01, 0x13, 0x01, 0x54, 0x01, 0x82, 0x01, 0xCA, 0x02, 0x00, 0x02, 0x01, 0x02, 0x34, 0x02, 0x67,
+        0x02, 0x84, 0x02, 0xA4, 0x02, 0xB7, 0x02, 0xCF, 0x02, 0xDE, 0x02, 0xF2, 0x02, 0xFE, 0x03, 0x10,
+        0x03, 0x33, 0x03, 0x6D,
+    LCD_SEQ(0xD200, 52),
+        0x00, 0x33, 0x00, 0x34, 0x00, 0x3A, 0x00, 0x4A, 0x00, 0x5C, 0x00, 0x81, 0x00, 0xA6, 0x00, 0xE5,
+        0x01, 0x13, 0x01, 0x54, 0x01, 0x82, 0x01, 0xCA, 0x02, 0x00, 0x02, 0x01, 0x02, 0x34, 0x02, 0x67,
+        0x02, 0x84, 0x02, 0xA4, 0x02, 0xB7, 0x02, 0xCF, 0x02, 0xDE, 0x02, 0xF2, 0x02, 0xFE, 0x03, 0x10,
+        0x03, 0x33, 0x03, 0x6D,
+    LCD_SEQ(0xD300, 52),
+        0x00, 0x33, 0x00, 0x34, 0x00, 0x3A, 0x00, 0x4A, 0x00, 0x5C, 0x00, 0x81, 0x00, 0xA6, 0x00, 0xE5,
+        0x01, 0x13, 0x01, 0x54, 0x01, 0x82, 0x01, 0xCA, 0x02, 0x00, 0x02, 0x01, 0x02, 0x34, 0x02, 0x67,
+        0x02, 0x84, 0x02, 0xA4, 0x02, 0xB7, 0x02, 0xCF, 0x02, 0xDE, 0x02, 0xF2, 0x02, 0xFE, 0x03, 0x10,
+        0x03, 0x33, 0x03, 0x6D,
+    LCD_SEQ(0xD400, 52),
+        0x00, 0x33, 0x00, 0x34, 0x00, 0x3A, 0x00, 0x4A, 0x00, 0x5C, 0x00, 0x81, 0x00, 0xA6, 0x00, 0xE5,
+        0x01, 0x13, 0x01, 0x54, 0x01, 0x82, 0x01, 0xCA, 0x02, 0x00, 0x02, 0x01, 0x02, 0x34, 0x02, 0x67,
+        0x02, 0x84, 0x02, 0xA4, 0x02, 0xB7, 0x02, 0xCF, 0x02, 0xDE, 0x02, 0xF2, 0x02, 0xFE, 0x03, 0x10,
+        0x03, 0x33, 0x03, 0x6D,
+    LCD_SEQ(0xD500, 52),
+        0x00, 0x33, 0x00, 0x34, 0x00, 0x3A, 0x00, 0x4A, 0x00, 0x5C, 0x00, 0x81, 0x00, 0xA6, 0x00, 0xE5,
+        0x01, 0x13, 0x01, 0x54, 0x01, 0x82, 0x01, 0xCA, 0x02, 0x00, 0x02, 0x01, 0x02, 0x34, 0x02, 0x67,
+        0x02, 0x84, 0x02, 0xA4, 0x02, 0xB7, 0x02, 0xCF, 0x02, 0xDE, 0x02, 0xF2, 0x02, 0xFE, 0x03, 0x10,
+        0x03, 0x33, 0x03, 0x6D,
+    LCD_SEQ(0xD600, 52),
+        0x00, 0x33, 0x00, 0x34, 0x00, 0x3A, 0x00, 0x4A, 0x00, 0x5C, 0x00, 0x81, 0x00, 0xA6, 0x00, 0xE5,
+        0x01, 0x13, 0x01, 0x54, 0x01, 0x82, 0x01, 0xCA, 0x02, 0x00, 0x02, 0x01, 0x02, 0x34, 0x02, 0x67,
+        0x02, 0x84, 0x02, 0xA4, 0x02, 0xB7, 0x02, 0xCF, 0x02, 0xDE, 0x02, 0xF2, 0x02, 0xFE, 0x03, 0x10,
+        0x03, 0x33, 0x03, 0x6D,
     /* LV2 Page 0 enable */
-    lcd_write_reg(0xF000, 0x55);
-    lcd_write_reg(0xF001, 0xAA);
-    lcd_write_reg(0xF002, 0x52);
-    lcd_write_reg(0xF003, 0x08);
-    lcd_write_reg(0xF004, 0x00);
+    LCD_SEQ(0xF000, 5), 0x55, 0xAA, 0x52, 0x08, 0x00,
     /* Display control */
-    lcd_write_reg(0xB100, 0xCC);
-    lcd_write_reg(0xB101, 0x00);
+    LCD_SEQ(0xB100, 2), 0xCC, 0x00,
     /* Source hold time */
-    lcd_write_reg(0xB600, 0x05);
+    LCD_SEQ(0xB600, 1), 0x05,
     /* Gate EQ control */
-    lcd_write_reg(0xB700, 0x70);
-    lcd_write_reg(0xB701, 0x70);
+    LCD_SEQ(0xB700, 2), 0x70, 0x70,
     /* Source EQ control (Mode 2) */
-    lcd_write_reg(0xB800, 0x01);
-    lcd_write_reg(0xB801, 0x03);
-    lcd_write_reg(0xB802, 0x03);
-    lcd_write_reg(0xB803, 0x03);
+    LCD_SEQ(0xB800, 4), 0x01, 0x03, 0x03, 0x03,
     /* Inversion mode (2-dot) */
-    lcd_write_reg(0xBC00, 0x02);
-    lcd_write_reg(0xBC01, 0x00);
-    lcd_write_reg(0xBC02, 0x00);
+    LCD_SEQ(0xBC00, 3), 0x02, 0x00, 0x00,
     /* Timing control 4H w/ 4-delay */
-    lcd_write_reg(0xC900, 0xD0);
-    lcd_write_reg(0xC901, 0x02);
-    lcd_write_reg(0xC902, 0x50);
-    lcd_write_reg(0xC903, 0x50);
-    lcd_write_reg(0xC904, 0x50);
-    lcd_write_reg(0x3500, 0x00);
-    lcd_write_reg(0x3A00, 0x55); /* 16-bit/pixel */
-    lcd_wr_regno(0x1100);
-    HAL_Delay(1);
-    lcd_wr_regno(0x2900);
-}
+    LCD_SEQ(0xC900, 5), 0xD0, 0x02, 0x50, 0x50, 0x50,
+    LCD_SEQ(0x3500, 1), 0x00,
+    LCD_SEQ(0x3A00, 1), 0x55,                           /* 16-bit/pixel */
+    LCD_CMD16(0x1100, 0),
+    LCD_DELAY(1),
+    LCD_CMD16(0x2900, 0),
+    LCD_END
+};
+
+/* ILI9806 */
+static const uint8_t g_lcd_ex_ili9806[] =
+{
+    LCD_CMD(0xFF, 3), 0xFF, 0x98, 0x06,                 /* EXTC Command Set enable register */
+    /* GIP 1 */
+    LCD_CMD(0xBC, 21),
+        0x01, 0x0F, 0x61, 0xFF, 0x01, 0x01, 0x0B, 0x10, 0x37, 0x63, 0xFF, 0xFF, 0x01, 0x01, 0x00, 0x00,
+        0xFF, 0x52, 0x01, 0x00, 0x40,
+    /* GIP 2 */
+    LCD_CMD(0xBD, 8), 0x01, 0x23, 0x45, 0x67, 0x01, 0x23, 0x45, 0x67,
+    /* GIP 3 */
+    LCD_CMD(0xBE, 9), 0x00, 0x01, 0xAB, 0x60, 0x22, 0x22, 0x22, 0x22, 0x22,
+    LCD_CMD(0xC7, 1), 0x36,                             /* VCOM Control */
+    LCD_CMD(0xED, 2), 0x7F, 0x0F,                       /* EN_volt_reg VGMP / VGMN /VGSP / VGSN voltage to output */
+    LCD_CMD(0xC0, 3),                                   /* Power Control 1 Setting AVDD / AVEE / VGH / VGL */
+        0x0F,
+        0x0B,
+        0x0A,                                           /* VGH 15V,VGLO-10V */
+    LCD_CMD(0xFC, 1), 0x08,                             /* AVDD / AVEE generated by internal pumping. */
+    LCD_CMD(0xDF, 6), 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    LCD_CMD(0xF3, 1), 0x74,                             /* DVDD Voltage Setting */
+    LCD_CMD(0xB4, 3),                                   /* Inversion Type */
+        0x00,                                           /* 02 */
+        0x00,                                           /* 02 */
+        0x00,                                           /* 02 */
+    LCD_CMD(0xF7, 1),                                   /* Resolution Control */
+        0x82,                                           /* 480*800 */
+    LCD_CMD(0xB1, 3), 0x00, 0x13, 0x13,                 /* FRAME RATE Setting */
+    LCD_CMD(0xF2, 4), 0x80, 0x04, 0x40, 0x28,           /* CR_EQ_PC_SDT  #C0,06,40,28 */
+    LCD_CMD(0xC1, 4),                                   /* Power Control 2  SD OP Bias_VRH1_VRH2_EXT_CPCK_SEL */
+        0x17,
+        0x88,                                           /* VGMP */
+        0x88,                                           /* VGMN */
+        0x20,
+    LCD_CMD(0xE0, 16),                                  /* Positive Gamma Control */
+        0x00,                                           /* P1 */
+        0x0A,                                           /* P2 */
+        0x12,                                           /* P3 */
+        0x10,                                           /* P4 */
+        0x0E,                                           /* P5 */
+        0x20,                                           /* P6 */
+        0xCC,                                           /* P7 */
+        0x07,                                           /* P8 */
+        0x06,                                           /* P9 */
+        0x0B,                                           /* P10 */
+        0x0E,                                           /* P11 */
+        0x0F,                                           /* P12 */
+        0x0D,                                           /* P13 */
+        0x15,                                           /* P14 */
+        0x10,                                           /* P15 */
+        0x00,                                           /* P16 */
+    LCD_CMD(0xE1, 16),                                  /* Negative Gamma Correction */
+        0x00,                                           /* P1 */
+        0x0B,                                           /* P2 */
+        0x13,                                           /* P3 */
+        0x0D,                                           /* P4 */
+        0x0E,                                           /* P5 */
+        0x1B,                                           /* P6 */
+        0x71,                                           /* P7 */
+        0x06,                                           /* P8 */
+        0x06,                                           /* P9 */
+        0x0A,                                           /* P10 */
+        0x0F,                                           /* P11 */
+        0x0E,                                           /* P12 */
+        0x0F,                                           /* P13 */
+        0x15,                                           /* P14 */
+        0x0C,                                           /* P15 */
+        0x00,                                           /* P16 */
+    LCD_CMD(0x2A, 4), 0x00, 0x00, 0x01, 0xDF,
+    LCD_CMD(0x2B, 4), 0x00, 0x00, 0x03, 0x1F,
+    LCD_CMD(0x3A, 1), 0x55,                             /* Pixel Format */
+    LCD_CMD(0x36, 1),                                   /* Memory Access Control */
+        0x00,                                           /* 02-180 */
+    LCD_CMD(0x11, 0),
+    LCD_DELAY(120),
+    LCD_CMD(0x29, 0),
+    LCD_DELAY(20),
+    LCD_CMD(0x2C, 0),
+    LCD_END
+};
+
+/* SSD1963 */
+static const uint8_t g_lcd_ex_ssd1963[] =
+{
+    LCD_CMD(0xE2, 3),                                   /* Set PLL with OSC = 10MHz (hardware),	Multiplier N = 35, 250MHz < VCO < 800MHz = OSC*(N+1), VCO = 300MHz */
+        0x1D,                                           /* 1 */
+        0x02,                                           /* 2 Divider M = 2, PLL = 300/(M+1) = 100MHz */
+        0x04,                                           /* 3 Validate M and N values */
+    LCD_DELAY(1),
+    LCD_CMD(0xE0, 1),                                   /* Start PLL command */
+        0x01,                                           /* enable PLL */
+    LCD_DELAY(10),
+    LCD_CMD(0xE0, 1),                                   /* Start PLL command again */
+        0x03,                                           /* now, use PLL output as system clock */
+    LCD_DELAY(12),
+    LCD_CMD(0x01, 0),                                   /* λ */
+    LCD_DELAY(10),
+    LCD_CMD(0xE6, 3), 0x2F, 0xFF, 0xFF,                 /* Ƶ,33Mhz */
+    LCD_CMD(0xB0, 7),                                   /* LCDģʽ */
+        0x20,                                           /* 24λģʽ */
+        0x00,                                           /* TFT ģʽ */
+        (SSD_HOR_RESOLUTION - 1) >> 8,                  /* LCDˮƽ */
+        (SSD_HOR_RESOLUTION - 1) & 0xFF,
+        (SSD_VER_RESOLUTION - 1) >> 8,                  /* LCDֱ */
+        (SSD_VER_RESOLUTION - 1) & 0xFF,
+        0x00,                                           /* RGB */
+    /* Set horizontal period */
+    LCD_CMD(0xB4, 8),
+        (SSD_HT - 1) >> 8, (SSD_HT - 1) & 0xFF,
+        SSD_HPS >> 8, SSD_HPS & 0xFF,
+        (SSD_HOR_PULSE_WIDTH - 1) & 0xFF,
+        0x00, 0x00, 0x00,
+    /* Set vertical perio */
+    LCD_CMD(0xB6, 7),
+        (SSD_VT - 1) >> 8, (SSD_VT - 1) & 0xFF,
+        SSD_VPS >> 8, SSD_VPS & 0xFF,
+        (SSD_VER_FRONT_PORCH - 1) & 0xFF,
+        0x00, 0x00,
+    LCD_CMD(0xF0, 1),                                   /* SSD1963CPUӿΪ16bit */
+        0x03,                                           /* 16-bit(565 format) data for 16bpp */
+    LCD_CMD(0x29, 0),                                   /* ʾ */
+    /* PWM  ͨռձȿɵ */
+    LCD_CMD(0xD0, 1),                                   /* ԶƽDBC */
+        0x00,                                           /* disable */
+    LCD_CMD(0xBE, 6),                                   /* PWM */
+        0x05,                                           /* 1PWMƵ */
+        0xFE,                                           /* 2PWMռձ */
+        0x01,                                           /* 3C */
+        0x00,                                           /* 4D */
+        0x00,                                           /* 5E */
+        0x00,                                           /* 6F */
+    LCD_CMD(0xB8, 2),                                   /* GPIO */
+        0x03,                                           /* 2IOó */
+        0x01,                                           /* GPIOʹIO */
+    LCD_CMD(0xBA, 1),
+        0x01,                                           /* GPIO[1:0]=01,LCD */
+    LCD_END
+};
+
+/* ʶID: ʲô */
+static const uint8_t g_lcd_ex_none[] =
+{
+    LCD_END
+};
 
 /**
- * @brief       ILI9806Ĵʼ 
- * @param       
- * @retval      
+ * @brief       ȡICӦĳʼ
+ * @param       id: lcddev.id
+ * @retval      ʼ(ʶIDؿձ)
  */
-void lcd_ex_ili9806_reginit(void)
+const uint8_t *lcd_ex_init_code(uint16_t id)
 {
-    lcd_wr_regno(0xFF); /* EXTC Command Set enable register */
-    lcd_wr_data(0xFF);
-    lcd_wr_data(0x98);
-    lcd_wr_data(0x06);
-
-    lcd_wr_regno(0xBC); /* GIP 1 */
-    lcd_wr_data(0x01);
-    lcd_wr_data(0x0F);
-    lcd_wr_data(0x61);
-    lcd_wr_data(0xFF);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0x0B);
-    lcd_wr_data(0x10);
-    lcd_wr_data(0x37);
-    lcd_wr_data(0x63);
-    lcd_wr_data(0xFF);
-    lcd_wr_data(0xFF);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0xFF);
-    lcd_wr_data(0x52);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x40);
-
-    lcd_wr_regno(0xBD); /* GIP 2 */
-    lcd_wr_data(0x01);
-    lcd_wr_data(0x23);
-    lcd_wr_data(0x45);
-    lcd_wr_data(0x67);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0x23);
-    lcd_wr_data(0x45);
-    lcd_wr_data(0x67);
-
-    lcd_wr_regno(0xBE); /* GIP 3 */
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0xAB);
-    lcd_wr_data(0x60);
-    lcd_wr_data(0x22);
-    lcd_wr_data(0x22);
-    lcd_wr_data(0x22);
-    lcd_wr_data(0x22);
-    lcd_wr_data(0x22);
-
-    lcd_wr_regno(0xC7); /* VCOM Control */
-    lcd_wr_data(0x36);
-
-    lcd_wr_regno(0xED); /* EN_volt_reg VGMP / VGMN /VGSP / VGSN voltage to output */
-    lcd_wr_data(0x7F);
-    lcd_wr_data(0x0F);
-
-    lcd_wr_regno(0XC0); /* Power Control 1 Setting AVDD / AVEE / VGH / VGL */
-    lcd_wr_data(0x0F);
-    lcd_wr_data(0x0B);
-    lcd_wr_data(0x0A);  /* VGH 15V,VGLO-10V */
+    switch (id)
+    {
+        case 0x7789:
+            return g_lcd_ex_st7789;
 
-    lcd_wr_regno(0XFC); /* AVDD / AVEE generated by internal pumping. */
-    lcd_wr_data(0x08);
+        case 0x9341:
+            return g_lcd_ex_ili9341;
 
-    lcd_wr_regno(0XDF); 
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x20);
+        case 0x5310:
+            return g_lcd_ex_nt35310;
 
-    lcd_wr_regno(0XF3); /* DVDD Voltage Setting */
-    lcd_wr_data(0x74);
+        case 0x7796:
+            return g_lcd_ex_st7796;
 
-    lcd_wr_regno(0xB4); /* Inversion Type */
-    lcd_wr_data(0x00);  /* 02 */
-    lcd_wr_data(0x00);  /* 02 */
-    lcd_wr_data(0x00);  /* 02 */
+        case 0x5510:
+            return g_lcd_ex_nt35510;
 
-    lcd_wr_regno(0xF7); /* Resolution Control */
-    lcd_wr_data(0x82);  /* 480*800 */
+        case 0x9806:
+            return g_lcd_ex_ili9806;
 
-    lcd_wr_regno(0xB1); /* FRAME RATE Setting */
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x13);
-    lcd_wr_data(0x13); 
+        case 0x1963:
+            return g_lcd_ex_ssd1963;
 
-    lcd_wr_regno(0XF2); /* CR_EQ_PC_SDT  #C0,06,40,28 */
-    lcd_wr_data(0x80);
-    lcd_wr_data(0x04);
-    lcd_wr_data(0x40);
-    lcd_wr_data(0x28);
-
-    lcd_wr_regno(0XC1); /* Power Control 2  SD OP Bias_VRH1_VRH2_EXT_CPCK_SEL */
-    lcd_wr_data(0x17);
-    lcd_wr_data(0x88);  /* VGMP */
-    lcd_wr_data(0x88);  /* VGMN */
-    lcd_wr_data(0x20);
-
-    lcd_wr_regno(0xE0); /* Positive Gamma Control */
-    lcd_wr_data(0x00);  /* P1 */
-    lcd_wr_data(0x0A);  /* P2 */
-    lcd_wr_data(0x12);  /* P3 */
-    lcd_wr_data(0x10);  /* P4 */
-    lcd_wr_data(0x0E);  /* P5 */
-    lcd_wr_data(0x20);  /* P6 */
-    lcd_wr_data(0xCC);  /* P7 */
-    lcd_wr_data(0x07);  /* P8 */
-    lcd_wr_data(0x06);  /* P9 */
-    lcd_wr_data(0x0B);  /* P10 */
-    lcd_wr_data(0x0E);  /* P11 */
-    lcd_wr_data(0x0F);  /* P12 */
-    lcd_wr_data(0x0D);  /* P13 */
-    lcd_wr_data(0x15);  /* P14 */
-    lcd_wr_data(0x10);  /* P15 */
-    lcd_wr_data(0x00);  /* P16 */
-
-    lcd_wr_regno(0xE1); /* Negative Gamma Correction */
-    lcd_wr_data(0x00);  /* P1 */
-    lcd_wr_data(0x0B);  /* P2 */
-    lcd_wr_data(0x13);  /* P3 */
-    lcd_wr_data(0x0D);  /* P4 */
-    lcd_wr_data(0x0E);  /* P5 */
-    lcd_wr_data(0x1B);  /* P6 */
-    lcd_wr_data(0x71);  /* P7 */
-    lcd_wr_data(0x06);  /* P8 */
-    lcd_wr_data(0x06);  /* P9 */
-    lcd_wr_data(0x0A);  /* P10 */
-    lcd_wr_data(0x0F);  /* P11 */
-    lcd_wr_data(0x0E);  /* P12 */
-    lcd_wr_data(0x0F);  /* P13 */
-    lcd_wr_data(0x15);  /* P14 */
-    lcd_wr_data(0x0C);  /* P15 */
-    lcd_wr_data(0x00);  /* P16 */
-
-    lcd_wr_regno(0x2a);   
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x01);
-    lcd_wr_data(0xdf);
-
-    lcd_wr_regno(0x2b);   
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x03);
-    lcd_wr_data(0x1f);
-
-    lcd_wr_regno(0x3A); /* Pixel Format */
-    lcd_wr_data(0x55);
-
-    lcd_wr_regno(0x36); /* Memory Access Control */
-    lcd_wr_data(0x00);  /* 02-180 */
-
-    lcd_wr_regno(0x11);
-    HAL_Delay(120);   
-    lcd_wr_regno(0x29);  
-    HAL_Delay(20);  
-    lcd_wr_regno(0x2C);
+        default:
+            return g_lcd_ex_none;
+    }
 }
 
 /**
- * @brief       SSD1963Ĵʼ 
- * @param       
- * @retval      
+ * @brief       ִгʼ, ֱʱ
+ *   @note       LCD_DELAY ʱҪȵʱ, *pc ָʱָ֮, ɵߵȹٵ;
+ *               LCD_END ʱ0, *pc ͣ LCD_END , ٵҲǷ0
+ * @param       pc: ָǰָָ
+ * @retval      Ҫȴms(1~255), 0ʾѾִ
  */
-void lcd_ex_ssd1963_reginit(void)
+uint8_t lcd_ex_run(const uint8_t **pc)
 {
-    lcd_wr_regno(0xE2); /* Set PLL with OSC = 10MHz (hardware),	Multiplier N = 35, 250MHz < VCO < 800MHz = OSC*(N+1), VCO = 300MHz */
-    lcd_wr_data(0x1D);  /* 1 */
-    lcd_wr_data(0x02);  /* 2 Divider M = 2, PLL = 300/(M+1) = 100MHz */
-    lcd_wr_data(0x04);  /* 3 Validate M and N values */
-    HAL_Delay(1);
-    lcd_wr_regno(0xE0); /*  Start PLL command */
-    lcd_wr_data(0x01);  /*  enable PLL */
-    HAL_Delay(10);
-    lcd_wr_regno(0xE0); /*  Start PLL command again */
-    lcd_wr_data(0x03);  /*  now, use PLL output as system clock */
-    HAL_Delay(12);
-    lcd_wr_regno(0x01); /* λ */
-    HAL_Delay(10);
-
-    lcd_wr_regno(0xE6); /* Ƶ,33Mhz */
-    lcd_wr_data(0x2F);
-    lcd_wr_data(0xFF);
-    lcd_wr_data(0xFF);
-
-    lcd_wr_regno(0xB0); /* LCDģʽ */
-    lcd_wr_data(0x20);  /* 24λģʽ */
-    lcd_wr_data(0x00);  /* TFT ģʽ */
-
-    lcd_wr_data((SSD_HOR_RESOLUTION - 1) >> 8); /* LCDˮƽ */
-    lcd_wr_data(SSD_HOR_RESOLUTION - 1);
-    lcd_wr_data((SSD_VER_RESOLUTION - 1) >> 8); /* LCDֱ */
-    lcd_wr_data(SSD_VER_RESOLUTION - 1);
-    lcd_wr_data(0x00);  /* RGB */
-
-    lcd_wr_regno(0xB4); /* Set horizontal period */
-    lcd_wr_data((SSD_HT - 1) >> 8);
-    lcd_wr_data(SSD_HT - 1);
-    lcd_wr_data(SSD_HPS >> 8);
-    lcd_wr_data(SSD_HPS);
-    lcd_wr_data(SSD_HOR_PULSE_WIDTH - 1);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-    lcd_wr_regno(0xB6); /* Set vertical perio */
-    lcd_wr_data((SSD_VT - 1) >> 8);
-    lcd_wr_data(SSD_VT - 1);
-    lcd_wr_data(SSD_VPS >> 8);
-    lcd_wr_data(SSD_VPS);
-    lcd_wr_data(SSD_VER_FRONT_PORCH - 1);
-    lcd_wr_data(0x00);
-    lcd_wr_data(0x00);
-
-    lcd_wr_regno(0xF0); /* SSD1963CPUӿΪ16bit */
-    lcd_wr_data(0x03);  /* 16-bit(565 format) data for 16bpp */
-
-    lcd_wr_regno(0x29); /* ʾ */
-    /* PWM  ͨռձȿɵ */
-    lcd_wr_regno(0xD0); /* ԶƽDBC */
-    lcd_wr_data(0x00);  /* disable */
-
-    lcd_wr_regno(0xBE); /* PWM */
-    lcd_wr_data(0x05);  /* 1PWMƵ */
-    lcd_wr_data(0xFE);  /* 2PWMռձ */
-    lcd_wr_data(0x01);  /* 3C */
-    lcd_wr_data(0x00);  /* 4D */
-    lcd_wr_data(0x00);  /* 5E */
-    lcd_wr_data(0x00);  /* 6F */
-
-    lcd_wr_regno(0xB8); /* GPIO */
-    lcd_wr_data(0x03);  /* 2IOó */
-    lcd_wr_data(0x01);  /* GPIOʹIO */
-    lcd_wr_regno(0xBA);
-    lcd_wr_data(0x01);  /* GPIO[1:0]=01,LCD */
+    const uint8_t *p = *pc;
+    uint16_t reg;
+    uint8_t op, n;
+
+    while (1)
+    {
+        op = *p++;
+
+        if (op == LCD_OP_END)
+        {
+            *pc = p - 1;
+            return 0;
+        }
+
+        if (op == LCD_OP_DELAY)
+        {
+            n = *p++;
+            *pc = p;
+
+            if (n)
+            {
+                return n;
+            }
+
+            continue;
+        }
+
+        n = op & LCD_OP_LEN;
+
+        if (op & LCD_OP_SEQ)            /* 16λĴ, ÿдһ(NT35510) */
+        {
+            reg = (p[0] << 8) | p[1];
+            p += 2;
+
+            while (n--)
+            {
+                lcd_write_reg(reg++, *p++);
+            }
+
+            continue;
+        }
+
+        if (op & LCD_OP_CMD16)          /* 16λ */
+        {
+            reg = (p[0] << 8) | p[1];
+            p += 2;
+        }
+        else
+        {
+            reg = *p++;
+        }
+
+        lcd_wr_regno(reg);
+
+        while (n--)
+        {
+            lcd_wr_data(*p++);
+        }
+    }
 }
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
@@ -0,0 +1,588 @@
+/**
+ ****************************************************************************************************
+ * @file        log.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       USART1 첽־(DMA, λ, ѡƼ¼ʽ)
+ ****************************************************************************************************
+ * @attention
+ *
+ * ԭfputcÿַҪæUSART1->SR, 115200һַԼ87us, AI_Init/AI_Run
+ * һprintfҪסCPUü. дɵĻλ, DMA2 Stream7
+ * ں̨USART1, д־һֻһڴ濽ͷ.
+ *
+ * λķ LDREX/STREX , ѭжϿͬʱд־, Ҫж:
+ *   g_log_head : һɷĲ(ֻ, д־һԭӵ)
+ *   g_log_tail : һҪ͵Ĳ(ֻ, ֻзͷ޸)
+ * ۵stateFREE->BUSY(д)->READY(ɷ), ɺصFREE.
+ * жϴϵĵȼд߻ûύʱ, DMAͣĲǰȴ, ύʱDMA,
+ * ־ڴϵ˳ͷλ˳һ, д(log_write)ڴϱ֤.
+ *
+ ****************************************************************************************************
+ */
+
+#include "string.h"
+#include "stdio.h"
+#include "stdarg.h"
+#include "log.h"
+#include "usart.h"
+
+
+/* ״̬ */
+#define LOG_SLOT_FREE       0       /*  */
+#define LOG_SLOT_BUSY       1       /* ѷ, д */
+#define LOG_SLOT_READY      2       /* ύ, ȴDMA */
+
+#define LOG_SLOT_MASK       (LOG_SLOT_NUM - 1)
+
+typedef struct
+{
+    volatile uint8_t state;         /* ״̬ */
+    uint8_t len;                    /* Чݳ */
+    uint8_t data[LOG_SLOT_PAYLOAD]; /*  */
+} log_slot_t;
+
+static log_slot_t g_log_slot[LOG_SLOT_NUM];
+static volatile uint32_t g_log_head = 0;    /* һɷĲ */
+static volatile uint32_t g_log_tail = 0;    /* һҪ͵Ĳ */
+static volatile uint32_t g_log_txbusy = 0;  /* 1, DMAڷg_log_tail */
+static log_stats_t g_log_stats;
+
+/* fputcʹõл, ֻѭʹ */
+static char g_log_line[LOG_SLOT_PAYLOAD];
+static uint8_t g_log_line_len = 0;
+
+#if !LOG_USE_BINARY
+/* ¼IDӦĸʽ */
+#define LOG_ID(name, fmt)   fmt,
+static const char *const g_log_fmt[LOG_ID_NUM] =
+{
+#include "log_ids.h"
+};
+#undef LOG_ID
+#endif
+
+/**
+ * @brief       ԭӼ
+ * @param       p: ַ
+ * @param       n: 
+ * @retval      ֵ֮
+ */
+static uint32_t log_atomic_add(volatile uint32_t *p, uint32_t n)
+{
+    uint32_t v;
+
+    do
+    {
+        v = __LDREXW(p) + n;
+    } while (__STREXW(v, p));
+
+    return v;
+}
+
+/**
+ * @brief       n
+ * @param       n  : 
+ * @param       pos: صһ۵
+ * @retval      0, ɹ; 1, (Ѽdropped);
+ */
+static uint8_t log_reserve(uint32_t n, uint32_t *pos)
+{
+    uint32_t head;
+    uint32_t used;
+
+    do
+    {
+        head = __LDREXW(&g_log_head);
+        used = head + n - g_log_tail;
+
+        if (used > LOG_SLOT_NUM)    /* Ų,  */
+        {
+            __CLREX();
+            log_atomic_add(&g_log_stats.dropped, 1);
+            return 1;
+        }
+    } while (__STREXW(head + n, &g_log_head));
+
+    if (used > g_log_stats.peak)    /* ˮλֻͳ, Ҫϸ */
+    {
+        g_log_stats.peak = used;
+    }
+
+    *pos = head;
+    return 0;
+}
+
+/**
+ * @brief       DMAһύĲ
+ *   @note      ĵ, g_log_txbusy֤ͬһʱֻһDMA
+ * @param       
+ * @retval      
+ */
+static void log_kick(void)
+{
+    log_slot_t *slot;
+
+    while (1)
+    {
+        if (__LDREXW(&g_log_txbusy))    /* DMAڷ, жϻ */
+        {
+            __CLREX();
+            return;
+        }
+
+        if (__STREXW(1, &g_log_txbusy))
+        {
+            continue;
+        }
+
+        slot = &g_log_slot[g_log_tail & LOG_SLOT_MASK];
+
+        if (g_log_tail != g_log_head && slot->state == LOG_SLOT_READY)
+        {
+            if (HAL_UART_Transmit_DMA(&huart1, slot->data, slot->len) == HAL_OK)
+            {
+                return;
+            }
+
+            g_log_txbusy = 0;   /* HAL proto  ReceiveToIdle_DMA ռ,  log_poll  */
+            return;
+        }
+
+        g_log_txbusy = 0;
+        __DMB();
+
+        /* ͷg_log_txbusy֮ǰв۸ոύ(log_kickbusyֱӷ), ټһ */
+        if (g_log_tail == g_log_head || slot->state != LOG_SLOT_READY)
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief       ύn
+ * @param       pos: һ۵
+ * @param       n  : 
+ * @retval      
+ */
+static void log_commit(uint32_t pos, uint32_t n)
+{
+    __DMB();    /* ֤״̬д */
+
+    while (n--)
+    {
+        g_log_slot[pos++ & LOG_SLOT_MASK].state = LOG_SLOT_READY;
+    }
+
+    log_atomic_add(&g_log_stats.written, 1);
+    log_kick();
+}
+
+/**
+ * @brief       USART1ɻص(DMAһ)
+ * @param       huart: ھ
+ * @retval      
+ */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+    log_slot_t *slot;
+
+    if (huart->Instance == USART1)
+    {
+        slot = &g_log_slot[g_log_tail & LOG_SLOT_MASK];
+        g_log_stats.bytes += slot->len;
+        slot->state = LOG_SLOT_FREE;
+        __DMB();
+        g_log_tail++;
+        g_log_txbusy = 0;
+        log_kick();
+    }
+}
+
+#if !LOG_USE_BINARY
+/**
+ * @brief       ޷תַ
+ * @param       p    : λ
+ * @param       end  : ĩβ
+ * @param       v    : ֵ
+ * @param       base : 10/16
+ * @param       width: С, ʱλpad
+ * @param       pad  : ַ
+ * @param       upper: ʮǷд
+ * @retval      ֮λ
+ */
+static char *log_utoa(char *p, char *end, uint32_t v, uint8_t base, uint8_t width, char pad, uint8_t upper)
+{
+    char tmp[10];
+    uint8_t n = 0;
+    const char *digit = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    do
+    {
+        tmp[n++] = digit[v % base];
+        v /= base;
+    } while (v);
+
+    while (width > n && p < end)
+    {
+        *p++ = pad;
+        width--;
+    }
+
+    while (n && p < end)
+    {
+        *p++ = tmp[--n];
+    }
+
+    return p;
+}
+
+/**
+ * @brief       log_ids.hĸʽ4ʽı
+ *   @note      ֻ֧ %d/%u/%x/%X/%c/%f/%% Լ0Ϳ, printf, ִʱ
+ * @param       buf : 
+ * @param       size: С
+ * @param       fmt : ʽ
+ * @param       arg : 4
+ * @retval      
+ */
+static uint16_t log_format(char *buf, uint16_t size, const char *fmt, const uint32_t *arg)
+{
+    char *p = buf;
+    char *end = buf + size;
+    uint8_t ai = 0;
+    uint8_t width;
+    char pad;
+    uint32_t v, frac;
+    float f;
+
+    while (*fmt && p < end)
+    {
+        if (*fmt != '%')
+        {
+            *p++ = *fmt++;
+            continue;
+        }
+
+        fmt++;
+        pad = ' ';
+        width = 0;
+
+        if (*fmt == '0')
+        {
+            pad = '0';
+            fmt++;
+        }
+
+        while (*fmt >= '0' && *fmt <= '9')
+        {
+            width = width * 10 + (*fmt++ - '0');
+        }
+
+        if (*fmt == '%')
+        {
+            *p++ = '%';
+            fmt++;
+            continue;
+        }
+
+        v = (ai < 4) ? arg[ai++] : 0;
+
+        switch (*fmt)
+        {
+            case 'd':
+                if ((int32_t)v < 0)
+                {
+                    *p++ = '-';
+                    v = -(int32_t)v;
+                }
+
+                p = log_utoa(p, end, v, 10, width, pad, 0);
+                break;
+
+            case 'u':
+                p = log_utoa(p, end, v, 10, width, pad, 0);
+                break;
+
+            case 'x':
+            case 'X':
+                p = log_utoa(p, end, v, 16, width, pad, *fmt == 'X');
+                break;
+
+            case 'c':
+                *p++ = (char)v;
+                break;
+
+            case 'f':   /* floatλģʽ, ̶6λС */
+                memcpy(&f, &v, 4);
+
+                if (f < 0)
+                {
+                    *p++ = '-';
+                    f = -f;
+                }
+
+                v = (uint32_t)f;
+                frac = (uint32_t)((f - v) * 1000000.0f + 0.5f);
+
+                if (frac >= 1000000)    /* С1, λ */
+                {
+                    frac -= 1000000;
+                    v++;
+                }
+
+                p = log_utoa(p, end, v, 10, 0, ' ', 0);
+
+                if (p < end)
+                {
+                    *p++ = '.';
+                }
+
+                p = log_utoa(p, end, frac, 10, 6, '0', 0);
+                break;
+
+            default:
+                break;
+        }
+
+        if (*fmt)
+        {
+            fmt++;
+        }
+    }
+
+    return p - buf;
+}
+#endif
+
+/**
+ * @brief       ʼ־
+ *   @note      ҪMX_DMA_InitMX_USART1_UART_Init֮, ͬʱDWTڼΪʱ
+ * @param       
+ * @retval      
+ */
+void log_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     /* ʹDWT */
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                /* ʹCYCCNT */
+
+    memset(g_log_slot, 0, sizeof(g_log_slot));
+    memset(&g_log_stats, 0, sizeof(g_log_stats));
+    g_log_head = 0;
+    g_log_tail = 0;
+    g_log_txbusy = 0;
+    g_log_line_len = 0;
+}
+
+/**
+ * @brief       ԭдһ
+ *   @note      ݰз, Ĳ, ڴϲᱻ־
+ * @param       buf: 
+ * @param       len: ,  LOG_SLOT_NUM * LOG_SLOT_PAYLOAD ֽ
+ * @retval      0, ɹ; 1, ;
+ */
+uint8_t log_write(const uint8_t *buf, uint16_t len)
+{
+    uint32_t pos, i;
+    uint32_t n = (len + LOG_SLOT_PAYLOAD - 1) / LOG_SLOT_PAYLOAD;
+    log_slot_t *slot;
+
+    if (len == 0)
+    {
+        return 0;
+    }
+
+    if (n > LOG_SLOT_NUM || log_reserve(n, &pos))
+    {
+        return 1;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        slot = &g_log_slot[(pos + i) & LOG_SLOT_MASK];
+        slot->state = LOG_SLOT_BUSY;
+        slot->len = (len > LOG_SLOT_PAYLOAD) ? LOG_SLOT_PAYLOAD : len;
+        memcpy(slot->data, buf, slot->len);
+        buf += slot->len;
+        len -= slot->len;
+    }
+
+    log_commit(pos, n);
+    return 0;
+}
+
+/**
+ * @brief       лһַ
+ *   @note      '\n'лʱύ. л岻, жlog_printf/LOG_BIN
+ * @param       ch: ַ
+ * @retval      
+ */
+void log_putc(char ch)
+{
+    g_log_line[g_log_line_len++] = ch;
+
+    if (ch == '\n' || g_log_line_len >= LOG_SLOT_PAYLOAD)
+    {
+        log_write((uint8_t *)g_log_line, g_log_line_len);
+        g_log_line_len = 0;
+    }
+}
+
+/**
+ * @brief       ʽһı־, ֱӸʽ(һ LOG_SLOT_PAYLOAD - 1 ַ)
+ * @param       fmt: ʽ
+ * @retval      дַ, 0ʾ
+ */
+int log_printf(const char *fmt, ...)
+{
+    va_list ap;
+    uint32_t pos;
+    int ret;
+    log_slot_t *slot;
+
+    if (log_reserve(1, &pos))
+    {
+        return 0;
+    }
+
+    slot = &g_log_slot[pos & LOG_SLOT_MASK];
+    slot->state = LOG_SLOT_BUSY;
+
+    va_start(ap, fmt);
+    ret = vsnprintf((char *)slot->data, LOG_SLOT_PAYLOAD, fmt, ap);
+    va_end(ap);
+
+    if (ret < 0)
+    {
+        ret = 0;
+    }
+    else if (ret >= LOG_SLOT_PAYLOAD)
+    {
+        ret = LOG_SLOT_PAYLOAD - 1;
+        log_atomic_add(&g_log_stats.truncated, 1);
+    }
+
+    slot->len = ret;
+    log_commit(pos, 1);
+    return ret;
+}
+
+/**
+ * @brief       дһ¼
+ *   @note      LOG_USE_BINARYΪ1ʱֻ24ֽڶ¼, ÿεõCPUʱ̶;
+ *              Ϊ0ʱlog_ids.hĸʽ豸˸ʽһı.
+ * @param       id   : ¼ID(log_id_t)
+ * @param       a0~a3: 
+ * @retval      
+ */
+void log_record(uint16_t id, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    uint32_t pos;
+    log_slot_t *slot;
+    uint8_t *p;
+    uint8_t i, sum;
+
+    if (log_reserve(1, &pos))
+    {
+        return;
+    }
+
+    slot = &g_log_slot[pos & LOG_SLOT_MASK];
+    slot->state = LOG_SLOT_BUSY;
+    p = slot->data;
+
+#if LOG_USE_BINARY
+    uint32_t rec[5];
+
+    rec[0] = DWT->CYCCNT;
+    rec[1] = a0;
+    rec[2] = a1;
+    rec[3] = a2;
+    rec[4] = a3;
+
+    p[0] = LOG_BIN_SYNC;
+    p[1] = id & 0xFF;
+    p[2] = id >> 8;
+    memcpy(&p[3], rec, sizeof(rec));    /* Cortex-M4С, ֱӿ */
+
+    sum = 0;
+
+    for (i = 1; i < LOG_BIN_SIZE - 1; i++)
+    {
+        sum ^= p[i];
+    }
+
+    p[LOG_BIN_SIZE - 1] = sum;
+    slot->len = LOG_BIN_SIZE;
+#else
+    uint32_t arg[4];
+    uint16_t len;
+
+    arg[0] = a0;
+    arg[1] = a1;
+    arg[2] = a2;
+    arg[3] = a3;
+    (void)i;
+    (void)sum;
+
+    len = log_format((char *)p, LOG_SLOT_PAYLOAD - 2, (id < LOG_ID_NUM) ? g_log_fmt[id] : "?", arg);
+    p[len++] = '\r';
+    p[len++] = '\n';
+    slot->len = len;
+#endif
+
+    log_commit(pos, 1);
+}
+
+/**
+ * @brief       ȴ־ȫ
+ * @param       timeout: ʱʱ(ms)
+ * @retval      
+ */
+void log_flush(uint32_t timeout)
+{
+    uint32_t start = HAL_GetTick();
+
+    if (g_log_line_len)     /* Ȱûлеİύ */
+    {
+        log_write((uint8_t *)g_log_line, g_log_line_len);
+        g_log_line_len = 0;
+    }
+
+    while (g_log_tail != g_log_head && (HAL_GetTick() - start) < timeout)
+    {
+        log_kick();
+    }
+}
+
+/**
+ * @brief       DMA: ڱռʱ log_kick , û־Ͳ
+ *   @note      ־ڵ, USART1ջص֮Ҳ(ʱHALͷ)
+ * @param       
+ * @retval      
+ */
+void log_poll(void)
+{
+    log_kick();
+}
+
+/**
+ * @brief       ȡͳƼ
+ * @param       stats: 
+ * @retval      
+ */
+void log_get_stats(log_stats_t *stats)
+{
+    *stats = g_log_stats;
+}
+
+/**
+ * @brief       ͳƼ
+ * @param       
+ * @retval      
+ */
+void log_report(void)
+{
+    LOG_BIN(LOG_STATS, g_log_stats.written, g_log_stats.dropped, g_log_stats.truncated, g_log_stats.bytes);
+}
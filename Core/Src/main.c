@@ -19,6 +19,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include "crc.h"
+#include "dma.h"
 #include "tim.h"
 #include "usart.h"
 #include "gpio.h"
@@ -34,6 +35,23 @@
 #include "ai_platform.h"//ֶͺ
 #include "touch.h"
 #include "delay.h"
+#include "log.h"
+#include "proto.h"
+#include "trace.h"
+#include "bench.h"
+#include "sched.h"
+#include "panel.h"
+#include "dirty.h"
+#include "bar.h"
+#include "fmap.h"
+#include "stroke.h"
+#include "seg.h"
+#include "strip.h"
+#include "online.h"
+#include "tprec.h"
+#include "cfg.h"
+#include "boot.h"
+#include "string.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -63,15 +81,59 @@ void SystemClock_Config(void);
 
 
 ai_handle network=AI_HANDLE_NULL;
-static float aiInData[AI_NETWORK_IN_1_SIZE]={0};
-static float aiOutData[AI_NETWORK_OUT_1_SIZE];
 ai_u8 activations[AI_NETWORK_DATA_ACTIVATIONS_SIZE];
 
 ai_buffer * ai_input;
 ai_buffer * ai_output;
 
-uint16_t lastpos[10][2]; 
-
+uint16_t lastpos[10][2];        /* īĩ */
+uint16_t prevpos[10][2];        /* īһε, һʱصĲ */
+static stroke_t g_stroke[10];   /* ÿ˲/ֵ */
+static uint32_t g_stroke_t0[10];        /* һɨʱ() */
+static uint16_t g_ghost[10][3][2];      /* ûʱī: ĩ -> ˲ -> Ԥʼ, [0][0]Ϊ0xFFFFʾû */
+static dirty_rect_t g_ink = {0xFFFF, 0xFFFF, 0, 0};    /* īӾ, x0Ϊ0xFFFFʾû */
+static volatile uint8_t g_clear_req = 0;        /* "RST", ǰȡϢ */
+
+/* ȼ, С; TASK_TOUCH/TASK_RENDER PendSV, ռ */
+#define TASK_TOUCH      0       /* ɨ, TIM2ÿ20msͷ */
+#define TASK_RENDER     1       /* , ͼƬ */
+#define TASK_LOG        2       /* ͳ/׼̨ */
+#define TASK_DISPLAY    3       /* ʾʶ */
+#define TASK_INFER      4       /* ʹЭ, ȼ */
+
+/*  ->  */
+typedef struct
+{
+  uint16_t x;
+  uint16_t y;
+  uint8_t id;                   /*  */
+  uint8_t down;                 /* 1, ; 0, ɿ */
+  uint16_t reserved;
+  uint32_t t0;                  /* ɨ迪ʼʱ() */
+} touch_msg_t;
+
+/*  -> ʾ */
+typedef struct
+{
+  uint8_t count;                /* ֳָ, 0ʾǿյ */
+  uint8_t num[SEG_MAX];         /* ÿָ,  */
+  uint8_t reserved;
+  uint16_t evt;                 /* ´¼(trace) */
+  uint32_t cycles;              /*  ai_network_run ֮ */
+  float conf[SEG_MAX];          /* ÿֵ */
+  float prob[AI_NETWORK_OUT_1_SIZE];    /* ұһֵĸ(ͼ) */
+} result_msg_t;
+
+static sched_queue_t g_q_touch;
+static touch_msg_t g_q_touch_buf[16];
+static sched_queue_t g_q_ink;   /*  -> , ݱ */
+static uint8_t g_q_ink_buf[4];
+static sched_queue_t g_q_result;
+static result_msg_t g_q_result_buf[2];
+static float aiSnapData[AI_NETWORK_IN_1_SIZE];  /* õ28x28, ڼ仭񻹻ĸ */
+static uint8_t g_preview_num = 0;               /* ϽʾŵԤ */
+
+static uint8_t clear_canvas(void);
 
 static void AI_Init(void)
 {
@@ -82,22 +144,22 @@ static void AI_Init(void)
   /* Create an instance of the model */
   err = ai_network_create_and_init(&network, act_addr, NULL);
   if (err.type != AI_ERROR_NONE) {
-    printf("ai_network_create error - type=%d code=%d\r\n", err.type, err.code);
+    LOG_BIN(AI_CREATE_ERR, err.type, err.code, 0, 0);
+    log_flush(100);
     Error_Handler();
   }
 	else 
 	{
-		printf("AI init success!\r\n");
+		LOG_BIN(AI_INIT_OK, 0, 0, 0, 0);
 	}
   ai_input = ai_network_inputs_get(network, NULL);
   ai_output = ai_network_outputs_get(network, NULL);
 }
 
-static void AI_Run(float *pIn, float *pOut)
+/* һ, ai_network_runʱ(ʹЭ鹲) */
+static uint32_t AI_Infer(const float *pIn, float *pOut)
 {
-	char logStr[100];
-	int count = 0;
-	float max = 0;
+  uint32_t cycles;
   ai_i32 batch;
   ai_error err;
 
@@ -105,169 +167,629 @@ static void AI_Run(float *pIn, float *pOut)
   ai_input[0].data = AI_HANDLE_PTR(pIn);
   ai_output[0].data = AI_HANDLE_PTR(pOut);
 
+  TRACE_BEGIN(AI_RUN);
+  cycles = DWT->CYCCNT;
   batch = ai_network_run(network, ai_input, ai_output);
+  cycles = DWT->CYCCNT - cycles;
+  TRACE_END(AI_RUN);
   if (batch != 1) {
     err = ai_network_get_error(network);
-    printf("AI ai_network_run error - type=%d code=%d\r\n", err.type, err.code);
+    LOG_BIN(AI_RUN_ERR, err.type, err.code, 0, 0);
+    log_flush(100);
     Error_Handler();
   }
-  for (uint32_t i = 0; i < AI_NETWORK_OUT_1_SIZE; i++) {
-
-	  sprintf(logStr,"%d  %8.6f\r\n",i,aiOutData[i]);
-		
-		
-	  //printf("%s",logStr);
-		
-		lcd_show_string(72, 336+72+i*32,336, 32,32, logStr,BLACK);
-	  if(max<aiOutData[i])
-	  {
-		  count = i;
-		  max= aiOutData[i];
-	  }
+  return cycles;
+}
+
+/**
+ * @brief       Ͻʾһֵ28x28(׵׺), sڵs
+ * @param       s  : ڼ
+ * @param       img: 28x28Ҷ, NULL ʱɿհ
+ * @retval      
+ */
+static void prep_preview(uint8_t s, const uint8_t *img)
+{
+    uint16_t i;
+    uint8_t v;
+
+    sched_lock();
+    lcd_set_window(s * 28, 0, 28, 28);
+    lcd_write_ram_prepare();
+    LCD_BUS_ADD(28 * 28);
+
+    for (i = 0; i < 28 * 28; i++)
+    {
+        v = img ? 255 - img[i] : 255;
+        LCD_WR_RAM(((v >> 3) << 11) | ((v >> 2) << 5) | (v >> 3));
+    }
+
+    sched_unlock();
+}
+
+#if STRIP_MODE
+/**
+ * @brief       ʶ(, strip.h): һʶ, ʾϽǵԤ
+ *   @note      ʱX-CUBE-AIļ,  AI_Infer ͬһ, ͬʱ
+ * @param       res: 
+ * @retval      
+ */
+static void infer_strip(result_msg_t *res)
+{
+  strip_result_t r;
+  const uint8_t *img = strip_image(activations);
+  uint16_t w, x, y;
+  uint8_t v;
+
+  sched_lock();
+  w = prep_strip(strip_image(activations), STRIP_W_MAX);
+  sched_unlock();
+
+  TRACE_BEGIN(AI_RUN);
+  res->cycles = DWT->CYCCNT;
+  res->count = strip_run(activations, w, 1, &r);
+  res->cycles = DWT->CYCCNT - res->cycles;
+  TRACE_END(AI_RUN);
+  memcpy(res->num, r.num, sizeof(res->num));
+  memcpy(res->conf, r.conf, sizeof(res->conf));
+  memcpy(res->prob, r.prob, sizeof(res->prob));
+
+  sched_lock();
+  lcd_set_window(0, 0, SEG_MAX * 28, 28);
+  lcd_write_ram_prepare();
+  LCD_BUS_ADD(SEG_MAX * 28 * 28);
+
+  for (y = 0; y < 28; y++)
+  {
+    for (x = 0; x < SEG_MAX * 28; x++)
+    {
+      v = (x < w) ? 255 - img[y * w + x] : 255;
+      LCD_WR_RAM(((v >> 3) << 11) | ((v >> 2) << 5) | (v >> 3));
+    }
   }
-	if(aiOutData[count]>0.5)
-	{
-  sprintf(logStr,"current number is %d   \r\n",count);
-	}
-	else 
-	{
-		sprintf(logStr,"current number is none");
-	}
-  //printf("%s",logStr);
-	lcd_show_string(72,336+ 72+10*32,400, 32,32, logStr,BLACK);
+
+  sched_unlock();
 }
+#endif
 
+#if ONLINE_MODE
+/**
+ * @brief       ʶ(, online.h): GRU Ѿڻʼ, ֻ
+ * @param       res: 
+ * @retval      
+ */
+static void infer_online(result_msg_t *res)
+{
+  uint32_t i;
+
+  TRACE_BEGIN(AI_RUN);
+  sched_lock();                         /*  GRU ״̬ */
+  res->cycles = DWT->CYCCNT;
+  res->count = online_result(res->prob) ? 1 : 0;
+  res->cycles = DWT->CYCCNT - res->cycles;
+  sched_unlock();
+  TRACE_END(AI_RUN);
+
+  res->num[0] = 0;
+  for (i = 1; i < AI_NETWORK_OUT_1_SIZE; i++) {
+    if (res->prob[i] > res->prob[res->num[0]])
+    {
+      res->num[0] = i;
+    }
+  }
+  res->conf[0] = res->prob[res->num[0]];
+}
+#endif
 
+/**
+ * @brief       : ȴЭ֡, ˾ͷָ, һΰÿֶʶ
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void infer_task(void *arg)
+{
+  result_msg_t res;
+  uint8_t ink = 0;
+#if !ONLINE_MODE && !STRIP_MODE
+  uint8_t n, s;
+  uint32_t i;
+#endif
 
-void load_draw_dialog(void)
+  UNUSED(arg);
+
+  if (g_clear_req)                      /* ѭ, ϳɻʱPendSVĴɨճ */
+  {
+    clear_canvas();
+    g_clear_req = 0;
+    sched_release(TASK_RENDER);         /* ֮ѹĴϢ */
+  }
+
+  if (proto_poll())
+  {
+    return;
+  }
+
+  while (sched_queue_get(&g_q_ink, NULL) == 0)
+  {
+    ink = 1;
+  }
+
+  if (ink == 0)
+  {
+    return;
+  }
+
+#if ONLINE_MODE
+  res.evt = TRACE_FRAME_MARK();
+  infer_online(&res);
+#elif STRIP_MODE
+  res.evt = TRACE_FRAME_MARK();
+  infer_strip(&res);
+#else
+  sched_lock();
+  n = prep_segment();
+  sched_unlock();
+
+  res.evt = TRACE_FRAME_MARK();
+  res.count = n;
+  res.cycles = 0;
+  memset(res.prob, 0, sizeof(res.prob));
+
+  for (s = 0; s < n; s++)
+  {
+    sched_lock();                       /* ÿֵ, סʱ */
+    prep_run(s, aiSnapData);
+    sched_unlock();
+    prep_preview(s, prep_image());
+    res.cycles += AI_Infer(aiSnapData, res.prob);
+
+    TRACE_BEGIN(ARGMAX);
+    res.num[s] = 0;
+    for (i = 1; i < AI_NETWORK_OUT_1_SIZE; i++) {
+	    if (res.prob[i] > res.prob[res.num[s]])
+	    {
+		    res.num[s] = i;
+	    }
+    }
+    res.conf[s] = res.prob[res.num[s]];
+    TRACE_END(ARGMAX);
+  }
+
+  for (; s < g_preview_num; s++)        /* ֱ, Ԥ */
+  {
+    prep_preview(s, NULL);
+  }
+
+  g_preview_num = n;
+#endif
+  boot_mark(BOOT_INFER);
+  sched_queue_put(&g_q_result, &res);
+}
+
+/**
+ * @brief       ʾ: ʾµһʶ, ֻˢ±˵ַͼ˵һ
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void display_task(void *arg)
 {
-    lcd_clear(WHITE);                                                /*  */
-    lcd_show_string(lcddev.width - 24, 0, 200, 16, 16, "RST", BLUE); /* ʾ */
-	lcd_draw_rectangle(72, 72, 336+72-1,336+72-1,  BLUE);
-	for (int i=0;i<AI_NETWORK_IN_1_SIZE;i++)
+	static uint32_t last = 0xFFFFFFFF;
+	result_msg_t res;
+	uint32_t value = 0;
+	float conf = 1.0f;
+	uint8_t i;
+
+	UNUSED(arg);
+
+	if (sched_queue_get(&g_q_result, &res))
+	{
+		if (bar_poll())		/* : ϴûˢʱͼ */
+		{
+			dirty_flush();
+		}
+		return;
+	}
+
+	while (sched_queue_get(&g_q_result, &res) == 0);	/* ѹʱֻʾµ */
+
+  TRACE_BEGIN(SHOW_TEXT);
+  panel_update(res.prob, res.num, res.conf, res.count);
+  bar_poll();
+  dirty_flush();
+  TRACE_END(SHOW_TEXT);
+  TRACE_FRAME_DONE(res.evt);
+  boot_mark(BOOT_SHOWN);
+	for (i = 0; i < res.count; i++)
 	{
-		aiInData[i]=0;
+		value = value * 10 + res.num[i];
+		conf = (res.conf[i] < conf) ? res.conf[i] : conf;
+	}
+
+	if (res.count && value * 8 + res.count != last)	/* 仯ʱż¼, ˢ־ */
+	{
+		if (res.count == 1)
+		{
+			LOG_BIN(AI_RESULT, res.num[0], LOG_F2U(res.conf[0]), res.cycles, 0);
+		}
+		else
+		{
+			LOG_BIN(AI_NUMBER, value, res.count, LOG_F2U(conf), res.cycles);
+		}
+		last = value * 8 + res.count;
 	}
 }
 
-void process_data(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+/**
+ * @brief       ־: ͳƻ, ׼̨
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void log_task(void *arg)
 {
-    uint16_t t;
-    int xerr = 0, yerr = 0, delta_x, delta_y, distance;
-    int incx, incy, row, col;
-    delta_x = x2 - x1;      /*  */
-    delta_y = y2 - y1;
-    row = x1;
-    col = y1;
-
-    if (delta_x > 0)
+	UNUSED(arg);
+	log_poll();		/* ڱռʱû־DMA */
+	trace_poll();
+	bench_poll();
+	tprec_poll();
+	sched_poll();
+	dirty_poll();
+	fmap_poll();
+	gt9xxx_poll();
+	boot_poll();
+}
+
+
+
+
+/**
+ * @brief       Իͼ: ߿ "RST"()
+ * @param       y    : 
+ * @param       x0,x1: зΧ
+ * @param       line : һе, line[0] Ӧ x0
+ * @retval      
+ */
+static void dialog_paint(uint16_t y, uint16_t x0, uint16_t x1, uint16_t *line)
+{
+    const uint16_t *rows;
+    uint16_t x, cx, bits;
+    uint8_t i;
+
+    if (y >= PREP_Y0 && y <= PREP_Y0 + PREP_H - 1)  /* ߿ */
     {
-        incx = 1;       /* õ */
+        if (y == PREP_Y0 || y == PREP_Y0 + PREP_H - 1)
+        {
+            for (x = (x0 > PREP_X0) ? x0 : PREP_X0; x <= x1 && x <= PREP_X0 + PREP_W - 1; x++)
+            {
+                line[x - x0] = BLUE;
+            }
+        }
+        else
+        {
+            if (x0 <= PREP_X0 && x1 >= PREP_X0)
+            {
+                line[PREP_X0 - x0] = BLUE;
+            }
+
+            if (x0 <= PREP_X0 + PREP_W - 1 && x1 >= PREP_X0 + PREP_W - 1)
+            {
+                line[PREP_X0 + PREP_W - 1 - x0] = BLUE;
+            }
+        }
     }
-    else if (delta_x == 0)
+
+    if (y < 16 && x1 >= lcddev.width - 24)  /* lcd_show_string(lcddev.width - 24, 0, 200, 16, 16, "RST", BLUE) */
     {
-        incx = 0;       /* ֱ */
+        for (i = 0; i < 3; i++)
+        {
+            cx = lcddev.width - 24 + i * 8;
+            rows = lcd_glyph_get("RST"[i], 16);
+            bits = rows ? rows[y] : 0;
+
+            for (x = cx; bits; x++, bits <<= 1)
+            {
+                if ((bits & 0x8000) && x >= x0 && x <= x1)
+                {
+                    line[x - x0] = BLUE;
+                }
+            }
+        }
     }
-    else
+}
+
+/**
+ * @brief       īӾμһΧ size ķΧ
+ * @param       x, y: 
+ * @param       size: 뾶
+ * @retval      
+ */
+static void ink_add(uint16_t x, uint16_t y, uint16_t size)
+{
+    uint16_t x0 = (x > size) ? x - size : 0;
+    uint16_t y0 = (y > size) ? y - size : 0;
+
+    if (g_ink.x0 == 0xFFFF)
     {
-        incx = -1;
-        delta_x = -delta_x;
+        g_ink.x0 = x0;
+        g_ink.y0 = y0;
+        g_ink.x1 = x + size;
+        g_ink.y1 = y + size;
+        return;
     }
 
-    if (delta_y > 0)
+    g_ink.x0 = (x0 < g_ink.x0) ? x0 : g_ink.x0;
+    g_ink.y0 = (y0 < g_ink.y0) ? y0 : g_ink.y0;
+    g_ink.x1 = (x + size > g_ink.x1) ? x + size : g_ink.x1;
+    g_ink.y1 = (y + size > g_ink.y1) ? y + size : g_ink.y1;
+}
+
+/**
+ * @brief       : ֻºϳī28x28Ԥڵľ, ǿյʱʲô
+ *   @note      ѭ(),  g_clear_req ǰ, ī״̬ᱻͬʱ޸
+ * @param       
+ * @retval      1, ī; 0, 屾ǿյ;
+ */
+static uint8_t clear_canvas(void)
+{
+    if (g_ink.x0 == 0xFFFF)
     {
-        incy = 1;
+        return 0;
     }
-    else if (delta_y == 0)
+
+    dirty_add(g_ink.x0, g_ink.y0, g_ink.x1, g_ink.y1);
+    dirty_add(0, 0, SEG_MAX * 28 - 1, 27);      /* 28x28Ԥ */
+    dirty_flush();
+    g_ink.x0 = 0xFFFF;
+    g_preview_num = 0;
+    prep_clear();
+#if ONLINE_MODE
+    online_clear();
+#endif
+    return 1;
+}
+
+/**
+ * @brief       ºϳ(ʱ, ׼дĻ), 
+ * @param       
+ * @retval      
+ */
+void load_draw_dialog(void)
+{
+    dirty_add_all();
+    dirty_flush();
+    g_ink.x0 = 0xFFFF;
+    g_preview_num = 0;
+    prep_clear();
+#if ONLINE_MODE
+    online_clear();
+#endif
+}
+
+/* 10صɫ(ݴ) */
+const uint16_t POINT_COLOR_TBL[10] = {RED, GREEN, BLUE, BROWN, YELLOW, MAGENTA, CYAN, LIGHTBLUE, BRRED, GRAY};
+
+/**
+ * @brief       ѵڻ(ֵƿܳ)
+ * @param       p: 
+ * @retval      
+ */
+static void canvas_clip(uint16_t p[2])
+{
+    p[0] = (p[0] < PREP_X0 + 1) ? PREP_X0 + 1 : (p[0] > PREP_X0 + PREP_W - 2) ? PREP_X0 + PREP_W - 2 : p[0];
+    p[1] = (p[1] < PREP_Y0 + 1) ? PREP_Y0 + 1 : (p[1] > PREP_Y0 + PREP_H - 2) ? PREP_Y0 + PREP_H - 2 : p[1];
+}
+
+/**
+ * @brief       ī: Ŷĩ˻ÿ, ͬʱӵԤĸ(ʶıʼ)
+ * @param       t  : 
+ * @param       pts: ĵ
+ * @param       n  : 
+ * @retval      
+ */
+static void stroke_ink(uint8_t t, uint16_t pts[][2], uint8_t n)
+{
+    uint8_t i;
+
+    for (i = 0; i < n; i++)
     {
-        incy = 0;       /* ˮƽ */
+        canvas_clip(pts[i]);
+        TRACE_BEGIN(DRAW_LINE);
+        lcd_draw_bline_join(prevpos[t][0], prevpos[t][1], lastpos[t][0], lastpos[t][1], pts[i][0], pts[i][1], 10, POINT_COLOR_TBL[t]);
+        TRACE_END(DRAW_LINE);
+        ink_add(pts[i][0], pts[i][1], 10);
+        TRACE_BEGIN(PROCESS);
+        prep_add(lastpos[t][0], lastpos[t][1], pts[i][0], pts[i][1]);
+#if ONLINE_MODE
+        online_add(lastpos[t][0], lastpos[t][1], pts[i][0], pts[i][1]);
+#endif
+        TRACE_END(PROCESS);
+        prevpos[t][0] = lastpos[t][0];
+        prevpos[t][1] = lastpos[t][1];
+        lastpos[t][0] = pts[i][0];
+        lastpos[t][1] = pts[i][1];
     }
-    else
+}
+
+/**
+ * @brief       ʱī(ñɫػ), һζī
+ *   @note      ʱīصīҲᱻһ
+ * @param       t: 
+ * @retval      
+ */
+static void stroke_ghost_erase(uint8_t t)
+{
+    uint16_t (*g)[2] = g_ghost[t];
+
+    if (g[0][0] == 0xFFFF)
     {
-        incy = -1;
-        delta_y = -delta_y;
+        return;
     }
 
-    if ( delta_x > delta_y)
+    TRACE_BEGIN(DRAW_LINE);
+    lcd_draw_bline(g[0][0], g[0][1], g[1][0], g[1][1], 10, WHITE);
+    lcd_draw_bline_join(g[0][0], g[0][1], g[1][0], g[1][1], g[2][0], g[2][1], 10, WHITE);
+
+    if (prevpos[t][0] != 0xFFFF)
     {
-        distance = delta_x;  /* ѡȡ */
+        lcd_draw_bline(prevpos[t][0], prevpos[t][1], lastpos[t][0], lastpos[t][1], 10, POINT_COLOR_TBL[t]);
     }
     else
     {
-        distance = delta_y;
+        lcd_draw_bline(lastpos[t][0], lastpos[t][1], lastpos[t][0], lastpos[t][1], 10, POINT_COLOR_TBL[t]);
     }
 
-    for (t = 0; t <= distance + 1; t++)     /*  */
-    {
-        //lcd_draw_point((row-30)/12, (col-30)/12);    /*  */
-			aiInData[((col-72)/12)*28+(row-72)/12 ]=1;
-			lcd_draw_point((row-72)/12, (col-72)/12,BLACK);
-        xerr += delta_x;
-        yerr += delta_y;
-
-        if (xerr > distance)
-        {
-            xerr -= distance;
-            row += incx;
-        }
-
-        if (yerr > distance)
-        {
-            yerr -= distance;
-            col += incy;
-        }
-    }
+    TRACE_END(DRAW_LINE);
+    g[0][0] = 0xFFFF;
 }
 
-/* 10صɫ(ݴ) */
-const uint16_t POINT_COLOR_TBL[10] = {RED, GREEN, BLUE, BROWN, YELLOW, MAGENTA, CYAN, LIGHTBLUE, BRRED, GRAY};
+/**
+ * @brief       ʱī: ĩ -> ˲ -> Ԥʼ(ڻ), һʱ
+ * @param       t: 
+ * @retval      
+ */
+static void stroke_ghost_draw(uint8_t t)
+{
+    uint16_t (*g)[2] = g_ghost[t];
+
+    g[0][0] = lastpos[t][0];
+    g[0][1] = lastpos[t][1];
+    stroke_last(&g_stroke[t], &g[1][0], &g[1][1]);
+    stroke_predict(&g_stroke[t], STROKE_PREDICT_MS, &g[2][0], &g[2][1]);
+    canvas_clip(g[1]);
+    canvas_clip(g[2]);
+
+    TRACE_BEGIN(DRAW_LINE);
+    lcd_draw_bline_join(prevpos[t][0], prevpos[t][1], g[0][0], g[0][1], g[1][0], g[1][1], 10, POINT_COLOR_TBL[t]);
+    lcd_draw_bline_join(g[0][0], g[0][1], g[1][0], g[1][1], g[2][0], g[2][1], 10, POINT_COLOR_TBL[t]);
+    TRACE_END(DRAW_LINE);
+    ink_add(g[1][0], g[1][1], 10);
+    ink_add(g[2][0], g[2][1], 10);
+}
 
 /**
- * @brief       ݴԺ
- * @param       
+ * @brief       : ɨݴ, Ѱ/ɿĴ㷢
+ * @param       arg: δʹ
  * @retval      
  */
-void ctp_test(void)
+static void touch_task(void *arg)
 {
+    static uint8_t down = 0;    /* ϴΰµĴ */
+    touch_msg_t msg;
     uint8_t t = 0;
-    uint8_t i = 0;
-       /* һε */
     uint8_t maxp = 5;
 
+    UNUSED(arg);
+    msg.t0 = trace_now();
+    msg.reserved = 0;
+
+        TRACE_BEGIN(TOUCH_SCAN);
         tp_dev.scan(0);
+        TRACE_END(TOUCH_SCAN);
+        tprec_sample();         /* ̨ "tp rec" ʱ¼ɨ */
 
         for (t = 0; t < maxp; t++)
         {
+            msg.id = t;
+
             if ((tp_dev.sta) & (1 << t))
             {
-                if (tp_dev.x[t] > 72 &&tp_dev.x[t] < 336+72-1 && tp_dev.y[t] > 72&& tp_dev.y[t] < 336+72-1)  /* ĻΧ */
+                msg.x = tp_dev.x[t];
+                msg.y = tp_dev.y[t];
+                msg.down = 1;
+                down |= 1 << t;
+                sched_queue_put(&g_q_touch, &msg);
+            }
+            else if (down & (1 << t))
+            {
+                msg.down = 0;
+                down &= ~(1 << t);
+                sched_queue_put(&g_q_touch, &msg);
+            }
+        }
+}
+
+/**
+ * @brief       : ˲/ֵʻ, ʱī, ͼƬ, ֪ͨ
+ *   @note      ÿ: ϴεʱī, ζ, ٻµʱī( stroke.h)
+ * @param       arg: δʹ
+ * @retval      
+ */
+static void render_task(void *arg)
+{
+    uint16_t pts[STROKE_CURVE_MAX][2];
+    touch_msg_t msg;
+    uint8_t t, n;
+    uint8_t drawn = 0;
+    uint8_t ink = 0;
+    uint32_t t0 = 0;
+
+    UNUSED(arg);
+
+    while (g_clear_req == 0 && sched_queue_get(&g_q_touch, &msg) == 0)   /* ûʱȲ, Ϣڶ */
+    {
+        t = msg.id;
+
+        if (drawn == 0)
+        {
+            t0 = msg.t0;
+        }
+
+        if (msg.down == 0)
+        {
+            if (lastpos[t][0] != 0xFFFF)    /* ̧: Ԥ, һ */
+            {
+                stroke_ghost_erase(t);
+                n = stroke_end(&g_stroke[t], pts);
+                stroke_ink(t, pts, n);
+                drawn = 1;
+            }
+
+            lastpos[t][0] = 0xFFFF;
+            continue;
+        }
+
+                if (msg.x > PREP_X0 && msg.x < PREP_X0 + PREP_W - 1 && msg.y > PREP_Y0 && msg.y < PREP_Y0 + PREP_H - 1)  /* ڻ巶Χ */
                 {
                     if (lastpos[t][0] == 0xFFFF)
                     {
-                        lastpos[t][0] = tp_dev.x[t];
-                        lastpos[t][1] = tp_dev.y[t];
+                        stroke_begin(&g_stroke[t], msg.x, msg.y);
+                        lastpos[t][0] = msg.x;
+                        lastpos[t][1] = msg.y;
+                        prevpos[t][0] = 0xFFFF;     /* ±ʻ, ûһ */
+                        ink_add(msg.x, msg.y, 10);
+                        TRACE_BEGIN(PROCESS);
+                        prep_add(msg.x, msg.y, msg.x, msg.y);
+#if ONLINE_MODE
+                        online_add(msg.x, msg.y, msg.x, msg.y);
+#endif
+                        TRACE_END(PROCESS);
+                    }
+                    else
+                    {
+                        n = stroke_add(&g_stroke[t], msg.x, msg.y, (msg.t0 - g_stroke_t0[t]) / (SystemCoreClock / 1000000), pts);
+                        stroke_ghost_erase(t);
+                        stroke_ink(t, pts, n);
                     }
 
-                    lcd_draw_bline(lastpos[t][0], lastpos[t][1], tp_dev.x[t], tp_dev.y[t], 10, POINT_COLOR_TBL[t]); /*  */
-										process_data(lastpos[t][0],  lastpos[t][1],tp_dev.x[t],tp_dev.y[t]);
-                    lastpos[t][0] = tp_dev.x[t];
-                    lastpos[t][1] = tp_dev.y[t];
-										
-
-
+                    g_stroke_t0[t] = msg.t0;
+                    stroke_ghost_draw(t);
+                    drawn = 1;
                 }                    
-								if (tp_dev.x[t] > (lcddev.width - 24) && tp_dev.y[t] < 20)
+								if (msg.x > (lcddev.width - 24) && msg.y < 20 && g_ink.x0 != 0xFFFF)
                     {
-                        load_draw_dialog();/*  */
+                        g_clear_req = 1;    /* : ºϳī̫, ѭ */
+                        ink = 1;
                     }
-            }
-            else 
-            {
-                lastpos[t][0] = 0xFFFF;
-            }
-        }
+    }
+
+    if (drawn)
+    {
+        TRACE_TOUCH_AT(t0);     /* Ի˱ʻǴɨĿʼʱ, ʼһ¼ */
+    }
+
+    if (drawn || ink)
+    {
+        sched_queue_put(&g_q_ink, &drawn);
+    }
 
-    
 }
 
 void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim){
@@ -275,10 +797,28 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim){
 					//printf("LCD FPS:%d\r\n",fps);
 			//FPS=fps;
 					//fps=0;
-		 ctp_test();
+		 if (!gt9xxx_irq_on() || tprec_playing())		/* INTжϷʽʱINTͷ, طŹ켣ʱûINT */
+		 {
+			 sched_release(TASK_TOUCH);
+		 }
     }
 }
 
+/* INT */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+	if (GPIO_Pin == GT9XXX_INT_GPIO_PIN)
+	{
+		gt9xxx_exti_isr();
+	}
+}
+
+/* gt9xxx µһ֡(ж) */
+static void touch_notify(void)
+{
+	sched_release(TASK_TOUCH);
+}
+
 
 /* USER CODE END PFP */
 
@@ -296,6 +836,11 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim){
 int main(void)
 {
   /* USER CODE BEGIN 1 */
+  uint8_t ink = 0;
+  uint32_t boot_lcd;
+  cfg_lcd_t lcd_cfg = {0, 0, TP_CTRL_NONE};
+  uint8_t lcd_hint, tp_hint;
+  cfg_ui_t ui_cfg = {1, {0}};
 
   /* USER CODE END 1 */
 
@@ -317,17 +862,74 @@ int main(void)
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
+  MX_DMA_Init();
   MX_USART1_UART_Init();
   MX_FSMC_Init();
   MX_TIM2_Init();
   MX_CRC_Init();
   /* USER CODE BEGIN 2 */
-   lcd_init();  
+   log_init();
+   trace_init();
+   LOG_BIN(BOOT, SystemCoreClock, 0, 0, 0);
+   boot_mark(BOOT_START);
+	 cfg_load();				/* EEPROMһζ: ϴμ⵽LCD/IC, У׼Ҫ tp_dev.init ֮ǰ */
+	 boot_mark(BOOT_CFG);
+	 cfg_get(CFG_LCD, &lcd_cfg, sizeof(lcd_cfg));	/* ûм¼ʱ id Ϊ0, ˳̽ */
+	 lcd_hint = lcd_init_start_hint(lcd_cfg.id) ? (lcd_cfg.id ? BOOT_HINT_MISS : BOOT_HINT_NONE) : BOOT_HINT_HIT;	/* ֻһμ¼ID; Ĵʼʱ, мLCD޹صĳʼ */
+	 boot_mark(BOOT_LCD_ID);
+	 lcd_init_poll();
+	 LOG_BIN(CFG_LOAD, cfg_get_stats()->load_ok, cfg_get_stats()->load_us, cfg_get_stats()->load_bad, 0);
+	 tp_set_hint((lcd_hint == BOOT_HINT_HIT) ? lcd_cfg.tp : TP_CTRL_NONE);	/* ʱICļ¼Ҳ */
 	 tp_dev.init(); 
-	 HAL_TIM_Base_Start_IT(&htim2);
+	 tp_hint = BOOT_HINT_NONE;
+	 if (lcd_hint == BOOT_HINT_HIT && lcd_cfg.tp != TP_CTRL_NONE)
+	 {
+	   tp_hint = (tp_get_ctrl() == lcd_cfg.tp) ? BOOT_HINT_HIT : BOOT_HINT_MISS;
+	 }
+	 boot_hint(lcd_hint, tp_hint);
+	 boot_mark(BOOT_TP);
+	 lcd_init_poll();
 	 AI_Init();
-	 printf("LCD ID:%x\r\n", lcddev.id);
+	 boot_mark(BOOT_AI);
+	 lcd_init_poll();
+	 proto_init(AI_Infer);
+	 bench_init(activations);		/* ׼ü, ֻѭ */
+	 lcd_init_poll();
+	 memset(lastpos, 0xFF, sizeof(lastpos));	/* д㶼ɿ״̬ */
+	 memset(g_ghost, 0xFF, sizeof(g_ghost));
+	 sched_init();
+	 sched_queue_init(&g_q_touch, g_q_touch_buf, sizeof(touch_msg_t), 16, TASK_RENDER);
+	 sched_queue_init(&g_q_ink, g_q_ink_buf, 1, 4, TASK_INFER);
+	 sched_queue_init(&g_q_result, g_q_result_buf, sizeof(result_msg_t), 2, TASK_DISPLAY);
+	 sched_create(TASK_TOUCH, "touch", touch_task, NULL, gt9xxx_irq_on() ? 0 : 20, 5000, SCHED_EXT);	/* 5msɨ */
+	 sched_create(TASK_RENDER, "render", render_task, NULL, 0, 20000, 0);		/* һɨǰ */
+	 sched_create(TASK_LOG, "log", log_task, NULL, 10, 0, 0);
+	 sched_create(TASK_DISPLAY, "display", display_task, NULL, BAR_FRAME_MS, 0, 0);	/* ˢʲͼ */
+	 sched_create(TASK_INFER, "infer", infer_task, NULL, 20, 0, 0);		/* ڲѯ֡ */
+	 while (lcd_init_poll());
+	 boot_mark(BOOT_LCD_READY);
+	 boot_lcd = HAL_GetTick();
+	 fmap_init(network);		/* ʱڻ滭ͼ */
+	 cfg_get(CFG_UI, &ui_cfg, sizeof(ui_cfg));		/* ûм¼ʱĬֵ */
+	 fmap_enable(ui_cfg.fmap);
+	 dirty_init(WHITE);
+	 dirty_layer_add(dialog_paint);
+	 panel_init();
+	 bench_board_init(AI_Infer);
+	 gt9xxx_irq_start(touch_notify);		/* INTж, ѯʽֻͳӳ */
+	 HAL_TIM_Base_Start_IT(&htim2);
+	 sched_queue_put(&g_q_ink, &ink);		/* һ,  */
+	 LOG_BIN(LCD_ID, lcddev.id, 0, 0, 0);
 	load_draw_dialog();
+	 boot_mark(BOOT_FRAME);
+	 LOG_BIN(BOOT_TIME, boot_lcd, HAL_GetTick(), 0, 0);		/* Ӹλ(HAL_Init)һ֡ */
+	 if (lcd_cfg.id != lcddev.id || lcd_cfg.dir != lcddev.dir || lcd_cfg.tp != tp_get_ctrl())
+	 {
+	   lcd_cfg.id = lcddev.id;		/* д, һ֮֡дӰ쿪ʱ */
+	   lcd_cfg.dir = lcddev.dir;
+	   lcd_cfg.tp = tp_get_ctrl();
+	   cfg_set(CFG_LCD, &lcd_cfg, sizeof(lcd_cfg));
+	 }
 
 
 	// AI_Run(test_img, aiOutData);
@@ -393,7 +995,7 @@ int main(void)
 //            lcd_clear(BROWN);
 //            break;
 //        }
-AI_Run(aiInData, aiOutData);
+sched_run();	/* Эȼ, ͻPendSVռ */
 
 
 
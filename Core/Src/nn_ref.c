@@ -0,0 +1,690 @@
+/**
+ ****************************************************************************************************
+ * @file        nn_ref.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       дĲοʵ(C, Ӻܱ)
+ ****************************************************************************************************
+ * @attention
+ *
+ * Ȩֱȡ X-CUBE-AI  s_network_weights_array_u64, ƫƼ network.c 
+ * network_configure_weights(). ֻ׷Ϳֲ, ׷ٶ.
+ *
+ ****************************************************************************************************
+ */
+
+#include "math.h"
+#include "string.h"
+#include "nn_ref.h"
+#include "network_data.h"
+
+
+/* Ȩ s_network_weights_array_u64 еֽƫ */
+#define NN_W_CONV0          0
+#define NN_B_CONV0          576
+#define NN_W_CONV3          640
+#define NN_B_CONV3          19072
+#define NN_W_CONV6          19200
+#define NN_B_CONV6          92928
+#define NN_LUT_DENSE9       93184
+#define NN_W_DENSE9         94208
+#define NN_B_DENSE9         495616
+#define NN_W_DENSE11        496128
+#define NN_B_DENSE11        501248
+
+#define NN_WEIGHT(off)      ((const float *)((const uint8_t *)s_network_weights_array_u64 + (off)))
+#define NN_WEIGHT_U8(off)   ((const uint8_t *)s_network_weights_array_u64 + (off))
+
+/* Ϣ(˼Ӵ network_generate_report.txt һ) */
+const nn_layer_info_t g_nn_layer[NN_LAYER_NUM] =
+{
+    {"conv0",     784,   12544, 640,    112912},
+    {"relu1",     12544, 12544, 0,      12544},
+    {"pool2",     12544, 3136,  0,      12544},
+    {"conv3",     3136,  6272,  18560,  903200},
+    {"relu4",     6272,  6272,  0,      6272},
+    {"pool5",     6272,  1568,  0,      6272},
+    {"conv6",     1568,  3136,  73984,  903232},
+    {"relu7",     3136,  3136,  0,      3136},
+    {"flat8",     3136,  3136,  0,      1568},
+    {"dense9",    3136,  128,   402944, 401536},
+    {"relu10",    128,   128,   0,      128},
+    {"dense11",   128,   10,    5160,   1290},
+    {"softmax12", 10,    10,    0,      150},
+};
+
+/**
+ * @brief       3x3, 1, same(߽粹0)
+ * @param       in  : , HWC
+ * @param       h, w: (Ҳ)ĸߺͿ
+ * @param       cin : ͨ
+ * @param       wt  : Ȩ, [cout][kh][kw][cin]
+ * @param       bias: ƫ, [cout]
+ * @param       cout: ͨ
+ * @param       out : , HWC
+ * @retval      
+ */
+void nn_conv3x3_f32(const float *in, uint16_t h, uint16_t w, uint16_t cin,
+                    const float *wt, const float *bias, uint16_t cout, float *out)
+{
+    uint16_t y, x, oc, ic;
+    int16_t ky, kx, iy, ix;
+    const float *pin;
+    const float *pw;
+    float acc;
+
+    for (y = 0; y < h; y++)
+    {
+        for (x = 0; x < w; x++)
+        {
+            for (oc = 0; oc < cout; oc++)
+            {
+                acc = bias[oc];
+
+                for (ky = 0; ky < 3; ky++)
+                {
+                    iy = y + ky - 1;
+
+                    if (iy < 0 || iy >= h)
+                    {
+                        continue;
+                    }
+
+                    for (kx = 0; kx < 3; kx++)
+                    {
+                        ix = x + kx - 1;
+
+                        if (ix < 0 || ix >= w)
+                        {
+                            continue;
+                        }
+
+                        pin = in + ((uint32_t)iy * w + ix) * cin;
+                        pw = wt + (((uint32_t)oc * 3 + ky) * 3 + kx) * cin;
+
+                        for (ic = 0; ic < cin; ic++)
+                        {
+                            acc += pin[ic] * pw[ic];
+                        }
+                    }
+                }
+
+                *out++ = acc;
+            }
+        }
+    }
+}
+
+/**
+ * @brief       relu(ԭ)
+ * @param       x: 
+ * @param       n: Ԫ
+ * @retval      
+ */
+void nn_relu_f32(float *x, uint32_t n)
+{
+    while (n--)
+    {
+        if (*x < 0)
+        {
+            *x = 0;
+        }
+
+        x++;
+    }
+}
+
+/**
+ * @brief       2x2ػ, 2
+ *   @note      ±ǲڻҪ±,  out Ե in
+ * @param       in  : , HWC
+ * @param       h, w: ĸߺͿ(ż)
+ * @param       c   : ͨ
+ * @param       out : , HWC, (h/2)x(w/2)
+ * @retval      
+ */
+void nn_maxpool2_f32(const float *in, uint16_t h, uint16_t w, uint16_t c, float *out)
+{
+    uint16_t y, x, ch;
+    const float *p0;
+    const float *p1;
+    float m;
+
+    for (y = 0; y < h / 2; y++)
+    {
+        for (x = 0; x < w / 2; x++)
+        {
+            p0 = in + ((uint32_t)(2 * y) * w + 2 * x) * c;
+            p1 = p0 + (uint32_t)w * c;
+
+            for (ch = 0; ch < c; ch++)
+            {
+                m = p0[ch];
+                m = (p0[ch + c] > m) ? p0[ch + c] : m;
+                m = (p1[ch] > m) ? p1[ch] : m;
+                m = (p1[ch + c] > m) ? p1[ch + c] : m;
+                *out++ = m;
+            }
+        }
+    }
+}
+
+/**
+ * @brief       HWCתCHW(Flatten֮ǰת, out ܵ in)
+ * @param       in  : , HWC
+ * @param       h, w: ߺͿ
+ * @param       c   : ͨ
+ * @param       out : , CHW
+ * @retval      
+ */
+void nn_hwc2chw_f32(const float *in, uint16_t h, uint16_t w, uint16_t c, float *out)
+{
+    uint32_t hw = (uint32_t)h * w;
+    uint32_t i;
+    uint16_t ch;
+
+    for (i = 0; i < hw; i++)
+    {
+        for (ch = 0; ch < c; ch++)
+        {
+            out[ch * hw + i] = *in++;
+        }
+    }
+}
+
+/**
+ * @brief       ȫ
+ * @param       in  : 
+ * @param       nin : Ԫ
+ * @param       wt  : Ȩ, [nout][nin]
+ * @param       bias: ƫ
+ * @param       nout: Ԫ
+ * @param       out : (ܵ in)
+ * @retval      
+ */
+void nn_dense_f32(const float *in, uint16_t nin, const float *wt, const float *bias,
+                  uint16_t nout, float *out)
+{
+    uint16_t o, i;
+    float acc;
+
+    for (o = 0; o < nout; o++)
+    {
+        acc = bias[o];
+
+        for (i = 0; i < nin; i++)
+        {
+            acc += in[i] * wt[i];
+        }
+
+        wt += nin;
+        out[o] = acc;
+    }
+}
+
+/**
+ * @brief       ȫ, ȨΪ8λѹ(ÿȨ lut ±)
+ * @param       in  : 
+ * @param       nin : Ԫ
+ * @param       idx : Ȩ±, [nout][nin]
+ * @param       lut : 256뱾
+ * @param       bias: ƫ
+ * @param       nout: Ԫ
+ * @param       out : (ܵ in)
+ * @retval      
+ */
+void nn_dense_lut8(const float *in, uint16_t nin, const uint8_t *idx, const float *lut,
+                   const float *bias, uint16_t nout, float *out)
+{
+    uint16_t o, i;
+    float acc;
+
+    for (o = 0; o < nout; o++)
+    {
+        acc = bias[o];
+
+        for (i = 0; i < nin; i++)
+        {
+            acc += in[i] * lut[idx[i]];
+        }
+
+        idx += nin;
+        out[o] = acc;
+    }
+}
+
+/**
+ * @brief       softmax(ԭ)
+ * @param       x: 
+ * @param       n: Ԫ
+ * @retval      
+ */
+void nn_softmax_f32(float *x, uint16_t n)
+{
+    float max = x[0];
+    float sum = 0;
+    uint16_t i;
+
+    for (i = 1; i < n; i++)
+    {
+        max = (x[i] > max) ? x[i] : max;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        x[i] = expf(x[i] - max);
+        sum += x[i];
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        x[i] /= sum;
+    }
+}
+
+/**
+ * @brief       еһ(ʹʵȨ)
+ * @param       layer: , NN_L_xxx
+ * @param       in   : , Ԫ g_nn_layer[layer].in_num
+ * @param       out  : , Ԫ g_nn_layer[layer].out_num. relu/softmax/pool Ե in
+ * @retval      
+ */
+void nn_ref_layer(uint8_t layer, const float *in, float *out)
+{
+    const nn_layer_info_t *info = &g_nn_layer[layer];
+
+    switch (layer)
+    {
+        case NN_L_CONV0:
+            nn_conv3x3_f32(in, 28, 28, 1, NN_WEIGHT(NN_W_CONV0), NN_WEIGHT(NN_B_CONV0), 16, out);
+            break;
+
+        case NN_L_POOL2:
+            nn_maxpool2_f32(in, 28, 28, 16, out);
+            break;
+
+        case NN_L_CONV3:
+            nn_conv3x3_f32(in, 14, 14, 16, NN_WEIGHT(NN_W_CONV3), NN_WEIGHT(NN_B_CONV3), 32, out);
+            break;
+
+        case NN_L_POOL5:
+            nn_maxpool2_f32(in, 14, 14, 32, out);
+            break;
+
+        case NN_L_CONV6:
+            nn_conv3x3_f32(in, 7, 7, 32, NN_WEIGHT(NN_W_CONV6), NN_WEIGHT(NN_B_CONV6), 64, out);
+            break;
+
+        case NN_L_FLAT8:
+            nn_hwc2chw_f32(in, 7, 7, 64, out);
+            break;
+
+        case NN_L_DENSE9:
+            nn_dense_lut8(in, 3136, NN_WEIGHT_U8(NN_W_DENSE9), NN_WEIGHT(NN_LUT_DENSE9),
+                          NN_WEIGHT(NN_B_DENSE9), 128, out);
+            break;
+
+        case NN_L_DENSE11:
+            nn_dense_f32(in, 128, NN_WEIGHT(NN_W_DENSE11), NN_WEIGHT(NN_B_DENSE11), 10, out);
+            break;
+
+        case NN_L_RELU1:
+        case NN_L_RELU4:
+        case NN_L_RELU7:
+        case NN_L_RELU10:
+            if (out != in)
+            {
+                memcpy(out, in, info->in_num * sizeof(float));
+            }
+
+            nn_relu_f32(out, info->out_num);
+            break;
+
+        case NN_L_SOFTMAX12:
+            if (out != in)
+            {
+                memcpy(out, in, info->in_num * sizeof(float));
+            }
+
+            nn_softmax_f32(out, info->out_num);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief       һ
+ *   @note      scratch : [0, 12544) /ػ, 784ȫ,
+ *               NN_REF_SCRATCH ֽ, ϿֱӽX-CUBE-AIļ
+ * @param       in     : , 28x28
+ * @param       out    : , 10
+ * @param       scratch: ʱ,  NN_REF_SCRATCH ֽ, 4ֽڶ
+ * @retval      
+ */
+void nn_ref_run(const float *in, float *out, void *scratch)
+{
+    float *a = (float *)scratch;
+    float *b = a + 12544;
+
+    nn_ref_layer(NN_L_CONV0, in, a);
+    nn_ref_layer(NN_L_RELU1, a, a);
+    nn_ref_layer(NN_L_POOL2, a, a);
+    nn_ref_layer(NN_L_CONV3, a, a + 3136);
+    nn_ref_layer(NN_L_RELU4, a + 3136, a + 3136);
+    nn_ref_layer(NN_L_POOL5, a + 3136, a);
+    nn_ref_layer(NN_L_CONV6, a, a + 1568);
+    nn_ref_layer(NN_L_RELU7, a + 1568, a + 1568);
+    nn_ref_layer(NN_L_FLAT8, a + 1568, a + 4704);
+    nn_ref_layer(NN_L_DENSE9, a + 4704, b);
+    nn_ref_layer(NN_L_RELU10, b, b);
+    nn_ref_layer(NN_L_DENSE11, b, out);
+    nn_ref_layer(NN_L_SOFTMAX12, out, out);
+}
+
+/******************************************************************************************/
+/* : 28xW Ͼ/ػֻһ, ÿ NN_STRIP_STEP һ28x28ڽȫ */
+
+/* ʱ(±), 㰴ˮ, ֻҪõļ, ޹ */
+#define NN_S_IN             0                               /* л, 3 x 28 */
+#define NN_S_C0             (NN_S_IN + 3 * 28)              /* conv0 , 2 x 28x16 */
+#define NN_S_P2             (NN_S_C0 + 2 * 28 * 16)         /* pool2 л, 3 x 14x16 */
+#define NN_S_C3             (NN_S_P2 + 3 * 14 * 16)         /* conv3 , 2 x 14x32 */
+#define NN_S_P5             (NN_S_C3 + 2 * 14 * 32)         /* pool5 л, 3 x 7x32 */
+#define NN_S_F6             (NN_S_P5 + 3 * 7 * 32)          /* conv6 л, 7 x 7x64(һ) */
+#define NN_S_FLAT           (NN_S_F6 + 7 * 7 * 64)          /* һչƽ(CHW), 3136 */
+#define NN_S_D9             (NN_S_FLAT + 3136)              /* dense9 , 128 */
+#define NN_S_END            (NN_S_D9 + 128)
+
+typedef char nn_strip_scratch_check[(NN_S_END * sizeof(float) <= NN_STRIP_SCRATCH) ? 1 : -1];
+
+/* һ״̬ */
+typedef struct
+{
+    float *buf;                         /* ʱ */
+    uint16_t w;                         /* () */
+    const uint8_t *gate;                /* ÿǷȫ, NULL ʾ */
+    float (*out)[NN_OUT_NUM];           /* ÿڵĸ */
+} nn_strip_t;
+
+/**
+ * @brief       3x3һ(same) + relu
+ *   @note      ۼ˳ nn_conv3x3_f32 ͬ, 28ʱ nn_ref_run һ
+ * @param       col : С(ÿ h x cin), NULL ʾ(0)
+ * @param       h   : 
+ * @param       cin : ͨ
+ * @param       wt  : Ȩ, [cout][kh][kw][cin]
+ * @param       bias: ƫ, [cout]
+ * @param       cout: ͨ
+ * @param       out : һ, h x cout
+ * @retval      
+ */
+static void nn_conv3x3_col(const float *const *col, uint16_t h, uint16_t cin,
+                           const float *wt, const float *bias, uint16_t cout, float *out)
+{
+    uint16_t y, oc, ic;
+    int16_t ky, kx, iy;
+    const float *pin;
+    const float *pw;
+    float acc;
+
+    for (y = 0; y < h; y++)
+    {
+        for (oc = 0; oc < cout; oc++)
+        {
+            acc = bias[oc];
+
+            for (ky = 0; ky < 3; ky++)
+            {
+                iy = y + ky - 1;
+
+                if (iy < 0 || iy >= h)
+                {
+                    continue;
+                }
+
+                for (kx = 0; kx < 3; kx++)
+                {
+                    if (col[kx] == NULL)
+                    {
+                        continue;
+                    }
+
+                    pin = col[kx] + (uint32_t)iy * cin;
+                    pw = wt + (((uint32_t)oc * 3 + ky) * 3 + kx) * cin;
+
+                    for (ic = 0; ic < cin; ic++)
+                    {
+                        acc += pin[ic] * pw[ic];
+                    }
+                }
+            }
+
+            *out++ = (acc < 0) ? 0 : acc;
+        }
+    }
+}
+
+/**
+ * @brief       2x2ػһ:  -> һ
+ * @param       a, b: , ÿ h x c
+ * @param       h   : (ż)
+ * @param       c   : ͨ
+ * @param       out : һ, (h/2) x c
+ * @retval      
+ */
+static void nn_maxpool2_col(const float *a, const float *b, uint16_t h, uint16_t c, float *out)
+{
+    uint16_t y, ch;
+    float m;
+
+    for (y = 0; y < h / 2; y++)
+    {
+        for (ch = 0; ch < c; ch++)
+        {
+            m = a[ch];
+            m = (b[ch] > m) ? b[ch] : m;
+            m = (a[ch + c] > m) ? a[ch + c] : m;
+            m = (b[ch + c] > m) ? b[ch + c] : m;
+            *out++ = m;
+        }
+
+        a += 2 * c;
+        b += 2 * c;
+    }
+}
+
+/**
+ * @brief       kڵȫӲ:  conv6 лȡ7չƽ(CHW) -> dense9 -> relu -> dense11 -> softmax
+ * @param       s: ״̬
+ * @param       k: ( k*NN_STRIP_STEP )
+ * @retval      
+ */
+static void nn_strip_head(nn_strip_t *s, uint16_t k)
+{
+    float *flat = s->buf + NN_S_FLAT;
+    float *d9 = s->buf + NN_S_D9;
+    const float *col;
+    uint16_t x, y, c;
+
+    if (s->gate && s->gate[k] == 0)
+    {
+        memset(s->out[k], 0, sizeof(s->out[k]));
+        return;
+    }
+
+    for (x = 0; x < 7; x++)
+    {
+        col = s->buf + NN_S_F6 + ((k + x) % 7) * (7 * 64);
+
+        for (y = 0; y < 7; y++)
+        {
+            for (c = 0; c < 64; c++)
+            {
+                flat[c * 49 + y * 7 + x] = col[y * 64 + c];
+            }
+        }
+    }
+
+    nn_ref_layer(NN_L_DENSE9, flat, d9);
+    nn_ref_layer(NN_L_RELU10, d9, d9);
+    nn_ref_layer(NN_L_DENSE11, d9, s->out[k]);
+    nn_ref_layer(NN_L_SOFTMAX12, s->out[k], s->out[k]);
+}
+
+/**
+ * @brief       conv6 ĵe( pool5  e-1 ~ e+1 ), 7ʱһ
+ * @param       s: ״̬
+ * @param       e: 
+ * @retval      
+ */
+static void nn_strip_conv6(nn_strip_t *s, uint16_t e)
+{
+    const float *p5 = s->buf + NN_S_P5;
+    const float *col[3];
+    uint16_t n = s->w / 4;
+
+    col[0] = (e > 0) ? p5 + ((e - 1) % 3) * (7 * 32) : NULL;
+    col[1] = p5 + (e % 3) * (7 * 32);
+    col[2] = (e + 1 < n) ? p5 + ((e + 1) % 3) * (7 * 32) : NULL;
+    nn_conv3x3_col(col, 7, 32, NN_WEIGHT(NN_W_CONV6), NN_WEIGHT(NN_B_CONV6), 64,
+                   s->buf + NN_S_F6 + (e % 7) * (7 * 64));
+
+    if (e >= 6)
+    {
+        nn_strip_head(s, e - 6);
+    }
+}
+
+/**
+ * @brief       conv3 ĵx( pool2  x-1 ~ x+1 ), гػ pool5 һ
+ * @param       s: ״̬
+ * @param       x: 
+ * @retval      
+ */
+static void nn_strip_conv3(nn_strip_t *s, uint16_t x)
+{
+    const float *p2 = s->buf + NN_S_P2;
+    float *c3 = s->buf + NN_S_C3;
+    const float *col[3];
+    uint16_t n = s->w / 2, d;
+
+    col[0] = (x > 0) ? p2 + ((x - 1) % 3) * (14 * 16) : NULL;
+    col[1] = p2 + (x % 3) * (14 * 16);
+    col[2] = (x + 1 < n) ? p2 + ((x + 1) % 3) * (14 * 16) : NULL;
+    nn_conv3x3_col(col, 14, 16, NN_WEIGHT(NN_W_CONV3), NN_WEIGHT(NN_B_CONV3), 32, c3 + (x & 1) * (14 * 32));
+
+    if ((x & 1) == 0)
+    {
+        return;
+    }
+
+    d = x / 2;
+    nn_maxpool2_col(c3, c3 + 14 * 32, 14, 32, s->buf + NN_S_P5 + (d % 3) * (7 * 32));
+
+    if (d > 0)                          /* pool5 ұһ,  conv6 ǰһ */
+    {
+        nn_strip_conv6(s, d - 1);
+    }
+
+    if (d == s->w / 4 - 1)
+    {
+        nn_strip_conv6(s, d);
+    }
+}
+
+/**
+ * @brief       : /ػֻһ, Ȼÿ NN_STRIP_STEP һڽȫ
+ *   @note      γػͼһжӦ4, ڰ4ضʱػķ͵ͬ,
+ *               conv6 7. ֻڴڱ: ʱڴڱ
+ *              0, ϿԱʵ.
+ *              㰴ˮ(conv0  -> pool2 һ -> conv3 ...), ʱ޹.
+ * @param       in     : , 28 x wлҶ(0~255, )
+ * @param       w      : , NN_STRIP_STEP ı, С28
+ * @param       gate   : ÿǷȫ(1/0), NULL ʾ; Ĵڸȫ0
+ * @param       out    : ÿڵĸ,  w/4-6 
+ * @param       scratch: ʱ,  NN_STRIP_SCRATCH ֽ, 4ֽڶ
+ * @retval      (w/4-6), 0ʾ w 
+ */
+uint16_t nn_ref_strip(const uint8_t *in, uint16_t w, const uint8_t *gate, float (*out)[NN_OUT_NUM], void *scratch)
+{
+    nn_strip_t s;
+    float *ring = (float *)scratch + NN_S_IN;
+    float *c0 = (float *)scratch + NN_S_C0;
+    const float *col[3];
+    uint16_t x, y, c;
+
+    if (w < NN_IN_W || w % NN_STRIP_STEP)
+    {
+        return 0;
+    }
+
+    s.buf = (float *)scratch;
+    s.w = w;
+    s.gate = gate;
+    s.out = out;
+
+    for (x = 0; x < w; x++)
+    {
+        for (c = (x == 0) ? 0 : x + 1; c <= x + 1 && c < w; c++)   /* ת: Ҫұһ */
+        {
+            for (y = 0; y < NN_IN_H; y++)
+            {
+                ring[(c % 3) * NN_IN_H + y] = in[(uint32_t)y * w + c] * (1.0f / 255);
+            }
+        }
+
+        col[0] = (x > 0) ? ring + ((x - 1) % 3) * NN_IN_H : NULL;
+        col[1] = ring + (x % 3) * NN_IN_H;
+        col[2] = (x + 1 < w) ? ring + ((x + 1) % 3) * NN_IN_H : NULL;
+        nn_conv3x3_col(col, 28, 1, NN_WEIGHT(NN_W_CONV0), NN_WEIGHT(NN_B_CONV0), 16, c0 + (x & 1) * (28 * 16));
+
+        if ((x & 1) == 0)
+        {
+            continue;
+        }
+
+        c = x / 2;
+        nn_maxpool2_col(c0, c0 + 28 * 16, 28, 16, s.buf + NN_S_P2 + (c % 3) * (14 * 16));
+
+        if (c > 0)                      /* pool2 ұһ,  conv3 ǰһ */
+        {
+            nn_strip_conv3(&s, c - 1);
+        }
+
+        if (c == w / 2 - 1)
+        {
+            nn_strip_conv3(&s, c);
+        }
+    }
+
+    return w / NN_STRIP_STEP - 6;
+}
+
+/**
+ * @brief       ĳ˼Ӵ( g_nn_layer Ŀھ)
+ *   @note      /relu/ػ(ÿͿȳ), ȫӲְ˵Ĵ
+ * @param       w    : 
+ * @param       heads: ȫӵĴ
+ * @retval      ˼Ӵ
+ */
+uint32_t nn_ref_strip_macc(uint16_t w, uint16_t heads)
+{
+    uint32_t conv = 0, head = 0;
+    uint8_t i;
+
+    for (i = 0; i < NN_LAYER_NUM; i++)
+    {
+        if (i <= NN_L_RELU7)
+        {
+            conv += (g_nn_layer[i].macc * w + NN_IN_W / 2) / NN_IN_W;
+        }
+        else
+        {
+            head += g_nn_layer[i].macc;
+        }
+    }
+
+    return conv + head * heads;
+}
@@ -0,0 +1,219 @@
+/**
+ ****************************************************************************************************
+ * @file        online.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʶ: ʼ + GRU 
+ ****************************************************************************************************
+ * @attention
+ *
+ *  GRU Ķ online.h. ø(²ĵ߶м), ʼֻһ״̬,
+ * 㴥ͬʱдʱʻᱻ̧,  prep һһ.
+ * expf/tanhf ѵ(Host/online_train.c)õͬһ, ӺĽֻ.
+ *
+ ****************************************************************************************************
+ */
+
+#include "online.h"
+#include "string.h"
+#include "math.h"
+
+
+/* ʼ״̬ */
+typedef struct
+{
+    float x, y;                         /* һ */
+    float rem;                          /* رʼһ㻹Ļ */
+    uint16_t px, py;                    /* ʵλ(һεյ) */
+    uint16_t x0, y0, x1, y1;            /* дֵӿ */
+    uint16_t steps;                     /* GRU ߹Ĳ */
+    uint8_t down;                       /* 1, д(һ) */
+    uint8_t reserved;
+} online_pen_t;
+
+static online_pen_t g_online_pen;
+static float g_online_h[ONLINE_UNITS];                  /* GRU ״̬ */
+static float g_online_x[ONLINE_GATES];                  /*  */
+static float g_online_u[ONLINE_GATES];                  /* ѭ */
+static float g_online_f[ONLINE_FEAT_MAX][ONLINE_IN];    /* online_add  */
+
+/**
+ * @brief       ʼ GRU ״̬
+ * @param       
+ * @retval      
+ */
+void online_clear(void)
+{
+    memset(&g_online_pen, 0, sizeof(g_online_pen));
+    memset(g_online_h, 0, sizeof(g_online_h));
+}
+
+/**
+ * @brief       ӿһ
+ * @param       p: ʼ״̬
+ * @param       x, y: 
+ * @retval      
+ */
+static void online_bbox(online_pen_t *p, uint16_t x, uint16_t y)
+{
+    p->x0 = (x < p->x0) ? x : p->x0;
+    p->y0 = (y < p->y0) ? y : p->y0;
+    p->x1 = (x > p->x1) ? x : p->x1;
+    p->y1 = (y > p->y1) ? y : p->y1;
+}
+
+/**
+ * @brief       һ߶, ֻ( GRU)
+ *   @note      㲻Ǳʵλʱһ̧ƶ;  ONLINE_FEAT_MAX Ĳ㶪
+ * @param       x1, y1: (ʱյͬ)
+ * @param       x2, y2: յ
+ * @param       f     : ,  ONLINE_FEAT_MAX 
+ * @retval      
+ */
+uint16_t online_feat(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, float (*f)[ONLINE_IN])
+{
+    online_pen_t *p = &g_online_pen;
+    float dx, dy, len, t = 0, s;
+    uint16_t n = 0;
+
+    if (p->down == 0)                   /* һʵʵ */
+    {
+        p->down = 1;
+        p->x = x1;
+        p->y = y1;
+        p->rem = ONLINE_STEP;
+        p->x0 = p->x1 = x1;
+        p->y0 = p->y1 = y1;
+    }
+    else if (x1 != p->px || y1 != p->py)    /* ̧ƶµһ */
+    {
+        s = (p->x1 - p->x0 > p->y1 - p->y0) ? p->x1 - p->x0 : p->y1 - p->y0;
+        s = (s < ONLINE_STEP) ? ONLINE_STEP : s;
+        f[n][0] = (x1 - p->x) / s;
+        f[n][1] = (y1 - p->y) / s;
+        f[n][2] = 1;
+        n++;
+        p->x = x1;
+        p->y = y1;
+        p->rem = ONLINE_STEP;
+    }
+
+    online_bbox(p, x1, y1);
+    online_bbox(p, x2, y2);
+    p->px = x2;
+    p->py = y2;
+
+    dx = (float)x2 - x1;
+    dy = (float)y2 - y1;
+    len = sqrtf(dx * dx + dy * dy);
+
+    while (len - t >= p->rem && n < ONLINE_FEAT_MAX)    /* ߶ÿ ONLINE_STEP һ */
+    {
+        t += p->rem;
+        s = t / len;
+        f[n][0] = (x1 + dx * s - p->x) * (1.0f / ONLINE_STEP);
+        f[n][1] = (y1 + dy * s - p->y) * (1.0f / ONLINE_STEP);
+        f[n][2] = 0;
+        p->x += f[n][0] * ONLINE_STEP;
+        p->y += f[n][1] * ONLINE_STEP;
+        p->rem = ONLINE_STEP;
+        n++;
+    }
+
+    p->rem -= len - t;
+    p->rem = (p->rem < 0) ? 0 : p->rem; /* ʱ */
+    return n;
+}
+
+/**
+ * @brief       sigmoid
+ * @param       x: 
+ * @retval      1 / (1 + e^-x)
+ */
+static float online_sigmoid(float x)
+{
+    return 1.0f / (1.0f + expf(-x));
+}
+
+/**
+ * @brief       GRU һ
+ * @param       f: , ONLINE_IN 
+ * @retval      
+ */
+void online_step(const float *f)
+{
+    const float *w;
+    float *g = g_online_x, *u = g_online_u, *h = g_online_h;
+    float v, z, r;
+    uint16_t i, j;
+
+    memcpy(g, g_online_bias, sizeof(g_online_x));
+    memcpy(u, g_online_bias + ONLINE_GATES, sizeof(g_online_u));
+
+    for (i = 0, w = g_online_kernel; i < ONLINE_IN; i++, w += ONLINE_GATES)
+    {
+        v = f[i];
+
+        if (v != 0)                     /* дʱ pen 0 */
+        {
+            for (j = 0; j < ONLINE_GATES; j++)
+            {
+                g[j] += v * w[j];
+            }
+        }
+    }
+
+    for (i = 0, w = g_online_recurrent; i < ONLINE_UNITS; i++, w += ONLINE_GATES)
+    {
+        v = h[i];
+
+        for (j = 0; j < ONLINE_GATES; j++)
+        {
+            u[j] += v * w[j];
+        }
+    }
+
+    for (j = 0; j < ONLINE_UNITS; j++)
+    {
+        z = online_sigmoid(g[j] + u[j]);
+        r = online_sigmoid(g[ONLINE_UNITS + j] + u[ONLINE_UNITS + j]);
+        v = tanhf(g[2 * ONLINE_UNITS + j] + r * u[2 * ONLINE_UNITS + j]);
+        h[j] = z * h[j] + (1.0f - z) * v;
+    }
+
+    g_online_pen.steps++;
+}
+
+/**
+ * @brief       һζ߶: , ÿһ GRU
+ * @param       x1, y1: (ʱյͬ)
+ * @param       x2, y2: յ
+ * @retval      
+ */
+void online_add(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    uint16_t i, n = online_feat(x1, y1, x2, y2, g_online_f);
+
+    for (i = 0; i < n; i++)
+    {
+        online_step(g_online_f[i]);
+    }
+}
+
+/**
+ * @brief       ǰʼ10(ֻ, ʱԵ)
+ * @param       prob: , NN_OUT_NUM ; û߹ GRU ʱȫΪ0
+ * @retval      GRU ߹Ĳ
+ */
+uint16_t online_result(float *prob)
+{
+    if (g_online_pen.steps == 0)
+    {
+        memset(prob, 0, NN_OUT_NUM * sizeof(float));
+        return 0;
+    }
+
+    nn_dense_f32(g_online_h, ONLINE_UNITS, g_online_dense, g_online_dense_bias, NN_OUT_NUM, prob);
+    nn_softmax_f32(prob, NN_OUT_NUM);
+    return g_online_pen.steps;
+}
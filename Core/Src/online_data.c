@@ -0,0 +1,524 @@
+/**
+ ****************************************************************************************************
+ * @file        online_data.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʶ GRU Ȩ(Host/online_train.c , Ҫָ)
+ ****************************************************************************************************
+ * @attention
+ *
+ * 32 Ԫ, 3000  x 32 , ֤(2000 )ʶ 99.95%.
+ *
+ ****************************************************************************************************
+ */
+
+#include "online.h"
+
+
+typedef char online_data_check[(ONLINE_UNITS == 32 && ONLINE_IN == 3) ? 1 : -1];   /*  online.h һ */
+
+const float g_online_kernel[ONLINE_IN * ONLINE_GATES] =
+{
+    0.040379636, 0.592310488, 0.523859084, -0.195731387, -0.126135454, 0.25504604, 0.0792408437, 0.918955743,
+    0.430334061, 0.334606141, 0.132794082, 0.170178294, 0.174802512, -0.489049673, -0.0859517828, -0.0899548531,
+    0.189559102, 0.442585915, 0.226198778, 0.169958815, 0.554250181, -0.543139279, -0.389039189, -0.0184075013,
+    0.115652069, -0.254944593, -0.0209223796, -0.0706255585, 0.791373491, -0.507903814, 0.305925757, 0.749868929,
+    0.535852313, 0.426450133, 0.31651032, -0.159575537, -0.114542104, 0.796769321, -0.0752885714, 0.184155643,
+    -0.111553952, 0.470474899, -0.350809634, -0.0937540904, -0.287161767, -0.127970979, -0.121418804, 0.043833416,
+    0.275552064, 0.635810852, 0.344272017, -0.194413617, -0.147381976, 0.100576721, 0.408635497, 0.0957583487,
+    -0.519517541, -0.383249134, -0.428506017, -0.230965331, -0.00186295388, 0.294358641, 0.650191069, 0.121996127,
+    -0.74014461, 0.366280228, 0.258094341, 0.31790933, -0.297407001, 0.0838933587, 0.20151341, -0.385163963,
+    -0.460760027, 0.826371372, 0.662336707, 0.5491274, -0.198827624, 0.311831176, 0.520831645, 0.235995844,
+    0.0690877661, -0.720641851, 0.254200935, 0.563576519, 0.60662359, -0.312583238, -0.344321996, 0.78432858,
+    -0.392256171, -0.0749686435, 0.759595871, 0.572251499, 0.670376956, 0.486570418, -0.335072011, 0.590615571,
+    0.435982943, -0.409018368, 0.500879645, 0.477673948, 0.188941553, -0.00476670125, -0.126949117, 0.0133976694,
+    -0.750436246, 0.211747169, 0.0458742753, 0.331535935, -0.428170711, 0.518822372, 0.178801939, -0.126213953,
+    0.0424906872, -0.763874352, -0.446854353, -0.820416808, -0.355579495, 0.0986500978, -0.129028857, 0.0122847222,
+    -0.286513656, -0.618596315, -0.0902409181, 0.364184707, 0.385345936, 0.0527169891, 0.332542807, -0.76381135,
+    0.314935356, 0.343832642, -0.00222589285, 0.150012538, 0.614390016, -0.0226875879, 0.122665577, 0.131954089,
+    0.329934567, 0.0290635414, -0.529157043, 0.0339473486, -0.41970557, 0.0268754214, -0.512848258, -0.134877205,
+    -0.467333585, -0.047924906, -0.0155893089, 0.223360598, 0.289636821, 0.422612935, -0.469045281, 0.571629703,
+    -0.29384926, 0.380220443, 0.152545601, -0.321986616, -0.439112008, -0.284681261, -0.269903451, 0.323272586,
+    0.183026597, 0.562747121, -0.554752111, -0.540886223, 0.595250666, -0.607092977, 0.527764976, -0.674456418,
+    0.633924425, -0.562292397, 0.137359783, -0.450791359, -0.653835833, 0.507835031, 0.250179201, -0.479200721,
+    -0.325201899, -0.436364383, 0.894643724, 0.386102021, -0.253998905, 0.150156647, 0.202137485, -0.285502642,
+    -0.151406586, -0.551841438, 0.166435778, 0.524678349, -0.41080609, 0.378786892, 0.511143446, 0.632716775,
+    0.122012869, 0.0634708628, -0.228742942, 0.122009702, 0.16407533, 0.209440947, 0.183786109, 0.162991628,
+    0.236057058, 0.120044343, 0.198603868, 0.238106087, 0.0821662024, -0.00134981214, -0.165450722, 0.162486598,
+    0.191505134, -0.208273426, 0.0737106279, -0.124054506, 0.0637513995, -0.133363739, 0.098778449, -0.0901683941,
+    -0.0843043625, -0.132235736, -0.209668651, 0.0655202195, -0.13606219, 0.0744122937, 0.00526140863, 0.232133672,
+    -0.108299829, 0.022701459, 0.107960388, -0.1904075, -0.0140405893, 0.0455635078, 0.218767121, -0.0241665244,
+    -0.0805751383, 0.171187997, -0.0322434269, -0.244591936, -0.0763448179, 0.0484888405, 0.164077669, -0.131022677,
+    0.0863984004, -0.00839470234, -0.00889418647, -0.0960331857, 0.104424551, -0.156298727, 0.0599814132, -0.226062804,
+    -0.0423514806, 0.096495755, 0.0856404155, 0.0677693263, -0.0752749443, -0.155281171, 0.053720016, 0.0626082197,
+    0.113603279, -0.0845025927, 0.118383713, -0.146620303, 0.207243919, 0.090967834, 0.0753961653, -0.119514219,
+    0.0159728322, -0.203030258, -0.117923163, 0.185811013, 0.0916415825, -0.200028494, -0.191394657, -0.0681430027,
+    0.0377597995, 0.0458941497, 0.0820067972, -0.103998639, 0.135778412, -0.104194783, -0.0838784426, -0.152756065,
+    0.238483965, -0.24442102, 0.161196262, -0.082973972, -0.153519198, -0.0312667191, 0.225817233, 0.206267074,
+};
+
+const float g_online_recurrent[ONLINE_UNITS * ONLINE_GATES] =
+{
+    0.0935734808, -0.244202599, -0.289178938, 0.765365124, 0.517204881, 0.320900142, 0.130638435, 0.0560418926,
+    -0.616911173, -0.788020909, 0.0293652676, 0.183679819, -0.15877299, 0.620576382, 0.964706779, 0.65525949,
+    -0.159997702, -0.318871886, -0.722435355, -0.0179544315, -0.275042444, 0.751941621, 0.150496081, 0.836139679,
+    -0.421595067, 0.201018021, -0.568997443, -0.156777248, -0.253028929, 0.078301087, -0.0978961661, -0.634066343,
+    0.179877117, -0.00984591246, -0.311967999, -0.205571219, -0.0955381244, -0.216825396, 0.12801601, -0.10713762,
+    0.35954994, 0.306309581, 0.0394406356, -0.0140250679, 0.262291789, 0.00421555294, -0.0103066275, -0.104950711,
+    -0.0725313202, 0.189066142, -0.173958078, -0.0783031061, -0.115890115, -0.225170597, -0.253617823, 0.110338219,
+    0.159961045, -0.0751702115, 0.0416604057, 0.00439822441, 0.0139474189, 0.0927948728, -0.0456878431, 0.299210697,
+    0.625735641, 0.139461011, -0.246468022, -0.0877512619, 0.103581205, -0.00042294545, -0.246048987, 0.116814978,
+    0.19182454, 0.010823166, -0.13288343, -0.0824280605, -0.202465862, -0.275784045, 0.0724300668, 0.0662356466,
+    0.75586623, 0.0437868759, 0.205579579, -0.53338778, -0.0424129516, -0.129145503, -0.225347891, -0.063412711,
+    0.0878185928, 0.500139594, 0.126291305, 0.039045509, -0.43306005, -0.401664108, 0.450781196, -0.149713114,
+    -0.14361687, -0.163792908, 0.32618767, 0.14157781, -0.167901188, 0.132584915, -0.300419033, 0.391262472,
+    -0.10647855, -0.0207543653, -0.482373893, -0.160169929, -0.64272064, 0.473013759, 0.239169776, 0.0319382139,
+    -0.268917978, -0.0615684651, 0.155990362, 0.124387696, -0.0120857684, 0.217665717, -0.415337354, 0.315052658,
+    0.174050242, -0.196105987, -0.358608067, -0.541549981, 0.139157146, -0.172552034, 0.406158894, -0.175519392,
+    -0.0501532853, -0.240822911, 0.326777011, -0.143364161, 0.0864071548, -0.0142746447, 0.173665434, -0.105494395,
+    0.140905008, 0.513724327, -0.202932358, 0.168793231, 0.109982423, -0.241969913, 0.085148111, -0.223748401,
+    -0.0697865859, 0.114788532, -0.258194864, -0.270434946, 0.0296956263, 0.188686058, -0.274610847, 0.435932547,
+    0.263835043, 0.230681762, 0.147439167, -0.0275935922, -0.0419557802, -0.0861692429, -0.134433746, -0.00649803923,
+    0.036727123, 0.0314882845, 0.00914999284, -0.18642436, -0.0203965064, 0.132734001, 0.0553660356, 0.197031125,
+    -0.316374719, -0.053872101, -0.0632744208, 0.0115153529, 0.109696515, 0.275235862, 0.426732957, -0.0867304504,
+    0.214759767, -0.254937232, 0.154102102, 0.17267932, 0.00811872724, -0.261128515, 0.0177647378, -0.0150531018,
+    -0.319573849, 0.205587372, 0.14222087, 0.100493118, -0.296444446, -0.400720626, -0.136371076, 0.108745322,
+    -0.185354531, 0.482124805, -0.163700625, -0.506486833, -0.317690164, -0.402300745, 0.243486747, -0.303439647,
+    0.792481542, 0.0702165887, 0.0274333116, 0.0393391028, 0.555756569, -0.22415933, -0.332012534, -0.158774838,
+    0.2554048, 0.241500989, 0.0515411794, 0.0591381453, 0.269066334, -0.247855023, 0.349357605, -0.547108054,
+    -0.0471730009, -0.0489358939, 0.694101036, 0.326331437, -0.0147411283, 0.397755504, -0.344397962, 0.668463528,
+    -0.167005107, 0.216217577, -0.0693978742, 0.146246985, 0.0807507858, 0.0848187283, -0.241215676, -0.121550612,
+    -0.395738542, 0.240088284, 0.331926525, -0.102569774, -0.134678617, 0.0215584878, 0.0971204937, 0.357059509,
+    0.155078799, -0.178814918, -0.244686186, 0.213683769, -0.203868076, -0.0705410466, 0.116378918, -0.0325997397,
+    -0.114956677, 0.0099324435, -0.291523188, -0.00507841399, -0.105763175, -0.0446420833, -0.0276325233, -0.46321398,
+    -0.0486203507, -0.419968575, 0.219863772, 0.0239928998, 0.199426904, -0.048142083, -0.24032706, -0.0474872291,
+    0.0239040852, -0.284182757, 0.166657805, -0.0384699851, -0.00227910047, -0.00715572853, -0.663631558, -0.0708463639,
+    -0.555554569, 0.220158935, -0.347901195, 0.0677398965, -0.0590928271, 0.59251523, 0.173079312, -0.203825623,
+    0.206356972, 0.0243922453, -0.321732849, -0.24682568, 0.20551087, 0.16130206, -0.398788333, -0.229481772,
+    0.466938704, 0.417833805, 0.0484082885, 0.0661686957, 0.210281536, -0.128785118, 0.708034694, 0.415488154,
+    0.301556587, 0.47918281, -0.0508847609, 0.251757294, 0.284372538, -0.442867786, -0.14277029, -0.0181016903,
+    0.319082916, 0.7706846, 0.106431507, 0.156579137, 0.413084686, -0.465314329, 0.326761127, -0.0494568013,
+    0.298686206, 0.486369759, 0.516900897, 0.233520985, 0.164029881, 0.0362102315, -0.211468711, 0.462621391,
+    -0.350068271, 0.0202522334, -0.0738619938, 0.233423397, -0.319728106, -0.0761416331, -0.081243746, -0.447947443,
+    -0.422753185, -0.206064567, 0.0761317536, 0.109722018, -0.0603214502, -0.127405018, 0.191784978, 0.196891174,
+    -0.0868156925, -0.283536434, -0.046225965, 0.124034815, -0.396675766, 0.275359511, -0.107164517, 0.0569462553,
+    0.0289529469, -0.253652483, -0.315794051, 0.0467184745, -0.240276009, 0.0257024281, -0.289997876, -0.224015906,
+    -0.635421038, -0.368180037, 0.372069508, 0.401731193, 0.16203095, 0.0662028939, 0.0366215408, -0.374122381,
+    0.185535416, -0.109112881, 0.351899981, 0.187381446, 0.0984801725, 0.0225241054, -0.255167574, 0.0500879139,
+    -0.647661388, -0.204462498, -0.330426425, 0.0274212938, -0.225573808, 0.111092784, 0.339627832, -0.0942423791,
+    -0.153476685, -0.556180835, 0.074253343, 0.0884398594, 0.579447925, 0.0101958765, -0.448377579, -0.0946476236,
+    -0.140231997, -0.120547272, -0.0581830963, -0.161033437, -0.192570224, -0.069364123, -0.343090773, -0.163224846,
+    -0.305519879, -0.21883747, 0.521942317, -0.0908922032, -0.249114946, 0.460214287, 0.355829388, -0.112139054,
+    -0.651734531, 0.315964818, -0.163711533, 0.230493858, 0.138080314, 0.801401675, -0.240238994, -0.350117236,
+    0.175217152, 0.319426656, -0.211339623, -0.527660787, -0.0672284737, 0.202750474, 0.221816808, -0.28602621,
+    0.14475517, -0.122521937, 0.104522318, -0.283172488, -0.0886697024, -0.0542169102, 0.00861856993, -0.190264314,
+    0.161321163, -0.24645184, 0.157470271, 0.0218963847, -0.128947899, -0.0069210995, -0.624420345, -0.312954336,
+    -0.166628525, 0.049238231, -0.159580737, 0.0403179713, 0.194858372, -0.116914243, -0.0514022633, 0.30858773,
+    0.294880807, -0.125800014, -0.140553772, 0.0472002476, 0.21949856, -0.375903487, 0.320084244, 0.230034232,
+    -0.0669483095, 0.148745373, -0.14408125, -0.299824834, 0.431964099, -0.135449409, 0.14762114, 0.112206899,
+    -0.13926293, -0.218582585, -0.160827488, 0.0720598996, -0.312488288, 0.299684793, -0.243334919, -0.0757983401,
+    -0.0640136153, 0.163091943, -0.246853992, 0.160813868, -0.0542984605, 0.00367156579, 0.0176562555, -0.362837195,
+    -0.376475245, -0.0749676302, -0.0487209782, 0.211233318, 0.046434857, 0.290384322, 0.464700639, 0.0966110528,
+    -0.323990345, 0.427231252, -0.347840875, -0.659140766, -0.601635993, -0.0848108754, 0.0707817003, -0.361568928,
+    0.431526005, 0.345908791, -0.682498753, -0.304962158, -0.0158371944, -0.435152233, -0.111583993, 0.161164835,
+    0.0703672692, -0.347582281, 0.674630344, -0.40428102, -0.0354849063, 0.0141225494, -0.262545526, -0.803601325,
+    -0.013035506, 0.354508907, -0.163059056, -0.261609554, 0.179279238, -0.0510589406, 0.916176677, 0.107856438,
+    -0.190007344, -0.339967698, 0.361499548, -0.380165279, 0.263813227, 0.0190336835, -0.0823824033, -0.578276157,
+    -0.804978609, 0.335354865, -0.0461991169, 0.403964341, 0.33840555, 0.0145743024, 0.736116469, 0.456027925,
+    -0.072551012, -0.626660824, -0.373010635, -0.466866881, -0.0625903532, 0.0492888838, 0.24880594, 0.0123409852,
+    -0.530854285, -0.369037002, 0.0144042233, 0.0994429439, -0.0702548772, 0.13844727, -0.0402328148, -0.606685817,
+    -0.0186258014, -0.16324681, -0.15334709, 0.50159961, 0.0987992957, 0.424825132, -0.328328907, 0.00430042576,
+    -0.191493422, -0.54552269, -0.0646898001, -0.176558658, 0.298147917, -0.0895045251, -0.609820068, 0.212887898,
+    -0.143439859, 0.116456673, -0.387349427, 0.251650959, 0.143286884, 0.476866871, 0.232048422, 0.138418525,
+    -0.0530202277, -0.560233235, -0.0107451119, -0.654031277, 0.0759240016, -0.209263131, -0.601292968, -0.0876128599,
+    0.0505958833, 0.263932437, 0.130242243, 0.0581488274, -0.0910158753, 0.0658155307, -0.0517946519, 0.159284011,
+    0.226420835, 0.0711212754, -0.195977867, -0.259447873, -0.255207807, 0.308354616, 0.0457666405, 0.194964394,
+    -0.00799559616, 0.328845143, 0.162720442, 0.166385964, -0.0877206475, 0.269471258, -0.3228167, 0.00973181892,
+    0.250356317, -0.340264976, -0.124231316, -0.293973833, -0.212918848, -0.471192002, 0.251044095, -0.0509175174,
+    0.260035813, 0.0893516093, -0.0175367463, 0.219630912, -0.117770635, 0.133624703, 0.171468005, -0.080073528,
+    0.307073414, 0.0940984339, -0.228649125, -0.207174391, 0.0752794147, 0.277587503, -0.245600849, -0.436258107,
+    -0.0640191957, 0.235773206, -0.259221911, -0.274094731, 0.308370233, 0.316353321, -0.0171401687, 0.18285571,
+    0.192545667, 0.29820025, 0.280272186, 0.0180611424, 0.130087271, -0.307462275, 0.123315088, 0.200132132,
+    0.0191651862, 0.269434452, -0.168079406, -0.419983685, 0.241988838, 0.0906107649, 0.217320055, 0.100581229,
+    -0.21078907, -0.33097291, 0.0872487873, -0.432567954, -0.140843809, 0.531422198, 0.313778937, -0.387958467,
+    0.0926418081, 0.12187808, -0.0774395019, 0.116675884, -0.103494376, -0.437959045, 0.215064704, -0.189167872,
+    -0.181013793, -0.138741091, 0.0371653028, 0.258122921, -0.1375788, 0.00312495418, -0.210206136, -0.0510158353,
+    -0.0696798861, 0.226714388, -0.0591500588, 0.0636694804, 0.0749088228, 0.298888952, -0.257531136, -0.165765494,
+    0.390107453, -0.751585245, -0.432761163, -0.284122258, -0.569644153, 0.192947805, 0.268424273, 0.107403018,
+    -0.573652148, 0.0400014482, -0.179306418, -0.106042147, 0.00971136708, 0.451989561, -0.460627526, 0.729335785,
+    -0.214888364, 0.324395299, -0.572568178, -0.658491611, -0.0843371227, -0.199124068, -0.0866143927, -0.254185706,
+    0.0758250132, -0.184188813, 0.223616362, -0.24952805, -0.0869064927, -0.246274725, 0.143884853, -0.14254275,
+    -0.0790926367, 0.62168318, 0.224485308, -0.0176246036, 0.360181183, -0.313848197, -0.15851213, -0.115451828,
+    0.192285806, -0.646450579, 0.197555095, -0.14082557, 0.218381658, 0.325921506, 0.0626591146, -0.222015351,
+    0.182085469, -0.122359395, -0.135804012, 0.614756405, 0.73467505, 0.412088007, 0.111620679, 0.121744551,
+    0.449848056, -0.188410074, -0.431588084, 0.0789697915, -0.097835578, 0.222217083, -0.172740385, 0.525290012,
+    0.354217291, -0.258243263, -0.154215559, 0.169050679, -0.182496935, -0.0703539699, -0.206711844, -0.158194453,
+    0.134710908, 0.381701857, -0.203755558, -0.358581543, -0.140530795, 0.378195971, 0.0207570828, -0.378038198,
+    -0.352355272, 0.404349059, 0.0137688527, 0.174686313, -0.40375936, -0.226889864, -0.141950116, -0.507865071,
+    0.543333054, -0.0837812349, -0.100629069, 0.175762504, 0.233882234, 0.102480531, 0.482443243, 0.0303233042,
+    0.107906193, -0.26486671, 0.825238287, 0.137532219, 0.159093678, 0.284203291, 0.0207376089, 0.100449599,
+    -0.0190296341, 0.0329985395, -0.0421248265, 0.110795267, 0.204608023, 0.0526207723, 0.265963584, 0.369580448,
+    0.237124383, 0.424006522, 0.312045068, 0.24988912, 0.134558186, -0.360718906, -0.465894818, 0.516472518,
+    -0.147002548, 0.137797698, 0.10145428, 0.0899186432, -0.185968146, -0.326386601, 0.33477357, 0.407271832,
+    0.377566963, -0.908895791, -0.0960706845, 0.0573157147, 0.00421853317, -0.0695116073, -0.251691341, 0.0120295789,
+    -0.108036458, 0.278004527, -0.0677773207, -0.117050551, 0.246802956, -0.378686965, -0.380958766, -0.519143164,
+    -0.0559435263, -0.190463245, -0.321847677, 0.620357096, -0.589324892, 0.0477136113, -0.287307292, 0.0863920227,
+    -0.175107136, 0.290103704, -0.0339087769, 0.0036427665, 0.0550963953, -0.844377697, 0.197956592, 0.299554944,
+    0.277570993, 0.295662075, 0.0537420958, 0.0217270628, -0.309139282, 0.0529485531, 0.295139998, -0.105170116,
+    -0.0742016435, 0.0127348248, -0.0508667864, -0.12534456, -0.24635528, -0.294490725, 0.0532896519, -0.0718596876,
+    -0.130878374, -0.330646932, -0.115472198, 0.408804595, 0.0231007338, 0.24476555, 0.126619905, 0.0463577658,
+    0.447135448, 0.850990891, 0.286369592, -0.281807214, -0.728706658, 0.816819429, 0.453617066, 0.207964212,
+    0.901747942, -0.0729183331, -0.0229668282, -0.2538459, 0.612693131, -0.94141829, -0.706039071, -0.844540596,
+    -0.00212969747, 0.181657001, 0.224643737, -0.0315112323, 0.130549103, -0.93282783, -0.30471307, -0.038905967,
+    0.391949087, -0.0172762834, 0.187248737, 0.0906829387, 0.171965763, -0.383988708, 0.144612163, 1.0036931,
+    -0.0523707569, -0.0396764502, 0.215024099, 0.280401647, -0.399959743, -0.231053844, -0.0445047617, 0.155657098,
+    -0.355467111, 0.380428433, -0.0957347155, 0.0434119329, -0.315600932, 0.179679468, -0.000668407069, 0.164447248,
+    0.34377709, -0.246113673, 0.332021952, 0.181433946, 0.0275919382, 0.0734365806, 0.554085195, -0.257681191,
+    -0.288176537, -0.104628026, -0.259272695, 0.0383431055, 0.284885317, 0.115926169, 0.352217793, -0.684072137,
+    0.0677613318, -0.368679106, 0.248600706, -0.22453633, -0.159267083, 0.0918951109, 0.00390409702, -0.0206069462,
+    0.397353768, 0.452203304, 0.413288325, 0.112226345, 0.0622638762, -0.29107666, -0.0292466115, 0.0101998579,
+    -0.186321661, -0.0971031934, -0.35324806, -0.00518553471, 0.210978016, 0.247672319, -0.0156849548, 0.0167294219,
+    0.0423722081, -0.455606103, -0.0793959275, 0.186269313, 0.512992024, 0.324332923, -0.468261808, 0.135357738,
+    0.23350969, 0.708937109, 0.340437859, -0.4681862, -0.692982495, 0.371184319, -0.0712669715, 0.473806262,
+    0.824969649, 0.142628312, -0.188760132, -0.134614155, -0.0567437448, -0.158523813, -0.282554656, -0.198971331,
+    0.318833143, 0.469296634, 0.468547314, -0.119576894, 0.220732525, -0.262746662, -0.206546307, -0.4716371,
+    0.26948747, -0.205439955, -0.00274863187, 0.177464157, 0.0425570868, -0.388094217, 0.216259301, -0.000878012448,
+    -0.144282699, 0.0470129587, -0.0681165233, -0.468359858, -0.0673862249, 0.125961229, -0.16410999, -0.385362566,
+    -0.147791103, 0.933430493, -0.292830557, -0.180447385, -0.295312434, -0.0334183276, -0.0295880511, -0.131357208,
+    -0.443467975, -0.773495793, -0.0308776293, 0.104274325, -0.0697528422, 0.0729132146, 0.00664678402, 0.272204041,
+    -0.515076995, 0.143113181, -0.0927605256, -0.118786596, 0.072145544, -0.0583565608, -0.139427498, -0.113344677,
+    0.0359169059, 0.278771192, 0.255038857, -0.0326261781, 0.223365724, 0.553182244, 0.401759088, -0.0271837655,
+    -0.288646907, 0.0395347178, 0.347737998, -0.0213384684, -0.338198602, 0.186888337, -0.160186544, -0.4890742,
+    -0.38599503, -0.102111742, -0.056136895, 0.336262375, -0.313209891, 0.0453247279, 0.529414535, -0.0467345379,
+    -0.0539761633, -0.238790676, 0.0552396066, 0.31506294, -0.0222328901, 0.056390103, -0.0823833942, 0.420871049,
+    0.0527107231, 0.258441091, -0.0293259174, -0.745578647, -0.240049556, 0.174827769, 0.167752787, -0.123437546,
+    0.0616450086, -0.0737141222, 0.173042133, -0.39874658, 0.35627231, -0.97195667, -0.717052758, -0.661658108,
+    0.392070234, -0.213364407, 0.354944944, -0.086083591, 0.0105411606, -0.89092499, 0.256028891, -0.235719383,
+    0.0996484831, -0.335844874, 0.404404134, 0.526757419, 0.222149059, -0.0561009422, -0.18062222, 0.0356517509,
+    0.165021688, 0.0980907679, -0.0250139125, 0.165686429, 0.126874641, -0.0619423762, 0.231666192, -0.0823101178,
+    -0.36226362, 0.185579106, 0.100770265, 0.135646597, -0.364816546, 0.323785305, 0.466631413, 0.379808426,
+    -0.0755897686, 0.101013146, 0.0401131287, 0.383812666, -0.514319777, -0.0454759449, 0.35980013, -0.10459432,
+    -0.396410465, -0.0455669984, -0.141818881, -0.0796968117, -0.303518325, 0.1012474, 0.0490098856, 0.0175890848,
+    0.0788649097, -0.194638625, 0.480205566, 0.119022921, -0.149833292, 0.144304603, -0.0126304422, -0.474314451,
+    0.100128286, 0.149692014, 0.0825633183, 0.224711135, -0.148692265, 0.0300227255, -0.422267258, 0.213933513,
+    0.0767686144, -0.267269582, 0.415617168, 0.107112177, 0.0299579762, 0.388210833, -0.101386413, 0.126049593,
+    0.185788304, 0.150966004, 0.439217418, 0.0100938128, 0.166244447, -0.111872941, -0.375086695, 0.0795643702,
+    0.292983234, 0.00470528845, -0.0353669152, -0.0651677623, 0.370729625, -0.107089125, 0.142015636, -0.0882489681,
+    -0.451338887, 0.064876236, -0.0429987349, -0.174160749, 0.686657846, -0.30165714, 0.0705606267, 0.134887174,
+    0.416087061, -0.117161691, 0.155301258, -0.158125997, -0.165725127, -0.357943088, -0.0418939218, -0.0452492796,
+    -0.305666149, 0.0662696436, 0.0738049001, 0.343898803, 0.142141521, 0.271931201, -0.0747707859, -0.0519399941,
+    -0.0949512273, -0.219594166, 0.156796798, -0.130568624, -0.207190767, -0.469916373, -0.020231396, 0.0305657238,
+    -0.449429184, -0.101772308, -0.044408109, 0.0827910751, 0.417038172, 0.398412377, 0.0983963013, 0.501356781,
+    0.0819471106, 0.167490706, 0.339095473, -0.00694712857, -0.0812084153, -0.137058288, 0.360574454, -0.211002201,
+    -0.0707965791, -0.509529889, 0.0615189895, -0.0395210534, 0.208150253, 0.130164847, -0.0637032911, -0.261982262,
+    0.13748309, -0.345067441, -0.0811464414, 0.2208592, -0.136316895, -0.0832429677, -0.21623145, 0.0796674863,
+    0.390747637, 0.197170183, -0.23581779, 0.20317784, 0.367653996, -0.473641932, 0.0513432175, 0.398641884,
+    0.196490586, 0.00596079836, -0.508441329, -0.088019833, 0.246234953, 0.276930004, -0.152651772, 0.0656772405,
+    0.303513587, -0.0586846508, 0.0591808893, -0.44981122, -0.0062837638, 0.184606537, -0.224564403, -0.286091626,
+    0.51009804, 0.163809076, 0.69819665, 0.566242039, -0.318309844, 0.469287306, -0.492509872, 0.063934207,
+    -0.122223899, 0.146134898, 0.0248527676, -0.074951686, -0.822746277, 0.000965098036, 0.00811548531, -0.00250803051,
+    0.0934683084, 0.00302513037, 0.253007293, 0.144521713, 0.318164319, 0.219516918, -0.706063926, 0.523705244,
+    0.554060459, 0.239524871, -0.693552613, -0.983799815, 0.602120876, 0.0559593253, 0.549405515, -0.0913140401,
+    0.494082391, -0.450897008, 0.401122153, -0.212077051, 0.227106586, -0.199915335, -0.00552259805, 0.303893417,
+    0.372925878, -0.0766553879, -0.0338018574, 0.220557511, 0.290332913, 0.230021492, -0.22914052, -0.325590938,
+    -0.615333855, -0.43211031, -0.250609756, -0.625521004, 0.431845754, 0.159650996, -0.0814135671, -0.0274718702,
+    0.0984738395, 0.237192839, -0.266734004, 0.0625886619, 0.228209227, -0.25697574, -0.0148338517, 0.0687414706,
+    0.258951187, 0.218712777, -0.124172069, -0.111457951, 0.159763351, 0.0861991793, 0.325252116, 0.533024013,
+    0.126495808, -0.322323054, -0.0588190481, -0.556989908, -0.00641851546, 0.466717571, 0.450076848, -0.0991585553,
+    -0.01864581, 0.378233045, -0.312915415, -0.152804345, -0.526353061, -0.412069738, -0.0108317938, -0.580590248,
+    0.0520000868, -0.40072751, -0.359934539, -0.057909593, -0.281195432, 0.152475804, -0.0383871123, -0.00464786822,
+    0.828532219, 0.0140897753, 0.885207951, 0.419665217, -0.0338571668, 0.5237059, -0.577416003, 0.113280959,
+    -0.42365101, 0.755353689, -0.235435456, -0.195877969, -0.497598767, 0.438863128, 0.182926804, -0.0824858695,
+    0.176512152, 0.307144821, 0.40279609, -0.0948050991, 0.552125275, 0.131095499, -0.415150076, 0.610931218,
+    0.566030264, 0.306768268, -0.507953942, -0.565130413, 0.88033396, -0.175205693, 0.754283726, 0.187796757,
+    0.381854504, -0.447811157, 0.0681791082, 0.28050819, 0.223996371, -0.619465947, 0.32167092, 0.301154763,
+    -0.503111124, -0.429719836, 0.082999602, 0.284257501, -0.0345533267, 0.0272809267, -0.151403397, -0.140679181,
+    -0.104588941, 0.126071632, 0.212006688, -0.490896046, 0.306534678, -0.2604132, 0.015942201, 0.116132095,
+    -0.197948068, 0.0585815385, 0.484494328, -0.0503594801, 0.105407596, 0.232892096, -0.0976073295, -0.187043622,
+    0.317735136, 0.272695303, -0.361097157, 0.225697994, -0.213681936, -0.106151015, -0.0381698161, 0.182637855,
+    -0.0876608938, 0.105826139, -0.226590887, -0.220295131, 0.169198856, 0.0920090154, 0.749028385, 0.0930528268,
+    0.313362867, -0.0373902135, 0.110460319, 0.0811208561, -0.0863845944, -0.680722058, -0.143951848, 0.235976681,
+    -0.645862401, -0.422762364, -0.24359329, -0.392948717, -0.10748066, -0.344803512, 0.153850943, -0.00974739157,
+    0.471399397, 0.381611019, 0.264549822, -0.0343925767, 0.330637097, 0.241532296, 0.2496095, 0.0268857032,
+    -0.501185775, 0.104904592, -0.165970534, 0.204238325, 0.185290724, -0.617863655, -0.268621475, 0.313983232,
+    0.302984506, 0.081887126, 0.392475009, 0.435642332, 1.10329604, -0.373325229, 0.275723785, 0.553880572,
+    0.252452493, 0.151333064, 0.398398578, 0.101554319, 0.576386094, 0.504604578, 0.287657499, 0.423245907,
+    -0.106022567, 0.0761293396, -0.0122987758, 0.276184648, 0.0707712322, -0.137403682, 0.0711864159, 0.0573041253,
+    -0.236126721, -0.048575379, 0.0488995723, 0.20661281, -7.65485674e-06, 0.194215521, 0.173840001, 0.144818008,
+    -0.11050646, -0.0141438181, -0.0605653748, 0.154598683, -0.260383934, 0.0760494769, -0.247468963, -0.170596823,
+    0.00275369687, -0.61427778, 0.0192646626, 0.000737574883, -0.0386697724, -0.0346972458, -0.523463428, -0.423040748,
+    0.122070022, -0.154313013, 0.401105762, 0.782152593, -0.374855697, -0.178709477, -0.515845001, -0.289452344,
+    -0.163691267, -0.0328091197, -0.176926583, 0.400378406, -0.101223789, -0.341053605, -0.0906379297, 0.743973374,
+    -0.217254609, 0.181598276, 0.140155166, -0.313720345, -0.0248271432, -0.0301579852, -0.0805878043, 0.0237725563,
+    0.387338579, 0.527854443, 0.168837845, -0.16900216, 0.551324546, -0.122614339, -0.470573097, -0.283878922,
+    -0.104831673, -0.0357687362, 0.106535427, 0.450023741, -0.111034855, 0.0166235026, -0.12375237, 0.200121701,
+    -0.51646471, 0.331433743, -0.821941435, -0.388890773, -0.137833118, -0.252729893, -0.0125859063, 0.0282046422,
+    0.274636775, -0.45261246, -0.110066198, -0.247808471, -0.376566201, 0.318100721, -0.466752082, 0.449839145,
+    0.192092493, 0.283319831, -0.357499927, -0.678837001, 0.0928840712, -0.345914334, 0.783923507, 0.0280580483,
+    0.154565588, -0.119344525, 0.156264201, 0.103643999, -0.00389728998, 0.15876098, 0.534908891, 0.669659555,
+    0.270834833, 0.301296562, -0.383863598, 0.237622127, 0.182436407, -0.0151368594, 0.442082614, 0.0119791739,
+    -0.0742270797, 0.32537365, 0.310750872, -0.0521177873, 0.139533132, -0.183595225, 0.0155671034, 0.119749777,
+    0.360460252, -0.17876929, 0.366463065, -0.0687333792, -0.279306829, 0.121566691, 0.202600315, 0.133828357,
+    0.0397945493, -0.0728023499, 0.0425801799, 0.561063945, -0.22364974, 0.184424266, -0.0330114029, 0.100278758,
+    0.541712344, 0.430832535, -0.116264358, 0.0171996597, -0.0432912782, 0.0157082006, -0.0304134376, 0.125906333,
+    0.295098096, -0.432180643, 0.00714310631, 0.0437838063, 0.121115252, 0.0460777171, -0.45026055, 0.0460388102,
+    -0.0896855444, 0.250713944, 0.0173969176, -0.0404489674, 0.0805911273, -0.502254963, 0.0567667894, -0.258035898,
+    0.0206603147, 0.13171944, -0.32275787, 0.198303282, 0.514231861, -0.131476119, 0.300036073, -0.514625371,
+    -0.205732748, -0.252008528, 0.434999824, 0.298058808, 0.391061455, -0.04149656, 0.560464501, 0.43948251,
+    -0.447271228, 0.248023078, -0.16357924, 0.0664028227, -0.00342951715, -0.0555210821, 0.273712158, 0.276562274,
+    -0.116045453, 0.337628424, 0.259059221, -0.086515151, -0.140595287, 0.442771822, -0.849671066, 0.209457472,
+    -0.167068169, -0.327766418, -0.284842193, 0.0205400717, -0.273579985, -0.280452639, -0.117581502, -0.487372786,
+    -0.30008927, -0.191628665, 0.266151965, 0.0451398045, -0.100060485, -0.489726245, -0.145500824, 0.0729659572,
+    0.0289956052, -0.15104644, 0.0695896447, 0.000850224285, 0.0944431797, -0.298293084, -0.248710483, -0.209900901,
+    0.118176132, -0.0893976167, 0.052955877, 0.157975405, 0.34141919, -0.213477373, -0.105636328, 0.191337988,
+    0.115545943, -0.282634318, -0.147076651, 0.0712157562, 0.270809501, -0.437110156, 0.0429252051, 0.260939151,
+    0.125453413, -0.10005983, -0.227327988, -0.219215289, 0.109276481, -0.0883071795, -0.201044232, -0.190066069,
+    -0.224819362, 0.271885276, -0.42679134, -0.397132039, -0.052907832, 0.331040353, 0.0959323123, -0.323677808,
+    -0.186443076, 0.238486886, -0.248728722, -0.0303030815, -0.147349894, 0.323280096, 0.0404075459, -0.538994491,
+    -0.067143783, -0.470535547, 0.185811281, 0.540406406, 0.0732966363, 0.0408488549, -0.465857923, 0.415467381,
+    -0.377609372, 0.138738692, -0.429037184, -0.127650335, -0.610822499, 0.252965063, 0.15564099, 0.0746081099,
+    0.0170680378, -0.425018519, -0.0216978639, -0.148588181, 0.0853319019, 0.187049627, -0.373208672, -0.0797361583,
+    0.0928069428, -0.309317589, -0.0564738289, -0.365015119, 0.141456991, -0.0668438077, 0.831178367, -0.414596766,
+    -0.0115160309, -0.196033075, 0.280414492, 0.191999495, -0.0708831176, 0.143076599, 0.100349061, 0.0770788416,
+    0.149358943, 0.266955554, -0.00708491961, 0.163595125, -0.0206375271, -0.0810750723, 0.191790953, -0.425664455,
+    -0.0844681635, 0.181957707, -0.174891531, 0.0182164088, 0.0896646976, 0.160678357, -0.0196420811, -0.0277059246,
+    0.0420375615, 0.0932813212, 0.35933283, 0.0531433299, 0.177155584, -0.102695078, -0.24506028, -0.122689977,
+    0.0170729533, 0.426566362, 0.176417023, 0.151278421, 0.0719578937, 0.0224824473, -0.077444993, 0.111703165,
+    -0.272051394, 0.10012462, -0.288819641, -0.0556865111, -0.0340611041, 0.23497881, 0.504760683, 0.317065388,
+    0.302797854, 0.119047597, 0.389320612, -0.173772663, -0.142604083, -0.4956038, -0.145698413, -0.0546529293,
+    -0.129047841, 0.289637148, 0.200594112, -0.0646652654, -0.322498888, -0.393068522, 0.232986748, 0.0544998236,
+    -0.217055902, 0.289253354, 0.0651904568, -0.0318159685, -0.723048568, -0.133016482, -0.348564029, 0.189396918,
+    -0.077960059, 0.0430715419, -0.518583119, -0.399827182, -0.440499961, 0.162092105, -0.342485815, -0.0310130268,
+    0.401895344, -0.192245439, 0.633344233, -0.545754969, 0.241979107, -0.158968732, -0.449814588, -0.34309569,
+    0.511255741, -0.302688777, -0.269467026, -0.374645859, 0.21994333, -0.223373592, 0.437800556, -0.310799092,
+    -0.0909308419, -0.17005378, 0.249881864, -0.212693632, 0.545721233, -0.100080542, 0.134167939, 0.118943721,
+    -0.168587387, 0.307729065, -0.147790015, 0.235626355, 0.0195052568, 0.205918565, 0.0565685891, -0.204899624,
+    -0.335519254, -0.179137945, -0.240277261, -0.253613442, 0.180585831, -0.202953085, 0.181300566, 0.385368973,
+    -0.194122896, 0.159837127, 0.0368521027, -0.51774472, -0.183177948, -0.011321784, 0.260250807, -0.0302997716,
+    -0.265427351, 0.256738991, 0.0423633754, -0.303038538, -0.00436451845, 0.321822137, 0.356473774, -0.102729447,
+    -0.573238432, -0.761993766, 0.173841879, -0.0485679097, -0.055423297, 0.352926403, 0.122482136, 0.111193717,
+    -0.0778260678, 0.0708984807, 0.397126049, 0.402399719, -0.248718619, -0.135347426, 0.332133442, 0.0296662711,
+    -0.277653813, -0.132710576, 0.206397027, -0.00997336581, -0.218710139, 0.156311005, 0.108809724, 0.340842485,
+    -0.208444223, 0.522723138, 0.179392651, -0.676416397, -0.420877635, 0.466026545, 0.0297565684, 0.0193781778,
+    0.563293755, 0.249355793, 0.183474243, -0.451624721, 0.401679397, -0.684682667, -0.402053058, -0.769355536,
+    0.283418745, 0.451981008, 0.697981358, 0.219564036, 0.211876154, -0.789238989, -0.0832032487, -0.214555189,
+    0.202882186, -0.0647007003, -0.0127851563, -0.00870586839, 0.0594433323, -0.0776676536, 0.170489088, 0.490512669,
+    0.048861295, 0.136296377, 0.0494624898, -0.13979125, -0.164194763, -0.213685781, -0.443100542, 0.0805794299,
+    -0.430784941, -0.119531699, 0.106471017, -0.21521616, -0.380765766, 0.175782204, -0.104653217, 0.681591272,
+    0.249714822, -0.138546675, 0.100673199, 0.0094317589, -0.237376779, -0.0840305835, 0.405363679, -0.36552611,
+    -0.0652533397, 0.0114052491, -0.242925614, 0.102887958, -0.0504368953, 0.033497069, -0.182954609, -0.380113453,
+    -0.284279048, -0.312064886, 0.052913107, 0.0449762978, -0.133898363, -0.21058175, -0.315141857, -0.000580119493,
+    0.142159373, 0.157063067, 0.36470148, 0.417590052, 0.17063047, 0.101374678, -0.149098769, 0.13096036,
+    -0.0684639141, -0.171746865, 0.0239273887, -0.161785275, 0.308856428, 0.151161745, -0.141832978, 0.17159754,
+    0.221092045, -0.367014408, 0.256810933, 0.390418321, 0.408860028, 0.137028605, -0.237509951, 0.220242172,
+    -0.668242931, 0.0191321373, -0.684107602, -0.40349102, -0.0676403418, -0.0866153166, 0.318335772, -0.454831243,
+    0.48450318, -0.66837281, 0.0927777663, 0.253559023, 0.670021176, 0.164087117, -0.276794523, 0.302901179,
+    -0.0446818806, -0.0223464482, -0.171427622, -0.229613468, -0.439916223, 0.211356074, 0.063696824, -0.151972651,
+    -0.484829783, -0.1482535, 0.298000306, 0.256625473, -0.572977245, 0.549876034, -0.194035411, 0.143298775,
+    -0.173848972, -0.0950261801, -0.0812711194, 0.17774421, 0.0224218164, 1.19598091, -0.334149927, -0.287019432,
+    0.334965438, 0.0891814008, -0.242949769, -0.180621505, -0.395654589, -0.230017796, -0.253166288, 0.279356509,
+    0.0975466818, 0.0749236494, -0.0173156168, 0.425677687, 0.00182074634, -0.0631581694, 0.175778568, -0.167407721,
+    -0.109039672, 0.197854087, -0.457123309, 0.325487792, 0.133608177, -0.168454155, 0.367180258, -0.0985760018,
+    0.0106022106, -0.232594699, -0.174055293, -0.441593856, 0.143711716, -0.120724611, -0.181494355, -0.468331307,
+    -0.184620276, 0.255271435, 0.191182792, 0.119826376, -0.390734881, -0.196301967, -0.479482442, -0.227573588,
+    -0.112378649, -0.187613815, -0.0331342667, 0.158954576, 0.161774024, 0.686882138, 0.168036625, 0.0313236266,
+    0.455456316, 0.130893484, 0.421260983, 0.175706387, 0.213873744, 0.175528854, 0.356071651, 0.136772782,
+    -0.113364123, 0.123995937, -0.296579719, -0.227591857, 0.164638162, -0.22648488, -0.101590239, 0.163415596,
+    0.365272313, -0.362146854, 0.0816632509, 0.310351372, -0.094408147, 0.7466259, 0.0829296112, 0.360986263,
+    -0.191322789, 0.332746148, 0.00402834732, 0.076228857, -0.0809350982, 0.408179671, -0.0121439695, -0.0286168717,
+    0.0143972598, 0.14217034, -0.213805944, 0.256169796, -0.566409767, -0.0887853727, -0.167592362, -0.155138537,
+    -0.46993646, 0.0905636624, -0.29823941, -0.318522245, -0.0947718173, -0.0319240391, -0.407375395, -0.229928002,
+    0.280433148, 0.4440687, -0.396741271, -0.290303886, 0.0104827974, -0.42492938, -0.529861867, -0.189501897,
+    -0.289001554, -0.3083736, -0.0979760438, -0.0660466328, 0.35532859, -0.0938038006, -0.245453596, -0.051593639,
+    -0.482976645, 0.316563189, 0.0950439796, -0.0413325354, -0.0237644073, -0.353520811, -0.173432425, -0.129900277,
+    -0.0062085609, 0.206192046, -0.0602231212, -0.724061072, 0.287826389, 0.276073098, 0.353060961, 0.419210821,
+    -0.26125598, -0.402461588, 0.0903026387, -0.380410999, 0.0379246585, 0.383013546, -0.0227446873, -0.55033505,
+    -0.514089584, 0.53452462, -0.583029807, 0.302403152, 0.00673243823, 0.131705344, 0.332359433, -0.542487144,
+    -0.422899067, -0.00362048019, -0.352574438, -0.33369115, -0.267392635, 0.168575138, -0.383862406, 0.00208524731,
+    0.0209607407, 0.608050585, -0.140924081, -0.492633045, -0.232145414, 0.244986862, 0.200139686, 0.0329476409,
+    0.535313547, 0.628397644, 0.210986584, -0.0243457817, 0.057599254, -0.407719612, -0.578152776, -0.461431175,
+    0.565806806, 0.501903713, 0.814085364, 0.403124243, 0.526161134, -1.00169146, 0.135252252, -0.106432028,
+    0.243692517, -0.228511944, 0.834087431, 0.248608127, 0.473321885, -0.0392276645, -0.0970859304, 0.611681819,
+    0.0704842955, -0.0709178522, -0.0713416263, -0.139983281, 0.113987952, 0.251128495, -0.238253206, -0.0423354395,
+    -0.586833298, -0.244336635, 0.00891622715, -0.0459352285, -0.311773479, 0.090442121, 0.438747853, -0.028400423,
+    0.350072145, -0.0224833712, -0.0232771635, -0.149791211, -0.112900726, -0.0348908901, -0.29762727, -0.00731038116,
+    0.015850693, -0.323277265, -0.321383476, -0.0888055563, 0.105621375, 0.049543608, -0.215875328, -0.38313207,
+    -0.537637532, -0.0573089756, 0.0622550286, -0.0427406542, -0.389482945, 0.272481829, 0.0985797644, -0.159599096,
+    -0.042907685, -0.188094392, 0.488385469, -0.0720971003, 0.176990867, 0.112558797, 0.077957049, 0.104612298,
+    -0.171427369, 0.0249996949, 0.237035319, 0.136845812, 0.0144379577, 0.245389387, -0.149601683, 0.607998967,
+    -0.234760091, -0.434469849, 0.253908426, -0.100344844, 0.131233811, 0.176363111, -0.0938277021, 0.201984331,
+    -0.282196224, -0.263782978, -0.159334466, -0.453214407, 0.351180017, -0.299426287, 0.27947703, -0.110542074,
+    0.437314659, -0.347277164, 0.0718654916, 0.0605136715, 0.301902354, 0.012279301, 0.0770445466, 0.0101201963,
+    -0.112193964, -0.118482478, -0.353480637, 0.23427771, -0.258981943, -0.205602512, 0.486088365, -0.322327316,
+    -0.134122685, -0.0213474371, 0.377469212, 0.346811354, -0.39274025, 0.377163827, -0.868147373, -0.0573914163,
+    -0.248038486, 0.183121786, -0.173579186, 0.0888594612, -0.572164536, -0.182893485, -0.0667268708, -0.283269972,
+    -0.0046457327, 0.148703322, 0.317267239, 0.0388387777, -0.155621588, -0.0246789176, -0.275181979, 0.0747880489,
+    -0.220904291, -0.244740546, -0.168395832, 0.458237052, -0.257290572, -0.0244723763, 0.316420168, -0.228710636,
+    0.0305050686, 0.0725906789, -0.618504763, -0.275143653, -0.0918041393, -0.273622334, 0.0220955256, 0.0480390154,
+    0.196401462, -0.0162171647, 0.221897066, -0.0623807721, 0.275364429, -0.415968031, 0.101324268, -0.187497899,
+    0.20952259, 0.027605474, 0.104100749, -0.225267291, -0.301759928, -0.0189006254, -0.315927356, -0.406987369,
+    -0.0218161102, 0.12972118, 0.101267636, -0.222821832, -0.00335441111, 0.322454453, 0.210626051, -0.356557846,
+    0.0543000363, 0.14681673, -0.206238568, 0.232708365, 0.130813912, -0.00977130607, 0.0290266369, 0.165730223,
+    -0.651453376, -0.0190525558, -0.304230243, 0.0454118773, 0.608442187, -0.092973195, 0.138592973, -0.226978019,
+    -0.2621032, -0.27270481, -0.0913800448, 0.244007915, 0.60019803, -0.0317282975, -0.120949075, -0.512674272,
+    -0.460417271, 0.612310886, -0.273753971, 0.1539637, -0.0241999496, -0.267828971, 0.196578562, 0.0164204966,
+    -0.35862869, -0.152997985, 0.724774539, 0.553594768, -0.745701015, 0.164772645, -0.354673386, 0.304935694,
+    0.151818678, 0.367766351, -0.358724535, -0.000873126322, -0.357333779, 0.248595998, 0.209075511, -0.302428812,
+    -0.518459439, 0.0381166823, -0.0165340621, 0.205345258, 0.218359381, -0.308088422, 0.175690368, 0.217378944,
+    0.1768668, 0.0491742119, 0.193532869, 0.373835921, -0.691827774, 0.0300183184, 0.320252866, -0.295481116,
+    0.205477655, -0.310231149, 0.14095965, 0.575121403, -0.0497607663, 0.380591303, 0.0758010969, 0.354559422,
+    0.0195583347, -0.10817197, 0.302559555, 0.0798633546, 0.02435809, -0.0142106619, -0.57370764, 0.0528307185,
+    -0.0129653597, 0.45089215, -0.0946043357, 0.304496735, 0.0781479999, -0.39468956, -0.336888939, -0.118847348,
+    0.0245685019, 0.251049161, 0.177149728, -0.484419256, 0.2623083, 0.297709674, -0.536805928, 0.0684611276,
+    0.531334639, 0.361442983, 0.0942621455, -0.0379878171, 0.26649788, -0.303371787, -0.0599163882, 0.224732429,
+    -0.129134178, 0.00163703191, 0.242128104, -0.546657264, -0.568887353, 0.294177115, 0.116049305, 0.386927545,
+    0.362075359, 0.0386364646, -0.669522583, 0.0219946075, -0.0769980326, 0.0200742483, -0.456174999, -0.20117946,
+    0.712129354, -0.49033919, 0.293972254, -0.49818638, -0.0284708552, -0.49311617, 0.107085742, -0.467797846,
+    0.0231199916, -0.273190886, 0.193520904, 0.0619781725, 0.0799913034, -0.155456513, 0.545139253, -0.058535561,
+    -0.226488143, 0.0977276787, 0.0291658528, 0.0656676814, 0.267737329, 0.435799837, -0.00182703999, -0.410225332,
+    0.19223398, 0.463476151, -0.462678701, 0.250905991, -0.0353663526, 0.141392797, 0.543614626, 0.0540296882,
+    -0.0153504061, -0.447991133, -0.0478041992, -0.186402738, -0.089536339, 0.00163943332, 0.406168401, -0.0462679863,
+    -0.140241727, -0.409061611, -0.22169365, -0.0542601012, -0.311645657, 0.175841957, -0.0656388327, -0.372508436,
+    -0.182362258, 0.185728192, 0.320354223, 0.0911037847, -0.460666984, 0.788455725, 0.0940721259, -0.296884358,
+    -0.119379058, 0.224045649, 0.0253903158, 0.112733454, -0.0101256417, -0.392591596, 0.112382434, 0.113351613,
+    0.00998659525, -0.749271691, 0.45451951, 0.344247133, 0.0929863974, -0.0082540689, 0.0355328172, 0.185808316,
+    0.0837837756, 0.141582146, 0.304514438, 0.164646819, -0.102259129, -0.27510336, -0.133853391, 0.663694203,
+    0.124498963, 0.0974770114, 0.188215956, -0.126632929, -0.745868981, 0.382088393, -0.0479871854, 0.648113787,
+    0.576557875, -0.321811825, 0.452063292, -0.336673558, -0.706819534, 0.394262463, -0.284659475, -0.130193532,
+    -0.119798563, 0.0266247876, -0.0722419918, 0.205019355, -0.213887006, -0.0240762457, -0.0730220303, 0.0542235598,
+    0.321089536, -0.135824218, -0.347942114, -0.980216146, -0.159629419, -0.218303025, 0.27425012, 0.538207173,
+    0.24480094, 0.2361065, 0.0458150804, 0.337990165, -0.0665932968, 0.348465234, 0.160247222, 0.332469344,
+    0.500526428, 0.164380908, -0.132566974, -0.0194822438, -0.126254454, 0.177167416, -0.213796571, -0.477068216,
+    -0.0610516258, -0.176702097, -0.119957745, 0.133398846, 0.119008943, 0.502135038, -0.351616472, 0.177704036,
+    0.314348042, 0.0579181276, -0.201785728, 0.129418537, 0.190486416, 0.0128933666, 0.225186512, 0.190002322,
+    0.154919058, 0.61431396, 0.102634966, -0.624167323, -0.199594438, -0.107367329, 0.396597445, 0.148251131,
+    -0.277312279, -0.000648375892, 0.3255651, -0.00413763756, -0.435141444, -0.0617470145, 0.312806487, 0.0943091363,
+    -0.0382816941, -0.376051784, 0.465468496, 0.113859244, -0.286179304, -0.15963541, 0.108538218, 0.113869525,
+    -0.457480967, 0.0570772104, -0.0097693596, 0.47467339, 0.175855145, -0.237426028, 0.553947508, 0.309422731,
+    -0.201092348, 0.490661949, -0.0399222858, -0.876640856, -0.0595831051, 0.081802465, 0.20367153, -0.161172912,
+    1.07852423, -0.0616091974, 0.445429385, -0.0709150806, 0.433761597, -0.534232318, -0.644659281, -0.123936929,
+    -0.079768002, 0.634748876, 0.0838793218, 0.191544339, -0.0219222698, -0.412941933, 0.0483544432, -0.365631402,
+    -0.15645583, -0.3759152, 0.816604316, 0.0832404345, -0.304767519, -0.0112940539, -0.246242821, 0.759355783,
+    0.0479457527, 0.14100334, 0.0931052193, 0.401028216, -0.467713326, -0.0895873383, -0.559914529, -0.426742285,
+    -0.452828676, 0.176813513, 0.101761259, -0.112978913, -0.32456249, 0.143131405, -0.194399059, 0.0207419582,
+    0.025256468, -0.156158522, 0.0836797506, 0.0821911767, -0.379112273, -0.0951243117, 0.0416863002, -0.142537266,
+    -0.296761453, -0.123911254, -0.399718821, 0.00624302169, 0.12251801, -0.090372391, -0.0842337832, -0.310420305,
+    -0.328819156, -0.059191633, 0.109884158, -0.399591953, 0.33245191, 0.0662063584, -0.0798029155, 0.088812314,
+    -0.155095622, 0.139355958, 0.150817454, 0.120581418, -0.039041549, 0.1231106, -0.2867966, -0.312695503,
+    -0.53460902, 0.133526742, -0.344615072, -0.0328897499, 0.077270478, 0.357113183, 0.239324808, -0.181094646,
+    0.365249395, -0.532171786, -0.258594096, 0.129824653, 0.139482677, 0.0703506321, -0.333641887, 0.147332802,
+    0.022752285, 0.613163531, 0.145004168, -0.354443789, -0.860508263, -0.0362572931, -0.0687806457, 0.331504643,
+    0.844715774, -0.201013088, 0.359859675, -0.0304766539, 0.205863625, 0.280879974, 0.143058896, -0.244456097,
+    0.0328893811, 0.340947002, 0.151259601, 0.173064113, 0.370868772, 0.347059667, -0.533088326, -0.353914469,
+    0.327310115, -0.237837121, -0.387369901, 0.515173376, -0.148179144, -0.525365114, -0.116678312, 0.26072973,
+    -0.0366227143, 0.245876104, 0.258107692, -0.0996138528, 0.108283058, 0.223927379, -0.249053627, 0.105370231,
+    0.134189263, 0.41846323, 0.00163230277, -0.33966884, -0.137969419, 0.0425030477, -0.479175776, -0.276993781,
+    -0.0689822957, 0.0423608087, 0.118249603, -0.224235281, 0.286485255, 0.0371640176, 0.0962306932, 0.357443929,
+    -0.162751287, -0.112782285, -0.522996962, -0.379337013, 0.157662347, 0.0187235978, 0.48473227, 0.0750176609,
+    0.101591624, 0.331800222, -0.104308821, -0.706630886, 0.427168876, -0.10871397, 0.274573445, 0.668912888,
+    -0.307935745, -0.111691698, 0.298448771, -0.239829466, -0.557853341, -0.0341898166, -0.0945510566, -0.310378402,
+    0.0241656844, -0.237519518, 0.147836819, 0.584027231, -0.274298161, 0.171758592, 0.609709084, -0.129467979,
+    -0.022001056, -0.0608103052, 0.101561159, 0.634729207, -0.150570586, 0.534917057, 0.27653712, 0.467283487,
+    0.155415818, -0.759745777, -0.117714621, 0.611246288, 0.298761249, 0.0129894568, -0.337610811, 0.414268076,
+    -0.840902209, 0.527346432, 0.108306654, -0.315345615, -0.488970697, 0.31924659, 0.281676173, 0.0673029125,
+    -0.120555371, -0.0425924994, -0.247669175, 0.229557455, -0.327269733, 0.171087027, 0.0790880919, 0.177930608,
+    -0.164340526, 0.364735514, 0.0371080562, -0.496309727, -0.00859652646, 0.191303059, 0.235006228, -0.746829987,
+    0.0735878348, 0.282139003, -0.0125590926, -0.141990438, 0.0657903627, 0.0773086995, 0.134610578, 0.166747808,
+    0.563203454, 0.119112842, -0.256998181, 0.000970128109, 0.0709262192, -0.124348246, 0.409761459, -0.117653109,
+    0.0633991361, 0.0225506574, 0.209200859, 0.253163427, 0.137288824, 0.0915968344, -0.264840364, 0.207458153,
+    0.561267853, 0.328862876, -0.0534619205, 0.101557702, 0.154688522, 0.253498524, 0.042176161, 0.349580497,
+    -0.0920802653, 0.0759600177, -0.204593778, -0.131395489, 0.0436257869, -0.346170574, 0.243469328, -0.209981635,
+    0.382896602, -0.181179047, -0.222193465, 0.0871103778, -0.0494576544, -0.0992359072, 0.631172478, -0.114249676,
+    0.211697668, -0.242367759, -0.126452982, -0.214294896, 0.102819003, -0.535106063, -0.398060292, 0.347982466,
+    -0.39351353, -0.115904123, 0.255040139, 0.401156515, -0.0194366425, -0.318604499, 0.53416729, 0.141723156,
+    0.0269511715, 0.391528755, 0.420038223, -0.146476761, -0.316166162, 0.0594043024, -0.293915778, 0.444338262,
+    0.0313562788, 0.245170906, -0.352497935, 0.0717155784, -0.3988024, -0.0538151562, -0.16771996, -0.243915275,
+    -0.049347885, 0.217533097, 0.336202681, 0.231522903, 0.182890445, 0.0561548807, -0.181832761, -0.365192235,
+    0.339339316, -0.376738369, -0.364372909, 0.0621659122, 0.181084618, -0.167060465, 0.714269221, -0.486179441,
+    -0.0906288698, -0.183998972, 0.12870805, -0.137944832, 0.211379886, -0.379410177, -0.280559719, -0.330462664,
+    0.107871696, 0.63872993, -0.18167606, -0.0532760471, -0.00940973405, -0.121814929, 0.208916247, -0.364653498,
+    -0.52905345, -0.317822397, -0.24009937, 0.13477613, 0.151737601, 0.291444063, -0.0822834373, 0.380447805,
+    -0.293985188, -0.0485233031, 0.216809347, -0.169900671, -0.0382947773, -0.113876231, -0.129264429, 0.126001701,
+    -0.0738283917, 0.119360551, 0.0390002877, -0.00201355433, -0.0979183763, 0.496748149, 0.297483653, -0.112937644,
+    -0.775695384, -0.41029039, 0.0231356993, 0.0491952896, -0.0364226364, 0.425858825, 0.138027549, -0.0563840233,
+    0.198623851, -0.131326318, 0.138266265, 0.291934669, -0.252877206, -0.196659043, 0.226840571, -0.145708531,
+    -0.0953797847, -0.25651598, -0.124563396, -0.273615658, -0.177289084, -0.125322491, 0.0568150841, 0.223752379,
+};
+
+const float g_online_bias[2 * ONLINE_GATES] =
+{
+    0.421604961, 0.639507473, 0.76236707, 0.852039158, 0.782832026, 0.271719009, 0.841332078, 0.908095419,
+    0.935608029, 0.586510897, 0.735086858, 0.696125865, 0.999305427, 1.17012596, 0.814358592, 0.825955629,
+    0.86828953, 0.357000828, 0.524914443, 0.452014029, 0.358631074, 1.07526505, 0.730707526, 0.639256775,
+    0.757758915, 0.677090526, 0.764282107, 0.808190346, 0.818554759, 0.815097749, 0.787838161, 0.809092581,
+    0.111490399, 0.212457955, 0.0795701817, 0.458854318, 0.234910816, 0.25954473, 0.337559581, 0.203111768,
+    0.197728947, 0.209710777, 0.147987127, 0.230647713, 0.199332029, 0.241653055, 0.444164485, 0.124650225,
+    0.210162178, 0.395043552, 0.395424604, 0.212078869, -0.0113099804, 0.448667288, 0.349895, -0.0178040098,
+    0.197713956, 0.633625984, 0.135837957, 0.346938074, 0.290466487, 0.317801356, 0.421896607, 0.439391166,
+    -0.176210105, -0.0547419749, 0.086605601, -0.00372758415, -0.0810949355, -0.0662395433, 0.0933870524, -0.102008678,
+    -0.19690381, 0.012521768, 0.0256348178, -0.000293164951, -0.0118425395, -0.0131967235, -0.0999388248, -0.19475852,
+    -0.0304529965, -0.0295144375, -0.0203676894, 0.186342403, -0.0170031302, 0.0567328706, 0.136175871, -0.0596809722,
+    -0.00572410459, -0.000268252275, 0.0130515164, -0.0650766641, 0.0131797595, 0.11480283, 0.028500434, -0.0171878077,
+    -0.578395069, -0.360491931, -0.237635732, -0.147961855, -0.217168376, -0.728279114, -0.158667922, -0.0919055119,
+    -0.0643919781, -0.413488865, -0.264912188, -0.303874463, -0.000694241258, 0.170126438, -0.185640886, -0.174044356,
+    -0.131710187, -0.642998457, -0.475086182, -0.5479877, -0.641369522, 0.0752667785, -0.269290358, -0.36074236,
+    -0.24224177, -0.32291019, -0.235717446, -0.191808447, -0.181443259, -0.184900105, -0.212161884, -0.190906972,
+    0.111490399, 0.212457955, 0.0795701817, 0.458854318, 0.234910816, 0.25954473, 0.337559581, 0.203111768,
+    0.197728947, 0.209710777, 0.147987127, 0.230647713, 0.199332029, 0.241653055, 0.444164485, 0.124650225,
+    0.210162178, 0.395043552, 0.395424604, 0.212078869, -0.0113099804, 0.448667288, 0.349895, -0.0178040098,
+    0.197713956, 0.633625984, 0.135837957, 0.346938074, 0.290466487, 0.317801356, 0.421896607, 0.439391166,
+    -0.245361373, -0.0648013949, 0.144596443, 0.0712834448, -0.0695585534, -0.0059550372, 0.0878554434, -0.141427517,
+    0.269294649, 0.0785141885, -0.0215533245, -0.0354054868, -0.00632216549, 0.0021950847, -0.221999109, -0.0961247832,
+    0.0775869787, -0.137936428, 0.00910405908, 0.123110734, -0.0167804807, 0.08898554, 0.158868045, -0.0657030195,
+    0.116433054, 0.00750549883, 0.0441515148, 0.0530081168, 0.0756753311, 0.0820111483, 0.0158143397, 0.0273046177,
+};
+
+const float g_online_dense[NN_OUT_NUM * ONLINE_UNITS] =
+{
+    0.0614936538, -0.462624758, 0.0482704602, 0.621536076, 0.39152813, -0.0910605118, -0.288960367, 0.335202664,
+    -1.29421771, 0.398579001, -0.290570408, 0.476329297, 0.406575292, 0.00460660504, -0.382776827, 0.514852285,
+    -0.537923813, 1.15503633, -0.699619949, -0.956744194, -0.160091698, 0.43191728, -0.708055377, 0.0998140499,
+    0.423811942, 0.364666998, -0.0581256673, -0.785425544, 0.640518069, -0.891165495, -0.394272536, -0.0861831978,
+    0.565126598, 0.392205238, -0.534248531, -0.565000176, 0.72964859, 0.394251317, 0.5645805, -0.381910324,
+    -0.561284423, -0.491194248, 0.194576517, 0.187638983, -0.49011004, 0.0542518981, -0.413334846, -0.373931646,
+    -0.817364097, -0.248435467, 0.353448063, 0.401344746, -0.489534318, 0.908752859, 0.893705666, -0.776486814,
+    -0.060074918, 0.436245948, 0.446274251, -0.225611448, -0.417341918, 0.749913573, -0.163631782, 0.885252655,
+    0.477500737, 0.563681602, -0.730838776, -0.387615412, -0.442828804, -0.752151251, 0.233325139, 0.795877099,
+    0.202986345, 1.04002857, 0.571869075, 0.719291687, -0.314034134, -0.405003756, 0.0553732775, 0.0173679218,
+    0.723516822, -0.74921906, 0.659625471, -0.341474771, 0.0875907615, 0.312798738, -0.608042061, -0.0138047673,
+    -0.119305313, 0.600244641, 0.434743077, 0.734779894, -0.440880328, -0.328642815, 0.370328814, 0.542471349,
+    0.817880392, -0.386061549, -0.369383812, -0.696300328, -0.0753525868, 0.346135139, -0.903427243, 0.157618225,
+    0.220892712, -0.516148269, -0.317839354, -0.4029921, 0.661037624, 0.218282223, 0.29070276, -0.342953175,
+    0.61546278, 0.73067522, -0.632040739, -0.659465611, 0.289646327, 0.237463817, 0.137777045, -0.28779,
+    0.734806776, 1.26438582, -0.55559504, -1.24371123, -0.578853548, 0.165528387, 0.32104218, -0.60850215,
+    -0.816420317, 0.561810136, -0.10373228, 0.0368397497, -0.262764901, 1.11405325, 0.512890041, -0.553894639,
+    -0.216618598, -0.526799977, 0.733636856, 0.164194718, 0.395346075, 0.269526839, 0.502195001, 0.374285817,
+    0.462178588, -0.586720884, 0.559885919, 0.314964414, 0.376986712, -0.19347997, 0.105862647, 0.862038732,
+    -0.31154874, -0.719096482, 0.622901499, 0.131743342, -0.334761351, -0.313020974, 0.414144903, 0.552316964,
+    -0.448615253, -0.832363904, -0.372264206, -0.0859785154, 0.0441628024, 0.339185506, 0.450482816, 0.489708424,
+    0.741812408, 0.570047557, -0.474146783, 0.118976176, 0.834762037, 0.781016946, 0.89728415, -0.508964956,
+    -0.440382987, 0.745320022, -0.957638204, 0.0464342684, -0.126976505, -0.865541041, 0.352481037, 0.258027405,
+    -0.669953644, -1.09762609, -0.507362366, -0.696720719, 0.136733755, 0.433662832, -0.505701005, -0.829867065,
+    0.12834698, -0.487145215, 0.064932026, 0.384729624, -1.07741344, -0.711170018, -0.364402175, -1.09077764,
+    1.43348348, -0.217124641, -0.859576583, 0.417470247, -0.070028834, 0.00442728307, -0.421933353, 0.791292012,
+    0.111285813, -0.931201339, 0.199988484, -0.485808998, -0.0451139063, 0.310158759, -0.134711698, 0.176209763,
+    0.476567209, 0.41629532, 0.644910872, 0.223232612, 0.0800167695, -0.514019012, -0.0989145041, -0.207094267,
+    0.475027293, 0.388145685, -0.348801255, -0.259093672, 0.806557119, -0.53197211, 0.373611778, 0.905158579,
+    0.470077455, -0.258769125, -0.167513445, -0.208790392, -0.798720598, 0.342036396, -0.365109146, -0.311231375,
+    0.285177082, 0.749123096, -0.0695060268, -0.652020395, -0.495857418, -0.59795332, 0.601859689, -0.624100268,
+    -0.455883265, 0.276898533, -0.600652158, 1.03705788, -0.0312117487, -0.0734617561, 0.151565865, -0.925782919,
+    -0.0394292846, -0.129918709, 0.383464783, 0.328168392, -0.550609231, 1.27479422, -0.385086715, -0.198656812,
+    -0.623319864, 0.669045269, 1.01975238, 0.605451763, 0.277941614, -0.598482072, -0.47856161, 0.138681918,
+    0.399704486, -0.498439789, -0.354667306, 1.05025685, 0.461368829, -0.135223061, 0.386729628, 0.465650082,
+    -0.0524581559, 0.0479117744, 0.394248158, -0.477547705, 0.286079943, 0.577997029, -0.446713716, -0.320419461,
+    -0.906907201, 0.61804992, 0.515255213, 0.131541833, 0.884144604, -0.858462691, 0.531356037, -0.790234864,
+    -0.302304208, 0.21837604, 0.0552655905, -0.339255154, -0.262903482, 0.51797986, 0.769190609, -0.44595468,
+    -0.542444766, -0.659723938, 0.0490253717, 0.832878053, -0.446784794, -0.697733164, 0.686970532, -0.56134212,
+    0.331724286, -1.12895596, -0.517733693, 0.322884947, 0.471480668, 0.862491667, 0.529346228, 0.121512756,
+};
+
+const float g_online_dense_bias[NN_OUT_NUM] =
+{
+    -0.148739755, -0.012635787, 0.0398955159, -0.0538935885, -0.0391056128, 0.244302407, 0.0300587285, -0.0765351951,
+    -0.0525866486, 0.0685001314,
+};
@@ -0,0 +1,413 @@
+/**
+ ****************************************************************************************************
+ * @file        panel.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʶ: ʽ, ֻػ˵ַ
+ ****************************************************************************************************
+ * @attention
+ *
+ * ԭÿ sprintf("%d  %8.6f") ʽ10, ػ11ַ.
+ * ڰѸʵβ 10^decimals λ, printfλͬ, ø;
+ * ʵǰλ಻, ͨÿֻػ󼸸.
+ *
+ *  dirty.c һͼ: ύֶʱֻǼǱ˵ַڵľ,  dirty_flush() ϳˢ,
+ * ͬһб˵ֻϲһ. ºϳʱ shown , Ҫύ.
+ *
+ ****************************************************************************************************
+ */
+
+#include "string.h"
+#include "panel.h"
+#include "lcd.h"
+#include "dirty.h"
+#include "bar.h"
+
+
+static const uint32_t g_fmt_pow10[10] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+static panel_field_t g_panel[PANEL_FIELD_NUM];
+
+/**
+ * @brief       Ҷ޷, λʱ width  '*'
+ * @param       buf  : (ӽ)
+ * @param       v    : ֵ
+ * @param       width: (1 ~ 10)
+ * @retval      дַ(= width)
+ */
+uint8_t fmt_uint(char *buf, uint32_t v, uint8_t width)
+{
+    uint8_t i = width;
+
+    do
+    {
+        buf[--i] = '0' + v % 10;
+        v /= 10;
+    } while (v && i);
+
+    if (v)
+    {
+        memset(buf, '*', width);
+        return width;
+    }
+
+    while (i)
+    {
+        buf[--i] = ' ';
+    }
+
+    return width;
+}
+
+/**
+ * @brief        |v| * 10^decimals , printfͬ(vľȷֵ, һʱȡż)
+ *   @note       v * 10^n + 0.5f: 10^6ķֱֻ1/16, Լ1%ĸһλ
+ * @param       v       : ֵ
+ * @param       decimals: Сλ(0 ~ 9)
+ * @param       q       : 
+ * @retval      0, ɹ; 1, 32λ߲;
+ */
+static uint8_t fmt_scale(float v, uint8_t decimals, uint32_t *q)
+{
+    union
+    {
+        float f;
+        uint32_t u;
+    } b;
+    uint64_t x, rem, half;
+    uint32_t m;
+    int e;
+
+    b.f = v;
+    e = (b.u >> 23) & 0xFF;
+    m = b.u & 0x7FFFFF;
+
+    if (e == 0xFF)
+    {
+        return 1;                       /* inf/nan */
+    }
+
+    if (e)
+    {
+        m |= 0x800000;
+        e -= 150;                       /* |v| = m * 2^e */
+    }
+    else
+    {
+        e = -149;                       /* ǹ */
+    }
+
+    x = (uint64_t)m * g_fmt_pow10[decimals];    /* < 2^54 */
+
+    if (e >= 0)
+    {
+        if (e > 31 || (x << e) >> 32)
+        {
+            return 1;
+        }
+
+        *q = (uint32_t)(x << e);
+        return 0;
+    }
+
+    if (e <= -63)
+    {
+        *q = 0;
+        return 0;
+    }
+
+    rem = x & ((1ULL << -e) - 1);
+    half = 1ULL << (-e - 1);
+    x >>= -e;
+
+    if (rem > half || (rem == half && (x & 1)))
+    {
+        x++;
+    }
+
+    if (x >> 32)
+    {
+        return 1;
+    }
+
+    *q = (uint32_t)x;
+    return 0;
+}
+
+/**
+ * @brief       ҶС, ͬ "%*.*f", ֳʱ width  '*'
+ * @param       buf     : (ӽ)
+ * @param       v       : ֵ, |v| * 10^decimals ҪС 2^32
+ * @param       width   : ܿ, źС
+ * @param       decimals: Сλ(1 ~ 9)
+ * @retval      дַ(= width)
+ */
+uint8_t fmt_fixed(char *buf, float v, uint8_t width, uint8_t decimals)
+{
+    uint32_t q;
+    uint8_t i = width;
+    uint8_t neg = (v < 0);
+    uint8_t n;
+
+    if (width < decimals + 2 + neg || fmt_scale(v, decimals, &q))
+    {
+        memset(buf, '*', width);
+        return width;
+    }
+
+    for (n = 0; n < decimals; n++)      /* С */
+    {
+        buf[--i] = '0' + q % 10;
+        q /= 10;
+    }
+
+    buf[--i] = '.';
+
+    do                                  /*  */
+    {
+        buf[--i] = '0' + q % 10;
+        q /= 10;
+    } while (q && i);
+
+    if (q || (neg && i == 0))
+    {
+        memset(buf, '*', width);
+        return width;
+    }
+
+    if (neg)
+    {
+        buf[--i] = '-';
+    }
+
+    while (i)
+    {
+        buf[--i] = ' ';
+    }
+
+    return width;
+}
+
+/**
+ * @brief       Ҷٷ,  p = 0.9821, decimals = 1  " 98.2%"
+ * @param       buf     : (ӽ)
+ * @param       p       : , 1 ʾ 100%, Ǹ
+ * @param       width   : ܿ,  '%'
+ * @param       decimals: Сλ(0 ~ 9), 0 ʾС
+ * @retval      дַ(= width)
+ */
+uint8_t fmt_pct(char *buf, float p, uint8_t width, uint8_t decimals)
+{
+    uint32_t q;
+
+    if (width < 2 || p < 0 || (decimals == 0 && fmt_scale(p * 100, 0, &q)))
+    {
+        memset(buf, '*', width);
+        return width;
+    }
+
+    if (decimals)
+    {
+        fmt_fixed(buf, p * 100, width - 1, decimals);
+    }
+    else
+    {
+        fmt_uint(buf, q, width - 1);
+    }
+
+    buf[width - 1] = '%';
+    return width;
+}
+
+/**
+ * @brief       ʼһֶ, Ϊո, Ļδ֪
+ * @param       f    : ֶ
+ * @param       x,y  : 
+ * @param       size : С 12/16/24/32
+ * @param       len  : ַ(1 ~ PANEL_TEXT_MAX)
+ * @param       color: ַɫ
+ * @retval      
+ */
+void panel_field_init(panel_field_t *f, uint16_t x, uint16_t y, uint8_t size, uint8_t len, uint16_t color)
+{
+    f->x = x;
+    f->y = y;
+    f->size = size;
+    f->len = len;
+    f->color = color;
+    memset(f->text, ' ', sizeof(f->text));
+    memset(f->shown, 0, sizeof(f->shown));
+}
+
+/**
+ * @brief        pos ʼдַ, ֶεĲֶ
+ * @param       f  : ֶ
+ * @param       pos: ʼַλ
+ * @param       s  : ַ
+ * @retval      
+ */
+void panel_field_set(panel_field_t *f, uint8_t pos, const char *s)
+{
+    while (*s && pos < f->len)
+    {
+        f->text[pos++] = *s++;
+    }
+}
+
+/**
+ * @brief       ύֶ: ϴύַȽ, 仯ļַǼΪһ
+ * @param       f: ֶ
+ * @retval      ˵ַ
+ */
+uint8_t panel_field_commit(panel_field_t *f)
+{
+    uint8_t i = 0, s, n = 0;
+    uint8_t w = f->size / 2;
+
+    while (i < f->len)
+    {
+        if (f->text[i] == f->shown[i])
+        {
+            i++;
+            continue;
+        }
+
+        for (s = i; i < f->len && f->text[i] != f->shown[i]; i++)
+        {
+            f->shown[i] = f->text[i];
+        }
+
+        dirty_add(f->x + s * w, f->y, f->x + i * w - 1, f->y + f->size - 1);
+        n += i - s;
+    }
+
+    return n;
+}
+
+/**
+ * @brief       ͼ: y [x0, x1] ֶεЧ(ͼ㻭)
+ * @param       y    : 
+ * @param       x0,x1: зΧ
+ * @param       line : һе, line[0] Ӧ x0
+ * @retval      
+ */
+static void panel_paint(uint16_t y, uint16_t x0, uint16_t x1, uint16_t *line)
+{
+    const panel_field_t *f;
+    const uint16_t *rows;
+    uint16_t cx, bits, x;
+    uint8_t i, w;
+
+    if (y < PANEL_Y || y >= PANEL_Y + PANEL_FIELD_NUM * PANEL_SIZE)
+    {
+        return;
+    }
+
+    f = &g_panel[(y - PANEL_Y) / PANEL_SIZE];
+    w = f->size / 2;
+
+    for (i = 0; i < f->len; i++)
+    {
+        cx = f->x + i * w;
+
+        if (cx > x1 || cx + w <= x0 || f->shown[i] == ' ')
+        {
+            continue;
+        }
+
+        rows = lcd_glyph_get(f->shown[i], f->size);
+
+        if (rows == NULL)
+        {
+            continue;
+        }
+
+        bits = rows[y - f->y];
+
+        for (x = cx; bits; x++, bits <<= 1)
+        {
+            if ((bits & 0x8000) && x >= x0 && x <= x1)
+            {
+                line[x - x0] = f->color;
+            }
+        }
+    }
+}
+
+/**
+ * @brief       ʼ: "0  " ~ "9  "  "current number is ", עΪ dirty.c ͼ
+ *   @note       dirty_init ֮; һʾˢ»
+ * @param       
+ * @retval      
+ */
+void panel_init(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < PANEL_PROB_NUM; i++)    /* "%d  %8.6f", ͼʱֻ "%d" */
+    {
+        panel_field_init(&g_panel[i], PANEL_X, PANEL_Y + i * PANEL_SIZE, PANEL_SIZE, PANEL_PROB_TEXT ? 11 : 1, BLACK);
+        fmt_uint(g_panel[i].text, i, 1);
+    }
+
+    panel_field_init(&g_panel[i], PANEL_X, PANEL_Y + i * PANEL_SIZE, PANEL_SIZE, 24, BLACK);
+    panel_field_set(&g_panel[i], 0, "current number is");
+
+    for (i = 0; i < PANEL_FIELD_NUM; i++)
+    {
+        memcpy(g_panel[i].shown, g_panel[i].text, sizeof(g_panel[i].shown));
+    }
+
+    dirty_layer_add(panel_paint);
+#if !PANEL_PROB_TEXT
+    bar_init();
+#endif
+}
+
+/**
+ * @brief       ʾһʶ, ֻǼǱ˵ַ, ɵ dirty_flush() ˢ
+ *   @note      ͼʱֻ bar_set(),  bar_poll() ˢύ
+ *              λʱʾ "current number is 2026", ʵ PANEL_THRESHOLD ʾ '?'
+ * @param       prob : PANEL_PROB_NUM (ұһֵ)
+ * @param       num  : ÿָ, 
+ * @param       conf : ÿֵ
+ * @param       count: ָ( PANEL_NUM_MAX), 0ʾǿյ
+ * @retval      ˵ַ
+ */
+uint8_t panel_update(const float *prob, const uint8_t *num, const float *conf, uint8_t count)
+{
+    panel_field_t *f = &g_panel[PANEL_PROB_NUM];
+    uint8_t n = 0, i;
+
+#if PANEL_PROB_TEXT
+    for (i = 0; i < PANEL_PROB_NUM; i++)
+    {
+        fmt_fixed(&g_panel[i].text[3], prob[i], 8, 6);
+        n += panel_field_commit(&g_panel[i]);
+    }
+#else
+    bar_set(prob);
+#endif
+
+    count = (count > PANEL_NUM_MAX) ? PANEL_NUM_MAX : count;
+
+    if (count == 1 && conf[0] > PANEL_THRESHOLD)    /* "current number is 7  98%" */
+    {
+        fmt_uint(&f->text[18], num[0], 1);
+        fmt_pct(&f->text[19], conf[0], 5, 0);
+    }
+    else if (count > 1)                             /* "current number is 2026" */
+    {
+        for (i = 0; i < PANEL_NUM_MAX; i++)
+        {
+            f->text[18 + i] = (i >= count) ? ' ' : (conf[i] > PANEL_THRESHOLD) ? '0' + num[i] : '?';
+        }
+    }
+    else
+    {
+        panel_field_set(f, 18, "none  ");
+    }
+
+    n += panel_field_commit(f);
+    return n;
+}
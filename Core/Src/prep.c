@@ -0,0 +1,412 @@
+/**
+ ****************************************************************************************************
+ * @file        prep.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       Ԥ: MNISTѻϵıʻ28x28
+ ****************************************************************************************************
+ * @attention
+ *
+ * : ĵ߶εľ d(), d <= R - PREP_CELL/2 Ϊ255, d >= R + PREP_CELL/2 Ϊ0,
+ * м䰴 d^2 Թ. ƽQ8, ֻڸͶӰ߶мʱһ.
+ *
+ ****************************************************************************************************
+ */
+
+#include "prep.h"
+#include "seg.h"
+#include "string.h"
+
+
+static uint8_t g_prep_grid[PREP_NW * PREP_NH];          /*  */
+static uint8_t g_prep_row[PREP_NW];                     /* һڵǰֵĸ */
+static uint8_t g_prep_tmp[PREP_NH * PREP_FIT];          /* źм */
+static uint32_t g_prep_img32[PREP_OUT * PREP_OUT / 4];  /* 28x28Ҷ, ֶSIMD */
+static uint8_t *const g_prep_img = (uint8_t *)g_prep_img32;
+static uint8_t g_prep_x0 = 0xFF, g_prep_y0, g_prep_x1, g_prep_y1;   /* ӿ(), x0 Ϊ0xFFʾ */
+static seg_box_t g_prep_box[SEG_MAX];                   /* prep_segment ֳ */
+static uint8_t g_prep_seg_num = 0;
+
+/**
+ * @brief       (ȡ)
+ * @param       v: 
+ * @retval      ƽ
+ */
+static uint32_t prep_isqrt(uint32_t v)
+{
+    uint32_t r = 0, b = 1u << 30;
+
+    while (b > v)
+    {
+        b >>= 2;
+    }
+
+    while (b)
+    {
+        if (v >= r + b)
+        {
+            v -= r + b;
+            r = (r >> 1) + b;
+        }
+        else
+        {
+            r >>= 1;
+        }
+
+        b >>= 2;
+    }
+
+    return r;
+}
+
+/**
+ * @brief       
+ * @param       
+ * @retval      
+ */
+void prep_clear(void)
+{
+    memset(g_prep_grid, 0, sizeof(g_prep_grid));
+    g_prep_x0 = 0xFF;
+    seg_clear();
+}
+
+/**
+ * @brief       ( -> , )
+ * @param       v : , ԻϽ
+ * @param       n : 
+ * @retval      
+ */
+static int32_t prep_cell(int32_t v, int32_t n)
+{
+    v /= PREP_CELL;
+    return (v < 0) ? 0 : (v > n - 1) ? n - 1 : v;
+}
+
+/**
+ * @brief       һαʻ: 뾶 PREP_RADIUS Ľ, ݸʺȡ
+ * @param       x1,y1: (Ļ)
+ * @param       x2,y2: յ(Ļ), ͬʱһԲ
+ * @retval      
+ */
+void prep_add(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    const int32_t rin2 = (PREP_RADIUS - PREP_CELL / 2) * (PREP_RADIUS - PREP_CELL / 2) << 8;
+    const int32_t rout2 = (PREP_RADIUS + PREP_CELL / 2) * (PREP_RADIUS + PREP_CELL / 2) << 8;
+    int32_t ax = x1 - PREP_X0, ay = y1 - PREP_Y0, bx = x2 - PREP_X0, by = y2 - PREP_Y0;
+    int32_t ex = bx - ax, ey = by - ay;
+    int32_t len2 = ex * ex + ey * ey;
+    int32_t len = prep_isqrt(len2);
+    int32_t cx0, cx1, cy0, cy1, cx, cy, px, py, dx, dy, along, d2, q, lo, hi;
+    uint8_t *g, cov;
+
+    cx0 = prep_cell(((ax < bx) ? ax : bx) - PREP_RADIUS - PREP_CELL / 2, PREP_NW);
+    cx1 = prep_cell(((ax > bx) ? ax : bx) + PREP_RADIUS + PREP_CELL / 2, PREP_NW);
+    cy0 = prep_cell(((ay < by) ? ay : by) - PREP_RADIUS - PREP_CELL / 2, PREP_NH);
+    cy1 = prep_cell(((ay > by) ? ay : by) + PREP_RADIUS + PREP_CELL / 2, PREP_NH);
+
+    for (cy = cy0; cy <= cy1; cy++)
+    {
+        py = cy * PREP_CELL + PREP_CELL / 2;
+        dy = py - ay;
+        g = &g_prep_grid[cy * PREP_NW];
+        lo = PREP_NW;
+        hi = -1;
+
+        for (cx = cx0; cx <= cx1; cx++)
+        {
+            px = cx * PREP_CELL + PREP_CELL / 2;
+            dx = px - ax;
+            along = dx * ex + dy * ey;
+
+            if (along <= 0 || len == 0)     /* Բ */
+            {
+                d2 = (dx * dx + dy * dy) << 8;
+            }
+            else if (along >= len2)         /* յԲ */
+            {
+                d2 = ((px - bx) * (px - bx) + (py - by) * (py - by)) << 8;
+            }
+            else                            /* м:  /  = ֱߵľ(Q4) */
+            {
+                q = (dx * ey - dy * ex) * 16 / len;     /* з,  */
+                d2 = q * q;
+            }
+
+            if (d2 >= rout2)
+            {
+                continue;
+            }
+
+            cov = (d2 <= rin2) ? 255 : (uint8_t)((rout2 - d2) * 255 / (rout2 - rin2));
+
+            if (cov > g[cx])
+            {
+                g[cx] = cov;
+            }
+
+            lo = (cx < lo) ? cx : lo;
+            hi = cx;
+
+            if (g_prep_x0 == 0xFF)
+            {
+                g_prep_x0 = g_prep_x1 = cx;
+                g_prep_y0 = g_prep_y1 = cy;
+            }
+
+            g_prep_x0 = (cx < g_prep_x0) ? cx : g_prep_x0;
+            g_prep_x1 = (cx > g_prep_x1) ? cx : g_prep_x1;
+            g_prep_y0 = (cy < g_prep_y0) ? cy : g_prep_y0;
+            g_prep_y1 = (cy > g_prep_y1) ? cy : g_prep_y1;
+        }
+
+        if (lo <= hi)                   /* Һһཻһ */
+        {
+            seg_add(cy, lo, hi);
+        }
+    }
+}
+
+/**
+ * @brief       ƽ: Դ [a, a+q)(Q16, λԴ)ڸ㰴ǵĳȼȨƽ
+ * @param       src   : Դ
+ * @param       stride: Դļ
+ * @param       n     : Դ, Ĳ0
+ * @param       a     : (Q16)
+ * @param       q     : 䳤(Q16)
+ * @retval      ƽֵ
+ */
+static uint8_t prep_area(const uint8_t *src, uint16_t stride, uint16_t n, uint32_t a, uint32_t q)
+{
+    uint32_t b = a + q, k, lo, hi, sum = 0;
+
+    for (k = a >> 16; k < n && (k << 16) < b; k++)
+    {
+        lo = ((k << 16) > a) ? k << 16 : a;
+        hi = (((k + 1) << 16) < b) ? (k + 1) << 16 : b;
+        sum += src[k * stride] * (hi - lo);
+    }
+
+    return (sum + q / 2) / q;
+}
+
+/**
+ * @brief       (28x28Ҷ)
+ *   @note      һζ4: __USADA8 , __UXTB16 02͵13, __SMLAD xۼ
+ * @param       cx,cy: (Q8), ȫ0ʱ
+ * @retval      
+ */
+static uint32_t prep_mass(int32_t *cx, int32_t *cy)
+{
+    const uint32_t *p = g_prep_img32;
+    uint32_t m = 0, row, w;
+    int32_t mx = 0, my = 0;
+    uint8_t y, k;
+
+    for (y = 0; y < PREP_OUT; y++)
+    {
+        row = 0;
+
+        for (k = 0; k < PREP_OUT / 4; k++)
+        {
+            w = *p++;
+            row = __USADA8(w, 0, row);
+            mx = __SMLAD(__UXTB16(w), (4 * k) | ((4 * k + 2) << 16), mx);
+            mx = __SMLAD(__UXTB16(__ROR(w, 8)), (4 * k + 1) | ((4 * k + 3) << 16), mx);
+        }
+
+        m += row;
+        my += row * y;
+    }
+
+    if (m)
+    {
+        *cx = ((uint32_t)mx << 8) / m;
+        *cy = ((uint32_t)my << 8) / m;
+    }
+
+    return m;
+}
+
+/**
+ * @brief       ָ: īֳɴҵļ
+ *   @note      γ̳ʱӿ򵱳һ
+ * @param       
+ * @retval      , 0ʾǿյ
+ */
+uint8_t prep_segment(void)
+{
+    g_prep_seg_num = seg_run(g_prep_box, SEG_MAX);
+
+    if (g_prep_seg_num == 0 && g_prep_x0 != 0xFF)
+    {
+        g_prep_box[0].x0 = g_prep_x0;
+        g_prep_box[0].y0 = g_prep_y0;
+        g_prep_box[0].x1 = g_prep_x1;
+        g_prep_box[0].y1 = g_prep_y1;
+        g_prep_seg_num = 1;
+    }
+
+    return g_prep_seg_num;
+}
+
+/**
+ * @brief       һֵ28x28: ӿ򳤱ƽŵ PREP_FIT, ƽƵ, ת0~1
+ * @param       n  : ڼ(prep_segment Ľ), ʱȫ0
+ * @param       out: (PREP_OUT x PREP_OUT)
+ * @retval      
+ */
+void prep_run(uint8_t n, float *out)
+{
+    const seg_box_t *b = &g_prep_box[n];
+    uint16_t w, h, s, ow, oh, ox, oy, i, j;
+    int32_t cx = 0, cy = 0, sx, sy;
+    uint32_t q;
+
+    memset(g_prep_img32, 0, sizeof(g_prep_img32));
+
+    if (n < g_prep_seg_num)
+    {
+        w = b->x1 - b->x0 + 1;
+        h = b->y1 - b->y0 + 1;
+        s = (w > h) ? w : h;
+        ow = (w * PREP_FIT + s / 2) / s;
+        oh = (h * PREP_FIT + s / 2) / s;
+        ow = ow ? ow : 1;
+        oh = oh ? oh : 1;
+        q = ((uint32_t)s << 16) / PREP_FIT;                 /* һӦԴ */
+
+        for (i = 0; i < h; i++)                             /* , īȥ */
+        {
+            seg_mask(n, b->y0 + i, b->x0, w, g_prep_row);
+
+            for (j = 0; j < w; j++)
+            {
+                g_prep_row[j] &= g_prep_grid[(b->y0 + i) * PREP_NW + b->x0 + j];
+            }
+
+            for (j = 0; j < ow; j++)
+            {
+                g_prep_tmp[i * PREP_FIT + j] = prep_area(g_prep_row, 1, w, j * q, q);
+            }
+        }
+
+        ox = (PREP_OUT - ow) / 2;
+        oy = (PREP_OUT - oh) / 2;
+
+        for (i = 0; i < oh; i++)                            /*  */
+        {
+            for (j = 0; j < ow; j++)
+            {
+                g_prep_img[(oy + i) * PREP_OUT + ox + j] = prep_area(&g_prep_tmp[j], PREP_FIT, h, i * q, q);
+            }
+        }
+
+        prep_mass(&cx, &cy);
+        sx = ox + ((((PREP_OUT / 2) << 8) - cx + 128) >> 8);   /* Ƶ (14, 14) */
+        sy = oy + ((((PREP_OUT / 2) << 8) - cy + 128) >> 8);
+        sx = (sx < 0) ? 0 : (sx > PREP_OUT - ow) ? PREP_OUT - ow : sx;
+        sy = (sy < 0) ? 0 : (sy > PREP_OUT - oh) ? PREP_OUT - oh : sy;
+
+        if (sx != ox || sy != oy)
+        {
+            for (i = 0; i < oh; i++)                        /* ᵽм, ٷŵλ */
+            {
+                memcpy(&g_prep_tmp[i * PREP_FIT], &g_prep_img[(oy + i) * PREP_OUT + ox], ow);
+            }
+
+            memset(g_prep_img32, 0, sizeof(g_prep_img32));
+
+            for (i = 0; i < oh; i++)
+            {
+                memcpy(&g_prep_img[(sy + i) * PREP_OUT + sx], &g_prep_tmp[i * PREP_FIT], ow);
+            }
+        }
+    }
+
+    for (i = 0; i < PREP_OUT * PREP_OUT; i++)
+    {
+        out[i] = g_prep_img[i] * (1.0f / 255);
+    }
+}
+
+/**
+ * @brief       ϴ prep_run 28x28Ҷ
+ * @param       
+ * @retval      Ҷ(0~255, )
+ */
+const uint8_t *prep_image(void)
+{
+    return g_prep_img;
+}
+
+/**
+ * @brief       : ӿ߶ƽŵ PREP_FIT, ͬ, ľ
+ *   @note      ̫ŲʱС. (ÿһ)ٺ, Ҫм仺
+ * @param       out : , 28 x WлҶ(, оΪW),  28*wmax ֽ
+ * @param       wmax: (, 4ı, С28)
+ * @retval      W(4ı, С28), 0ʾǿյ
+ */
+uint16_t prep_strip(uint8_t *out, uint16_t wmax)
+{
+    uint16_t w, h, s, ow, oh, ox, oy, sw, i, j;
+    uint32_t q, m = 0, my = 0, row;
+    int32_t sy;
+
+    if (g_prep_x0 == 0xFF)
+    {
+        return 0;
+    }
+
+    w = g_prep_x1 - g_prep_x0 + 1;
+    h = g_prep_y1 - g_prep_y0 + 1;
+    s = h;
+
+    if ((w * PREP_FIT + s / 2) / s > wmax - 2 * PREP_STRIP_PAD)
+    {
+        s = (w * PREP_FIT + wmax - 2 * PREP_STRIP_PAD - 1) / (wmax - 2 * PREP_STRIP_PAD);
+    }
+
+    ow = (w * PREP_FIT + s / 2) / s;
+    oh = (h * PREP_FIT + s / 2) / s;
+    ow = ow ? ow : 1;
+    oh = oh ? oh : 1;
+    q = ((uint32_t)s << 16) / PREP_FIT;
+    sw = (ow + 2 * PREP_STRIP_PAD + 3) & ~3;
+    sw = (sw < PREP_OUT) ? PREP_OUT : sw;
+    ox = (sw - ow) / 2;
+    oy = (PREP_OUT - oh) / 2;
+    memset(out, 0, (uint32_t)PREP_OUT * sw);
+
+    for (i = 0; i < oh; i++)
+    {
+        for (j = 0; j < w; j++)             /* : һӦļи */
+        {
+            g_prep_row[j] = prep_area(&g_prep_grid[g_prep_y0 * PREP_NW + g_prep_x0 + j], PREP_NW, h, i * q, q);
+        }
+
+        for (j = 0, row = 0; j < ow; j++)   /*  */
+        {
+            out[(oy + i) * sw + ox + j] = prep_area(g_prep_row, 1, w, j * q, q);
+            row += out[(oy + i) * sw + ox + j];
+        }
+
+        m += row;
+        my += row * i;
+    }
+
+    if (m)                                  /* Ƶ14 */
+    {
+        sy = ((PREP_OUT / 2) << 4) - (int32_t)((my << 4) / m);     /* Q4 */
+        sy = (sy + 8) >> 4;
+        sy = (sy < 0) ? 0 : (sy > PREP_OUT - oh) ? PREP_OUT - oh : sy;
+
+        if (sy != oy)
+        {
+            memmove(out + sy * sw, out + oy * sw, (uint32_t)oh * sw);
+            memset(out + ((sy < oy) ? sy + oh : oy) * sw, 0, (uint32_t)((sy < oy) ? oy - sy : sy - oy) * sw);
+        }
+    }
+
+    return sw;
+}
@@ -0,0 +1,480 @@
+/**
+ ****************************************************************************************************
+ * @file        proto.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       USART1 Э(ѭDMA + ж + ӲCRC)
+ ****************************************************************************************************
+ * @attention
+ *
+ * : USART1_RX  DMA2 Stream2 ѭģʽд g_proto_rxdma, HAL_UARTEx_ReceiveToIdle_DMA
+ * ڰ/ȫ/·ʱص HAL_UARTEx_RxEventCallback, صµֽڽ״̬,
+ * ״ֱ̬Ӱ֡ƴ g_proto_frame[] (: ж, : ѭ).
+ * Уѭ proto_poll , CRCͬʱ X-CUBE-AI пʹ, ֻѭ
+ * . Ӧ֡ͨ log_write , ־ USART1 TX DMA.
+ *
+ ****************************************************************************************************
+ */
+
+#include "string.h"
+#include "proto.h"
+#include "usart.h"
+#include "crc.h"
+#include "log.h"
+#include "tprec.h"
+
+
+/* ״̬ */
+enum
+{
+    PROTO_RX_SOF0 = 0,
+    PROTO_RX_SOF1,
+    PROTO_RX_HDR,
+    PROTO_RX_DATA,
+    PROTO_RX_CRC,
+    PROTO_RX_SKIP,
+};
+
+#define PROTO_FRAME_MASK    (PROTO_FRAME_NUM - 1)
+#define PROTO_NAK_NUM       4
+#define PROTO_TX_SIZE       (2 + PROTO_HDR_SIZE + sizeof(proto_result_t) + 4)
+
+typedef struct
+{
+    uint32_t crc;                                               /* ֡CRC */
+    uint32_t buf[(PROTO_HDR_SIZE + PROTO_MAX_PAYLOAD + 3) / 4]; /* ֡ͷ+, ֶCRC */
+} proto_frame_t;
+
+static uint8_t g_proto_rxdma[PROTO_RX_DMA_SIZE];
+static uint16_t g_proto_rxpos = 0;          /* ѴDMAλ */
+static uint32_t g_proto_rxtick = 0;         /* һյݵʱ */
+
+static proto_frame_t g_proto_frame[PROTO_FRAME_NUM];
+static volatile uint32_t g_proto_wr = 0;    /* жд֡ */
+static volatile uint32_t g_proto_rd = 0;    /* ѭ֡ */
+
+static uint8_t g_proto_state = PROTO_RX_SOF0;
+static uint8_t g_proto_hdr[PROTO_HDR_SIZE];
+static uint16_t g_proto_cnt;
+static uint16_t g_proto_len;
+
+/* ж﷢ֵĴ, ѭNAK(жﲻCRC) */
+static uint8_t g_proto_nak[PROTO_NAK_NUM][2];
+static volatile uint32_t g_proto_nak_wr = 0;
+static volatile uint32_t g_proto_nak_rd = 0;
+
+/* ͵Ӧ, ־ʱ´ٷ */
+static uint32_t g_proto_tx[(PROTO_TX_SIZE + 3) / 4 + 1];
+static uint16_t g_proto_txlen = 0;
+
+static float g_proto_in[PROTO_MAX_PAYLOAD];
+static proto_infer_t g_proto_infer;
+static proto_stats_t g_proto_stats;
+
+/**
+ * @brief       ֽ֡, Ĭ϶
+ *   @note      USART1ж, Ҫеģʵֱ
+ * @param       ch: ֽ
+ * @retval      
+ */
+__weak void proto_text_rx(uint8_t ch)
+{
+    UNUSED(ch);
+}
+
+/**
+ * @brief       CRC32(ӲCRC)
+ * @param       buf: , ֶ, β4ֽڵĲֱΪ0
+ * @param       len: ֽ
+ * @retval      CRC
+ */
+static uint32_t proto_crc(uint32_t *buf, uint16_t len)
+{
+    return HAL_CRC_Calculate(&hcrc, buf, (len + 3) / 4);
+}
+
+/**
+ * @brief       ¼һNAK(ж)
+ * @param       seq : 
+ * @param       code: 
+ * @retval      
+ */
+static void proto_nak(uint8_t seq, uint8_t code)
+{
+    if (g_proto_nak_wr - g_proto_nak_rd < PROTO_NAK_NUM)
+    {
+        g_proto_nak[g_proto_nak_wr % PROTO_NAK_NUM][0] = seq;
+        g_proto_nak[g_proto_nak_wr % PROTO_NAK_NUM][1] = code;
+        g_proto_nak_wr++;
+    }
+}
+
+/**
+ * @brief       ״̬, һֽ(ж)
+ * @param       ch: ֽ
+ * @retval      
+ */
+static void proto_rx_byte(uint8_t ch)
+{
+    uint8_t *p;
+
+    switch (g_proto_state)
+    {
+        case PROTO_RX_SOF0:
+            if (ch == PROTO_SOF0)
+            {
+                g_proto_state = PROTO_RX_SOF1;
+            }
+            else
+            {
+                proto_text_rx(ch);
+            }
+
+            break;
+
+        case PROTO_RX_SOF1:
+            if (ch == PROTO_SOF1)
+            {
+                g_proto_state = PROTO_RX_HDR;
+                g_proto_cnt = 0;
+            }
+            else if (ch != PROTO_SOF0)
+            {
+                g_proto_state = PROTO_RX_SOF0;
+            }
+
+            break;
+
+        case PROTO_RX_HDR:
+            g_proto_hdr[g_proto_cnt++] = ch;
+
+            if (g_proto_cnt < PROTO_HDR_SIZE)
+            {
+                break;
+            }
+
+            g_proto_len = g_proto_hdr[2] | (g_proto_hdr[3] << 8);
+            g_proto_cnt = 0;
+
+            if (g_proto_len > PROTO_MAX_PAYLOAD)    /* Ȳ, ֱ֡ͷ */
+            {
+                g_proto_stats.len_err++;
+                proto_nak(g_proto_hdr[1], PROTO_E_LEN);
+                g_proto_state = PROTO_RX_SOF0;
+                break;
+            }
+
+            if (g_proto_wr - g_proto_rd >= PROTO_FRAME_NUM) /* ֡, һ֡ */
+            {
+                g_proto_stats.busy++;
+                proto_nak(g_proto_hdr[1], PROTO_E_BUSY);
+                g_proto_len += 4;
+                g_proto_state = PROTO_RX_SKIP;
+                break;
+            }
+
+            memcpy(g_proto_frame[g_proto_wr & PROTO_FRAME_MASK].buf, g_proto_hdr, PROTO_HDR_SIZE);
+            g_proto_state = g_proto_len ? PROTO_RX_DATA : PROTO_RX_CRC;
+            break;
+
+        case PROTO_RX_DATA:
+            p = (uint8_t *)g_proto_frame[g_proto_wr & PROTO_FRAME_MASK].buf + PROTO_HDR_SIZE;
+            p[g_proto_cnt++] = ch;
+
+            if (g_proto_cnt == g_proto_len)
+            {
+                while (g_proto_cnt & 3)     /* CRCּ, β0 */
+                {
+                    p[g_proto_cnt++] = 0;
+                }
+
+                g_proto_cnt = 0;
+                g_proto_state = PROTO_RX_CRC;
+            }
+
+            break;
+
+        case PROTO_RX_CRC:
+            g_proto_frame[g_proto_wr & PROTO_FRAME_MASK].crc >>= 8;
+            g_proto_frame[g_proto_wr & PROTO_FRAME_MASK].crc |= (uint32_t)ch << 24;
+
+            if (++g_proto_cnt == 4)
+            {
+                g_proto_stats.frames++;
+                g_proto_wr++;
+                g_proto_state = PROTO_RX_SOF0;
+            }
+
+            break;
+
+        case PROTO_RX_SKIP:
+            if (--g_proto_len == 0)
+            {
+                g_proto_state = PROTO_RX_SOF0;
+            }
+
+            break;
+
+        default:
+            g_proto_state = PROTO_RX_SOF0;
+            break;
+    }
+}
+
+/**
+ * @brief       USART1¼ص(DMA/ȫ/·)
+ * @param       huart: ھ
+ * @param       Size : DMAµдλ
+ * @retval      
+ */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+    uint32_t tick;
+
+    if (huart->Instance != USART1)
+    {
+        return;
+    }
+
+    tick = HAL_GetTick();
+
+    if (g_proto_state != PROTO_RX_SOF0 && tick - g_proto_rxtick > PROTO_RX_TIMEOUT)
+    {
+        g_proto_stats.resync++;     /* һ֡ûͶ */
+        g_proto_state = PROTO_RX_SOF0;
+    }
+
+    g_proto_rxtick = tick;
+
+    if (Size >= PROTO_RX_DMA_SIZE)
+    {
+        Size = 0;
+    }
+
+    while (g_proto_rxpos != Size)
+    {
+        proto_rx_byte(g_proto_rxdma[g_proto_rxpos]);
+
+        if (++g_proto_rxpos >= PROTO_RX_DMA_SIZE)
+        {
+            g_proto_rxpos = 0;
+        }
+    }
+
+    log_poll();                     /* ־DMAΪռHALʧ */
+}
+
+/**
+ * @brief       USART1ص, 
+ * @param       huart: ھ
+ * @retval      
+ */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+    if (huart->Instance != USART1)
+    {
+        return;
+    }
+
+    g_proto_stats.uart_err++;
+
+    if (huart->RxState == HAL_UART_STATE_READY)     /* ձHALֹ */
+    {
+        g_proto_rxpos = 0;
+        g_proto_state = PROTO_RX_SOF0;
+        HAL_UARTEx_ReceiveToIdle_DMA(&huart1, g_proto_rxdma, PROTO_RX_DMA_SIZE);
+        log_poll();
+    }
+}
+
+/**
+ * @brief       һӦ֡ g_proto_tx
+ * @param       type: 
+ * @param       seq : 
+ * @param       data: 
+ * @param       len : س
+ * @retval      
+ */
+static void proto_build(uint8_t type, uint8_t seq, const void *data, uint16_t len)
+{
+    uint8_t *p = (uint8_t *)g_proto_tx;
+    uint32_t crc;
+
+    /* SOFڵ2,3ֽ, type~شֶλÿʼ */
+    memset(g_proto_tx, 0, sizeof(g_proto_tx));
+    p[2] = PROTO_SOF0;
+    p[3] = PROTO_SOF1;
+    p[4] = type;
+    p[5] = seq;
+    p[6] = len & 0xFF;
+    p[7] = len >> 8;
+    memcpy(&p[8], data, len);
+
+    crc = proto_crc(&g_proto_tx[1], PROTO_HDR_SIZE + len);
+    memcpy(&p[8 + len], &crc, 4);
+    g_proto_txlen = 2 + PROTO_HDR_SIZE + len + 4;
+}
+
+/**
+ * @brief       ʹӦ
+ * @param       
+ * @retval      0, ѷ; 1, ־, ´ٷ;
+ */
+static uint8_t proto_flush_tx(void)
+{
+    if (g_proto_txlen == 0)
+    {
+        return 0;
+    }
+
+    if (log_write((uint8_t *)g_proto_tx + 2, g_proto_txlen))
+    {
+        return 1;
+    }
+
+    g_proto_txlen = 0;
+    return 0;
+}
+
+/**
+ * @brief       һ֡
+ * @param       f: ֡
+ * @retval      
+ */
+static void proto_handle(proto_frame_t *f)
+{
+    uint8_t *hdr = (uint8_t *)f->buf;
+    uint8_t type = hdr[0];
+    uint8_t seq = hdr[1];
+    uint16_t len = hdr[2] | (hdr[3] << 8);
+    uint16_t i;
+    uint8_t code;
+    uint32_t size;
+    proto_ping_t ping;
+    proto_result_t res;
+
+    if (proto_crc(f->buf, PROTO_HDR_SIZE + len) != f->crc)
+    {
+        g_proto_stats.crc_err++;
+        code = PROTO_E_CRC;
+        proto_build(PROTO_T_ERR, seq, &code, 1);
+        return;
+    }
+
+    switch (type)
+    {
+        case PROTO_T_PING:
+            ping.version = PROTO_VERSION;
+            ping.frame_num = PROTO_FRAME_NUM;
+            ping.max_payload = PROTO_MAX_PAYLOAD;
+            ping.clock = SystemCoreClock;
+            proto_build(PROTO_T_PING | PROTO_T_ACK, seq, &ping, sizeof(ping));
+            break;
+
+        case PROTO_T_INFER:
+            if (len != PROTO_MAX_PAYLOAD || g_proto_infer == NULL)
+            {
+                code = PROTO_E_LEN;
+                proto_build(PROTO_T_ERR, seq, &code, 1);
+                break;
+            }
+
+            for (i = 0; i < PROTO_MAX_PAYLOAD; i++)
+            {
+                g_proto_in[i] = hdr[PROTO_HDR_SIZE + i] * (1.0f / 255.0f);
+            }
+
+            memset(&res, 0, sizeof(res));
+            res.cycles = g_proto_infer(g_proto_in, res.prob);
+
+            for (i = 1; i < 10; i++)
+            {
+                if (res.prob[i] > res.prob[res.result])
+                {
+                    res.result = i;
+                }
+            }
+
+            proto_build(PROTO_T_INFER | PROTO_T_ACK, seq, &res, sizeof(res));
+            break;
+
+        case PROTO_T_TRACE:
+            if (len < 2 || tprec_load(hdr[PROTO_HDR_SIZE] | (hdr[PROTO_HDR_SIZE + 1] << 8),
+                                      &hdr[PROTO_HDR_SIZE + 2], len - 2))
+            {
+                code = PROTO_E_LEN;
+                proto_build(PROTO_T_ERR, seq, &code, 1);
+                break;
+            }
+
+            size = tprec_size();
+            proto_build(PROTO_T_TRACE | PROTO_T_ACK, seq, &size, sizeof(size));
+            break;
+
+        default:
+            code = PROTO_E_TYPE;
+            proto_build(PROTO_T_ERR, seq, &code, 1);
+            break;
+    }
+}
+
+/**
+ * @brief       ʼЭ, ѭDMA
+ * @param       infer: 
+ * @retval      
+ */
+void proto_init(proto_infer_t infer)
+{
+    g_proto_infer = infer;
+    g_proto_rxpos = 0;
+    g_proto_state = PROTO_RX_SOF0;
+    HAL_UARTEx_ReceiveToIdle_DMA(&huart1, g_proto_rxdma, PROTO_RX_DMA_SIZE);
+    log_poll();                     /* ʱд־ûDMA */
+}
+
+/**
+ * @brief       յ֡, ÿദһ֡, ѭ
+ * @param       
+ * @retval      0, û֡; 1, һ֡;
+ */
+uint8_t proto_poll(void)
+{
+    uint8_t code;
+
+    if (proto_flush_tx())
+    {
+        return 0;
+    }
+
+    while (g_proto_nak_rd != g_proto_nak_wr)
+    {
+        code = g_proto_nak[g_proto_nak_rd % PROTO_NAK_NUM][1];
+        proto_build(PROTO_T_ERR, g_proto_nak[g_proto_nak_rd % PROTO_NAK_NUM][0], &code, 1);
+        g_proto_nak_rd++;
+
+        if (proto_flush_tx())
+        {
+            return 0;
+        }
+    }
+
+    if (g_proto_rd == g_proto_wr)
+    {
+        return 0;
+    }
+
+    proto_handle(&g_proto_frame[g_proto_rd & PROTO_FRAME_MASK]);
+    g_proto_rd++;   /* ֡Ѵ, ͷŸжϼ */
+    proto_flush_tx();
+    return 1;
+}
+
+/**
+ * @brief       ȡͳƼ
+ * @param       stats: 
+ * @retval      
+ */
+void proto_get_stats(proto_stats_t *stats)
+{
+    *stats = g_proto_stats;
+}
@@ -0,0 +1,451 @@
+/**
+ ****************************************************************************************************
+ * @file        sched.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ȼȵϢ(///ʾ/־)
+ ****************************************************************************************************
+ * @attention
+ *
+ * PendSV Ϊжȼ, ȼŷѭ, 
+ * ѭ(ai_network_runԼ60ms)ʱԱɨͻռ.
+ * PendSV֮䲻ụռ, ǶӦúܶ.
+ *
+ * ѭʱ۵ڼPendSVõʱ, ʱͬ۳.
+ *
+ ****************************************************************************************************
+ */
+
+#include "string.h"
+#include "sched.h"
+
+#ifndef HOST_SIM
+#include "log.h"
+#endif
+
+
+#define SCHED_PREEMPT_MASK  ((1u << SCHED_PRIO_THREAD) - 1)
+#define SCHED_THREAD_MASK   (((1u << SCHED_TASK_NUM) - 1) & ~SCHED_PREEMPT_MASK)
+
+static sched_task_t g_sched_task[SCHED_TASK_NUM];
+static volatile uint32_t g_sched_ready = 0;         /* ͷŵ, nλӦȼn */
+static volatile uint8_t g_sched_lock = 0;           /* sched_lock Ƕ״ */
+static volatile uint8_t g_sched_deferred = 0;       /* סڼƳ */
+static volatile uint32_t g_sched_isr_cycles = 0;    /* PendSVۼе */
+static uint64_t g_sched_idle = 0;                   /*  */
+static uint32_t g_sched_tick = 0;                   /* ͳƴڿʼʱ(ms) */
+
+/**
+ * @brief       ҳȼ
+ * @param       mask: λͼ
+ * @retval      ȼ, SCHED_TASK_NUMʾû
+ */
+static uint8_t sched_highest(uint32_t mask)
+{
+    uint8_t prio;
+
+    for (prio = 0; prio < SCHED_TASK_NUM; prio++)
+    {
+        if (mask & (1u << prio))
+        {
+            return prio;
+        }
+    }
+
+    return SCHED_TASK_NUM;
+}
+
+/**
+ * @brief       һ񲢸ͳ
+ * @param       prio: ȼ
+ * @retval      е(ռʱ)
+ */
+static uint32_t sched_exec(uint8_t prio)
+{
+    sched_task_t *task = &g_sched_task[prio];
+    uint32_t primask = __get_PRIMASK();
+    uint32_t release, start, end, period, t;
+
+    __disable_irq();
+    g_sched_ready &= ~(1u << prio);
+    release = task->release;
+    __set_PRIMASK(primask);
+
+    start = sched_now();
+    task->fn(task->arg);
+    end = sched_now();
+
+    t = start - release;
+    task->max_lat = (t > task->max_lat) ? t : task->max_lat;
+    t = end - release;
+    task->max_resp = (t > task->max_resp) ? t : task->max_resp;
+
+    if (task->deadline && t > task->deadline)
+    {
+        task->misses++;
+    }
+
+    if (task->period && task->runs)
+    {
+        period = task->period * (SystemCoreClock / 1000);
+        t = start - task->last_start;
+        t = (t > period) ? t - period : period - t;
+        task->max_jitter = (t > task->max_jitter) ? t : task->max_jitter;
+    }
+
+    task->last_start = start;
+    task->runs++;
+    return end - start;
+}
+
+/**
+ * @brief       ʼ
+ * @param       
+ * @retval      
+ */
+void sched_init(void)
+{
+    memset(g_sched_task, 0, sizeof(g_sched_task));
+    g_sched_ready = 0;
+    g_sched_lock = 0;
+    g_sched_deferred = 0;
+    g_sched_isr_cycles = 0;
+    g_sched_idle = 0;
+    g_sched_tick = HAL_GetTick();
+}
+
+/**
+ * @brief       
+ * @param       prio       : ȼ(0 ~ SCHED_TASK_NUM - 1), ÿȼֻһ
+ * @param       name       : ()
+ * @param       fn         : 
+ * @param       arg        : 
+ * @param       period_ms  : , 0ʾֻ¼ͷ
+ * @param       deadline_us: ͷŵĽֹʱ, 0ʾ
+ * @param       flags      : SCHED_EXT 
+ * @retval      0, ɹ; 1, ʧ;
+ */
+uint8_t sched_create(uint8_t prio, const char *name, sched_fn_t fn, void *arg,
+                     uint16_t period_ms, uint32_t deadline_us, uint8_t flags)
+{
+    sched_task_t *task;
+
+    if (prio >= SCHED_TASK_NUM || g_sched_task[prio].fn)
+    {
+        return 1;
+    }
+
+    task = &g_sched_task[prio];
+    task->name = name;
+    task->arg = arg;
+    task->period = period_ms;
+    task->flags = flags;
+    task->deadline = deadline_us * (SystemCoreClock / 1000000);
+    task->next = HAL_GetTick() + period_ms;
+    task->fn = fn;
+    return 0;
+}
+
+/**
+ * @brief       ͷ, ж
+ *   @note      ûֱͷֻһ( lost), ͷʱ̱Ǵ
+ * @param       prio: ȼ
+ * @retval      
+ */
+void sched_release(uint8_t prio)
+{
+    sched_task_t *task = &g_sched_task[prio];
+    uint32_t primask;
+
+    if (task->fn == NULL)
+    {
+        return;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (g_sched_ready & (1u << prio))
+    {
+        task->lost++;
+    }
+    else
+    {
+        task->release = sched_now();
+        g_sched_ready |= 1u << prio;
+    }
+
+    __set_PRIMASK(primask);
+
+    if (prio < SCHED_PRIO_THREAD)
+    {
+        sched_port_pend();
+    }
+}
+
+/**
+ * @brief       ͷŵĿռ,  PendSV_Handler 
+ * @param       
+ * @retval      
+ */
+void sched_isr(void)
+{
+    uint32_t t;
+    uint8_t prio;
+
+    if (g_sched_lock)
+    {
+        g_sched_deferred = 1;
+        return;
+    }
+
+    while ((prio = sched_highest(g_sched_ready & SCHED_PREEMPT_MASK)) < SCHED_TASK_NUM)
+    {
+        t = sched_exec(prio);
+        g_sched_task[prio].busy += t;
+        g_sched_isr_cycles += t;
+    }
+}
+
+/**
+ * @brief       ͷŵڵ
+ * @param       
+ * @retval      
+ */
+static void sched_release_periodic(void)
+{
+    uint32_t tick = HAL_GetTick();
+    uint8_t prio;
+    sched_task_t *task;
+
+    for (prio = 0; prio < SCHED_TASK_NUM; prio++)
+    {
+        task = &g_sched_task[prio];
+
+        if (task->fn && task->period && !(task->flags & SCHED_EXT) && (int32_t)(tick - task->next) >= 0)
+        {
+            task->next += task->period;
+
+            if ((int32_t)(tick - task->next) >= 0)  /* 󳬹һ,  */
+            {
+                task->next = tick + task->period;
+            }
+
+            sched_release(prio);
+        }
+    }
+}
+
+/**
+ * @brief       ȼЭ, ûоͿеһͷ
+ * @param       
+ * @retval      
+ */
+void sched_run(void)
+{
+    uint32_t isr0 = g_sched_isr_cycles;
+    uint32_t t, tick;
+    uint8_t prio;
+
+    sched_release_periodic();
+    prio = sched_highest(g_sched_ready & SCHED_THREAD_MASK);
+
+    if (prio < SCHED_TASK_NUM)
+    {
+        t = sched_exec(prio);
+        g_sched_task[prio].busy += t - (g_sched_isr_cycles - isr0);
+        return;
+    }
+
+    t = sched_now();
+    tick = HAL_GetTick();
+
+    while (!(g_sched_ready & SCHED_THREAD_MASK) && HAL_GetTick() == tick)
+    {
+        sched_port_idle();
+    }
+
+    g_sched_idle += (sched_now() - t) - (g_sched_isr_cycles - isr0);
+}
+
+/**
+ * @brief       ͣPendSV, Ƕ
+ * @param       
+ * @retval      
+ */
+void sched_lock(void)
+{
+    g_sched_lock++;
+}
+
+/**
+ * @brief       ָPendSV, סڼ䱻Ƴٵ
+ * @param       
+ * @retval      
+ */
+void sched_unlock(void)
+{
+    if (--g_sched_lock == 0 && g_sched_deferred)
+    {
+        g_sched_deferred = 0;
+        sched_port_pend();
+    }
+}
+
+/**
+ * @brief       ȡͱͳƴڵͳ
+ * @param       prio: ȼ
+ * @retval      
+ */
+const sched_task_t *sched_get(uint8_t prio)
+{
+    return &g_sched_task[prio];
+}
+
+/**
+ * @brief       ʼϢ
+ * @param       q   : 
+ * @param       buf : 洢, size * num ֽ
+ * @param       size: Ϣֽ
+ * @param       num : Ϣ, 2
+ * @param       task: յϢʱͷŵ, 0xFFʾͷ
+ * @retval      
+ */
+void sched_queue_init(sched_queue_t *q, void *buf, uint16_t size, uint16_t num, uint8_t task)
+{
+    q->buf = (uint8_t *)buf;
+    q->size = size;
+    q->num = num;
+    q->wr = 0;
+    q->rd = 0;
+    q->task = task;
+    q->drops = 0;
+}
+
+/**
+ * @brief       һϢͷŽ
+ * @param       q  : 
+ * @param       msg: Ϣ
+ * @retval      0, ɹ; 1, ;
+ */
+uint8_t sched_queue_put(sched_queue_t *q, const void *msg)
+{
+    uint16_t wr = q->wr;
+
+    if ((uint16_t)(wr - q->rd) >= q->num)
+    {
+        q->drops++;
+        return 1;
+    }
+
+    memcpy(q->buf + (wr & (q->num - 1)) * q->size, msg, q->size);
+    q->wr = wr + 1;
+
+    if (q->task < SCHED_TASK_NUM)
+    {
+        sched_release(q->task);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       һϢ
+ * @param       q  : 
+ * @param       msg: Ϣ, NULLʾֱӶ
+ * @retval      0, ɹ; 1, п;
+ */
+uint8_t sched_queue_get(sched_queue_t *q, void *msg)
+{
+    uint16_t rd = q->rd;
+
+    if (rd == q->wr)
+    {
+        return 1;
+    }
+
+    if (msg)
+    {
+        memcpy(msg, q->buf + (rd & (q->num - 1)) * q->size, q->size);
+    }
+
+    q->rd = rd + 1;
+    return 0;
+}
+
+/**
+ * @brief       ʱ, ־
+ * @param       
+ * @retval      
+ */
+void sched_poll(void)
+{
+#if SCHED_REPORT_MS
+    if (HAL_GetTick() - g_sched_tick >= SCHED_REPORT_MS)
+    {
+        sched_report();
+    }
+#endif
+}
+
+/**
+ * @brief       ΢
+ * @param       cycles: 
+ * @retval      ΢
+ */
+static uint32_t sched_to_us(uint32_t cycles)
+{
+    return cycles / (SystemCoreClock / 1000000);
+}
+
+/**
+ * @brief       沢ͳ
+ *   @note      ÿһ: д ʧͷ ʱ ӳ Ӧ ڶ(us) CPUռ
+ * @param       
+ * @retval      
+ */
+void sched_report(void)
+{
+    uint32_t ms = HAL_GetTick() - g_sched_tick;
+    uint64_t total = (uint64_t)ms * (SystemCoreClock / 1000);
+    uint32_t permille;
+    uint8_t prio;
+    sched_task_t *task;
+
+    if (total == 0)
+    {
+        return;
+    }
+
+    log_printf("sched: %lums, task n lost miss lat resp jit cpu%%\r\n", (unsigned long)ms);
+
+    for (prio = 0; prio < SCHED_TASK_NUM; prio++)
+    {
+        task = &g_sched_task[prio];
+
+        if (task->fn == NULL)
+        {
+            continue;
+        }
+
+        permille = (uint32_t)(task->busy * 1000 / total);
+        log_printf("%-7s%6lu%5lu%5lu%7lu%8lu%8lu%4lu.%lu\r\n", task->name, (unsigned long)task->runs,
+                   (unsigned long)task->lost, (unsigned long)task->misses,
+                   (unsigned long)sched_to_us(task->max_lat), (unsigned long)sched_to_us(task->max_resp),
+                   (unsigned long)sched_to_us(task->max_jitter),
+                   (unsigned long)(permille / 10), (unsigned long)(permille % 10));
+
+        task->runs = 0;
+        task->lost = 0;
+        task->misses = 0;
+        task->max_lat = 0;
+        task->max_resp = 0;
+        task->max_jitter = 0;
+        task->busy = 0;
+    }
+
+    permille = (uint32_t)(g_sched_idle * 1000 / total);
+    log_printf("idle %lu.%lu%%\r\n", (unsigned long)(permille / 10), (unsigned long)(permille % 10));
+    g_sched_idle = 0;
+    g_sched_tick = HAL_GetTick();
+}
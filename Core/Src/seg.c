@@ -0,0 +1,375 @@
+/**
+ ****************************************************************************************************
+ * @file        seg.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       λָ: γ + 鼯ͨ
+ ****************************************************************************************************
+ * @attention
+ *
+ * γ̳ص0Ų, ±0ʾ, ȫ0бͷǿ, óʼ.
+ * ͬһкϲγ̴ժ, ڲ鼯(Ǳ˵ĸ), ֱ seg_clear.
+ * 鼯·, ϲʱ±Сĵ.
+ *
+ ****************************************************************************************************
+ */
+
+#include "seg.h"
+#include "string.h"
+
+
+#define SEG_NIL             0           /*  */
+
+/* һγ */
+typedef struct
+{
+    uint16_t next;                      /* ͬһұߵһγ */
+    uint16_t parent;                    /* 鼯 */
+    uint8_t x0, x1;                     /*  */
+    uint8_t group;                      /* seg_run ֵ(ͨ), 0xFF ʾû */
+    uint8_t reserved;
+} seg_span_t;
+
+static seg_span_t g_seg_span[SEG_SPAN_MAX];
+static uint16_t g_seg_head[SEG_ROWS];   /* ÿߵγ */
+static uint16_t g_seg_num = 1;          /* õγ(0) */
+static uint8_t g_seg_full = 0;          /* 1, γ̳ */
+
+/**
+ * @brief       
+ * @param       
+ * @retval      
+ */
+void seg_clear(void)
+{
+    memset(g_seg_head, 0, sizeof(g_seg_head));
+    g_seg_num = 1;
+    g_seg_full = 0;
+}
+
+/**
+ * @brief       鼯: Ҹ
+ * @param       k: γ
+ * @retval      
+ */
+static uint16_t seg_find(uint16_t k)
+{
+    seg_span_t *s = g_seg_span;
+
+    while (s[k].parent != k)
+    {
+        s[k].parent = s[s[k].parent].parent;    /* · */
+        k = s[k].parent;
+    }
+
+    return k;
+}
+
+/**
+ * @brief       鼯: ϲ
+ * @param       a,b: γ
+ * @retval      
+ */
+static void seg_union(uint16_t a, uint16_t b)
+{
+    a = seg_find(a);
+    b = seg_find(b);
+
+    if (a < b)
+    {
+        g_seg_span[b].parent = a;
+    }
+    else if (b < a)
+    {
+        g_seg_span[a].parent = b;
+    }
+}
+
+/**
+ * @brief       һī, ͬһСӵγ̺ϲ
+ * @param       row  : 
+ * @param       x0,x1: (x0 <= x1)
+ * @retval      
+ */
+void seg_add(uint8_t row, uint8_t x0, uint8_t x1)
+{
+    seg_span_t *s = g_seg_span;
+    uint16_t prev = SEG_NIL, k, n;
+    int16_t r;
+
+    if (g_seg_full || row >= SEG_ROWS)
+    {
+        return;
+    }
+
+    for (k = g_seg_head[row]; k != SEG_NIL && s[k].x1 + 1 < x0; k = s[k].next)
+    {
+        prev = k;
+    }
+
+    if (k == SEG_NIL || s[k].x0 > x1 + 1)   /* ͱγ: ½ */
+    {
+        if (g_seg_num >= SEG_SPAN_MAX)
+        {
+            g_seg_full = 1;
+            return;
+        }
+
+        n = g_seg_num++;
+        s[n].next = k;
+        s[n].parent = n;
+        s[n].x0 = x0;
+        s[n].x1 = x1;
+        s[n].group = 0xFF;
+
+        if (prev == SEG_NIL)
+        {
+            g_seg_head[row] = n;
+        }
+        else
+        {
+            s[prev].next = n;
+        }
+
+        k = n;
+    }
+    else                                    /* : չ, ̵ұӵ */
+    {
+        s[k].x0 = (x0 < s[k].x0) ? x0 : s[k].x0;
+        s[k].x1 = (x1 > s[k].x1) ? x1 : s[k].x1;
+
+        while ((n = s[k].next) != SEG_NIL && s[n].x0 <= s[k].x1 + 1)
+        {
+            s[k].x1 = (s[n].x1 > s[k].x1) ? s[n].x1 : s[k].x1;
+            s[k].next = s[n].next;
+            seg_union(k, n);
+        }
+    }
+
+    for (r = row - 1; r <= row + 1; r += 2) /* , бҲ */
+    {
+        if (r < 0 || r >= SEG_ROWS)
+        {
+            continue;
+        }
+
+        for (n = g_seg_head[r]; n != SEG_NIL && s[n].x0 <= s[k].x1 + 1; n = s[n].next)
+        {
+            if (s[n].x1 + 1 >= s[k].x0)
+            {
+                seg_union(k, n);
+            }
+        }
+    }
+}
+
+/**
+ * @brief       ӿϲ
+ * @param       a: ϲ
+ * @param       b: һ
+ * @retval      
+ */
+static void seg_box_merge(seg_box_t *a, const seg_box_t *b)
+{
+    a->x0 = (b->x0 < a->x0) ? b->x0 : a->x0;
+    a->y0 = (b->y0 < a->y0) ? b->y0 : a->y0;
+    a->x1 = (b->x1 > a->x1) ? b->x1 : a->x1;
+    a->y1 = (b->y1 > a->y1) ? b->y1 : a->y1;
+}
+
+/**
+ * @brief       صǷ񳬹խһ SEG_OVERLAP%
+ * @param       a,b: ӿ
+ * @retval      1, ͬһ; 0, 
+ */
+static uint8_t seg_same(const seg_box_t *a, const seg_box_t *b)
+{
+    int16_t lo = (a->x0 > b->x0) ? a->x0 : b->x0;
+    int16_t hi = (a->x1 < b->x1) ? a->x1 : b->x1;
+    int16_t wa = a->x1 - a->x0 + 1, wb = b->x1 - b->x0 + 1;
+
+    return (hi - lo + 1) * 100 >= SEG_OVERLAP * ((wa < wb) ? wa : wb);
+}
+
+/**
+ * @brief       ָ: ͨ -> , ÿγ̼
+ * @param       box: ֵӿ(), 
+ * @param       max: box ĴС
+ * @retval      , 0ʾûīγ̳
+ */
+uint8_t seg_run(seg_box_t *box, uint8_t max)
+{
+    seg_span_t *s = g_seg_span;
+    seg_box_t comp[SEG_COMP_MAX];       /* ͨ */
+    seg_box_t grp[SEG_COMP_MAX];        /*  */
+    uint8_t order[SEG_COMP_MAX];        /* ͨ */
+    uint8_t cg[SEG_COMP_MAX];           /* ͨ ->  */
+    uint8_t nc = 0, ng = 0, i, j, c, pass, small, best;
+    uint16_t k, root, d, dmin;
+    int16_t gap, gmin;
+
+    if (g_seg_full)
+    {
+        return 0;
+    }
+
+    for (k = 1; k < g_seg_num; k++)
+    {
+        s[k].group = 0xFF;
+    }
+
+    for (i = 0; i < SEG_ROWS; i++)      /* ͨǵӿ */
+    {
+        for (k = g_seg_head[i]; k != SEG_NIL; k = s[k].next)
+        {
+            root = seg_find(k);
+
+            if (s[root].group == 0xFF && nc < SEG_COMP_MAX)
+            {
+                comp[nc].x0 = s[k].x0;
+                comp[nc].x1 = s[k].x1;
+                comp[nc].y0 = i;
+                s[root].group = nc++;
+            }
+            else if (s[root].group == 0xFF)
+            {
+                s[root].group = SEG_COMP_MAX - 1;
+            }
+
+            c = s[root].group;
+            s[k].group = c;
+            comp[c].x0 = (s[k].x0 < comp[c].x0) ? s[k].x0 : comp[c].x0;
+            comp[c].x1 = (s[k].x1 > comp[c].x1) ? s[k].x1 : comp[c].x1;
+            comp[c].y1 = i;
+        }
+    }
+
+    for (i = 0; i < nc; i++)            /* ߲ */
+    {
+        for (j = i; j > 0 && comp[order[j - 1]].x0 > comp[i].x0; j--)
+        {
+            order[j] = order[j - 1];
+        }
+
+        order[j] = i;
+    }
+
+    for (pass = 0; pass < 2; pass++)    /* Ŵͨ, ٰСĲ */
+    {
+        for (i = 0; i < nc; i++)
+        {
+            c = order[i];
+            small = (comp[c].x1 - comp[c].x0 < SEG_MIN_SIZE - 1) && (comp[c].y1 - comp[c].y0 < SEG_MIN_SIZE - 1);
+
+            if (small != pass)
+            {
+                continue;
+            }
+
+            if (pass && ng)
+            {
+                for (j = 0, best = 0, dmin = 0xFFFF; j < ng; j++)
+                {
+                    gap = (int16_t)(grp[j].x0 + grp[j].x1) - (comp[c].x0 + comp[c].x1);
+                    d = (gap < 0) ? -gap : gap;
+
+                    if (d < dmin)
+                    {
+                        dmin = d;
+                        best = j;
+                    }
+                }
+
+                cg[c] = best;
+                seg_box_merge(&grp[best], &comp[c]);
+            }
+            else if (ng && seg_same(&grp[ng - 1], &comp[c]))
+            {
+                cg[c] = ng - 1;
+                seg_box_merge(&grp[ng - 1], &comp[c]);
+            }
+            else
+            {
+                cg[c] = ng;
+                grp[ng++] = comp[c];
+            }
+        }
+    }
+
+    while (ng > max)                    /* ̫: ϲС */
+    {
+        for (i = 0, best = 0, gmin = 0x7FFF; i + 1 < ng; i++)
+        {
+            gap = grp[i + 1].x0 - grp[i].x1;
+
+            if (gap < gmin)
+            {
+                gmin = gap;
+                best = i;
+            }
+        }
+
+        seg_box_merge(&grp[best], &grp[best + 1]);
+
+        for (i = best + 1; i + 1 < ng; i++)
+        {
+            grp[i] = grp[i + 1];
+        }
+
+        for (i = 0; i < nc; i++)
+        {
+            cg[i] -= (cg[i] > best) ? 1 : 0;
+        }
+
+        ng--;
+    }
+
+    for (i = 0; i < ng; i++)
+    {
+        box[i] = grp[i];
+    }
+
+    for (i = 0; i < SEG_ROWS; i++)      /* γ: ͨ ->  */
+    {
+        for (k = g_seg_head[i]; k != SEG_NIL; k = s[k].next)
+        {
+            s[k].group = cg[s[k].group];
+        }
+    }
+
+    return ng;
+}
+
+/**
+ * @brief       sһ(seg_run ֮ӵγ̲)
+ * @param       s   : 
+ * @param       row : 
+ * @param       x0  : ʼ
+ * @param       w   : 
+ * @param       mask: , ֵĸΪ0xFF, Ϊ0
+ * @retval      
+ */
+void seg_mask(uint8_t s, uint8_t row, uint8_t x0, uint8_t w, uint8_t *mask)
+{
+    seg_span_t *p = g_seg_span;
+    uint16_t k;
+    uint8_t a, b;
+
+    if (g_seg_full)
+    {
+        memset(mask, 0xFF, w);
+        return;
+    }
+
+    memset(mask, 0, w);
+
+    for (k = g_seg_head[row]; k != SEG_NIL && p[k].x0 < x0 + w; k = p[k].next)
+    {
+        if (p[k].group == s && p[k].x1 >= x0)
+        {
+            a = (p[k].x0 > x0) ? p[k].x0 : x0;
+            b = (p[k].x1 < x0 + w - 1) ? p[k].x1 : x0 + w - 1;
+            memset(mask + a - x0, 0xFF, b - a + 1);
+        }
+    }
+}
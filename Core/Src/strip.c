@@ -0,0 +1,258 @@
+/**
+ ****************************************************************************************************
+ * @file        strip.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʶ: һ 28xW , (ȫ)ʶλ, ÷ָ
+ ****************************************************************************************************
+ * @attention
+ *
+ * ʱ: [0, NN_STRIP_SCRATCH)  nn_ref_strip(ſ֮ǰ, Ƚÿеī),
+ * ȻÿڵĸʡҶȡÿڵīſ.
+ *
+ ****************************************************************************************************
+ */
+
+#include "strip.h"
+#include "string.h"
+
+
+#define STRIP_PROB          NN_STRIP_SCRATCH
+#define STRIP_IMAGE         (STRIP_PROB + STRIP_POS_MAX * NN_OUT_NUM * 4)
+#define STRIP_GATE          (STRIP_IMAGE + PREP_OUT * STRIP_W_MAX)
+
+typedef char strip_scratch_check[(STRIP_SCRATCH <= NN_REF_SCRATCH) ? 1 : -1];   /* ϽX-CUBE-AIļ */
+
+/**
+ * @brief       Ҷʱλ
+ * @param       scratch: ʱ,  STRIP_SCRATCH ֽ, 4ֽڶ
+ * @retval      28 x STRIP_W_MAX ֽ
+ */
+uint8_t *strip_image(void *scratch)
+{
+    return (uint8_t *)scratch + STRIP_IMAGE;
+}
+
+/**
+ * @brief       kڵĸ(ϴ strip_run , ûȫӵĴȫ0)
+ * @param       scratch: ʱ
+ * @param       k      : 
+ * @retval      10
+ */
+const float *strip_prob(void *scratch, uint16_t k)
+{
+    return (const float *)((uint8_t *)scratch + STRIP_PROB) + k * NN_OUT_NUM;
+}
+
+/**
+ * @brief       һ [a, b] ī
+ * @param       col : ÿеī
+ * @param       a, b: зΧ
+ * @retval      (, )
+ */
+static uint8_t strip_center(const uint32_t *col, uint16_t a, uint16_t b)
+{
+    uint32_t m = 0, mx = 0;
+    uint16_t x;
+
+    for (x = a; x <= b; x++)
+    {
+        m += col[x];
+        mx += col[x] * x;
+    }
+
+    return m ? (mx + m / 2) / m : (a + b) / 2;
+}
+
+/**
+ * @brief       īֱͶӰ: īһ, ̫Ķڹȵ״ֳɼ
+ * @param       img: 
+ * @param       w  : 
+ * @param       col: ʱ, w 
+ * @param       r  : ,  count  at
+ * @retval      
+ */
+static void strip_find(const uint8_t *img, uint16_t w, uint32_t *col, strip_result_t *r)
+{
+    uint16_t run[SEG_COMP_MAX][2];
+    uint32_t mass[SEG_COMP_MAX], max = 0;
+    uint16_t x, y, a, b, p, cut, lo, hi;
+    uint8_t n = 0, i, j, m;
+
+    memset(col, 0, w * sizeof(uint32_t));
+
+    for (y = 0; y < PREP_OUT; y++)
+    {
+        for (x = 0; x < w; x++)
+        {
+            col[x] += *img++;
+        }
+    }
+
+    for (x = 0; x < w && n < SEG_COMP_MAX; x++)     /* ī */
+    {
+        if (col[x] < STRIP_INK)
+        {
+            continue;
+        }
+
+        run[n][0] = x;
+        mass[n] = 0;
+
+        for (; x < w && col[x] >= STRIP_INK; x++)
+        {
+            mass[n] += col[x];
+        }
+
+        run[n][1] = x - 1;
+        max = (mass[n] > max) ? mass[n] : max;
+        n++;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        if (mass[i] * 100 < max * STRIP_MIN)        /* ǵĵ */
+        {
+            continue;
+        }
+
+        a = run[i][0];
+        b = run[i][1];
+        m = (b - a + 1 <= STRIP_SPLIT) ? 1 : (b - a + 1 + STRIP_PITCH / 2) / STRIP_PITCH;
+
+        for (j = 1; j <= m && r->count < SEG_MAX; j++)
+        {
+            cut = b;
+
+            if (j < m)                              /* ֵ㸽ҹȵ */
+            {
+                p = run[i][0] + (uint32_t)j * (run[i][1] - run[i][0] + 1) / m;
+                lo = (p > a + STRIP_VALLEY) ? p - STRIP_VALLEY : a + 1;
+                hi = (p + STRIP_VALLEY < b) ? p + STRIP_VALLEY : b - 1;
+
+                for (x = cut = lo; x <= hi; x++)
+                {
+                    cut = (col[x] < col[cut]) ? x : cut;
+                }
+            }
+
+            r->at[r->count++] = strip_center(col, a, cut);
+            a = cut + 1;
+        }
+    }
+}
+
+/**
+ * @brief       kڶcֵȨ: cһʱԲֵ
+ *   @note      c ڵһһڵ֮, дڵȨش0
+ * @param       k  : 
+ * @param       pos: 
+ * @param       c  : ()
+ * @retval      Ȩ(0 ~ NN_STRIP_STEP)
+ */
+static int16_t strip_weight(uint16_t k, uint16_t pos, uint8_t c)
+{
+    int16_t lo = NN_IN_W / 2, hi = (pos - 1) * NN_STRIP_STEP + NN_IN_W / 2;
+    int16_t d = (int16_t)(k * NN_STRIP_STEP + NN_IN_W / 2) - ((c < lo) ? lo : (c > hi) ? hi : c);
+
+    d = (d < 0) ? -d : d;
+    return (d < NN_STRIP_STEP) ? NN_STRIP_STEP - d : 0;
+}
+
+/**
+ * @brief       : ÿȡߴڵĸʰֵ, 
+ *   @note      strip_run һ;  strip_prob ĸ(𴰿ڵ)ٵһ
+ * @param       scratch: ʱ()
+ * @param       r      : ,  pos/count/at  num/conf/prob
+ * @retval      
+ */
+void strip_decode(void *scratch, strip_result_t *r)
+{
+    float acc[NN_OUT_NUM], sum;
+    const float *p;
+    int16_t wt;
+    uint16_t k;
+    uint8_t i, j;
+
+    for (i = 0; i < r->count; i++)
+    {
+        memset(acc, 0, sizeof(acc));
+        sum = 0;
+
+        for (k = 0; k < r->pos; k++)
+        {
+            wt = strip_weight(k, r->pos, r->at[i]);
+
+            if (wt == 0)
+            {
+                continue;
+            }
+
+            p = strip_prob(scratch, k);
+            sum += wt;
+
+            for (j = 0; j < NN_OUT_NUM; j++)
+            {
+                acc[j] += wt * p[j];
+            }
+        }
+
+        for (j = 1, r->num[i] = 0; j < NN_OUT_NUM; j++)
+        {
+            r->num[i] = (acc[j] > acc[r->num[i]]) ? j : r->num[i];
+        }
+
+        r->conf[i] = acc[r->num[i]] / sum;
+
+        for (j = 0; j < NN_OUT_NUM; j++)
+        {
+            r->prob[j] = acc[j] / sum;
+        }
+    }
+}
+
+/**
+ * @brief       ʶ( prep_strip д strip_image )
+ * @param       scratch: ʱ,  STRIP_SCRATCH ֽ, 4ֽڶ
+ * @param       w      : (prep_strip ķֵ), 0 ʾ
+ * @param       gated  : 1, ֻſͨĴȫ(ͬ, ˼); 0, ÿڶ
+ * @param       r      : 
+ * @retval      
+ */
+uint8_t strip_run(void *scratch, uint16_t w, uint8_t gated, strip_result_t *r)
+{
+    uint8_t *gate = (uint8_t *)scratch + STRIP_GATE;
+    uint16_t k;
+    uint8_t i;
+
+    memset(r, 0, sizeof(*r));
+
+    if (w < NN_IN_W || w > STRIP_W_MAX)
+    {
+        return 0;
+    }
+
+    r->w = w;
+    r->pos = w / NN_STRIP_STEP - 6;
+    strip_find(strip_image(scratch), w, (uint32_t *)scratch, r);
+    memset(gate, 0, r->pos);
+
+    for (i = 0; i < r->count; i++)      /* ֻߵĴҪȫ */
+    {
+        for (k = 0; k < r->pos; k++)
+        {
+            gate[k] |= (strip_weight(k, r->pos, r->at[i]) > 0);
+        }
+    }
+
+    for (k = 0; k < r->pos; k++)
+    {
+        r->heads += gated ? gate[k] : 1;
+    }
+
+    nn_ref_strip(strip_image(scratch), w, gated ? gate : NULL,
+                 (float (*)[NN_OUT_NUM])((uint8_t *)scratch + STRIP_PROB), scratch);
+    r->macc = nn_ref_strip_macc(w, r->heads);
+    strip_decode(scratch, r);
+    return r->count;
+}
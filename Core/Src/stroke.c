@@ -0,0 +1,257 @@
+/**
+ ****************************************************************************************************
+ * @file        stroke.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʻ: 1-euro ˲, Ԥʼ, Catmull-Rom ֵ
+ ****************************************************************************************************
+ * @attention
+ *
+ * 1-euro ˲ Casiez , "1 Euro Filter" (CHI 2012): λúٶȸһһ׵ͨ,
+ * λõĽֹƵ = STROKE_MIN_CUTOFF + STROKE_BETA * |ٶ|, ֿ.
+ * ԭĵٶ ( - һ˲ֵ) / dt, ˲ֵͺ, ٶƫ, ƻͷ;
+ * Ĳ, ֻٶȵĵͨȥ.
+ *
+ ****************************************************************************************************
+ */
+
+#include <math.h>
+#include "stroke.h"
+
+
+/**
+ * @brief       һ׵ͨϵ
+ * @param       cutoff: ֹƵ(Hz)
+ * @param       dt    : ()
+ * @retval      ֵȨ(0~1)
+ */
+static float stroke_alpha(float cutoff, float dt)
+{
+    float tau = 1.0f / (2.0f * 3.14159265f * cutoff);
+
+    return 1.0f / (1.0f + tau / dt);
+}
+
+/**
+ * @brief       һ 1-euro ˲
+ * @param       f : ˲λ, 
+ * @param       v : ˲ٶ, 
+ * @param       x : ²
+ * @param       xp: һ
+ * @param       dt: ()
+ * @retval      
+ */
+static void stroke_euro(float *f, float *v, float x, float xp, float dt)
+{
+    float cutoff;
+
+    *v += stroke_alpha(STROKE_D_CUTOFF, dt) * ((x - xp) / dt - *v);
+    cutoff = STROKE_MIN_CUTOFF + STROKE_BETA * ((*v < 0) ? -*v : *v);
+    *f += stroke_alpha(cutoff, dt) * (x - *f);
+}
+
+/**
+ * @brief       Q4 ת(, 0)
+ * @param       v: Q4 
+ * @retval      
+ */
+static uint16_t stroke_px(int32_t v)
+{
+    return (v < 0) ? 0 : (uint16_t)((v + 8) >> 4);
+}
+
+/**
+ * @brief       һ: p1 -> p2  Catmull-Rom (Ȳ)
+ *   @note      p(t) = (2p1 + (p2-p0)t + (2p0-5p1+4p2-p3)t^2 + (-p0+3p1-3p2+p3)t^3) / 2,
+ *              Q4, tȡQ8,  Horner , 32λ. t = 1 ʱ p2.
+ * @param       p0,p1,p2,p3: ĸƵ(Q4)
+ * @param       out        : ϵĵ,  p1, һ p2
+ * @retval      
+ */
+static uint8_t stroke_curve(const int32_t *p0, const int32_t *p1, const int32_t *p2, const int32_t *p3, uint16_t out[][2])
+{
+    int32_t dx = p2[0] - p1[0], dy = p2[1] - p1[1];
+    int32_t len, b, c, d, t, v;
+    uint8_t n, i, k;
+
+    dx = (dx < 0) ? -dx : dx;
+    dy = (dy < 0) ? -dy : dy;
+    len = ((dx > dy) ? dx : dy) >> 4;
+
+    if (len < STROKE_CURVE_MIN)
+    {
+        n = 1;                          /* ̵ֱֱ */
+    }
+    else
+    {
+        n = (len + STROKE_CURVE_STEP - 1) / STROKE_CURVE_STEP;
+        n = (n > STROKE_CURVE_MAX) ? STROKE_CURVE_MAX : n;
+    }
+
+    for (k = 0; k < 2; k++)
+    {
+        b = p2[k] - p0[k];
+        c = 2 * p0[k] - 5 * p1[k] + 4 * p2[k] - p3[k];
+        d = -p0[k] + 3 * p1[k] - 3 * p2[k] + p3[k];
+
+        for (i = 1; i < n; i++)
+        {
+            t = ((int32_t)i << 8) / n;
+            v = (((d * t) >> 8) + c) * t >> 8;
+            v = ((v + b) * t >> 8) + 2 * p1[k];
+            out[i - 1][k] = stroke_px(v >> 1);
+        }
+
+        out[n - 1][k] = stroke_px(p2[k]);
+    }
+
+    return n;
+}
+
+/**
+ * @brief       : һֱΪ˲ĳֵ, ҲǶ
+ * @param       s  : ʻ
+ * @param       x,y: 
+ * @retval      
+ */
+void stroke_begin(stroke_t *s, uint16_t x, uint16_t y)
+{
+    s->x = x;
+    s->y = y;
+    s->vx = 0;
+    s->vy = 0;
+    s->rx = x;
+    s->ry = y;
+    s->p[3][0] = (int32_t)x << 4;
+    s->p[3][1] = (int32_t)y << 4;
+    s->n = 1;
+}
+
+/**
+ * @brief       һ: ˲, 嵹ڶ˲֮ǰһ
+ * @param       s    : ʻ
+ * @param       x,y  : 
+ * @param       dt_us: һļ(us)
+ * @param       out  : ĵ(ϴζĩ),  STROKE_CURVE_MAX 
+ * @retval      ĵ, 0ʾûж
+ */
+uint8_t stroke_add(stroke_t *s, uint16_t x, uint16_t y, uint32_t dt_us, uint16_t out[][2])
+{
+    float dt = ((dt_us < 1000) ? 1000 : dt_us) * 1e-6f;     /* ͬһɨظ㰴1ms */
+    int32_t px, py;
+    uint8_t i;
+
+    stroke_euro(&s->x, &s->vx, x, s->rx, dt);
+    stroke_euro(&s->y, &s->vy, y, s->ry, dt);
+    s->rx = x;
+    s->ry = y;
+
+    px = (s->x < 0) ? 0 : (int32_t)(s->x * 16 + 0.5f);
+    py = (s->y < 0) ? 0 : (int32_t)(s->y * 16 + 0.5f);
+
+    if (px == s->p[3][0] && py == s->p[3][1])
+    {
+        return 0;                       /* û */
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+        s->p[i][0] = s->p[i + 1][0];
+        s->p[i][1] = s->p[i + 1][1];
+    }
+
+    s->p[3][0] = px;
+    s->p[3][1] = py;
+    s->n += (s->n < 4) ? 1 : 0;
+
+    if (s->n < 3)
+    {
+        return 0;
+    }
+
+    return stroke_curve(s->p[(s->n == 3) ? 1 : 0], s->p[1], s->p[2], s->p[3], out);
+}
+
+/**
+ * @brief       ̧: һ(ûе, ĩظһ)
+ * @param       s  : ʻ
+ * @param       out: ĵ,  STROKE_CURVE_MAX 
+ * @retval      ĵ
+ */
+uint8_t stroke_end(stroke_t *s, uint16_t out[][2])
+{
+    uint8_t n = s->n;
+
+    s->n = 0;
+
+    if (n < 2)
+    {
+        return 0;
+    }
+
+    return stroke_curve(s->p[(n == 2) ? 2 : 1], s->p[2], s->p[3], s->p[3], out);
+}
+
+/**
+ * @brief       µ˲(ûһεյ)
+ * @param       s  : ʻ
+ * @param       x,y: 
+ * @retval      
+ */
+void stroke_last(const stroke_t *s, uint16_t *x, uint16_t *y)
+{
+    *x = stroke_px(s->p[3][0]);
+    *y = stroke_px(s->p[3][1]);
+}
+
+/**
+ * @brief       Ʊʼ: ˲ٶ, һ˲ķ, μнcos8η(ԽԽ),
+ *              һεĳȺ STROKE_PREDICT_MAX; , ٶȵ STROKE_PREDICT_VMIN,
+ *              չ90Ȼͷʱ
+ * @param       s  : ʻ
+ * @param       ms : ʱ
+ * @param       x,y: Ԥ
+ * @retval      
+ */
+void stroke_predict(const stroke_t *s, uint16_t ms, uint16_t *x, uint16_t *y)
+{
+    float dx = s->vx * ms * 1e-3f;
+    float dy = s->vy * ms * 1e-3f;
+    float m = (dx < 0) ? -dx : dx;
+    float ax, ay, bx, by, a, b, k;
+
+    m = (dy > m) ? dy : (-dy > m) ? -dy : m;
+
+    ax = (s->p[2][0] - s->p[1][0]) * (1.0f / 16);   /* ڶ */
+    ay = (s->p[2][1] - s->p[1][1]) * (1.0f / 16);
+    bx = (s->p[3][0] - s->p[2][0]) * (1.0f / 16);   /* һ */
+    by = (s->p[3][1] - s->p[2][1]) * (1.0f / 16);
+
+    if (s->n < 3 || m * 1000 < STROKE_PREDICT_VMIN * ms)
+    {
+        dx = 0;                         /* ʻʱٶҪ,  */
+        dy = 0;
+    }
+    else if (ax * bx + ay * by <= 0 || dx * bx + dy * by <= 0)
+    {
+        dx = 0;                         /* չ90Ȼߵͷ,  */
+        dy = 0;
+    }
+    else
+    {
+        a = sqrtf(ax * ax + ay * ay);
+        b = sqrtf(bx * bx + by * by);
+        k = (ax * bx + ay * by) / (a * b);  /* μнǵcos, 1ֱ */
+        k = k * k;
+        k = k * k;
+        k = k * k;                          /* cos^8: 30ʣ0.32, 45ʣ0.06 */
+        m = sqrtf(dx * dx + dy * dy) * k;
+        m = (m < b) ? m : b;                /* һ߹ľ */
+        m = (m < STROKE_PREDICT_MAX) ? m : STROKE_PREDICT_MAX;
+        dx = bx * m / b;                    /* һεķ, ٶȵķͺ */
+        dy = by * m / b;
+    }
+
+    *x = stroke_px((int32_t)((s->x + dx) * 16 + 0.5f));
+    *y = stroke_px((int32_t)((s->y + dy) * 16 + 0.5f));
+}
@@ -2,8 +2,8 @@
  ****************************************************************************************************
  * @file        touch.c
  * @author      ԭŶ(ALIENTEK)
- * @version     V1.1
- * @date        2023-05-29
+ * @version     V1.2
+ * @date        2026-10-18
  * @brief        
  *   @note      ֵ֧/ʽ
  *              ֧ADS7843/7846/UH7843/7846/XPT2046/TSC2046/GT9147/GT9271/FT5206/GT1151ȣ
@@ -24,6 +24,11 @@
  * V1.1 20230529
  * 1ST7796 3.5 GT1151֧
  * 2ILI9806 4.3 GT1151֧
+ * V1.2 20261018
+ * 1X, YһƬѡｻ(16ʱһת), ѡӲSPI(TP_HW_SPI)
+ * 2ðΪ޷֧βƽ
+ * 3У׼ cfg.h ļ¼(汾CRC), ԭλõĲһκǨƹȥ
+ * 4tp_set_hint: 7ϴGTϵʱȳʼGT, ̽FT5206
  ****************************************************************************************************
  */
 
@@ -32,6 +37,8 @@
 #include "lcd.h"
 #include "touch.h"
 #include "24cxx.h"
+#include "cfg.h"
+#include "string.h"
 #include "delay.h"
 
 
@@ -50,15 +57,56 @@ _m_tp_dev tp_dev =
     0,
 };
 
+/* tp_init ԵĴIC, TP_CTRL_NONE ԭ˳̽ */
+static uint8_t g_tp_hint = TP_CTRL_NONE;
+
+#if TP_HW_SPI
+SPI_HandleTypeDef g_tp_spi_handle;
+
 /**
- * @brief       SPIд
- *   @note      ICд1 byte
- * @param       data: Ҫд
+ * @brief       ʼICõӲSPI
+ * @param       
  * @retval      
  */
-static void tp_write_byte(uint8_t data)
+static void tp_spi_init(void)
+{
+    GPIO_InitTypeDef gpio_init_struct;
+
+    TP_SPI_GPIO_CLK_ENABLE();
+    TP_SPI_CLK_ENABLE();
+
+    gpio_init_struct.Pin = TP_SPI_SCK_GPIO_PIN | TP_SPI_MISO_GPIO_PIN | TP_SPI_MOSI_GPIO_PIN;
+    gpio_init_struct.Mode = GPIO_MODE_AF_PP;                /* 츴 */
+    gpio_init_struct.Pull = GPIO_PULLUP;                    /*  */
+    gpio_init_struct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;     /*  */
+    gpio_init_struct.Alternate = TP_SPI_GPIO_AF;
+    HAL_GPIO_Init(TP_SPI_GPIO_PORT, &gpio_init_struct);
+
+    g_tp_spi_handle.Instance = TP_SPI;
+    g_tp_spi_handle.Init.Mode = SPI_MODE_MASTER;
+    g_tp_spi_handle.Init.Direction = SPI_DIRECTION_2LINES;
+    g_tp_spi_handle.Init.DataSize = SPI_DATASIZE_8BIT;
+    g_tp_spi_handle.Init.CLKPolarity = SPI_POLARITY_LOW;    /* ԭSPIһ: ز */
+    g_tp_spi_handle.Init.CLKPhase = SPI_PHASE_1EDGE;
+    g_tp_spi_handle.Init.NSS = SPI_NSS_SOFT;                /* ƬѡT_CS */
+    g_tp_spi_handle.Init.BaudRatePrescaler = TP_SPI_PRESCALER;
+    g_tp_spi_handle.Init.FirstBit = SPI_FIRSTBIT_MSB;
+    g_tp_spi_handle.Init.TIMode = SPI_TIMODE_DISABLE;
+    g_tp_spi_handle.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
+    g_tp_spi_handle.Init.CRCPolynomial = 7;
+    HAL_SPI_Init(&g_tp_spi_handle);
+}
+#else
+/**
+ * @brief       SPIһֽ(SPI)
+ *   @note      ֮ǰ, ֮, ԭλдʱͬ
+ * @param       data: Ҫд
+ * @retval      ͬʱ
+ */
+static uint8_t tp_xfer_byte(uint8_t data)
 {
     uint8_t count = 0;
+    uint8_t in = 0;
 
     for (count = 0; count < 8; count++)
     {
@@ -72,123 +120,146 @@ static void tp_write_byte(uint8_t data)
         }
 
         data <<= 1;
+        in <<= 1;
         T_CLK(0);
         delay_us(1);
         T_CLK(1);           /* Ч */
+
+        if (T_MISO) in++;
     }
+
+    return in;
 }
+#endif
 
 /**
- * @brief       SPI
- *   @note      ӴICȡadcֵ
- * @param       cmd: ָ
- * @retval      ȡ,ADCֵ(12bit)
+ * @brief       ѡдIC, lenֽ
+ * @param       tx : Ҫдֽ
+ * @param       rx : ֽ
+ * @param       len: ֽ
+ * @retval      
  */
-static uint16_t tp_read_ad(uint8_t cmd)
+static void tp_xfer(const uint8_t *tx, uint8_t *rx, uint8_t len)
 {
-    uint8_t count = 0;
-    uint16_t num = 0;
-    
+#if TP_HW_SPI
+    T_CS(0);            /* ѡдIC */
+    HAL_SPI_TransmitReceive(&g_tp_spi_handle, (uint8_t *)tx, rx, len, 10);
+#else
+    uint8_t i;
+
     T_CLK(0);           /* ʱ */
     T_MOSI(0);          /*  */
     T_CS(0);            /* ѡдIC */
-    tp_write_byte(cmd); /*  */
-    delay_us(6);        /* ADS7846תʱΪ6us */
-    T_CLK(0);
-    delay_us(1);
-    T_CLK(1);           /* 1ʱӣBUSY */
-    delay_us(1);
-    T_CLK(0);
-
-    for (count = 0; count < 16; count++)    /* 16λ,ֻи12λЧ */
-    {
-        num <<= 1;
-        T_CLK(0);       /* ½Ч */
-        delay_us(1);
-        T_CLK(1);
 
-        if (T_MISO) num++;
+    for (i = 0; i < len; i++)
+    {
+        rx[i] = tp_xfer_byte(tx[i]);
     }
-
-    num >>= 4;          /* ֻи12λЧ. */
+#endif
     T_CS(1);            /* ͷƬѡ */
-    return num;
 }
 
 /* 败оƬ ݲɼ ˲ò */
 #define TP_READ_TIMES   5       /* ȡ */
 #define TP_LOST_VAL     1       /* ֵ */
 
+/* һ: X, Y  TP_READ_TIMES . 16ʱһת: ÿתֽڼһ0ֽ,
+ * (12λ)֮16ʱ, һֽںһĵλͬʱ, һ0ֽ
+ */
+#define TP_BURST_NUM    (2 * TP_READ_TIMES)
+#define TP_BURST_LEN    (2 * TP_BURST_NUM + 1)
+
 /**
- * @brief       ȡһֵ(xy)
- *   @note      ȡTP_READ_TIMES,Щ,
- *              ȻȥͺTP_LOST_VAL, ȡƽֵ
+ * @brief       ȡkתĽ
+ * @param       rx: ֽ
+ * @param       k : ڼת
+ * @retval      ADCֵ(12bit)
+ */
+static uint16_t tp_burst_val(const uint8_t *rx, uint8_t k)
+{
+    return ((((uint16_t)rx[2 * k + 1] << 8) | rx[2 * k + 2]) >> 3) & 0X0FFF;   /* 1ʱBUSY, Ȼ12λ */
+}
+
+/* ȽϽ(÷֧): Сķa, ķb */
+#define TP_CSWAP(a, b)  do{ int32_t d_ = (int32_t)(a) - (int32_t)(b); d_ &= ~(d_ >> 31); (a) -= d_; (b) += d_; }while(0)
+
+/**
+ * @brief       βƽ
+ *   @note      ȽϽ˳޹, ûз֧; 59αȽϵ,
+ *              żλ(Ҳ). ȥͺTP_LOST_VAL, ȡƽֵ
  *              ʱ: TP_READ_TIMES > 2*TP_LOST_VAL 
- *
- * @param       cmd : ָ
- *   @arg       0XD0: ȡX(@״̬,״̬YԵ.)
- *   @arg       0X90: ȡY(@״̬,״̬XԵ.)
- *
- * @retval      ȡ(˲), ADCֵ(12bit)
+ * @param       v: TP_READ_TIMES , ᱻ
+ * @retval      βƽ
  */
-static uint16_t tp_read_xoy(uint8_t cmd)
+static uint16_t tp_trim_mean(int32_t *v)
 {
-    uint16_t i, j;
-    uint16_t buf[TP_READ_TIMES];
-    uint16_t sum = 0;
-    uint16_t temp;
+    uint32_t sum = 0;
+    uint8_t i;
 
-    for (i = 0; i < TP_READ_TIMES; i++)     /* ȶȡTP_READ_TIMES */
-    {
-        buf[i] = tp_read_ad(cmd);
-    }
+#if TP_READ_TIMES == 5
+    TP_CSWAP(v[0], v[1]); TP_CSWAP(v[3], v[4]); TP_CSWAP(v[2], v[4]);
+    TP_CSWAP(v[2], v[3]); TP_CSWAP(v[0], v[3]); TP_CSWAP(v[0], v[2]);
+    TP_CSWAP(v[1], v[4]); TP_CSWAP(v[1], v[3]); TP_CSWAP(v[1], v[2]);
+#else
+    uint8_t r;
 
-    for (i = 0; i < TP_READ_TIMES - 1; i++) /* ݽ */
+    for (r = 0; r < TP_READ_TIMES; r++)
     {
-        for (j = i + 1; j < TP_READ_TIMES; j++)
+        for (i = r & 1; i + 1 < TP_READ_TIMES; i += 2)
         {
-            if (buf[i] > buf[j])   /*  */
-            {
-                temp = buf[i];
-                buf[i] = buf[j];
-                buf[j] = temp;
-            }
+            TP_CSWAP(v[i], v[i + 1]);
         }
     }
-
-    sum = 0;
+#endif
 
     for (i = TP_LOST_VAL; i < TP_READ_TIMES - TP_LOST_VAL; i++)   /* ȥ˵Ķֵ */
     {
-        sum += buf[i];  /* ۼȥֵԺ. */
+        sum += v[i];
     }
 
-    temp = sum / (TP_READ_TIMES - 2 * TP_LOST_VAL); /* ȡƽֵ */
-    return temp;
+    return sum / (TP_READ_TIMES - 2 * TP_LOST_VAL);
 }
 
 /**
  * @brief       ȡx, y
+ *   @note      һƬѡX, YTP_READ_TIMES, βƽ
  * @param       x,y: ȡֵ
  * @retval      
  */
 static void tp_read_xy(uint16_t *x, uint16_t *y)
 {
-    uint16_t xval, yval;
+    uint8_t tx[TP_BURST_LEN];
+    uint8_t rx[TP_BURST_LEN];
+    int32_t xv[TP_READ_TIMES];
+    int32_t yv[TP_READ_TIMES];
+    uint8_t cx, cy, i;
 
     if (tp_dev.touchtype & 0X01)    /* X,YĻ෴ */
     {
-        xval = tp_read_xoy(0X90);   /* ȡXADֵ, з任 */
-        yval = tp_read_xoy(0XD0);   /* ȡYADֵ */
+        cx = 0X90;                  /* ȡXADֵ, з任 */
+        cy = 0XD0;                  /* ȡYADֵ */
     }
     else                            /* X,YĻͬ */
     {
-        xval = tp_read_xoy(0XD0);   /* ȡXADֵ */
-        yval = tp_read_xoy(0X90);   /* ȡYADֵ */
+        cx = 0XD0;                  /* ȡXADֵ */
+        cy = 0X90;                  /* ȡYADֵ */
     }
 
-    *x = xval;
-    *y = yval;
+    for (i = 0; i < TP_BURST_LEN; i++)
+    {
+        tx[i] = (i & 1) ? 0 : ((i < TP_BURST_LEN - 1) ? (((i >> 1) & 1) ? cy : cx) : 0);
+    }
+
+    tp_xfer(tx, rx, TP_BURST_LEN);
+
+    for (i = 0; i < TP_READ_TIMES; i++)
+    {
+        xv[i] = tp_burst_val(rx, 2 * i);
+        yv[i] = tp_burst_val(rx, 2 * i + 1);
+    }
+
+    *x = tp_trim_mean(xv);
+    *y = tp_trim_mean(yv);
 }
 
 /* ζȡX,Yֵ */
@@ -202,7 +273,7 @@ static void tp_read_xy(uint16_t *x, uint16_t *y)
  * @param       x,y: ȡֵ
  * @retval      0, ʧ; 1, ɹ;
  */
-static uint8_t tp_read_xy2(uint16_t *x, uint16_t *y)
+uint8_t tp_read_xy2(uint16_t *x, uint16_t *y)
 {
     uint16_t x1, y1;
     uint16_t x2, y2;
@@ -308,30 +379,21 @@ static uint8_t tp_scan(uint8_t mode)
     return tp_dev.sta & TP_PRES_DOWN; /* صǰĴ״̬ */
 }
 
-/* TP_SAVE_ADDR_BASE崥У׼EEPROMλ(ʼַ)
- * ռÿռ : 13ֽ.
+/* TP_SAVE_ADDR_BASEԭУ׼EEPROMλ(ʼַ)
+ * ռÿռ : 13ֽ. ڴ cfg.h  CFG_TP_CAL ¼, ֻûм¼ʱһ(ǰУ׼İ).
  */
 #define TP_SAVE_ADDR_BASE   40
 
 /**
  * @brief       У׼
- *   @note      EEPROMоƬ(24C02),ʼַΪTP_SAVE_ADDR_BASE.
- *              ռôСΪ13ֽ
+ *   @note       CFG_TP_CAL ¼(cfg.h: 汾 + CRC, д, ҳд)
  * @param       
  * @retval      
  */
 void tp_save_adjust_data(void)
 {
-    uint8_t *p = (uint8_t *)&tp_dev.xfac;   /* ָ׵ַ */
-
-    /* pָtp_dev.xfacĵַ, p+4tp_dev.yfacĵַ
-     * p+8tp_dev.xoffĵַ,p+10,tp_dev.yoffĵַ
-     * ܹռ12ֽ(4)
-     * p+12ڴűǵ败ǷУ׼(0X0A)
-     * p[12]д0X0A. ѾУ׼.
-     */
-    at24cxx_write(TP_SAVE_ADDR_BASE, p, 12);                /* 12ֽ(xfac,yfac,xc,yc) */
-    at24cxx_write_one_byte(TP_SAVE_ADDR_BASE + 12, 0X0A);   /* У׼ֵ */
+    /* tp_dev.xfac, yfac, xc, yc , ܹ12ֽ */
+    cfg_set(CFG_TP_CAL, &tp_dev.xfac, 12);
 }
 
 /**
@@ -342,18 +404,20 @@ void tp_save_adjust_data(void)
  */
 uint8_t tp_get_adjust_data(void)
 {
-    uint8_t *p = (uint8_t *)&tp_dev.xfac;
-    uint8_t temp = 0;
+    uint8_t buf[13];
+
+    if (cfg_get(CFG_TP_CAL, &tp_dev.xfac, 12) == 0)
+    {
+        return 1;
+    }
 
-    /* ֱָtp_dev.xfacַб, ȡʱ,ȡ
-     * дָtp_dev.xfac׵ַ, ͿԻԭдȥֵ, Ҫ
-     * . ˷ڸ(ṹ)ı/ȡ(ṹ).
-     */
-    at24cxx_read(TP_SAVE_ADDR_BASE, p, 12);                 /* ȡ12ֽ */
-    temp = at24cxx_read_one_byte(TP_SAVE_ADDR_BASE + 12);   /* ȡУ׼״̬ */
+    /* ûм¼: ԭλ, ǰ12ֽxfac,yfac,xc,yc, 13ֽ0X0AʾУ׼ */
+    at24cxx_read(TP_SAVE_ADDR_BASE, buf, 13);
 
-    if (temp == 0X0A)
+    if (buf[12] == 0X0A)
     {
+        memcpy(&tp_dev.xfac, buf, 12);
+        tp_save_adjust_data();      /* ¼¼, Ժٶ */
         return 1;
     }
 
@@ -503,6 +567,32 @@ void tp_adjust(void)
 
 }
 
+/**
+ * @brief        tp_init ԵĴIC(ϴμ⵽)
+ *   @note      ֻFT/GTֶܵ7; ĴICLCD ID, 3.5ĵûIDɶ, ̽GT
+ * @param       ctrl: TP_CTRL_xx
+ * @retval      
+ */
+void tp_set_hint(uint8_t ctrl)
+{
+    g_tp_hint = ctrl;
+}
+
+/**
+ * @brief       ⵽ĴIC(tp_init ֮)
+ * @param       
+ * @retval      TP_CTRL_xx
+ */
+uint8_t tp_get_ctrl(void)
+{
+    if (tp_dev.scan == gt9xxx_scan)
+    {
+        return TP_CTRL_GT;
+    }
+
+    return (tp_dev.scan == ft5206_scan) ? TP_CTRL_FT : TP_CTRL_RES;
+}
+
 /**
  * @brief       ʼ
  * @param       
@@ -535,7 +625,11 @@ uint8_t tp_init(void)
     }
     else if (lcddev.id == 0X1963 || lcddev.id == 0X7084 || lcddev.id == 0X7016)     /* SSD1963 7 7800*480/1024*600 RGB */
     {
-        if (!ft5206_init())             /* ICFTϵеľִft5206_initԼʹft5206_scanɨ躯 */
+        if (g_tp_hint == TP_CTRL_GT && gt9xxx_init() == 0)  /* ϴGTϵ, GTIDͲ̽FT */
+        {
+            tp_dev.scan = gt9xxx_scan;
+        }
+        else if (!ft5206_init())        /* ICFTϵеľִft5206_initԼʹft5206_scanɨ躯 */
         {
             tp_dev.scan = ft5206_scan;  /* ɨ躯ָFT5206ɨ */
         }
@@ -576,6 +670,9 @@ uint8_t tp_init(void)
         gpio_init_struct.Pin = T_CS_GPIO_PIN;
         HAL_GPIO_Init(T_CS_GPIO_PORT, &gpio_init_struct);        /* ʼT_CS */
 
+#if TP_HW_SPI
+        tp_spi_init();          /* SCK/MISO/MOSISPI, T_CLK/T_MOSI/T_MISOʹ */
+#endif
         tp_read_xy(&tp_dev.x[0], &tp_dev.y[0]); /* һζȡʼ */
         at24cxx_init();         /* ʼ24CXX */
 
@@ -585,6 +682,7 @@ uint8_t tp_init(void)
         }
         else                    /* δУ׼? */
         {
+            while (lcd_init_poll());    /* У׼Ҫ, LCDʼ */
             lcd_clear(WHITE);   /*  */
             tp_adjust();        /* ĻУ׼ */
             tp_save_adjust_data();
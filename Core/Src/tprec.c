@@ -0,0 +1,406 @@
+/**
+ ****************************************************************************************************
+ * @file        tprec.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       켣¼/ط
+ ****************************************************************************************************
+ * @attention
+ *
+ * ʽ÷ tprec.h. ¼ touch_task (PendSV), ֻƴһ24ֽڼ¼ log_write, ȴ.
+ * طŵ tprec_scan Ҳ touch_task , ֻñ־, ־ tprec_poll .
+ * طŻֻЭд(PROTO_T_TRACE , "tp play" ־), ಻.
+ *
+ ****************************************************************************************************
+ */
+
+#include "string.h"
+#include "tprec.h"
+
+#ifndef HOST_SIM
+#include "touch.h"
+#include "lcd.h"
+#include "log.h"
+#include "trace.h"
+#endif
+
+
+#define TPREC_MASK          ((1 << TPREC_PT_MAX) - 1)
+
+/**
+ * @brief       һ(12λ)
+ * @param       p   : 3ֽ
+ * @param       x, y: 
+ * @retval      
+ */
+static void tprec_pack(uint8_t *p, uint16_t x, uint16_t y)
+{
+    p[0] = x & 0xFF;
+    p[1] = ((x >> 8) & 0x0F) | ((y & 0x0F) << 4);
+    p[2] = (y >> 4) & 0xFF;
+}
+
+/**
+ * @brief       дļͷ
+ * @param       buf : , TPREC_HDR_SIZE ֽ
+ * @param       w, h: ¼ʱLCD
+ * @retval      ֽ
+ */
+uint8_t tprec_header(uint8_t *buf, uint16_t w, uint16_t h)
+{
+    buf[0] = 'T';
+    buf[1] = 'P';
+    buf[2] = 'R';
+    buf[3] = TPREC_VERSION;
+    buf[4] = w & 0xFF;
+    buf[5] = w >> 8;
+    buf[6] = h & 0xFF;
+    buf[7] = h >> 8;
+    return TPREC_HDR_SIZE;
+}
+
+/**
+ * @brief       һ֡
+ * @param       buf: ,  TPREC_FRAME_MAX ֽ
+ * @param       dt : һ֡ʱ(us),  TPREC_DT_US 
+ * @param       f  : ֡(ֻ mask/x/y)
+ * @retval      ֽ
+ */
+uint8_t tprec_encode(uint8_t *buf, uint32_t dt, const tprec_frame_t *f)
+{
+    uint8_t i, n = 3;
+
+    dt = (dt + TPREC_DT_US / 2) / TPREC_DT_US;
+    dt = (dt > 0xFFFF) ? 0xFFFF : dt;
+    buf[0] = dt & 0xFF;
+    buf[1] = dt >> 8;
+    buf[2] = f->mask & TPREC_MASK;
+
+    for (i = 0; i < TPREC_PT_MAX; i++)
+    {
+        if (f->mask & (1 << i))
+        {
+            tprec_pack(buf + n, f->x[i], f->y[i]);
+            n += 3;
+        }
+    }
+
+    return n;
+}
+
+/**
+ * @brief       ļͷ, ׼
+ * @param       r   : ״̬
+ * @param       buf : 켣
+ * @param       len : ֽ
+ * @param       w, h: ¼ʱLCD
+ * @retval      0, ɹ; 1, ǹ켣汾;
+ */
+uint8_t tprec_open(tprec_reader_t *r, const uint8_t *buf, uint32_t len, uint16_t *w, uint16_t *h)
+{
+    if (len < TPREC_HDR_SIZE || buf[0] != 'T' || buf[1] != 'P' || buf[2] != 'R' || buf[3] != TPREC_VERSION)
+    {
+        return 1;
+    }
+
+    *w = buf[4] | (buf[5] << 8);
+    *h = buf[6] | (buf[7] << 8);
+    r->buf = buf;
+    r->len = len;
+    r->pos = TPREC_HDR_SIZE;
+    r->t = 0;
+    return 0;
+}
+
+/**
+ * @brief       һ֡
+ * @param       r: ״̬
+ * @param       f: 
+ * @retval      0, ɹ; 1, 켣֡;
+ */
+uint8_t tprec_next(tprec_reader_t *r, tprec_frame_t *f)
+{
+    const uint8_t *p = r->buf + r->pos;
+    uint8_t i, n = 3;
+
+    if (r->pos + 3 > r->len || (p[2] & ~TPREC_MASK))
+    {
+        return 1;
+    }
+
+    for (i = 0; i < TPREC_PT_MAX; i++)
+    {
+        n += (p[2] >> i & 1) * 3;
+    }
+
+    if (r->pos + n > r->len)
+    {
+        return 1;
+    }
+
+    memset(f, 0, sizeof(*f));
+    r->t += (p[0] | (p[1] << 8)) * TPREC_DT_US;
+    f->t = r->t;
+    f->mask = p[2];
+
+    for (i = 0, n = 3; i < TPREC_PT_MAX; i++)
+    {
+        if (f->mask & (1 << i))
+        {
+            f->x[i] = p[n] | ((p[n + 1] & 0x0F) << 8);
+            f->y[i] = (p[n + 1] >> 4) | (p[n + 2] << 4);
+            n += 3;
+        }
+    }
+
+    r->pos += n;
+    return 0;
+}
+
+#ifndef HOST_SIM
+
+static uint8_t g_tprec_rec = 0;                 /* 1, ¼ */
+static uint8_t g_tprec_last = 0;                /* ϴ¼µ mask */
+static uint8_t g_tprec_seq = 0;
+static uint32_t g_tprec_rec_num = 0;            /* ¼µ֡ */
+static uint32_t g_tprec_rec_drop = 0;           /* ־֡ */
+
+static uint8_t g_tprec_buf[TPREC_BUF_SIZE];     /* طŻ */
+static uint32_t g_tprec_len = 0;
+static tprec_reader_t g_tprec_rd;
+static tprec_frame_t g_tprec_next;              /* һҪ֡ */
+static uint8_t (*g_tprec_scan)(uint8_t);        /* طǰ tp_dev.scan */
+static volatile uint8_t g_tprec_play = 0;       /* 1, ڻط */
+static volatile uint8_t g_tprec_end = 0;        /* 1, һ֡Ѹ; 2, ȴ */
+static uint32_t g_tprec_t0;                     /* طſʼʱ(ms) */
+static uint32_t g_tprec_given = 0;              /* Ѹ֡ */
+static uint32_t g_tprec_late = 0;               /* ʱһ֡ҲѾʱĴ */
+
+/**
+ * @brief       ʼ/ֹͣ¼
+ * @param       on: 1, ʼ; 0, ֹͣ
+ * @retval      
+ */
+void tprec_record(uint8_t on)
+{
+    if (on && g_tprec_rec == 0)
+    {
+        g_tprec_last = 0;
+        g_tprec_rec_num = 0;
+        g_tprec_rec_drop = 0;
+    }
+
+    g_tprec_rec = on;
+}
+
+/**
+ * @brief       ¼ɨ tp_dev ״̬(touch_task  tp_dev.scan ֮)
+ *   @note      ûдɨ費¼, ɿֻ¼һ
+ * @param       
+ * @retval      
+ */
+void tprec_sample(void)
+{
+    uint8_t rec[LOG_BIN_SIZE];
+    uint32_t now = DWT->CYCCNT;
+    uint8_t mask = tp_dev.sta & TPREC_MASK;
+    uint8_t i, sum = 0;
+
+    if (g_tprec_rec == 0 || (mask == 0 && g_tprec_last == 0))
+    {
+        return;
+    }
+
+    g_tprec_last = mask;
+    memset(rec, 0, sizeof(rec));
+    rec[0] = LOG_BIN_SYNC;
+    rec[1] = LOG_ID_TOUCH_REC & 0xFF;
+    rec[2] = LOG_ID_TOUCH_REC >> 8;
+    memcpy(&rec[3], &now, 4);           /*  log_record һС˿ */
+    rec[7] = mask | ((g_tprec_seq++ & 7) << 5);
+
+    for (i = 0; i < TPREC_PT_MAX; i++)  /* ¼ÿռ̶λ */
+    {
+        if (mask & (1 << i))
+        {
+            tprec_pack(&rec[8 + i * 3], tp_dev.x[i], tp_dev.y[i]);
+        }
+    }
+
+    for (i = 1; i < LOG_BIN_SIZE - 1; i++)
+    {
+        sum ^= rec[i];
+    }
+
+    rec[LOG_BIN_SIZE - 1] = sum;
+
+    if (log_write(rec, LOG_BIN_SIZE))
+    {
+        g_tprec_rec_drop++;
+    }
+    else
+    {
+        g_tprec_rec_num++;
+    }
+}
+
+/**
+ * @brief       дطŻ
+ * @param       off : ƫ, 0ʾ¿ʼ, һ
+ * @param       data: 
+ * @param       len : ֽ
+ * @retval      0, ɹ; 1, ڻط/ƫƲ/;
+ */
+uint8_t tprec_load(uint16_t off, const uint8_t *data, uint16_t len)
+{
+    if (g_tprec_play)
+    {
+        return 1;
+    }
+
+    if (off == 0)
+    {
+        g_tprec_len = 0;
+    }
+
+    if (off != g_tprec_len || off + len > TPREC_BUF_SIZE)
+    {
+        return 1;
+    }
+
+    memcpy(&g_tprec_buf[off], data, len);
+    g_tprec_len += len;
+    return 0;
+}
+
+/**
+ * @brief       طŻֽ
+ * @param       
+ * @retval      ֽ
+ */
+uint32_t tprec_size(void)
+{
+    return g_tprec_len;
+}
+
+/**
+ * @brief       طʱ tp_dev.scan: 켣ʱһ֡, ûʱ䱣һ֡
+ * @param       mode: δʹ(켣Ļ)
+ * @retval      1, д㰴; 0, û;
+ */
+static uint8_t tprec_scan(uint8_t mode)
+{
+    tprec_frame_t *f = &g_tprec_next;
+    uint32_t now = (HAL_GetTick() - g_tprec_t0) * 1000;
+    uint8_t i;
+
+    UNUSED(mode);
+
+    if (g_tprec_end)                    /* : ȫɿ, ָɨ */
+    {
+        tp_dev.sta = 0;
+        tp_dev.scan = g_tprec_scan;
+        g_tprec_end = 2;
+        g_tprec_play = 0;
+        return 0;
+    }
+
+    if (f->t <= now)
+    {
+        tp_dev.sta = f->mask ? (TP_PRES_DOWN | f->mask) : 0;
+
+        for (i = 0; i < TPREC_PT_MAX; i++)
+        {
+            tp_dev.x[i] = f->x[i];
+            tp_dev.y[i] = f->y[i];
+        }
+
+        g_tprec_given++;
+
+        if (tprec_next(&g_tprec_rd, f))
+        {
+            g_tprec_end = 1;
+        }
+        else if (f->t <= now)
+        {
+            g_tprec_late++;
+        }
+    }
+
+    return (tp_dev.sta & TP_PRES_DOWN) ? 1 : 0;
+}
+
+/**
+ * @brief       ʼطŻطŻĹ켣,  trace ͳ
+ * @param       
+ * @retval      0, ɹ; 1, ڻطŻûй켣; 2, ¼ʱLCDߺڲͬ;
+ */
+uint8_t tprec_play(void)
+{
+    uint16_t w, h;
+
+    if (g_tprec_play || tprec_open(&g_tprec_rd, g_tprec_buf, g_tprec_len, &w, &h)
+        || tprec_next(&g_tprec_rd, &g_tprec_next))
+    {
+        return 1;
+    }
+
+    if (w != lcddev.width || h != lcddev.height)
+    {
+        return 2;
+    }
+
+    g_tprec_given = 0;
+    g_tprec_late = 0;
+    g_tprec_end = 0;
+    trace_reset();
+    g_tprec_scan = tp_dev.scan;
+    g_tprec_t0 = HAL_GetTick();
+    g_tprec_play = 1;
+    tp_dev.scan = tprec_scan;
+    return 0;
+}
+
+/**
+ * @brief       Ƿڻط(طʱTIM2ҲҪͷŴ)
+ * @param       
+ * @retval      1, ڻط; 0, û;
+ */
+uint8_t tprec_playing(void)
+{
+    return g_tprec_play;
+}
+
+/**
+ * @brief       طŽ trace , ־
+ * @param       
+ * @retval      
+ */
+void tprec_poll(void)
+{
+    if (g_tprec_end != 2)
+    {
+        return;
+    }
+
+    g_tprec_end = 0;
+    log_printf("tp: replay done, %lu frames in %lu ms, %lu late\r\n", (unsigned long)g_tprec_given,
+               (unsigned long)(HAL_GetTick() - g_tprec_t0), (unsigned long)g_tprec_late);
+    trace_poll();
+    trace_report();
+}
+
+/**
+ * @brief       ¼/ط״̬
+ * @param       
+ * @retval      
+ */
+void tprec_report(void)
+{
+    log_printf("tp: rec %s, %lu frames, %lu dropped; buffer %lu/%u bytes; %s, %lu frames given, %lu late\r\n",
+               g_tprec_rec ? "on" : "off", (unsigned long)g_tprec_rec_num, (unsigned long)g_tprec_rec_drop,
+               (unsigned long)g_tprec_len, TPREC_BUF_SIZE, g_tprec_play ? "playing" : "idle",
+               (unsigned long)g_tprec_given, (unsigned long)g_tprec_late);
+}
+
+#endif
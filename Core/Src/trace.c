@@ -0,0 +1,317 @@
+/**
+ ****************************************************************************************************
+ * @file        trace.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʶķֽ׶κʱ(DWTڼ)
+ ****************************************************************************************************
+ * @attention
+ *
+ * trace_stage() TIM2ж(ɨ/)ѭ(/ʾ)ͬʱ, дλʱ
+ * ֻμָж. ֱͼֻѭ trace_poll() , Ҫ.
+ *
+ ****************************************************************************************************
+ */
+
+#include "string.h"
+#include "trace.h"
+
+#ifndef HOST_SIM
+#include "log.h"
+#endif
+
+
+#define TRACE_RING_MASK     (TRACE_RING_NUM - 1)
+#define TRACE_EVT_MASK      (TRACE_EVT_NUM - 1)
+
+static trace_rec_t g_trace_ring[TRACE_RING_NUM];
+static volatile uint32_t g_trace_wr = 0;
+static volatile uint32_t g_trace_rd = 0;
+static volatile uint32_t g_trace_lost = 0;          /* λļ¼ */
+
+static uint32_t g_trace_evt_start[TRACE_EVT_NUM];   /* ¼ʼʱ */
+static volatile uint16_t g_trace_evt = 0;           /* µĴ¼ */
+static uint16_t g_trace_done = 0;                   /* Ѿ㵽¼ */
+static uint16_t g_trace_frame = 0;                  /* ǰ¼ */
+
+static uint32_t g_trace_hist[TRACE_STAGE_NUM][TRACE_HIST_NUM];
+static uint32_t g_trace_n[TRACE_STAGE_NUM];
+static uint32_t g_trace_max[TRACE_STAGE_NUM];
+static uint32_t g_trace_tick = 0;                   /* ϴʱ */
+static uint32_t g_trace_new = 0;                    /* ϴα֮ļ¼ */
+
+static const char *const g_trace_name[TRACE_STAGE_NUM] =
+{
+    "scan", "bline", "process", "ai_run", "argmax", "show", "e2e",
+};
+
+/**
+ * @brief        -> ֱͼ, ÿƵ8
+ * @param       v: 
+ * @retval      (0 ~ TRACE_HIST_NUM - 1)
+ */
+static uint8_t trace_bucket(uint32_t v)
+{
+    uint32_t msb;
+
+    if (v < 8)
+    {
+        return v;
+    }
+
+    msb = 31 - __CLZ(v);
+    return (msb - 2) * 8 + ((v >> (msb - 3)) & 7);
+}
+
+/**
+ * @brief       ֱͼ -> һмֵ
+ * @param       idx: 
+ * @retval      
+ */
+static uint32_t trace_bucket_value(uint8_t idx)
+{
+    uint32_t shift;
+
+    if (idx < 8)
+    {
+        return idx;
+    }
+
+    shift = idx / 8 - 1;
+    return ((8 + idx % 8) << shift) + ((1u << shift) >> 1);
+}
+
+/**
+ * @brief       ʼ
+ * @param       
+ * @retval      
+ */
+void trace_init(void)
+{
+    g_trace_wr = 0;
+    g_trace_rd = 0;
+    g_trace_evt = 0;
+    g_trace_done = 0;
+    g_trace_tick = HAL_GetTick();
+    trace_reset();
+}
+
+/**
+ * @brief       ¼һ׶εĺʱ(жϺѭԵ)
+ * @param       stage : ׶
+ * @param       cycles: 
+ * @retval      
+ */
+void trace_stage(uint8_t stage, uint32_t cycles)
+{
+    trace_rec_t *rec;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    if (g_trace_wr - g_trace_rd < TRACE_RING_NUM)
+    {
+        rec = &g_trace_ring[g_trace_wr & TRACE_RING_MASK];
+        rec->cycles = cycles;
+        rec->stage = stage;
+        /* ׶μҪ򿪵¼, ׶μ¼ */
+        rec->evt = (stage < TRACE_AI_RUN) ? (uint16_t)(g_trace_evt + 1) : g_trace_frame;
+        g_trace_wr++;
+    }
+    else
+    {
+        g_trace_lost++;
+    }
+
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief       ʼһ¼(ɨ軭˱ʻʱ)
+ * @param       start: ɨ迪ʼʱ
+ * @retval      
+ */
+void trace_touch(uint32_t start)
+{
+    uint16_t evt = g_trace_evt + 1;
+
+    g_trace_evt_start[evt & TRACE_EVT_MASK] = start;
+    g_trace_evt = evt;
+}
+
+/**
+ * @brief       ʼ
+ * @param       
+ * @retval      ¼
+ */
+uint16_t trace_frame_begin(void)
+{
+    g_trace_frame = g_trace_evt;
+    return g_trace_frame;
+}
+
+/**
+ * @brief       ʾ, Ĵ¼ɶ˵ӳ
+ * @param       evt: trace_frame_begin ķֵ
+ * @retval      
+ */
+void trace_frame_end(uint16_t evt)
+{
+    uint32_t now = trace_now();
+    uint16_t e = g_trace_done + 1;
+
+    if ((uint16_t)(evt - g_trace_done) > TRACE_EVT_NUM)    /* ̫ϵ¼ʱѱ */
+    {
+        e = evt - TRACE_EVT_NUM + 1;
+    }
+
+    for (; (uint16_t)(evt - e) < 0x8000; e++)
+    {
+        trace_stage(TRACE_E2E, now - g_trace_evt_start[e & TRACE_EVT_MASK]);
+    }
+
+    g_trace_done = evt;
+}
+
+/**
+ * @brief       ѻλļ¼ۼӽֱͼ, ʱԶ
+ * @param       
+ * @retval      
+ */
+void trace_poll(void)
+{
+    trace_rec_t *rec;
+
+    while (g_trace_rd != g_trace_wr)
+    {
+        rec = &g_trace_ring[g_trace_rd & TRACE_RING_MASK];
+
+        if (rec->stage < TRACE_STAGE_NUM)
+        {
+            g_trace_hist[rec->stage][trace_bucket(rec->cycles)]++;
+            g_trace_n[rec->stage]++;
+
+            if (rec->cycles > g_trace_max[rec->stage])
+            {
+                g_trace_max[rec->stage] = rec->cycles;
+            }
+
+            g_trace_new++;
+        }
+
+        g_trace_rd++;
+    }
+
+#if TRACE_REPORT_MS
+    if (g_trace_new && HAL_GetTick() - g_trace_tick >= TRACE_REPORT_MS)
+    {
+        trace_report();
+    }
+#endif
+}
+
+/**
+ * @brief       ȡĳ׶εͳ
+ * @param       stage: ׶
+ * @param       sum  : 
+ * @retval      
+ */
+void trace_summary(uint8_t stage, trace_summary_t *sum)
+{
+    uint32_t acc = 0;
+    uint32_t p50, p95;
+    uint8_t i;
+
+    sum->n = g_trace_n[stage];
+    sum->max = g_trace_max[stage];
+    sum->p50 = 0;
+    sum->p95 = 0;
+
+    if (sum->n == 0)
+    {
+        return;
+    }
+
+    p50 = (sum->n * 50ull + 99) / 100;
+    p95 = (sum->n * 95ull + 99) / 100;
+
+    for (i = 0; i < TRACE_HIST_NUM; i++)
+    {
+        acc += g_trace_hist[stage][i];
+
+        if (sum->p50 == 0 && acc >= p50)
+        {
+            sum->p50 = trace_bucket_value(i);
+        }
+
+        if (acc >= p95)
+        {
+            sum->p95 = trace_bucket_value(i);
+            break;
+        }
+    }
+
+    /* мֵܱʵֵ */
+    if (sum->p50 > sum->max)
+    {
+        sum->p50 = sum->max;
+    }
+
+    if (sum->p95 > sum->max)
+    {
+        sum->p95 = sum->max;
+    }
+}
+
+/**
+ * @brief       0.1us
+ * @param       cycles: 
+ * @retval      0.1us
+ */
+static uint32_t trace_to_100ns(uint32_t cycles)
+{
+    return (uint64_t)cycles * 10 / (SystemCoreClock / 1000000);
+}
+
+/**
+ * @brief       ͳƱ(ÿ׶һ, λus)
+ * @param       
+ * @retval      
+ */
+void trace_report(void)
+{
+    trace_summary_t sum;
+    uint32_t p50, p95, max;
+    uint8_t i;
+
+    log_printf("trace: stage n p50 p95 max (us), lost=%lu\r\n", (unsigned long)g_trace_lost);
+
+    for (i = 0; i < TRACE_STAGE_NUM; i++)
+    {
+        trace_summary(i, &sum);
+        p50 = trace_to_100ns(sum.p50);
+        p95 = trace_to_100ns(sum.p95);
+        max = trace_to_100ns(sum.max);
+        log_printf("%-8s %6lu %7lu.%lu %7lu.%lu %7lu.%lu\r\n", g_trace_name[i], (unsigned long)sum.n,
+                   (unsigned long)(p50 / 10), (unsigned long)(p50 % 10),
+                   (unsigned long)(p95 / 10), (unsigned long)(p95 % 10),
+                   (unsigned long)(max / 10), (unsigned long)(max % 10));
+    }
+
+    g_trace_tick = HAL_GetTick();
+    g_trace_new = 0;
+}
+
+/**
+ * @brief       ͳ
+ * @param       
+ * @retval      
+ */
+void trace_reset(void)
+{
+    memset(g_trace_hist, 0, sizeof(g_trace_hist));
+    memset(g_trace_n, 0, sizeof(g_trace_n));
+    memset(g_trace_max, 0, sizeof(g_trace_max));
+    g_trace_lost = 0;
+    g_trace_new = 0;
+}
@@ -0,0 +1,260 @@
+/**
+ ****************************************************************************************************
+ * @file        asset_pack.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       Դ: ֿͼƬѹ asset.h ʽCͷļ
+ ****************************************************************************************************
+ * @attention
+ *
+ * (ڲֿĿ¼):
+ *   gcc -O2 -DHOST_SIM -ICore/Inc -IHost Host/asset_pack.c Core/Src/asset_enc.c -o asset_pack
+ * :
+ *   ./asset_pack font > Core/Inc/lcdfont_pack.h
+ *       ѹ lcdfont.h ֿ, ֿѹ󲻸Сԭ
+ *   ./asset_pack img <> <ļ> [ ] [raw|rle|lz] > xxx.h
+ *       ͼƬ .ppm(P6, 8λ)  lcd_show_pic ʽСRGB565ļ(Ҫ),
+ *       ָʽʱȡ rle/lz нС
+ *
+ * ѹǰֽ stderr. ɵͷļֻܱһ.cļ( lcdfont.h һ).
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdlib.h>
+#include "asset.h"
+#include "lcdfont.h"
+
+
+static const char *g_pack_codec[] = {"ASSET_RAW", "ASSET_RLE", "ASSET_LZ"};
+static const char *g_pack_fmt[] = {"raw", "rle", "lz"};
+
+/**
+ * @brief       Cֽ
+ * @param       buf: 
+ * @param       len: ֽ
+ * @retval      
+ */
+static void pack_bytes(const uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        printf("%s0x%02X,%s", (i % 16) ? "" : "    ", buf[i], (i % 16 == 15 || i == len - 1) ? "\n" : "");
+    }
+}
+
+/**
+ * @brief       ѹһֿ
+ * @param       name : ,  asc2_1206
+ * @param       size : С
+ * @param       raw  : lcdfont.h 
+ * @param       bytes: ÿģֽ
+ * @retval      ѹֽ(ƫƱ)
+ */
+static uint32_t pack_font(const char *name, uint8_t size, const uint8_t *raw, uint8_t bytes)
+{
+    static uint8_t buf[ASSET_GLYPH_NUM * ASSET_GLYPH_MAX * 4];
+    uint16_t offs[ASSET_GLYPH_NUM + 1];
+    uint32_t len = 0, total;
+    uint8_t i;
+
+    for (i = 0; i < ASSET_GLYPH_NUM; i++)
+    {
+        offs[i] = len;
+        len += asset_pack_glyph(raw + i * bytes, bytes, buf + len);
+    }
+
+    offs[ASSET_GLYPH_NUM] = len;
+    total = len + sizeof(offs);
+
+    if (total >= (uint32_t)ASSET_GLYPH_NUM * bytes)
+    {
+        total = ASSET_GLYPH_NUM * bytes;
+        printf("/* %ux%u: %u ֽ, ѹ󲻸С, ԭ */\n", size, size / 2, total);
+        printf("const uint8_t %s_pack[%u] =\n{\n", name, total);
+        pack_bytes(raw, total);
+        printf("};\n");
+        printf("const asset_font_t g_font_%s = {%u, %u, ASSET_RAW, NULL, %s_pack};\n\n", name + 5, size, bytes, name);
+    }
+    else
+    {
+        printf("/* %ux%u: %u -> %u ֽ(ƫƱ %u) */\n", size, size / 2, ASSET_GLYPH_NUM * bytes,
+               total, (unsigned)sizeof(offs));
+        printf("const uint16_t %s_offs[%u] =\n{\n", name, ASSET_GLYPH_NUM + 1);
+
+        for (i = 0; i <= ASSET_GLYPH_NUM; i++)
+        {
+            printf("%s%u,%s", (i % 12) ? " " : "    ", offs[i], (i % 12 == 11 || i == ASSET_GLYPH_NUM) ? "\n" : "");
+        }
+
+        printf("};\n");
+        printf("const uint8_t %s_pack[%u] =\n{\n", name, len);
+        pack_bytes(buf, len);
+        printf("};\n");
+        printf("const asset_font_t g_font_%s = {%u, %u, ASSET_RLE, %s_offs, %s_pack};\n\n", name + 5,
+               size, bytes, name, name);
+    }
+
+    fprintf(stderr, "%s: %u -> %u bytes\n", name, ASSET_GLYPH_NUM * bytes, total);
+    return total;
+}
+
+/**
+ * @brief       ѹ lcdfont.h ֿ,  lcdfont_pack.h
+ * @param       
+ * @retval      0
+ */
+static int pack_fonts(void)
+{
+    uint32_t raw = ASSET_GLYPH_NUM * (sizeof(asc2_1206[0]) + sizeof(asc2_1608[0]) + sizeof(asc2_2412[0]) + sizeof(asc2_3216[0]));
+    uint32_t total = 0;
+
+    printf("/**\n * @file        lcdfont_pack.h\n");
+    printf(" * @brief       ѹ lcdfont.h ֿ(asset.h ʽ),  Host/asset_pack.c , Ҫֹ޸:\n");
+    printf(" *                ./asset_pack font > Core/Inc/lcdfont_pack.h\n");
+    printf(" *              ֻܱ lcd.c \n */\n\n");
+    printf("#ifndef __LCDFONT_PACK_H\n#define __LCDFONT_PACK_H\n\n#include \"asset.h\"\n\n");
+    total += pack_font("asc2_1206", 12, asc2_1206[0], sizeof(asc2_1206[0]));
+    total += pack_font("asc2_1608", 16, asc2_1608[0], sizeof(asc2_1608[0]));
+    total += pack_font("asc2_2412", 24, asc2_2412[0], sizeof(asc2_2412[0]));
+    total += pack_font("asc2_3216", 32, asc2_3216[0], sizeof(asc2_3216[0]));
+    printf("/* ϼ %u -> %u ֽ */\n\n#endif\n", raw, total);
+    fprintf(stderr, "fonts: %u -> %u bytes (%u%%)\n", raw, total, total * 100 / raw);
+    return 0;
+}
+
+/**
+ * @brief       ͼƬļ
+ * @param       path: .ppm СRGB565
+ * @param       w, h: , .ppm ļͷ
+ * @retval      (ͷ), NULLʾʧ
+ */
+static uint16_t *pack_load(const char *path, uint32_t *w, uint32_t *h)
+{
+    FILE *f = fopen(path, "rb");
+    uint16_t *px = NULL;
+    uint8_t rgb[3];
+    uint32_t i, n, max;
+
+    if (f == NULL)
+    {
+        return NULL;
+    }
+
+    if (fscanf(f, "P6 %u %u %u", w, h, &max) == 3 && max == 255 && fgetc(f) != EOF)
+    {
+        n = *w * *h;
+        px = malloc(n * sizeof(uint16_t));
+
+        for (i = 0; px && i < n && fread(rgb, 1, 3, f) == 3; i++)
+        {
+            px[i] = ((rgb[0] >> 3) << 11) | ((rgb[1] >> 2) << 5) | (rgb[2] >> 3);
+        }
+    }
+    else if (*w && *h)
+    {
+        rewind(f);
+        n = *w * *h;
+        px = malloc(n * sizeof(uint16_t));
+
+        for (i = 0; px && i < n && fread(rgb, 1, 2, f) == 2; i++)
+        {
+            px[i] = rgb[0] | (rgb[1] << 8);
+        }
+    }
+    else
+    {
+        i = n = 1;
+    }
+
+    fclose(f);
+
+    if (px && i < n)
+    {
+        free(px);
+        px = NULL;
+    }
+
+    return px;
+}
+
+/**
+ * @brief       ѹһͼƬ
+ * @param       argc, argv: img <> <ļ> [ ] [raw|rle|lz]
+ * @retval      0, ɹ; 1, ʧ
+ */
+static int pack_img(int argc, char **argv)
+{
+    const char *name = argv[2];
+    const char *fmt = (argc == 5 || argc == 7) ? argv[argc - 1] : NULL;
+    uint32_t w = (argc >= 6) ? strtoul(argv[4], NULL, 0) : 0;
+    uint32_t h = (argc >= 6) ? strtoul(argv[5], NULL, 0) : 0;
+    uint32_t len[3], n, cap;
+    uint16_t *px = pack_load(argv[3], &w, &h);
+    uint8_t *buf[3];
+    uint8_t c, codec = ASSET_RLE;
+
+    if (px == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", argv[3]);
+        return 1;
+    }
+
+    n = w * h;
+    cap = n * 2 + n / ASSET_LIT_MAX + 1;
+
+    for (c = ASSET_RAW; c <= ASSET_LZ; c++)
+    {
+        buf[c] = malloc(cap);
+        len[c] = asset_pack_img(c, px, n, buf[c], cap);
+    }
+
+    if (fmt == NULL)
+    {
+        codec = (len[ASSET_LZ] < len[ASSET_RLE]) ? ASSET_LZ : ASSET_RLE;
+    }
+    else
+    {
+        for (codec = ASSET_RAW; codec <= ASSET_LZ && strcmp(fmt, g_pack_fmt[codec]) != 0; codec++);
+
+        if (codec > ASSET_LZ)
+        {
+            fprintf(stderr, "unknown format %s\n", fmt);
+            return 1;
+        }
+    }
+
+    printf("/* %s: %ux%u, %s, %u -> %u ֽ */\n", name, w, h, g_pack_codec[codec], len[ASSET_RAW], len[codec]);
+    printf("const uint8_t %s_data[%u] __attribute__((aligned(2))) =\n{\n", name, len[codec]);
+    pack_bytes(buf[codec], len[codec]);
+    printf("};\n");
+    printf("const asset_img_t %s = {%u, %u, %s, %u, %s_data};\n", name, w, h, g_pack_codec[codec], len[codec], name);
+    fprintf(stderr, "%s: %ux%u raw %u, rle %u, lz %u bytes -> %s (%u%%)\n", name, w, h, len[ASSET_RAW],
+            len[ASSET_RLE], len[ASSET_LZ], g_pack_codec[codec], len[codec] * 100 / len[ASSET_RAW]);
+
+    for (c = ASSET_RAW; c <= ASSET_LZ; c++)
+    {
+        free(buf[c]);
+    }
+
+    free(px);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 2 && strcmp(argv[1], "font") == 0)
+    {
+        return pack_fonts();
+    }
+
+    if (argc >= 4 && argc <= 7 && strcmp(argv[1], "img") == 0)
+    {
+        return pack_img(argc, argv);
+    }
+
+    fprintf(stderr, "usage: %s font\n       %s img <name> <file.ppm|file.bin w h> [raw|rle|lz]\n", argv[0], argv[0]);
+    return 1;
+}
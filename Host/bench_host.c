@@ -0,0 +1,134 @@
+/**
+ ****************************************************************************************************
+ * @file        bench_host.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       bench.c : Linuxͬһ׼
+ ****************************************************************************************************
+ * @attention
+ *
+ * (ڲֿĿ¼):
+ *   gcc -O2 -DHOST_SIM -ICore/Inc -IHost -IMiddlewares/ST/AI/Inc -IX-CUBE-AI/App \
+ *       Host/bench_host.c Host/host_sim.c Core/Src/bench.c Core/Src/nn_ref.c \
+ *       X-CUBE-AI/App/network_data_params.c -lm -o bench_host
+ * :
+ *   ./bench_host "run all 20" report      ÿһ
+ *   ./bench_host < cmds.txt               ûвʱӱ׼ж
+ *
+ *  HOST_CLOCK ǽʱ任, ֻڶԱ㷨Ķ, Ϻʱ.
+ * һοʵ, ü򵥱ʻȨŲǷȷ.
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdlib.h>
+#include "bench.h"
+#include "nn_ref.h"
+
+
+static float g_host_scratch[NN_REF_SCRATCH / sizeof(float)];
+
+/**
+ * @brief       28x28ͼƬϻһ3شֵ߶
+ * @param       img   : ͼƬ
+ * @param       x0, y0: 
+ * @param       x1, y1: յ
+ * @retval      
+ */
+static void host_line(float *img, int x0, int y0, int x1, int y1)
+{
+    int t, dx, dy, x, y;
+
+    for (t = 0; t <= 64; t++)
+    {
+        for (dy = -1; dy <= 1; dy++)
+        {
+            for (dx = -1; dx <= 1; dx++)
+            {
+                x = x0 + (x1 - x0) * t / 64 + dx;
+                y = y0 + (y1 - y0) * t / 64 + dy;
+
+                if (x >= 0 && x < NN_IN_W && y >= 0 && y < NN_IN_H)
+                {
+                    img[y * NN_IN_W + x] = 1;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief       "1""7"ʻοʵ
+ * @param       
+ * @retval      0, ͨ; 1, ʧ;
+ */
+static int host_selftest(void)
+{
+    static const uint8_t expect[2] = {1, 7};
+    float img[NN_IN_H * NN_IN_W];
+    float out[NN_OUT_NUM];
+    int k, i, best;
+
+    for (k = 0; k < 2; k++)
+    {
+        memset(img, 0, sizeof(img));
+
+        if (k == 0)
+        {
+            host_line(img, 14, 4, 14, 24);
+        }
+        else
+        {
+            host_line(img, 7, 5, 21, 5);
+            host_line(img, 21, 5, 12, 24);
+        }
+
+        nn_ref_run(img, out, g_host_scratch);
+
+        for (best = 0, i = 1; i < NN_OUT_NUM; i++)
+        {
+            best = (out[i] > out[best]) ? i : best;
+        }
+
+        printf("selftest: '%u' -> %d (%.3f)\n", expect[k], best, out[best]);
+
+        if (best != expect[k])
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    char line[BENCH_LINE_SIZE * 2];
+    int i;
+
+    if (host_selftest())
+    {
+        printf("selftest failed\n");
+        return 1;
+    }
+
+    bench_init(g_host_scratch);
+
+    if (argc > 1)
+    {
+        for (i = 1; i < argc; i++)
+        {
+            bench_exec(argv[i]);
+        }
+
+        return 0;
+    }
+
+    while (fgets(line, sizeof(line), stdin))
+    {
+        line[strcspn(line, "\r\n")] = 0;
+        bench_exec(line);
+    }
+
+    return 0;
+}
@@ -0,0 +1,229 @@
+/**
+ ****************************************************************************************************
+ * @file        digit_sim.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       õд: ģ + С/б/λ, ɨ
+ ****************************************************************************************************
+ * @attention
+ *
+ * ģͲ digit_sim.h. prep_host.cstrip_host.c ʶ online_train.c/online_host.c .
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "digit_sim.h"
+#include "stroke.h"
+
+
+/* ģ: ʻ = ,  x, y (0~1, y), ʻ֮ -1 , -2  */
+static const float g_digit[10][40] =
+{
+    {0},                                                                                /* 0: Բ,  */
+    {0.3f, 0.2f, 0.55f, 0.0f, 0.55f, 1.0f, -2},
+    {0.15f, 0.25f, 0.3f, 0.05f, 0.6f, 0.0f, 0.85f, 0.2f, 0.8f, 0.45f, 0.5f, 0.7f, 0.1f, 1.0f, 0.9f, 1.0f, -2},
+    {0.15f, 0.1f, 0.5f, 0.0f, 0.8f, 0.15f, 0.75f, 0.4f, 0.45f, 0.5f, 0.8f, 0.6f, 0.85f, 0.85f, 0.5f, 1.0f, 0.15f, 0.9f, -2},
+    {0.65f, 1.0f, 0.65f, 0.0f, 0.1f, 0.7f, 0.9f, 0.7f, -2},
+    {0.85f, 0.0f, 0.2f, 0.0f, 0.15f, 0.45f, 0.5f, 0.4f, 0.8f, 0.55f, 0.85f, 0.8f, 0.55f, 1.0f, 0.15f, 0.9f, -2},
+    {0.75f, 0.0f, 0.4f, 0.2f, 0.2f, 0.5f, 0.2f, 0.8f, 0.45f, 1.0f, 0.75f, 0.9f, 0.8f, 0.65f, 0.5f, 0.5f, 0.2f, 0.65f, -2},
+    {0.1f, 0.0f, 0.9f, 0.0f, 0.4f, 1.0f, -2},
+    {0.8f, 0.15f, 0.5f, 0.0f, 0.2f, 0.15f, 0.25f, 0.35f, 0.75f, 0.65f, 0.8f, 0.85f, 0.5f, 1.0f, 0.2f, 0.85f, 0.25f, 0.65f, 0.75f, 0.35f, 0.8f, 0.15f, -2},
+    {0.8f, 0.3f, 0.6f, 0.05f, 0.3f, 0.05f, 0.2f, 0.3f, 0.4f, 0.5f, 0.75f, 0.4f, 0.8f, 0.3f, 0.75f, 1.0f, -2},
+};
+
+uint16_t g_pt[HOST_PT_MAX][2];
+uint32_t g_pt_num;
+
+/**
+ * @brief       
+ * @param       a,b: Χ
+ * @retval      [a, b)
+ */
+double host_rand(double a, double b)
+{
+    return a + (b - a) * rand() / ((double)RAND_MAX + 1);
+}
+
+/**
+ * @brief       ̬(Box-Muller)
+ * @param       
+ * @retval      ׼̬
+ */
+double host_gauss(void)
+{
+    double u = host_rand(1e-9, 1), v = host_rand(0, 1);
+
+    return sqrt(-2 * log(u)) * cos(2 * 3.14159265358979 * v);
+}
+
+/**
+ * @brief       һ߰ step ², , 浽 g_pt
+ * @param       p   : (Ļ, double x, y)
+ * @param       n   : 
+ * @param       step: ()
+ * @retval      
+ */
+static void host_sample(const double (*p)[2], uint32_t n, double step)
+{
+    double x, y, dx, dy, len, d = 0;
+    uint32_t i;
+    int32_t k;
+
+    for (i = 0; i + 1 < n; i++)
+    {
+        dx = p[i + 1][0] - p[i][0];
+        dy = p[i + 1][1] - p[i][1];
+        len = sqrt(dx * dx + dy * dy);
+
+        for (; d < len || (i + 2 == n && d <= len); d += step)
+        {
+            x = p[i][0] + (len > 0 ? dx * d / len : 0) + HOST_NOISE * host_gauss();
+            y = p[i][1] + (len > 0 ? dy * d / len : 0) + HOST_NOISE * host_gauss();
+
+            if (g_pt_num < HOST_PT_MAX - 2)
+            {
+                for (k = 0; k < 2; k++)
+                {
+                    double v = k ? y : x;
+                    double lo = k ? PREP_Y0 + 1 : PREP_X0 + 1, hi = k ? PREP_Y0 + PREP_H - 2 : PREP_X0 + PREP_W - 2;
+                    g_pt[g_pt_num][k] = (v < lo) ? lo : (v > hi) ? hi : (uint16_t)(v + 0.5);
+                }
+
+                g_pt_num++;
+            }
+        }
+
+        d -= len;
+    }
+
+    g_pt[g_pt_num][0] = 0xFFFF;                 /* ̧ */
+    g_pt_num++;
+}
+
+/**
+ * @brief       һ, ʻ g_pt 
+ * @param       digit  : 
+ * @param       h      : ߶()
+ * @param       xlo,xhi: Χ()
+ * @param       ylo,yhi: Χ()
+ * @retval      
+ */
+void host_digit(uint8_t digit, double h, double xlo, double xhi, double ylo, double yhi)
+{
+    double w = h * host_rand(0.5, 0.8);
+    double slant = host_rand(-0.25, 0.25);
+    double step = host_rand(8, 20);
+    double x0, y0, p[32][2], u, v;
+    const float *t = g_digit[digit];
+    uint32_t n = 0, i;
+
+    w += fabs(slant) * h;
+    x0 = host_rand(xlo, xhi - w) + (slant < 0 ? -slant * h : 0);
+    y0 = host_rand(ylo, yhi - h);
+
+    if (digit == 0)
+    {
+        for (i = 0; i <= 24; i++)
+        {
+            u = 0.5 + 0.5 * sin(2 * 3.14159265358979 * i / 24);
+            v = 0.5 - 0.5 * cos(2 * 3.14159265358979 * i / 24);
+            p[i][0] = x0 + u * (w - fabs(slant) * h) + slant * (1 - v) * h;
+            p[i][1] = y0 + v * h;
+        }
+
+        host_sample(p, 25, step);
+        return;
+    }
+
+    for (; *t != -2; t += 2)
+    {
+        if (*t == -1)
+        {
+            host_sample(p, n, step);
+            n = 0;
+            t--;
+            continue;
+        }
+
+        p[n][0] = x0 + t[0] * (w - fabs(slant) * h) + slant * (1 - t[1]) * h;
+        p[n][1] = y0 + t[1] * h;
+        n++;
+    }
+
+    host_sample(p, n, step);
+}
+
+/**
+ * @brief       ѵǰ߶νһֹդ
+ * @param       line: դ
+ * @retval      
+ */
+void host_feed(void (*line)(uint16_t, uint16_t, uint16_t, uint16_t))
+{
+    uint32_t i;
+
+    for (i = 0; i < g_pt_num; i++)
+    {
+        if (g_pt[i][0] == 0xFFFF)
+        {
+            continue;
+        }
+
+        if (i == 0 || g_pt[i - 1][0] == 0xFFFF)     /* ʵ */
+        {
+            line(g_pt[i][0], g_pt[i][1], g_pt[i][0], g_pt[i][1]);
+        }
+        else
+        {
+            line(g_pt[i - 1][0], g_pt[i - 1][1], g_pt[i][0], g_pt[i][1]);
+        }
+    }
+}
+
+/**
+ * @brief       ѵǰ,  stroke.c, ߶νߺ
+ *   @note      ʵյͬһ; ĵڻ(ͬ main.c  canvas_clip)
+ * @param       line: ߺ
+ * @param       dt  : ÿһʱ(us),  g_pt һһӦ; NULL ʾ HOST_PERIOD_US
+ * @retval      
+ */
+void host_feed_stroke(void (*line)(uint16_t, uint16_t, uint16_t, uint16_t), const uint32_t *dt)
+{
+    uint16_t pts[STROKE_CURVE_MAX][2], last[2] = {0};
+    stroke_t s;
+    uint32_t i;
+    uint8_t n = 0, k, down = 0;
+
+    for (i = 0; i < g_pt_num; i++)
+    {
+        if (g_pt[i][0] == 0xFFFF)
+        {
+            n = down ? stroke_end(&s, pts) : 0;
+            down = 0;
+        }
+        else if (down == 0)
+        {
+            stroke_begin(&s, g_pt[i][0], g_pt[i][1]);
+            line(g_pt[i][0], g_pt[i][1], g_pt[i][0], g_pt[i][1]);
+            last[0] = g_pt[i][0];
+            last[1] = g_pt[i][1];
+            down = 1;
+            continue;
+        }
+        else
+        {
+            n = stroke_add(&s, g_pt[i][0], g_pt[i][1], dt ? dt[i] : HOST_PERIOD_US, pts);
+        }
+
+        for (k = 0; k < n; k++)
+        {
+            pts[k][0] = (pts[k][0] < PREP_X0 + 1) ? PREP_X0 + 1 : (pts[k][0] > PREP_X0 + PREP_W - 2) ? PREP_X0 + PREP_W - 2 : pts[k][0];
+            pts[k][1] = (pts[k][1] < PREP_Y0 + 1) ? PREP_Y0 + 1 : (pts[k][1] > PREP_Y0 + PREP_H - 2) ? PREP_Y0 + PREP_H - 2 : pts[k][1];
+            line(last[0], last[1], pts[k][0], pts[k][1]);
+            last[0] = pts[k][0];
+            last[1] = pts[k][1];
+        }
+    }
+}
@@ -0,0 +1,41 @@
+/**
+ ****************************************************************************************************
+ * @file        digit_sim.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       õд: ģ + С/б/λ, ɨ
+ ****************************************************************************************************
+ * @attention
+ *
+ * 0~9 ģ(λ), ߱Ⱥб,  8~20 һ²(ɨļ)
+ *  HOST_NOISE , ߶ζ˵ g_pt (ڻ prep.h  PREP_X0.. ).
+ * host_feed  g_pt ʵ/߶νһߺ( prep_add);
+ * host_feed_stroke  g_pt (Ĭÿ HOST_PERIOD_US һ),  main.c Ļһ
+ * Ⱦ stroke.c(˲ + ֵ), ߶ٽߺ.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __DIGIT_SIM_H
+#define __DIGIT_SIM_H
+
+#include "prep.h"
+
+
+#define HOST_NOISE          1.0         /* (, ׼) */
+#define HOST_PT_MAX         2048        /* һ߶ζ˵ */
+#define HOST_YLO            (PREP_Y0 + 1)           /* Χ(һ) */
+#define HOST_YHI            (PREP_Y0 + PREP_H - 2)
+#define HOST_PERIOD_US      20000       /* host_feed_stroke: ɨ(TIM2) */
+
+/* һ: ߶ζ˵(Ļ), x Ϊ 0xFFFF ʾ̧ */
+extern uint16_t g_pt[HOST_PT_MAX][2];
+extern uint32_t g_pt_num;
+
+double host_rand(double a, double b);                                   /*  [a, b) */
+double host_gauss(void);                                                /* ׼̬ */
+void host_digit(uint8_t digit, double h, double xlo, double xhi, double ylo, double yhi);  /* һ,  g_pt  */
+void host_feed(void (*line)(uint16_t, uint16_t, uint16_t, uint16_t));   /*  g_pt һߺ */
+void host_feed_stroke(void (*line)(uint16_t, uint16_t, uint16_t, uint16_t), const uint32_t *dt);    /*  stroke.c ٽߺ */
+
+#endif
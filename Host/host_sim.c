@@ -0,0 +1,39 @@
+/**
+ ****************************************************************************************************
+ * @file        host_sim.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       (Linux)湹Ĺ
+ ****************************************************************************************************
+ */
+
+#include <stdarg.h>
+#include "host_sim.h"
+
+
+/**
+ * @brief       ʽһ־(ֱдstdout)
+ * @param       fmt: ʽ
+ * @retval      дַ
+ */
+int log_printf(const char *fmt, ...)
+{
+    va_list ap;
+    int ret;
+
+    va_start(ap, fmt);
+    ret = vprintf(fmt, ap);
+    va_end(ap);
+    return ret;
+}
+
+/**
+ * @brief       ԭдһ
+ * @param       buf: 
+ * @param       len: 
+ * @retval      0, ɹ; 1, ʧ;
+ */
+uint8_t log_write(const uint8_t *buf, uint16_t len)
+{
+    return fwrite(buf, 1, len, stdout) != len;
+}
@@ -0,0 +1,128 @@
+/**
+ ****************************************************************************************************
+ * @file        host_sim.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       (Linux)湹Ĺ
+ *   @note       HOST_SIM ʱ, Core µģļ main.h, ṩ
+ *              DWTڼ/HAL_GetTick/SystemCoreClock/־, 弶벻ҪĶ.
+ *              ڼ CLOCK_MONOTONIC  HOST_CLOCK , ֵͰϿֱӱȽ.
+ ****************************************************************************************************
+ */
+
+#ifndef __HOST_SIM_H
+#define __HOST_SIM_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HOST_CLOCK          168000000u  /* F407Ƶ */
+
+#define SystemCoreClock     HOST_CLOCK
+
+#ifndef __weak
+#define __weak              __attribute__((weak))
+#endif
+
+#ifndef UNUSED
+#define UNUSED(x)           ((void)(x))
+#endif
+
+/**
+ * @brief       ģ DWT->CYCCNT
+ * @param       
+ * @retval      (32λ, Ӳһ)
+ */
+static inline uint32_t host_cycles(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * HOST_CLOCK + (uint64_t)ts.tv_nsec * (HOST_CLOCK / 1000000u) / 1000u);
+}
+
+/**
+ * @brief       ģ HAL_GetTick
+ * @param       
+ * @retval      
+ */
+static inline uint32_t HAL_GetTick(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000u + ts.tv_nsec / 1000000u);
+}
+
+/* ϲõӲ, ʱΪ */
+static inline void HAL_Delay(uint32_t ms)
+{
+    (void)ms;
+}
+
+static inline uint32_t __CLZ(uint32_t v)
+{
+    return v ? (uint32_t)__builtin_clz(v) : 32u;
+}
+
+static inline uint32_t __ROR(uint32_t v, uint32_t n)
+{
+    n &= 31u;
+    return n ? (v >> n) | (v << (32u - n)) : v;
+}
+
+/* Cortex-M4 SIMD ָCʵ(Ӳһ) */
+static inline uint32_t __USADA8(uint32_t a, uint32_t b, uint32_t acc)
+{
+    uint32_t i, x, y;
+
+    for (i = 0; i < 32; i += 8)
+    {
+        x = (a >> i) & 0xFF;
+        y = (b >> i) & 0xFF;
+        acc += (x > y) ? x - y : y - x;
+    }
+
+    return acc;
+}
+
+static inline uint32_t __UXTB16(uint32_t v)
+{
+    return v & 0x00FF00FFu;
+}
+
+static inline uint32_t __SMLAD(uint32_t a, uint32_t b, uint32_t acc)
+{
+    return acc + (int16_t)a * (int16_t)b + (int16_t)(a >> 16) * (int16_t)(b >> 16);
+}
+
+/* ûж, ٽΪ */
+static inline uint32_t __get_PRIMASK(void)
+{
+    return 0;
+}
+
+static inline void __set_PRIMASK(uint32_t v)
+{
+    (void)v;
+}
+
+static inline void __disable_irq(void)
+{
+}
+
+/* log.h ӿڵʵ(host_sim.c), ֱдstdout */
+int log_printf(const char *fmt, ...);
+uint8_t log_write(const uint8_t *buf, uint16_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,308 @@
+/**
+ ****************************************************************************************************
+ * @file        lcd_host.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       LCDع: ģ lcd.c ĸͼ, ͳ߿
+ ****************************************************************************************************
+ * @attention
+ *
+ * (ڲֿĿ¼):
+ *   gcc -O2 -DHOST_SIM -ICore/Inc -IHost Host/lcd_host.c Host/lcd_sim.c Host/host_sim.c \
+ *       Core/Src/lcd.c Core/Src/lcd_ex.c Core/Src/dirty.c Core/Src/panel.c Core/Src/bar.c \
+ *       Core/Src/asset.c Core/Src/asset_enc.c -lm -o lcd_host
+ * :
+ *   ./lcd_host                    ģNT35510(ϵ)
+ *   ./lcd_host 9341 out.png       ģILI9341, Ļout.png(.ppm)
+ *
+ * ÿ: дĴ//Ĵ, ʼдGRAM(򴰿)Ĵ, ظдĵ,
+ * ԼGRAMɢ. ĻͼǰԱű: ܻ, ɢб仯ǻ.
+ * ģд g_lcd_bus_writes һʱ, ˵к©ǻд, ط0.
+ * asset_rle/asset_lz  show_pic ͼƬѹͬһλٻһ, 벻.
+ * init_hint/init_stale  lcd_init_start_hint ٳʼһ: ԵIDֻһIDĴ, ID()һ̽.
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdlib.h>
+#include "lcd.h"
+#include "dirty.h"
+#include "panel.h"
+#include "bar.h"
+#include "asset.h"
+
+
+#define HOST_STROKE_SIZE    10          /* ʻ뾶, 뻭ͬ */
+#define HOST_PIC_W          64
+#define HOST_PIC_H          48
+
+/* һ"2",  bench_board.c ıʻͬ */
+static const uint16_t g_host_stroke[][2] =
+{
+    {150, 160}, {162, 150}, {178, 142}, {196, 140}, {214, 144}, {228, 154}, {236, 170},
+    {236, 188}, {230, 206}, {218, 224}, {202, 242}, {186, 260}, {170, 278}, {158, 294},
+    {150, 308}, {166, 310}, {186, 310}, {208, 310}, {230, 310}, {252, 312},
+};
+#define HOST_STROKE_NUM     (sizeof(g_host_stroke) / sizeof(g_host_stroke[0]))
+
+static uint16_t g_host_pic[HOST_PIC_W * HOST_PIC_H];
+static uint8_t g_host_pack[HOST_PIC_W * HOST_PIC_H * 2 + HOST_PIC_W * HOST_PIC_H / ASSET_LIT_MAX + 1];
+static const float g_host_prob_a[PANEL_PROB_NUM] = {0.01f, 0.02f, 0.90f, 0.01f, 0.01f, 0.01f, 0.01f, 0.01f, 0.01f, 0.01f};
+static const float g_host_prob_b[PANEL_PROB_NUM] = {0.01f, 0.02f, 0.85f, 0.06f, 0.01f, 0.01f, 0.01f, 0.01f, 0.01f, 0.01f};
+static const uint8_t g_host_num = 2;    /*  */
+static uint32_t g_host_bus;             /* ʼʱ g_lcd_bus_writes */
+static uint8_t g_host_fail = 0;
+
+/* lcd.c/dirty.c ѭ, ûе */
+void sched_lock(void)
+{
+}
+
+void sched_unlock(void)
+{
+}
+
+/**
+ * @brief       ͼ: ׵һ߿
+ * @param       y, x0, x1: кзΧ
+ * @param       line     : л
+ * @retval      
+ */
+static void host_paint(uint16_t y, uint16_t x0, uint16_t x1, uint16_t *line)
+{
+    uint16_t x;
+
+    for (x = x0; x <= x1; x++)
+    {
+        if ((y == 72 || y == 407) && x >= 72 && x <= 407)
+        {
+            line[x - x0] = BLACK;
+        }
+        else if ((x == 72 || x == 407) && y >= 72 && y <= 407)
+        {
+            line[x - x0] = BLACK;
+        }
+    }
+}
+
+/**
+ * @brief       ʼһ
+ * @param       
+ * @retval      
+ */
+static void host_begin(void)
+{
+    lcd_sim_mark();
+    g_host_bus = g_lcd_bus_writes;
+}
+
+/**
+ * @brief       һ: ͳ, ˶д
+ * @param       name: 
+ * @retval      
+ */
+static void host_end(const char *name)
+{
+    const lcd_sim_stats_t *s = lcd_sim_get_stats();
+    uint32_t sim = s->regs + s->params + s->pixels;
+    uint32_t bus = g_lcd_bus_writes - g_host_bus;
+
+    printf("%-12s %6u %7u %8u %6u %8u  %08x%s\n", name, (unsigned)s->regs, (unsigned)s->params,
+           (unsigned)s->pixels, (unsigned)s->setups, (unsigned)s->overdraw, (unsigned)lcd_sim_hash(),
+           (sim != bus) ? "  !" : "");
+
+    if (sim != bus)
+    {
+        printf("  bus writes %u, controller saw %u\n", (unsigned)bus, (unsigned)sim);
+        g_host_fail = 1;
+    }
+
+    if (s->wraps)
+    {
+        printf("  %u writes past the end of the window\n", (unsigned)s->wraps);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    uint16_t id = (argc > 1) ? (uint16_t)strtoul(argv[1], NULL, 16) : 0x5510;
+    asset_img_t img = {HOST_PIC_W, HOST_PIC_H, ASSET_RAW, 0, g_host_pack};
+    uint16_t w, h;
+    uint32_t i, hash;
+    uint8_t p;
+
+    if (lcd_sim_init(id))
+    {
+        printf("unsupported LCD id %s\n", argv[1]);
+        return 2;
+    }
+
+    for (i = 0; i < HOST_PIC_W * HOST_PIC_H; i++)     /* ϰǽ, °ǰ׵ϵ */
+    {
+        if (i < HOST_PIC_W * HOST_PIC_H / 2)
+        {
+            g_host_pic[i] = ((i % HOST_PIC_W) << 11) | ((i / HOST_PIC_W) << 5) | (i & 0x1F);
+        }
+        else
+        {
+            g_host_pic[i] = (i % HOST_PIC_W / 8 == 3) ? RED : WHITE;
+        }
+    }
+
+    host_begin();
+    lcd_init();
+    w = lcddev.width;
+    h = lcddev.height;
+    printf("LCD %04x %ux%u, GRAM %ux%u\n", lcddev.id, w, h, lcd_sim_width(), lcd_sim_height());
+
+    if (lcddev.id != id)
+    {
+        printf("lcd_init detected %04x\n", lcddev.id);
+        return 2;
+    }
+
+    printf("%-12s %6s %7s %8s %6s %8s  %s\n", "case", "regs", "params", "pixels", "setups", "overdraw", "hash");
+    host_end("init");
+
+    for (i = 0; i < 2; i++)             /* ϴμ⵽ID(init_hint)/(init_stale, )ʱٳʼһ */
+    {
+        host_begin();
+        p = lcd_init_start_hint(i ? ((id == 0x9341) ? 0x7789 : 0x9341) : id);
+
+        while (lcd_init_poll());
+
+        host_end(i ? "init_stale" : "init_hint");
+
+        if (p != i || lcddev.id != id)
+        {
+            printf("  lcd_init_start_hint detected %04x\n", lcddev.id);
+            g_host_fail = 1;
+        }
+    }
+
+    host_begin();
+    lcd_clear(WHITE);
+    host_end("clear");
+
+    host_begin();
+    lcd_fill(10, 10, 109, 109, RED);
+    host_end("fill");
+
+    host_begin();
+    lcd_fill(120, 10, 129, 19, BLUE);
+    host_end("fill_small");
+
+    host_begin();
+    lcd_color_fill(10, 120, 10 + HOST_PIC_W - 1, 120 + HOST_PIC_H - 1, g_host_pic);
+    host_end("color_fill");
+
+    host_begin();
+    lcd_show_pic(80, 120, 80 + HOST_PIC_W - 1, 120 + HOST_PIC_H - 1, (uint8_t *)g_host_pic);
+    host_end("show_pic");
+
+    for (img.codec = ASSET_RLE; img.codec <= ASSET_LZ; img.codec++)
+    {
+        img.len = asset_pack_img(img.codec, g_host_pic, HOST_PIC_W * HOST_PIC_H, g_host_pack, sizeof(g_host_pack));
+        hash = lcd_sim_hash();
+        host_begin();
+        asset_show_img(80, 120, &img);
+        host_end((img.codec == ASSET_RLE) ? "asset_rle" : "asset_lz");
+        printf("  %u -> %u bytes\n", HOST_PIC_W * HOST_PIC_H * 2, (unsigned)img.len);
+
+        if (lcd_sim_hash() != hash && lcddev.id != 0x1963)  /* 1963дĻģⲻ׼ */
+        {
+            printf("  differs from show_pic\n");
+            g_host_fail = 1;
+        }
+    }
+
+    host_begin();
+    lcd_draw_point(5, 5, BLACK);
+    host_end("point");
+
+    host_begin();
+    lcd_draw_line(0, 0, w - 1, h - 1, GREEN);
+    host_end("line");
+
+    host_begin();
+    lcd_draw_hline(0, 200, w, MAGENTA);
+    host_end("hline");
+
+    host_begin();
+    lcd_draw_rectangle(20, 210, 120, 260, BLUE);
+    host_end("rect");
+
+    host_begin();
+    lcd_draw_circle(180, 240, 30, BROWN);
+    host_end("circle");
+
+    host_begin();
+    lcd_fill_circle(100, 300, 20, CYAN);
+    host_end("fill_circle");
+
+    host_begin();
+    lcd_show_char(10, 280, 'A', 32, 1, BLACK);
+    host_end("char");
+
+    host_begin();
+    lcd_show_string(10, 172, w - 10, 24, 24, "MNIST 0123456789", BLACK);
+    host_end("string");
+
+    host_begin();
+    lcd_draw_bline(g_host_stroke[0][0], g_host_stroke[0][1], g_host_stroke[0][0], g_host_stroke[0][1],
+                   HOST_STROKE_SIZE, RED);
+
+    for (i = 1; i < HOST_STROKE_NUM; i++)
+    {
+        p = (i > 1) ? i - 2 : 0;
+        lcd_draw_bline_join(g_host_stroke[p][0], g_host_stroke[p][1],
+                            g_host_stroke[i - 1][0], g_host_stroke[i - 1][1],
+                            g_host_stroke[i][0], g_host_stroke[i][1], HOST_STROKE_SIZE, RED);
+    }
+
+    host_end("stroke");
+
+    if (w >= PANEL_X + PANEL_TEXT_MAX * PANEL_SIZE / 2 && h >= PANEL_Y + PANEL_FIELD_NUM * PANEL_SIZE)
+    {
+        dirty_init(WHITE);
+        dirty_layer_add(host_paint);
+        panel_init();
+
+        host_begin();
+        dirty_add_all();
+        dirty_flush();
+        host_end("dirty_all");
+
+        host_begin();
+        panel_update(g_host_prob_a, &g_host_num, &g_host_prob_a[2], 1);
+        bar_commit();
+        dirty_flush();
+        host_end("panel_a");
+
+        host_begin();
+        panel_update(g_host_prob_b, &g_host_num, &g_host_prob_b[2], 1);
+        bar_commit();
+        dirty_flush();
+        host_end("panel_b");
+
+        host_begin();
+        bar_set(g_host_prob_b);
+        bar_commit();
+        dirty_flush();
+        host_end("bars_same");
+
+        if (lcd_sim_get_stats()->pixels)
+        {
+            printf("  unchanged bars were redrawn\n");
+            g_host_fail = 1;
+        }
+    }
+
+    if (argc > 2 && lcd_sim_dump(argv[2]))
+    {
+        printf("cannot write %s\n", argv[2]);
+        return 2;
+    }
+
+    return g_host_fail;
+}
@@ -0,0 +1,490 @@
+/**
+ ****************************************************************************************************
+ * @file        lcd_sim.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       (Linux)ϵLCDģ: FSMCϵ, άGRAM, ͳ߿
+ ****************************************************************************************************
+ * @attention
+ *
+ *  lcd.c ÷:
+ *   NT35510 16λĴ, 0x2A00~0x2A03/0x2B00~0x2B03 ÿĴһֽ(ʼ/, /),
+ *           0x2C00 ʼдGRAM, 0x3600 ɨ跽;
+ *   8λ, 0x2A/0x2B  ʼ/, /(ֻдʼ),
+ *           0x2C ʼдGRAM, 0x3C д, 0x36 ɨ跽.
+ * дGRAMʱַ(ʼ, ʼҳ)ʼ, кҳ, ҳصʼҳ, ддһ wraps.
+ * ɨ跽 lcd_scan_dir ı: bit5 , bit6 Ҿ, bit7 ¾.
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lcd_sim.h"
+
+
+/*  */
+typedef struct
+{
+    uint16_t id;
+    uint16_t w, h;                      /* ֱ(, ҳ) */
+    uint8_t wide;                       /* 1, 16λĴ(NT35510) */
+    uint16_t idcmd[2];                  /* ID */
+    uint8_t idlen[2];
+    uint8_t idval[2][4];                /* Ӧ, һֽdummy read(5510û) */
+} lcd_sim_ic_t;
+
+static const lcd_sim_ic_t g_sim_ic[] =
+{
+    {0x9341, 240, 320, 0, {0xD3, 0}, {4, 0}, {{0x00, 0x00, 0x93, 0x41}}},
+    {0x7789, 240, 320, 0, {0x04, 0}, {4, 0}, {{0x00, 0x85, 0x85, 0x52}}},
+    {0x5310, 320, 480, 0, {0xD4, 0}, {4, 0}, {{0x00, 0x01, 0x53, 0x10}}},
+    {0x7796, 320, 480, 0, {0xD3, 0}, {4, 0}, {{0x00, 0x00, 0x77, 0x96}}},
+    {0x5510, 480, 800, 1, {0xC500, 0xC501}, {1, 1}, {{0x55}, {0x10}}},
+    {0x9806, 480, 800, 0, {0xD3, 0}, {4, 0}, {{0x00, 0x00, 0x98, 0x06}}},
+    {0x1963, 800, 480, 0, {0xA1, 0}, {3, 0}, {{0x00, 0x57, 0x61}}},
+};
+#define SIM_IC_NUM      (sizeof(g_sim_ic) / sizeof(g_sim_ic[0]))
+
+static const lcd_sim_ic_t *g_sim;
+static uint16_t *g_sim_fb;              /* GRAM,  */
+static uint32_t *g_sim_stamp;           /* ÿһαдĵú, ͳظд */
+static uint32_t g_sim_gen = 1;          /* ǰú */
+static lcd_sim_stats_t g_sim_stats;
+
+static uint16_t g_sim_cmd;              /* ǰ */
+static uint8_t g_sim_argn;              /* ǰյĲ */
+static uint8_t g_sim_writing;           /* 1, дGRAM */
+static uint8_t g_sim_full;              /* 1, Ѿд */
+static uint16_t g_sim_ca[2];            /* еַ {ʼ, } */
+static uint16_t g_sim_pa[2];            /* ҳַ {ʼ, } */
+static uint16_t g_sim_col, g_sim_page;  /* ַ */
+static uint8_t g_sim_madctl;
+static const uint8_t *g_sim_rd;         /* ݵӦ */
+static uint8_t g_sim_rdn;
+
+/**
+ * @brief       ѡģĿ, GRAM()ͳ
+ * @param       id: ID,  0x5510
+ * @retval      0, ɹ; 1, ֵ֧ID;
+ */
+uint8_t lcd_sim_init(uint16_t id)
+{
+    uint32_t n;
+    uint8_t i;
+
+    for (i = 0; i < SIM_IC_NUM && g_sim_ic[i].id != id; i++);
+
+    if (i == SIM_IC_NUM)
+    {
+        return 1;
+    }
+
+    g_sim = &g_sim_ic[i];
+    n = (uint32_t)g_sim->w * g_sim->h;
+    free(g_sim_fb);
+    free(g_sim_stamp);
+    g_sim_fb = calloc(n, sizeof(uint16_t));
+    g_sim_stamp = calloc(n, sizeof(uint32_t));
+    g_sim_gen = 1;
+    g_sim_cmd = 0;
+    g_sim_argn = 0;
+    g_sim_writing = 0;
+    g_sim_ca[0] = g_sim_pa[0] = 0;
+    g_sim_ca[1] = g_sim->w - 1;
+    g_sim_pa[1] = g_sim->h - 1;
+    g_sim_madctl = 0;
+    g_sim_rdn = 0;
+    memset(&g_sim_stats, 0, sizeof(g_sim_stats));
+    return (g_sim_fb == NULL || g_sim_stamp == NULL);
+}
+
+/**
+ * @brief       дַĴһֽ
+ * @param       addr: лҳ {ʼ, }
+ * @param       k   : 0~3, ʼ/, /
+ * @param       v   : ֽ
+ * @retval      
+ */
+static void sim_addr_byte(uint16_t *addr, uint8_t k, uint16_t v)
+{
+    uint16_t *a = &addr[k >> 1];
+
+    *a = (k & 1) ? ((*a & 0xFF00) | (v & 0xFF)) : ((*a & 0x00FF) | ((v & 0xFF) << 8));
+}
+
+/**
+ * @brief       д(Ĵ)
+ * @param       regno: Ĵ
+ * @retval      
+ */
+void lcd_sim_wr_reg(uint16_t regno)
+{
+    uint8_t i;
+
+    g_sim_stats.regs++;
+    g_sim_cmd = g_sim->wide ? regno : (regno & 0xFF);
+    g_sim_argn = 0;
+    g_sim_writing = 0;
+    g_sim_rdn = 0;
+
+    if (g_sim_cmd == (g_sim->wide ? 0x2C00 : 0x2C))     /* дGRAM, ʼַʼ */
+    {
+        g_sim_col = g_sim_ca[0];
+        g_sim_page = g_sim_pa[0];
+        g_sim_writing = 1;
+        g_sim_full = 0;
+        g_sim_stats.setups++;
+    }
+    else if (!g_sim->wide && g_sim_cmd == 0x3C)         /* д */
+    {
+        g_sim_writing = 1;
+    }
+
+    for (i = 0; i < 2; i++)
+    {
+        if (g_sim->idlen[i] && g_sim_cmd == g_sim->idcmd[i])
+        {
+            g_sim_rd = g_sim->idval[i];
+            g_sim_rdn = g_sim->idlen[i];
+        }
+    }
+}
+
+/**
+ * @brief       дһ, ַǰ
+ * @param       color: ɫ
+ * @retval      
+ */
+static void sim_pixel(uint16_t color)
+{
+    uint32_t x, y, i;
+
+    x = (g_sim_madctl & 0x20) ? g_sim_page : g_sim_col;
+    y = (g_sim_madctl & 0x20) ? g_sim_col : g_sim_page;
+    x = (g_sim_madctl & 0x40) ? g_sim->w - 1 - x : x;
+    y = (g_sim_madctl & 0x80) ? g_sim->h - 1 - y : y;
+    g_sim_stats.pixels++;
+    g_sim_stats.wraps += g_sim_full;
+    g_sim_full = 0;
+
+    if (x < g_sim->w && y < g_sim->h)
+    {
+        i = y * g_sim->w + x;
+        g_sim_fb[i] = color;
+        g_sim_stats.overdraw += (g_sim_stamp[i] == g_sim_gen);
+        g_sim_stamp[i] = g_sim_gen;
+    }
+
+    if (g_sim_col++ >= g_sim_ca[1])
+    {
+        g_sim_col = g_sim_ca[0];
+
+        if (g_sim_page++ >= g_sim_pa[1])
+        {
+            g_sim_page = g_sim_pa[0];
+            g_sim_full = 1;
+        }
+    }
+}
+
+/**
+ * @brief       д: дGRAM״̬ǵ, ǵǰĲ
+ * @param       data: 
+ * @retval      
+ */
+void lcd_sim_wr_ram(uint16_t data)
+{
+    uint16_t cmd = g_sim_cmd;
+    uint8_t k = g_sim_argn++;
+
+    if (g_sim_writing)
+    {
+        sim_pixel(data);
+        return;
+    }
+
+    g_sim_stats.params++;
+
+    if (g_sim->wide)                    /* 5510: Ĵŵĵ2λֽ */
+    {
+        k = cmd & 3;
+        cmd &= ~3;
+
+        if (k > 0 && cmd != 0x2A00 && cmd != 0x2B00)
+        {
+            return;
+        }
+
+        cmd >>= 8;
+    }
+
+    if (cmd == 0x2A && k < 4)
+    {
+        sim_addr_byte(g_sim_ca, k, data);
+    }
+    else if (cmd == 0x2B && k < 4)
+    {
+        sim_addr_byte(g_sim_pa, k, data);
+    }
+    else if (cmd == 0x36 && k == 0)
+    {
+        g_sim_madctl = data & 0xFF;
+    }
+}
+
+/**
+ * @brief       : IDηӦ, Ϊ0
+ * @param       
+ * @retval      
+ */
+uint16_t lcd_sim_rd_ram(void)
+{
+    g_sim_stats.reads++;
+
+    if (g_sim_rdn == 0)
+    {
+        return 0;
+    }
+
+    g_sim_rdn--;
+    return *g_sim_rd++;
+}
+
+/**
+ * @brief       ʼͳһε: ͳ, ֮ظдͬһ overdraw
+ * @param       
+ * @retval      
+ */
+void lcd_sim_mark(void)
+{
+    memset(&g_sim_stats, 0, sizeof(g_sim_stats));
+    g_sim_gen++;
+}
+
+const lcd_sim_stats_t *lcd_sim_get_stats(void)
+{
+    return &g_sim_stats;
+}
+
+uint16_t lcd_sim_width(void)
+{
+    return g_sim->w;
+}
+
+uint16_t lcd_sim_height(void)
+{
+    return g_sim->h;
+}
+
+uint16_t lcd_sim_pixel(uint16_t x, uint16_t y)
+{
+    return (x < g_sim->w && y < g_sim->h) ? g_sim_fb[(uint32_t)y * g_sim->w + x] : 0;
+}
+
+/**
+ * @brief       GRAMFNV-1aɢ
+ * @param       
+ * @retval      ɢֵ
+ */
+uint32_t lcd_sim_hash(void)
+{
+    uint32_t h = 2166136261u;
+    uint32_t i, n = (uint32_t)g_sim->w * g_sim->h;
+
+    for (i = 0; i < n; i++)
+    {
+        h = (h ^ (g_sim_fb[i] & 0xFF)) * 16777619u;
+        h = (h ^ (g_sim_fb[i] >> 8)) * 16777619u;
+    }
+
+    return h;
+}
+
+/**
+ * @brief       RGB565 ת RGB888, дһ
+ * @param       y  : 
+ * @param       out: w*3 ֽ
+ * @retval      
+ */
+static void sim_row_rgb(uint16_t y, uint8_t *out)
+{
+    uint16_t x, c;
+
+    for (x = 0; x < g_sim->w; x++)
+    {
+        c = g_sim_fb[(uint32_t)y * g_sim->w + x];
+        *out++ = ((c >> 11) & 0x1F) * 255 / 31;
+        *out++ = ((c >> 5) & 0x3F) * 255 / 63;
+        *out++ = (c & 0x1F) * 255 / 31;
+    }
+}
+
+static uint32_t g_sim_crc_table[256];
+
+/**
+ * @brief       PNGCRC32
+ * @param       crc: ֵ(ȡ)
+ * @param       buf: 
+ * @param       len: 
+ * @retval      CRC
+ */
+static uint32_t sim_crc32(uint32_t crc, const uint8_t *buf, uint32_t len)
+{
+    uint32_t c, i, k;
+
+    if (g_sim_crc_table[1] == 0)
+    {
+        for (i = 0; i < 256; i++)
+        {
+            for (c = i, k = 0; k < 8; k++)
+            {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+
+            g_sim_crc_table[i] = c;
+        }
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        crc = g_sim_crc_table[(crc ^ buf[i]) & 0xFF] ^ (crc >> 8);
+    }
+
+    return crc;
+}
+
+static void sim_put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+/**
+ * @brief       дһPNG
+ * @param       f   : ļ
+ * @param       type: 
+ * @param       data: 
+ * @param       len : 
+ * @retval      
+ */
+static void sim_png_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len)
+{
+    uint8_t b[4];
+    uint32_t crc;
+
+    sim_put32(b, len);
+    fwrite(b, 1, 4, f);
+    fwrite(type, 1, 4, f);
+    fwrite(data, 1, len, f);
+    crc = sim_crc32(0xFFFFFFFFu, (const uint8_t *)type, 4);
+    crc = sim_crc32(crc, data, len) ^ 0xFFFFFFFFu;
+    sim_put32(b, crc);
+    fwrite(b, 1, 4, f);
+}
+
+/**
+ * @brief       PNG: 8λRGB, zlibѹ(stored), zlib
+ * @param       f: ļ
+ * @retval      
+ */
+static void sim_dump_png(FILE *f)
+{
+    static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    uint32_t row = g_sim->w * 3 + 1;                    /* ÿһ˲ֽ(0) */
+    uint32_t raw = row * g_sim->h;
+    uint32_t nblk = (raw + 65534) / 65535;
+    uint32_t len = 2 + raw + nblk * 5 + 4;
+    uint8_t *z = malloc(len);
+    uint8_t *line = malloc(row);
+    uint8_t *p = z;
+    uint32_t a = 1, b = 0, left = raw, pos = 0, n, i;
+    uint8_t ihdr[13];
+    uint16_t y = 0;
+
+    sim_put32(ihdr, g_sim->w);
+    sim_put32(ihdr + 4, g_sim->h);
+    ihdr[8] = 8;                        /* λ */
+    ihdr[9] = 2;                        /* RGB */
+    ihdr[10] = ihdr[11] = ihdr[12] = 0;
+
+    *p++ = 0x78;
+    *p++ = 0x01;
+
+    while (left)
+    {
+        n = (left > 65535) ? 65535 : left;
+        left -= n;
+        *p++ = (left == 0);             /* BFINAL, BTYPE=00 */
+        *p++ = n & 0xFF;
+        *p++ = n >> 8;
+        *p++ = ~n & 0xFF;
+        *p++ = (~n >> 8) & 0xFF;
+
+        for (i = 0; i < n; i++, pos++)
+        {
+            if (pos % row == 0)
+            {
+                line[0] = 0;
+                sim_row_rgb(y++, line + 1);
+            }
+
+            *p = line[pos % row];
+            a = (a + *p) % 65521;
+            b = (b + a) % 65521;
+            p++;
+        }
+    }
+
+    sim_put32(p, (b << 16) | a);
+
+    fwrite(sig, 1, 8, f);
+    sim_png_chunk(f, "IHDR", ihdr, 13);
+    sim_png_chunk(f, "IDAT", z, len);
+    sim_png_chunk(f, "IEND", NULL, 0);
+    free(line);
+    free(z);
+}
+
+/**
+ * @brief       ͼƬ, չѡPNGPPM(P6)
+ * @param       path: ļ
+ * @retval      0, ɹ; 1, ʧ;
+ */
+uint8_t lcd_sim_dump(const char *path)
+{
+    const char *ext = strrchr(path, '.');
+    uint8_t *line;
+    FILE *f;
+    uint16_t y;
+
+    f = fopen(path, "wb");
+
+    if (f == NULL)
+    {
+        return 1;
+    }
+
+    if (ext && strcmp(ext, ".png") == 0)
+    {
+        sim_dump_png(f);
+    }
+    else
+    {
+        line = malloc(g_sim->w * 3);
+        fprintf(f, "P6\n%u %u\n255\n", g_sim->w, g_sim->h);
+
+        for (y = 0; y < g_sim->h; y++)
+        {
+            sim_row_rgb(y, line);
+            fwrite(line, 1, g_sim->w * 3, f);
+        }
+
+        free(line);
+    }
+
+    return fclose(f) != 0;
+}
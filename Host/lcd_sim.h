@@ -0,0 +1,48 @@
+/**
+ ****************************************************************************************************
+ * @file        lcd_sim.h
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       (Linux)ϵLCDģ: FSMCϵ, άGRAM, ͳ߿
+ ****************************************************************************************************
+ * @attention
+ *
+ *  HOST_SIM ʱ lcd.h  LCD_WR_REG/LCD_WR_RAM/LCD_RD_RAM , lcd.c/lcd_ex.c ø.
+ * ģ lcd_init ʶļֿ: IDӦ, /ҳַ(ʹ), дGRAM, ɨ跽(0x36).
+ * GRAM򱣴, PNG/PPM. GRAM(lcd_read_point)ģ, 0.
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __LCD_SIM_H
+#define __LCD_SIM_H
+
+#include <stdint.h>
+
+
+/* ͳ, lcd_sim_mark()  */
+typedef struct
+{
+    uint32_t regs;                      /* дĴ */
+    uint32_t params;                    /* д(GRAM) */
+    uint32_t pixels;                    /* дGRAMĵ */
+    uint32_t setups;                    /* ʼдGRAM, ù/ںʼдĴ */
+    uint32_t overdraw;                  /* ͬһεﱻظдĵ */
+    uint32_t wraps;                     /* дںֽдĴ(д˵) */
+    uint32_t reads;                     /*  */
+} lcd_sim_stats_t;
+
+uint8_t lcd_sim_init(uint16_t id);                                      /* ѡģĿ, GRAM */
+void lcd_sim_wr_reg(uint16_t regno);                                    /* LCD->LCD_REG = regno */
+void lcd_sim_wr_ram(uint16_t data);                                     /* LCD->LCD_RAM = data */
+uint16_t lcd_sim_rd_ram(void);                                          /*  LCD->LCD_RAM */
+
+void lcd_sim_mark(void);                                                /* ʼͳһε */
+const lcd_sim_stats_t *lcd_sim_get_stats(void);                         /* ȡͳ */
+uint16_t lcd_sim_width(void);                                           /* GRAM() */
+uint16_t lcd_sim_height(void);                                          /* GRAM߶ */
+uint16_t lcd_sim_pixel(uint16_t x, uint16_t y);                         /* GRAMһ */
+uint32_t lcd_sim_hash(void);                                            /* GRAMFNV-1aɢ, ڻعȽ */
+uint8_t lcd_sim_dump(const char *path);                                 /* ͼƬ, չ .png/.ppm */
+
+#endif
@@ -0,0 +1,353 @@
+/**
+ ****************************************************************************************************
+ * @file        online_host.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʶ: CNN(prep + nn_ref)Ƚϱдϵʶʺ̧ʺӳ
+ ****************************************************************************************************
+ * @attention
+ *
+ * (ڲֿĿ¼):
+ *   gcc -O2 -DHOST_SIM -ICore/Inc -IHost -IMiddlewares/ST/AI/Inc -IX-CUBE-AI/App Host/online_host.c
+ *       Host/digit_sim.c Host/host_sim.c Core/Src/stroke.c Core/Src/prep.c Core/Src/seg.c Core/Src/online.c
+ *       Core/Src/online_data.c Core/Src/nn_ref.c X-CUBE-AI/App/network_data_params.c -lm -o online_host
+ * :
+ *   ./online_host [ÿֵ, Ĭ200] [¼Ƶıʼ...]
+ *
+ * ¼Ƶıʼ: ÿ " x y"( stroke_host һ), һ "up" ʾ̧, һ "digit d" ʼ
+ * һ(d д). ͻһʱ stroke.c.
+ * ϳɵ(digit_sim.h, ÿ HOST_PERIOD_US):
+ *   normal  : ģı˳
+ *   reversed: ÿһʶд(ѵʱֻ 20% ıʻǷ), Ա˳; CNN ֻͼ, Ӱ
+ * ͬһ鶨߶ηֱ prep_add(̧ʺ prep_segment + prep_run + nn_ref_run, ȡһ)
+ *  online_add(ʱ online_result), ͳֻдǰ 50%/75%/100% ߶ʱʶ,
+ * Լʶдٷ֮һֱǶԵ(settle, ûԵĲ).
+ * : ÿ߶ prep_add  online_add ʱ, ̧ʺʱ.
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdlib.h>
+#include "prep.h"
+#include "online.h"
+#include "digit_sim.h"
+
+
+#define HOST_LINE_MAX       4096        /* һ߶ */
+#define HOST_FRAC_NUM       3           /* ͳƵдı */
+
+static const uint8_t g_host_frac[HOST_FRAC_NUM] = {50, 75, 100};
+
+/* һͳ */
+typedef struct
+{
+    uint32_t num;
+    uint32_t ok_cnn[HOST_FRAC_NUM];
+    uint32_t ok_gru[HOST_FRAC_NUM];
+    double settle;                      /* һֱı֮ */
+    uint32_t settle_num;
+} host_stat_t;
+
+static uint16_t g_line[HOST_LINE_MAX][4];
+static uint32_t g_line_num;
+static uint32_t g_dt[HOST_PT_MAX];
+static float g_host_in[NN_IN_H * NN_IN_W];
+static float g_host_scratch[NN_REF_SCRATCH / sizeof(float)];
+
+/* (֮) */
+static double g_c_prep, g_c_gru, g_c_cnn, g_c_res, g_c_steps;
+static uint32_t g_c_lines, g_c_gru_max, g_c_num;
+
+/**
+ * @brief       ߻ص: ¶߶
+ * @param       x1,y1,x2,y2: ߶
+ * @retval      
+ */
+static void host_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    if (g_line_num < HOST_LINE_MAX)
+    {
+        g_line[g_line_num][0] = x1;
+        g_line[g_line_num][1] = y1;
+        g_line[g_line_num][2] = x2;
+        g_line[g_line_num][3] = y2;
+        g_line_num++;
+    }
+}
+
+/**
+ * @brief       һ
+ * @param       prob: 
+ * @retval      
+ */
+static uint8_t host_argmax(const float *prob)
+{
+    uint8_t i, m = 0;
+
+    for (i = 1; i < NN_OUT_NUM; i++)
+    {
+        m = (prob[i] > prob[m]) ? i : m;
+    }
+
+    return m;
+}
+
+/**
+ * @brief       CNN ʶǰ n ߶дɵ
+ * @param       n   : ߶
+ * @param       time: 1, 뿪
+ * @retval      , ǿյʱΪ 0xFF
+ */
+static uint8_t host_cnn(uint32_t n, uint8_t time)
+{
+    float out[NN_OUT_NUM];
+    uint32_t i, t;
+
+    prep_clear();
+
+    for (i = 0; i < n; i++)
+    {
+        t = host_cycles();
+        prep_add(g_line[i][0], g_line[i][1], g_line[i][2], g_line[i][3]);
+        g_c_prep += time ? host_cycles() - t : 0;
+    }
+
+    t = host_cycles();
+
+    if (prep_segment() == 0)
+    {
+        return 0xFF;
+    }
+
+    prep_run(0, g_host_in);
+    nn_ref_run(g_host_in, out, g_host_scratch);
+    g_c_cnn += time ? host_cycles() - t : 0;
+    return host_argmax(out);
+}
+
+/**
+ * @brief       õǰ(g_pt)һ
+ * @param       st   : ͳ
+ * @param       label: д
+ * @param       dt   : ʱ(us), NULL ʾ HOST_PERIOD_US
+ * @retval      
+ */
+static void host_eval(host_stat_t *st, uint8_t label, const uint32_t *dt)
+{
+    float prob[NN_OUT_NUM];
+    uint32_t i, k, t, settle = 0;
+    uint16_t steps = 0;
+    uint8_t m = 0xFF;
+
+    g_line_num = 0;
+    host_feed_stroke(host_line, dt);
+
+    if (g_line_num == 0)
+    {
+        return;
+    }
+
+    st->num++;
+    online_clear();
+
+    for (i = 0, k = 0; i < g_line_num; i++)
+    {
+        t = host_cycles();
+        online_add(g_line[i][0], g_line[i][1], g_line[i][2], g_line[i][3]);
+        t = host_cycles() - t;
+        g_c_gru += t;
+        g_c_gru_max = (t > g_c_gru_max) ? t : g_c_gru_max;
+
+        t = host_cycles();
+        steps = online_result(prob);
+        g_c_res += host_cycles() - t;
+        m = steps ? host_argmax(prob) : 0xFF;
+        settle = (m == label) ? settle : i + 1;     /* һβ֮ */
+
+        for (; k < HOST_FRAC_NUM && (i + 1) * 100 >= g_host_frac[k] * g_line_num; k++)
+        {
+            st->ok_gru[k] += (m == label);
+            st->ok_cnn[k] += (host_cnn(i + 1, g_host_frac[k] == 100) == label);
+        }
+    }
+
+    g_c_lines += g_line_num;
+    g_c_steps += steps;
+    g_c_num++;
+
+    if (m == label)
+    {
+        st->settle += (double)settle / g_line_num;
+        st->settle_num++;
+    }
+}
+
+/**
+ * @brief        g_pt ÿһʶ
+ * @param       
+ * @retval      
+ */
+static void host_reverse_all(void)
+{
+    uint32_t i, a, b, e;
+    uint16_t t[2];
+
+    for (i = 0; i < g_pt_num; i = b + 1)
+    {
+        for (b = i; b < g_pt_num && g_pt[b][0] != 0xFFFF; b++);
+
+        for (a = i, e = b; a + 1 < e; a++, e--)
+        {
+            memcpy(t, g_pt[a], sizeof(t));
+            memcpy(g_pt[a], g_pt[e - 1], sizeof(t));
+            memcpy(g_pt[e - 1], t, sizeof(t));
+        }
+    }
+}
+
+/**
+ * @brief       ¼Ƶıʼ, ÿһ
+ * @param       st  : ͳ
+ * @param       name: ļ
+ * @retval      0, ɹ; 1, 򲻿
+ */
+static uint8_t host_trace(host_stat_t *st, const char *name)
+{
+    FILE *f = fopen(name, "r");
+    char line[64];
+    double ms, last = 0;
+    unsigned x, y, d;
+    int label = -1;
+
+    if (f == NULL)
+    {
+        return 1;
+    }
+
+    g_pt_num = 0;
+
+    while (1)
+    {
+        char *s = fgets(line, sizeof(line), f);
+
+        if (s == NULL || sscanf(line, "digit %u", &d) == 1)
+        {
+            if (label >= 0 && g_pt_num)
+            {
+                if (g_pt[g_pt_num - 1][0] != 0xFFFF)    /* û̧ */
+                {
+                    g_pt[g_pt_num++][0] = 0xFFFF;
+                }
+
+                host_eval(st, label, g_dt);
+            }
+
+            if (s == NULL)
+            {
+                break;
+            }
+
+            label = d % 10;
+            g_pt_num = 0;
+        }
+        else if (strncmp(line, "up", 2) == 0 && g_pt_num < HOST_PT_MAX)
+        {
+            g_pt[g_pt_num++][0] = 0xFFFF;
+        }
+        else if (sscanf(line, "%lf %u %u", &ms, &x, &y) == 3 && g_pt_num < HOST_PT_MAX - 1)
+        {
+            g_pt[g_pt_num][0] = x;
+            g_pt[g_pt_num][1] = y;
+            g_dt[g_pt_num] = (ms > last) ? (uint32_t)((ms - last) * 1000) : HOST_PERIOD_US;
+            g_pt_num++;
+            last = ms;
+        }
+    }
+
+    fclose(f);
+    return 0;
+}
+
+/**
+ * @brief       һͳ
+ * @param       name: 
+ * @param       st  : ͳ
+ * @retval      
+ */
+static void host_print(const char *name, const host_stat_t *st)
+{
+    uint8_t k;
+
+    printf("%-9s %5u ", name, st->num);
+
+    for (k = 0; k < HOST_FRAC_NUM; k++)
+    {
+        printf(" %5.1f%%", 100.0 * st->ok_cnn[k] / st->num);
+    }
+
+    printf("  ");
+
+    for (k = 0; k < HOST_FRAC_NUM; k++)
+    {
+        printf(" %5.1f%%", 100.0 * st->ok_gru[k] / st->num);
+    }
+
+    printf("   %5.1f%%\n", st->settle_num ? 100.0 * st->settle / st->settle_num : 0.0);
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t num = (argc > 1) ? (uint32_t)atoi(argv[1]) : 200;
+    host_stat_t st[3];
+    uint32_t i;
+    uint8_t d, set;
+    int a;
+
+    memset(st, 0, sizeof(st));
+    srand(7);                           /* ѵ(online_train.c)õͬ */
+
+    for (set = 0; set < 2; set++)
+    {
+        for (d = 0; d < 10; d++)
+        {
+            for (i = 0; i < num; i++)
+            {
+                g_pt_num = 0;
+                host_digit(d, host_rand(0.3, 0.9) * PREP_H, PREP_X0 + 1, PREP_X0 + PREP_W - 2, HOST_YLO, HOST_YHI);
+
+                if (set)
+                {
+                    host_reverse_all();
+                }
+
+                host_eval(&st[set], d, NULL);
+            }
+        }
+    }
+
+    for (a = 2; a < argc; a++)
+    {
+        if (host_trace(&st[2], argv[a]))
+        {
+            fprintf(stderr, "cannot read %s\n", argv[a]);
+        }
+    }
+
+    printf("                   CNN (prep + nn_ref)      GRU (online)\n");
+    printf("set        num    50%%    75%%   100%%     50%%    75%%   100%%   settle\n");
+    host_print("normal", &st[0]);
+    host_print("reversed", &st[1]);
+
+    if (st[2].num)
+    {
+        host_print("trace", &st[2]);
+    }
+
+    printf("\ncost (host, %u MHz cycles):\n", HOST_CLOCK / 1000000);
+    printf("  per ink line  prep_add %6.0f   online_add %6.0f (max %u, %.2f GRU steps per line)\n",
+           g_c_prep / g_c_lines, g_c_gru / g_c_lines, g_c_gru_max, g_c_steps / g_c_lines);
+    printf("  per GRU step  %6.0f\n", g_c_gru / g_c_steps);
+    printf("  pen up -> result  CNN %8.0f (prep_segment + prep_run + nn_ref_run)   GRU %6.0f (online_result)\n",
+           g_c_cnn / g_c_num, g_c_res / g_c_lines);
+    return 0;
+}
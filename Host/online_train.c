@@ -0,0 +1,526 @@
+/**
+ ****************************************************************************************************
+ * @file        online_train.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʶѵ: ѵ online.h  GRU,  Core/Src/online_data.c
+ ****************************************************************************************************
+ * @attention
+ *
+ * (ڲֿĿ¼):
+ *   gcc -O3 -DHOST_SIM -ICore/Inc -IHost -IMiddlewares/ST/AI/Inc -IX-CUBE-AI/App Host/online_train.c
+ *       Host/digit_sim.c Core/Src/stroke.c Core/Src/online.c Core/Src/online_data.c Core/Src/nn_ref.c
+ *       X-CUBE-AI/App/network_data_params.c -lm -o online_train
+ * :
+ *   ./online_train [, Ĭ HOST_BATCHES] > Core/Src/online_data.c
+ *
+ * : digit_sim.h (С HOST_SIZE_MIN~HOST_SIZE_MAXλáб, ɨ
+ * ), ÿһ HOST_REVERSE ĸʷд(ģı˳ǹ̶), ÿ, ظ.
+ * ͰһȾ stroke.c(host_feed_stroke),  online.c  online_feat (ͬһݴ).
+ * ģ: online.h  GRU, һ״̬ȫ + softmax, ; ʱ䷴򴫲(BPTT),
+ * Adam, ѧϰ½, ݶȰü. ̶, ͬĲÿͬȨ.
+ * ѵڹ̶ HOST_VALID Ͽʶ(stderr), Ҳ online_step ѵǰ
+ * online_data.c һԱ. ɵCļ stdout.
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "online.h"
+#include "digit_sim.h"
+
+
+#define HOST_BATCHES        3000        /* Ĭ */
+#define HOST_BATCH          32          /* ÿ */
+#define HOST_VALID          2000        /* ֤ */
+#define HOST_T_MAX          512         /* һĲ */
+#define HOST_SIZE_MIN       0.3         /* ָ߶/߶ */
+#define HOST_SIZE_MAX       0.9
+#define HOST_LR             0.004       /* Adam ʼѧϰ */
+#define HOST_LR_MIN         0.0002      /* ½յ */
+#define HOST_CLIP           5.0         /* ݶȷ */
+#define HOST_REVERSE        0.2         /* ÿһʷдĸ(˴һͷ) */
+
+#define U                   ONLINE_UNITS
+#define G                   ONLINE_GATES
+
+/* ( online_data.c Ųͬ), ѵʱһ,  Adam ͳһ */
+typedef struct
+{
+    float k[ONLINE_IN * G];
+    float r[U * G];
+    float b[2 * G];
+    float d[NN_OUT_NUM * U];
+    float db[NN_OUT_NUM];
+} host_param_t;
+
+#define HOST_PARAM_NUM      (sizeof(host_param_t) / sizeof(float))
+
+/* һ */
+typedef struct
+{
+    uint16_t t;                         /*  */
+    uint8_t label;
+    float f[HOST_T_MAX][ONLINE_IN];
+} host_seq_t;
+
+static host_param_t g_p, g_grad, g_m, g_v;
+static host_seq_t g_seq;
+static host_seq_t *g_valid;
+static uint16_t g_seq_full;             /* online_feat ص:  */
+
+/* ǰм(򴫲) */
+static float g_h[HOST_T_MAX + 1][U];    /* g_h[t] ǵt֮ǰ״̬ */
+static float g_z[HOST_T_MAX][U], g_r[HOST_T_MAX][U], g_n[HOST_T_MAX][U], g_un[HOST_T_MAX][U];
+
+/**
+ * @brief       host_feed Ļص: ߶εӵ g_seq 
+ * @param       x1,y1,x2,y2: ߶
+ * @retval      
+ */
+static void host_feat(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    float f[ONLINE_FEAT_MAX][ONLINE_IN];
+    uint16_t i, n = online_feat(x1, y1, x2, y2, f);
+
+    for (i = 0; i < n; i++)
+    {
+        if (g_seq.t >= HOST_T_MAX)
+        {
+            g_seq_full = 1;
+            return;
+        }
+
+        memcpy(g_seq.f[g_seq.t++], f[i], sizeof(f[i]));
+    }
+}
+
+/**
+ * @brief        g_pt ÿһʰ rev ĸʵ(յʵ)
+ * @param       rev: 
+ * @retval      
+ */
+static void host_reverse(double rev)
+{
+    uint32_t i, a, b, e;
+    uint16_t t[2];
+
+    for (i = 0; i < g_pt_num; i = b + 1)
+    {
+        for (b = i; b < g_pt_num && g_pt[b][0] != 0xFFFF; b++);
+
+        if (host_rand(0, 1) >= rev)
+        {
+            continue;
+        }
+
+        for (a = i, e = b; a + 1 < e; a++, e--)
+        {
+            memcpy(t, g_pt[a], sizeof(t));
+            memcpy(g_pt[a], g_pt[e - 1], sizeof(t));
+            memcpy(g_pt[e - 1], t, sizeof(t));
+        }
+    }
+}
+
+/**
+ * @brief       һ g_seq
+ * @param       
+ * @retval      
+ */
+static void host_sample_digit(void)
+{
+    g_seq.label = rand() % 10;
+    g_seq.t = 0;
+    g_seq_full = 0;
+    g_pt_num = 0;
+    host_digit(g_seq.label, host_rand(HOST_SIZE_MIN, HOST_SIZE_MAX) * PREP_H, PREP_X0 + 1, PREP_X0 + PREP_W - 2,
+               HOST_YLO, HOST_YHI);
+    host_reverse(HOST_REVERSE);
+    online_clear();
+    host_feed_stroke(host_feat, NULL);
+}
+
+/**
+ * @brief       ǰ: , 10
+ * @param       s   : 
+ * @param       prob: 
+ * @retval      
+ */
+static void host_forward(const host_seq_t *s, float *prob)
+{
+    float g[G], u[G], v, m, sum;
+    uint16_t t, i, j;
+
+    memset(g_h[0], 0, sizeof(g_h[0]));
+
+    for (t = 0; t < s->t; t++)
+    {
+        memcpy(g, g_p.b, sizeof(g));
+        memcpy(u, g_p.b + G, sizeof(u));
+
+        for (i = 0; i < ONLINE_IN; i++)
+        {
+            v = s->f[t][i];
+
+            for (j = 0; j < G; j++)
+            {
+                g[j] += v * g_p.k[i * G + j];
+            }
+        }
+
+        for (i = 0; i < U; i++)
+        {
+            v = g_h[t][i];
+
+            for (j = 0; j < G; j++)
+            {
+                u[j] += v * g_p.r[i * G + j];
+            }
+        }
+
+        for (j = 0; j < U; j++)
+        {
+            g_z[t][j] = 1.0f / (1.0f + expf(-(g[j] + u[j])));
+            g_r[t][j] = 1.0f / (1.0f + expf(-(g[U + j] + u[U + j])));
+            g_un[t][j] = u[2 * U + j];
+            g_n[t][j] = tanhf(g[2 * U + j] + g_r[t][j] * u[2 * U + j]);
+            g_h[t + 1][j] = g_z[t][j] * g_h[t][j] + (1.0f - g_z[t][j]) * g_n[t][j];
+        }
+    }
+
+    for (i = 0, m = -1e30f; i < NN_OUT_NUM; i++)
+    {
+        for (j = 0, v = g_p.db[i]; j < U; j++)
+        {
+            v += g_p.d[i * U + j] * g_h[s->t][j];
+        }
+
+        prob[i] = v;
+        m = (v > m) ? v : m;
+    }
+
+    for (i = 0, sum = 0; i < NN_OUT_NUM; i++)
+    {
+        prob[i] = expf(prob[i] - m);
+        sum += prob[i];
+    }
+
+    for (i = 0; i < NN_OUT_NUM; i++)
+    {
+        prob[i] /= sum;
+    }
+}
+
+/**
+ * @brief       : ضԲݶȼӵ g_grad( host_forward)
+ * @param       s   : 
+ * @param       prob: host_forward ĸ
+ * @retval      
+ */
+static double host_backward(const host_seq_t *s, const float *prob)
+{
+    float dh[U], dhp[U], dg[G], v, dl;
+    uint16_t t, i, j;
+
+    memset(dh, 0, sizeof(dh));
+
+    for (i = 0; i < NN_OUT_NUM; i++)
+    {
+        dl = prob[i] - (i == s->label);
+        g_grad.db[i] += dl;
+
+        for (j = 0; j < U; j++)
+        {
+            g_grad.d[i * U + j] += dl * g_h[s->t][j];
+            dh[j] += dl * g_p.d[i * U + j];
+        }
+    }
+
+    for (t = s->t; t-- > 0;)
+    {
+        /* dg: żǰ( + ѭ)ݶ; n ŵѭ r */
+        for (j = 0; j < U; j++)
+        {
+            float z = g_z[t][j], r = g_r[t][j], n = g_n[t][j];
+            float dn = dh[j] * (1.0f - z) * (1.0f - n * n);
+
+            dg[j] = dh[j] * (g_h[t][j] - n) * z * (1.0f - z);
+            dg[U + j] = dn * g_un[t][j] * r * (1.0f - r);
+            dg[2 * U + j] = dn;
+            dhp[j] = dh[j] * z;
+        }
+
+        for (j = 0; j < G; j++)                         /*  */
+        {
+            g_grad.b[j] += dg[j];
+        }
+
+        for (i = 0; i < ONLINE_IN; i++)
+        {
+            v = s->f[t][i];
+
+            for (j = 0; j < G; j++)
+            {
+                g_grad.k[i * G + j] += v * dg[j];
+            }
+        }
+
+        for (j = 0; j < U; j++)                         /* ѭ: n ų r */
+        {
+            dg[2 * U + j] *= g_r[t][j];
+        }
+
+        for (j = 0; j < G; j++)
+        {
+            g_grad.b[G + j] += dg[j];
+        }
+
+        for (i = 0; i < U; i++)
+        {
+            const float *w = g_p.r + i * G;
+            float *gw = g_grad.r + i * G;
+            float acc = 0;
+
+            v = g_h[t][i];
+
+            for (j = 0; j < G; j++)
+            {
+                gw[j] += v * dg[j];
+                acc += w[j] * dg[j];
+            }
+
+            dhp[i] += acc;
+        }
+
+        memcpy(dh, dhp, sizeof(dh));
+    }
+
+    return -log(prob[s->label] + 1e-12);
+}
+
+/**
+ * @brief       ֤ϵʶ
+ * @param       
+ * @retval      ȷı
+ */
+static double host_valid(void)
+{
+    float prob[NN_OUT_NUM];
+    uint32_t i, ok = 0;
+    uint8_t k, m;
+
+    for (i = 0; i < HOST_VALID; i++)
+    {
+        host_forward(&g_valid[i], prob);
+
+        for (k = 1, m = 0; k < NN_OUT_NUM; k++)
+        {
+            m = (prob[k] > prob[m]) ? k : m;
+        }
+
+        ok += (m == g_valid[i].label);
+    }
+
+    return (double)ok / HOST_VALID;
+}
+
+/**
+ * @brief        online_step(ǰ online_data.c)֤
+ * @param       
+ * @retval      ȷı
+ */
+static double host_valid_data(void)
+{
+    float prob[NN_OUT_NUM];
+    uint32_t i, ok = 0;
+    uint16_t t;
+    uint8_t k, m;
+
+    for (i = 0; i < HOST_VALID; i++)
+    {
+        online_clear();
+
+        for (t = 0; t < g_valid[i].t; t++)
+        {
+            online_step(g_valid[i].f[t]);
+        }
+
+        online_result(prob);
+
+        for (k = 1, m = 0; k < NN_OUT_NUM; k++)
+        {
+            m = (prob[k] > prob[m]) ? k : m;
+        }
+
+        ok += (m == g_valid[i].label);
+    }
+
+    return (double)ok / HOST_VALID;
+}
+
+/**
+ * @brief       ʼ: ȷֲ(Glorot), ƫΪ1(ʼʱסǰ״̬)
+ * @param       
+ * @retval      
+ */
+static void host_init(void)
+{
+    float a;
+    uint32_t i;
+
+    a = sqrtf(6.0f / (ONLINE_IN + G));
+
+    for (i = 0; i < ONLINE_IN * G; i++)
+    {
+        g_p.k[i] = host_rand(-a, a);
+    }
+
+    a = sqrtf(6.0f / (U + G));
+
+    for (i = 0; i < U * G; i++)
+    {
+        g_p.r[i] = host_rand(-a, a);
+    }
+
+    for (i = 0; i < U; i++)
+    {
+        g_p.b[i] = 1.0f;
+    }
+
+    a = sqrtf(6.0f / (U + NN_OUT_NUM));
+
+    for (i = 0; i < NN_OUT_NUM * U; i++)
+    {
+        g_p.d[i] = host_rand(-a, a);
+    }
+}
+
+/**
+ * @brief       Adam һ(ݶȰü)
+ * @param       lr  : ѧϰ
+ * @param       step: ڼ(1ʼ)
+ * @retval      
+ */
+static void host_adam(double lr, uint32_t step)
+{
+    float *p = (float *)&g_p, *gr = (float *)&g_grad, *m = (float *)&g_m, *v = (float *)&g_v;
+    double norm = 0, c1 = 1 - pow(0.9, step), c2 = 1 - pow(0.999, step), scale;
+    uint32_t i;
+
+    for (i = 0; i < HOST_PARAM_NUM; i++)
+    {
+        gr[i] /= HOST_BATCH;
+        norm += (double)gr[i] * gr[i];
+    }
+
+    norm = sqrt(norm);
+    scale = (norm > HOST_CLIP) ? HOST_CLIP / norm : 1.0;
+
+    for (i = 0; i < HOST_PARAM_NUM; i++)
+    {
+        float g = gr[i] * scale;
+
+        m[i] = 0.9f * m[i] + 0.1f * g;
+        v[i] = 0.999f * v[i] + 0.001f * g * g;
+        p[i] -= lr * (m[i] / c1) / (sqrt(v[i] / c2) + 1e-8);
+    }
+
+    memset(&g_grad, 0, sizeof(g_grad));
+}
+
+/**
+ * @brief       C
+ * @param       name: 
+ * @param       size: С()
+ * @param       w   : 
+ * @param       n   : 
+ * @retval      
+ */
+static void host_print(const char *name, const char *size, const float *w, uint32_t n)
+{
+    uint32_t i;
+
+    printf("\nconst float %s[%s] =\n{", name, size);
+
+    for (i = 0; i < n; i++)
+    {
+        printf("%s%.9g,", (i % 8) ? " " : "\n    ", w[i]);
+    }
+
+    printf("\n};\n");
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t batches = (argc > 1) ? (uint32_t)atoi(argv[1]) : HOST_BATCHES;
+    float prob[NN_OUT_NUM];
+    double loss = 0, lr, old, acc;
+    uint32_t i, b, steps = 0, full = 0;
+
+    srand(12345);                       /* ֤ */
+    g_valid = malloc(HOST_VALID * sizeof(host_seq_t));
+
+    for (i = 0; i < HOST_VALID; i++)
+    {
+        host_sample_digit();
+        full += g_seq_full;
+        steps += g_seq.t;
+        g_valid[i] = g_seq;
+    }
+
+    fprintf(stderr, "valid: %u samples, %.1f steps each, %u truncated\n", HOST_VALID, (double)steps / HOST_VALID, full);
+    old = host_valid_data();
+
+    srand(1);
+    host_init();
+
+    for (b = 1; b <= batches; b++)
+    {
+        lr = HOST_LR_MIN + 0.5 * (HOST_LR - HOST_LR_MIN) * (1 + cos(3.14159265358979 * (b - 1) / batches));
+
+        for (i = 0; i < HOST_BATCH; i++)
+        {
+            host_sample_digit();
+            host_forward(&g_seq, prob);
+            loss += host_backward(&g_seq, prob);
+        }
+
+        host_adam(lr, b);
+
+        if (b % 500 == 0 || b == batches)
+        {
+            fprintf(stderr, "batch %5u  lr %.5f  loss %.4f  valid %.2f%%\n", b, lr, loss / (500.0 * HOST_BATCH),
+                    100 * host_valid());
+            loss = 0;
+        }
+    }
+
+    acc = host_valid();
+    fprintf(stderr, "valid: old online_data.c %.2f%%, new %.2f%%\n", 100 * old, 100 * acc);
+
+    printf("/**\n");
+    printf(" ****************************************************************************************************\n");
+    printf(" * @file        online_data.c\n");
+    printf(" * @version     V1.0\n");
+    printf(" * @date        2026-10-18\n");
+    printf(" * @brief       ʶ GRU Ȩ(Host/online_train.c , Ҫָ)\n");
+    printf(" ****************************************************************************************************\n");
+    printf(" * @attention\n");
+    printf(" *\n");
+    printf(" * %u Ԫ, %u  x %u , ֤(%u )ʶ %.2f%%.\n", U, batches, HOST_BATCH, HOST_VALID, 100 * acc);
+    printf(" *\n");
+    printf(" ****************************************************************************************************\n");
+    printf(" */\n\n");
+    printf("#include \"online.h\"\n\n\n");
+    printf("typedef char online_data_check[(ONLINE_UNITS == %u && ONLINE_IN == %u) ? 1 : -1];   /*  online.h һ */\n",
+           U, ONLINE_IN);
+    host_print("g_online_kernel", "ONLINE_IN * ONLINE_GATES", g_p.k, ONLINE_IN * G);
+    host_print("g_online_recurrent", "ONLINE_UNITS * ONLINE_GATES", g_p.r, U * G);
+    host_print("g_online_bias", "2 * ONLINE_GATES", g_p.b, 2 * G);
+    host_print("g_online_dense", "NN_OUT_NUM * ONLINE_UNITS", g_p.d, NN_OUT_NUM * U);
+    host_print("g_online_dense_bias", "NN_OUT_NUM", g_p.db, NN_OUT_NUM);
+    free(g_valid);
+    return 0;
+}
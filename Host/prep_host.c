@@ -0,0 +1,273 @@
+/**
+ ****************************************************************************************************
+ * @file        prep_host.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       Ԥ: Ƚԭ /12 ӳ prep.c ʶʺͿ
+ ****************************************************************************************************
+ * @attention
+ *
+ * (ڲֿĿ¼):
+ *   gcc -O2 -DHOST_SIM -ICore/Inc -IHost -IMiddlewares/ST/AI/Inc -IX-CUBE-AI/App Host/prep_host.c
+ *       Host/digit_sim.c Host/host_sim.c Core/Src/stroke.c Core/Src/prep.c Core/Src/seg.c Core/Src/nn_ref.c
+ *       X-CUBE-AI/App/network_data_params.c -lm -o prep_host
+ * :
+ *   ./prep_host [ÿֵ, Ĭ200]
+ *
+ * : 0~9 ģ(λ), С(߳ HOST_SIZE_MIN~HOST_SIZE_MAX)߱ȡ
+ * бλ,  8~20 һ²(ɨļ). ͬһ߶ηֱ͸
+ *   old : ԭ main.c  process_data,  /12 ֱӳ䵽 28x28, ĸд 1
+ *         (, ԭ 336x336 )
+ *   prep: prep_add / prep_segment / prep_run
+ *  nn_ref_run(Ͱϵһ)ʶ.
+ * λ: 2~4λ, ѻȷֳɼ, ÿλԼǸڷ(λ֮ 2*HOST_GAP),
+ * ͳƷֳλȷıֶʱÿλʶ.
+ * : prep_add(ÿ)prep_segmentprep_run  conv0 һʱ().
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "prep.h"
+#include "nn_ref.h"
+#include "digit_sim.h"
+
+
+#define HOST_SIZE_MIN       0.3         /* ָ߶/߳ */
+#define HOST_SIZE_MAX       0.9
+#define HOST_REPEAT         200         /* ʱظ */
+#define HOST_GAP            16          /* λÿĿ(, ʻ) */
+
+static float g_old[NN_IN_H * NN_IN_W];
+static float g_new[NN_IN_H * NN_IN_W];
+static float g_host_scratch[NN_REF_SCRATCH / sizeof(float)];
+static float g_conv_out[NN_IN_H * NN_IN_W * 16];
+
+/**
+ * @brief       ԭĹդ(main.c  process_data, ȥ)
+ * @param       x1,y1,x2,y2: ߶
+ * @retval      
+ */
+static void host_old_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    uint16_t t;
+    int xerr = 0, yerr = 0, delta_x, delta_y, distance;
+    int incx, incy, row, col;
+    delta_x = x2 - x1;
+    delta_y = y2 - y1;
+    row = x1;
+    col = y1;
+    incx = (delta_x > 0) ? 1 : (delta_x == 0) ? 0 : -1;
+    incy = (delta_y > 0) ? 1 : (delta_y == 0) ? 0 : -1;
+    delta_x = abs(delta_x);
+    delta_y = abs(delta_y);
+    distance = (delta_x > delta_y) ? delta_x : delta_y;
+
+    for (t = 0; t <= distance + 1; t++)
+    {
+        g_old[((col - 72) / 12) * 28 + (row - 72) / 12] = 1;
+        xerr += delta_x;
+        yerr += delta_y;
+
+        if (xerr > distance)
+        {
+            xerr -= distance;
+            row += incx;
+        }
+
+        if (yerr > distance)
+        {
+            yerr -= distance;
+            col += incy;
+        }
+    }
+}
+
+/**
+ * @brief       ʶ
+ * @param       in: 28x28
+ * @retval      
+ */
+static uint8_t host_classify(const float *in)
+{
+    float out[NN_OUT_NUM];
+    uint8_t i, m = 0;
+
+    nn_ref_run(in, out, g_host_scratch);
+
+    for (i = 1; i < NN_OUT_NUM; i++)
+    {
+        m = (out[i] > out[m]) ? i : m;
+    }
+
+    return m;
+}
+
+/**
+ * @brief       ѵǰ͸Ԥ
+ * @param       
+ * @retval      
+ */
+static void host_raster(void)
+{
+    memset(g_old, 0, sizeof(g_old));
+    host_feed(host_old_line);
+    prep_clear();
+    host_feed(prep_add);
+    prep_segment();
+    prep_run(0, g_new);
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t num = (argc > 1) ? (uint32_t)atoi(argv[1]) : 200;
+    uint32_t ok[2][10] = {{0}}, oks[2][2] = {{0}}, cnt[2] = {0};
+    uint32_t m_seg = 0, m_dig = 0, m_num = 0, m_digits = 0;
+    uint32_t i, k, t, segs = 0, c_prep, c_add, c_seg, c_conv;
+    uint8_t d, big, n, all, dig[4];
+    double size, slot, h;
+
+    srand(1);
+
+    for (d = 0; d < 10; d++)
+    {
+        for (i = 0; i < num; i++)
+        {
+            size = host_rand(HOST_SIZE_MIN, HOST_SIZE_MAX);
+            big = size >= 0.6;
+            g_pt_num = 0;
+            host_digit(d, size * PREP_H, 77, 402, HOST_YLO, HOST_YHI);  /* ԭĻ, һ */
+            host_raster();
+            cnt[big]++;
+
+            if (host_classify(g_old) == d)
+            {
+                ok[0][d]++;
+                oks[0][big]++;
+            }
+
+            if (host_classify(g_new) == d)
+            {
+                ok[1][d]++;
+                oks[1][big]++;
+            }
+        }
+    }
+
+    printf("digit    old    prep\n");
+
+    for (d = 0; d < 10; d++)
+    {
+        printf("%5u  %5.1f%%  %5.1f%%\n", d, 100.0 * ok[0][d] / num, 100.0 * ok[1][d] / num);
+    }
+
+    for (k = 0; k < 2; k++)
+    {
+        printf("%5s  %5.1f%%  %5.1f%%   (%u)\n", k ? "large" : "small",
+               100.0 * oks[0][k] / cnt[k], 100.0 * oks[1][k] / cnt[k], cnt[k]);
+    }
+
+    for (d = 0, i = 0, k = 0; d < 10; d++)
+    {
+        i += ok[0][d];
+        k += ok[1][d];
+    }
+
+    printf("  all  %5.1f%%  %5.1f%%\n", 100.0 * i / (10 * num), 100.0 * k / (10 * num));
+
+    for (i = 0; i < 5 * num; i++)       /* λ */
+    {
+        n = 2 + rand() % 3;
+        slot = (PREP_W - 2.0) / n;
+        h = host_rand(0.3, 0.6) * PREP_H;
+        h = (h > (slot - 2 * HOST_GAP) / 1.05) ? (slot - 2 * HOST_GAP) / 1.05 : h;
+        g_pt_num = 0;
+
+        for (k = 0; k < n; k++)
+        {
+            dig[k] = rand() % 10;
+            host_digit(dig[k], h, PREP_X0 + 1 + k * slot + HOST_GAP, PREP_X0 + 1 + (k + 1) * slot - HOST_GAP,
+                       HOST_YLO, HOST_YHI);
+        }
+
+        prep_clear();
+        host_feed(prep_add);
+
+        if (prep_segment() != n)
+        {
+            continue;
+        }
+
+        m_seg++;
+        m_digits += n;
+
+        for (k = 0, all = 1; k < n; k++)
+        {
+            prep_run(k, g_new);
+            d = (host_classify(g_new) == dig[k]);
+            m_dig += d;
+            all &= d;
+        }
+
+        m_num += all;
+    }
+
+    printf("\nmulti-digit (2-4 digits, %u numbers):\n", 5 * num);
+    printf("  segmented    %5.1f%%\n", 100.0 * m_seg / (5 * num));
+    printf("  digits       %5.1f%%  (of segmented)\n", 100.0 * m_dig / m_digits);
+    printf("  numbers      %5.1f%%  (of all)\n", 100.0 * m_num / (5 * num));
+
+    /* : һ "8" */
+    g_pt_num = 0;
+    host_digit(8, 0.8 * PREP_H, 77, 402, HOST_YLO, HOST_YHI);
+
+    for (i = 0; i < g_pt_num; i++)
+    {
+        segs += (g_pt[i][0] != 0xFFFF);
+    }
+
+    t = host_cycles();
+
+    for (i = 0; i < HOST_REPEAT; i++)
+    {
+        prep_clear();
+        host_feed(prep_add);
+    }
+
+    c_add = (host_cycles() - t) / HOST_REPEAT;
+
+    t = host_cycles();
+
+    for (i = 0; i < HOST_REPEAT; i++)
+    {
+        prep_segment();
+    }
+
+    c_seg = (host_cycles() - t) / HOST_REPEAT;
+
+    t = host_cycles();
+
+    for (i = 0; i < HOST_REPEAT; i++)
+    {
+        prep_run(0, g_new);
+    }
+
+    c_prep = (host_cycles() - t) / HOST_REPEAT;
+
+    t = host_cycles();
+
+    for (i = 0; i < HOST_REPEAT; i++)
+    {
+        nn_ref_layer(NN_L_CONV0, g_new, g_conv_out);
+    }
+
+    c_conv = (host_cycles() - t) / HOST_REPEAT;
+
+    printf("\ncost (host, %u MHz cycles):\n", HOST_CLOCK / 1000000);
+    printf("  prep_add     %8u per segment (%u segments)\n", c_add / segs, segs);
+    printf("  prep_segment %8u\n", c_seg);
+    printf("  prep_run     %8u\n", c_prep);
+    printf("  conv0        %8u\n", c_conv);
+    return 0;
+}
@@ -0,0 +1,931 @@
+/**
+ ****************************************************************************************************
+ * @file        replay_host.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       켣ط():  main.c   -> /դ ->  -> ʾ, ӳٺ
+ ****************************************************************************************************
+ * @attention
+ *
+ * (ڲֿĿ¼):
+ *   gcc -O2 -DHOST_SIM -ICore/Inc -IHost -IMiddlewares/ST/AI/Inc -IX-CUBE-AI/App Host/replay_host.c
+ *       Host/digit_sim.c Host/host_sim.c Host/lcd_sim.c Core/Src/tprec.c Core/Src/stroke.c Core/Src/prep.c
+ *       Core/Src/seg.c Core/Src/nn_ref.c X-CUBE-AI/App/network_data_params.c Core/Src/lcd.c Core/Src/lcd_ex.c
+ *       Core/Src/dirty.c Core/Src/panel.c Core/Src/bar.c Core/Src/asset.c Core/Src/asset_enc.c -lm -o replay_host
+ * :
+ *   ./replay_host                      ϳɹ켣: 0~9 ÿд3, ÿдһ RST 
+ *   ./replay_host -n 1 -o synth.tpr    ÿд1, ͬʱѺϳɹ켣 .tpr(Լ2KB, Դϻط)
+ *   ./replay_host rec.tpr              طŰ¼Ĺ켣(log_decode.py --touch )
+ *
+ * ÿһ֡켣һ tp_dev.scan Ľ,  main.c һ: touch_task Ѱ/ɿ,
+ * (stroke.c ˲ֵ, lcd_draw_bline_join ģLCD, prep_add դ)֪ͨ,
+ *  prep_segment + ÿ prep_run + nn_ref_run( X-CUBE-AI ͬһ)28x28Ԥ,
+ * ʾ panel_update + dirty_flush. 붼ǰϵģ, ֻ main.c һ.
+ * ͬĵط: ûͼӻ(fmap.c  X-CUBE-AI ); ͼÿν bar_commit
+ * (bar_poll ǽʱˢ, ýظ).
+ *
+ * ʱ: ÿ֡ڹ켣ʱɨ, ׶εĺʱ, Ĺ x ϵĵ
+ * (REPLAY_CYC_*, FSMCд lcd.c  g_lcd_bus_writes), Ȱ main.c ȼ: ͻ
+ * ռ, ʾ. ͬһ켣ÿеıȫͬ, ˻/Ԥ/ʾĴ
+ * ǰԱűǹı仯; ֻ, ֵ԰ "tp play"  trace Ϊ׼.
+ * :
+ *   ink  : ɨʱ -> ɨīLCD(), ҲǸֵӳ
+ *   e2e  :  trace.c  TRACE_E2E һ, ÿλ˱ʻɨ -> ʶʾ
+ *   load : ռCPUʱ / 켣ʱ
+ * һʵõʱʵʱı(ֻ˵ʵʱ, Ƚ).
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdlib.h>
+#include "lcd.h"
+#include "dirty.h"
+#include "panel.h"
+#include "bar.h"
+#include "seg.h"
+#include "stroke.h"
+#include "nn_ref.h"
+#include "tprec.h"
+#include "digit_sim.h"
+
+
+#define REPLAY_LCD_ID       0x5510      /* ϵ */
+#define REPLAY_TRACE_MAX    (1024 * 1024)   /* 켣ֽ */
+#define REPLAY_EVT_MAX      65536       /* ͳƵӳ */
+#define REPLAY_RESULT_MAX   1024        /* ¼ǰ */
+#define REPLAY_GAP_STROKE   120000      /* ϳɹ켣: ʻ̧֮ʵʱ(us) */
+#define REPLAY_GAP_DIGIT    600000      /* ϳɹ켣: д굽 RST ʱ(us) */
+
+/* ģ: ÿλİ(168MHz). 㲿 x5(Cortex-M4 Ĵ²) */
+#define REPLAY_CYC_SCAN     33600       /* GT9xxx ״̬, Լ200us(trace_sim.c ) */
+#define REPLAY_CYC_BUS      6           /* һFSMCд: fsmc.c дʱ ADDSET 1 + DATAST 1 + BUSTURN 2, ѭ */
+#define REPLAY_CYC_STROKE   100         /* stroke_add/stroke_end һ(1-euro  + ֵ) */
+#define REPLAY_CYC_PREP     1000        /* prep_add һ */
+#define REPLAY_CYC_SEG      1000        /* prep_segment һ */
+#define REPLAY_CYC_RUN      12000       /* prep_run һ */
+#define REPLAY_CYC_MACC     4           /* ai_network_run ÿγ˼, 236Լ56ms(sched_sim.c Ĭ60ms) */
+
+/* ׶ */
+enum
+{
+    REPLAY_TOUCH = 0,
+    REPLAY_RENDER,
+    REPLAY_INFER,
+    REPLAY_DISPLAY,
+    REPLAY_STAGE_NUM
+};
+
+static const char *const g_stage_name[REPLAY_STAGE_NUM] = {"touch", "render", "infer", "display"};
+
+/*  main.c ͬĻ״̬ */
+static uint16_t lastpos[10][2];
+static uint16_t prevpos[10][2];
+static stroke_t g_stroke[10];
+static uint32_t g_stroke_t0[10];
+static uint16_t g_ghost[10][3][2];
+static dirty_rect_t g_ink = {0xFFFF, 0xFFFF, 0, 0};
+static uint8_t g_preview_num = 0;
+static const uint16_t POINT_COLOR_TBL[10] = {RED, GREEN, BLUE, BROWN, YELLOW, MAGENTA, CYAN, LIGHTBLUE, BRRED, GRAY};
+
+/* ʶ( -> ʾ) */
+typedef struct
+{
+    uint8_t count;
+    uint8_t num[SEG_MAX];
+    float conf[SEG_MAX];
+    float prob[NN_OUT_NUM];
+} replay_result_t;
+
+static replay_result_t g_res;
+static uint32_t g_shown = 0xFFFFFFFF;   /* ʾŵĽ: ֵ * 8 + λ, ûʱΪ 0xFFFFFFFF */
+static float g_in[NN_IN_H * NN_IN_W];
+static float g_scratch[NN_REF_SCRATCH / sizeof(float)];
+
+/*  */
+static uint32_t g_w_strokes, g_w_lines, g_w_digits, g_w_infers, g_w_scans;
+static uint64_t g_w_bus[REPLAY_STAGE_NUM];
+static uint64_t g_busy[REPLAY_STAGE_NUM];       /* ׶εCPUʱ() */
+static uint64_t g_host[REPLAY_STAGE_NUM];       /* ׶εʱ(, ֻο) */
+static uint32_t g_net_macc;
+
+/* ӳ() */
+static uint32_t g_lat_ink[REPLAY_EVT_MAX], g_lat_e2e[REPLAY_EVT_MAX];
+static uint32_t g_lat_ink_num, g_lat_e2e_num;
+
+/* ¼: ˱ʻɨʱ, ȰĽʾ */
+static uint64_t g_evt[REPLAY_EVT_MAX];
+static uint32_t g_evt_num, g_evt_done;
+
+/* ǰʾĽ, ϳɹ켣ʱдֱȽ */
+static uint32_t g_result[REPLAY_RESULT_MAX];
+static uint32_t g_result_num;
+static uint8_t g_label[REPLAY_RESULT_MAX];
+static uint32_t g_label_num;
+
+static uint8_t g_trace[REPLAY_TRACE_MAX];
+static uint32_t g_trace_len;
+static uint32_t g_trace_gap;            /* ϳɹ켣: һ֡ǰȵʱ(us) */
+
+/* lcd.c/dirty.c ѭ, ûе */
+void sched_lock(void)
+{
+}
+
+void sched_unlock(void)
+{
+}
+
+/**
+ * @brief       Իͼ(ͬ main.c): ߿ "RST"
+ * @param       y    : 
+ * @param       x0,x1: зΧ
+ * @param       line : һе
+ * @retval      
+ */
+static void dialog_paint(uint16_t y, uint16_t x0, uint16_t x1, uint16_t *line)
+{
+    const uint16_t *rows;
+    uint16_t x, cx, bits;
+    uint8_t i;
+
+    if (y >= PREP_Y0 && y <= PREP_Y0 + PREP_H - 1)
+    {
+        if (y == PREP_Y0 || y == PREP_Y0 + PREP_H - 1)
+        {
+            for (x = (x0 > PREP_X0) ? x0 : PREP_X0; x <= x1 && x <= PREP_X0 + PREP_W - 1; x++)
+            {
+                line[x - x0] = BLUE;
+            }
+        }
+        else
+        {
+            if (x0 <= PREP_X0 && x1 >= PREP_X0)
+            {
+                line[PREP_X0 - x0] = BLUE;
+            }
+
+            if (x0 <= PREP_X0 + PREP_W - 1 && x1 >= PREP_X0 + PREP_W - 1)
+            {
+                line[PREP_X0 + PREP_W - 1 - x0] = BLUE;
+            }
+        }
+    }
+
+    if (y < 16 && x1 >= lcddev.width - 24)
+    {
+        for (i = 0; i < 3; i++)
+        {
+            cx = lcddev.width - 24 + i * 8;
+            rows = lcd_glyph_get("RST"[i], 16);
+            bits = rows ? rows[y] : 0;
+
+            for (x = cx; bits; x++, bits <<= 1)
+            {
+                if ((bits & 0x8000) && x >= x0 && x <= x1)
+                {
+                    line[x - x0] = BLUE;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief       īӾμһΧ size ķΧ(ͬ main.c)
+ * @param       x, y: 
+ * @param       size: 뾶
+ * @retval      
+ */
+static void ink_add(uint16_t x, uint16_t y, uint16_t size)
+{
+    uint16_t x0 = (x > size) ? x - size : 0;
+    uint16_t y0 = (y > size) ? y - size : 0;
+
+    if (g_ink.x0 == 0xFFFF)
+    {
+        g_ink.x0 = x0;
+        g_ink.y0 = y0;
+        g_ink.x1 = x + size;
+        g_ink.y1 = y + size;
+        return;
+    }
+
+    g_ink.x0 = (x0 < g_ink.x0) ? x0 : g_ink.x0;
+    g_ink.y0 = (y0 < g_ink.y0) ? y0 : g_ink.y0;
+    g_ink.x1 = (x + size > g_ink.x1) ? x + size : g_ink.x1;
+    g_ink.y1 = (y + size > g_ink.y1) ? y + size : g_ink.y1;
+}
+
+/**
+ * @brief       (ͬ main.c), ǰʾĽ
+ * @param       
+ * @retval      1, ī; 0, 屾ǿյ;
+ */
+static uint8_t clear_canvas(void)
+{
+    if (g_ink.x0 == 0xFFFF)
+    {
+        return 0;
+    }
+
+    if (g_result_num < REPLAY_RESULT_MAX)
+    {
+        g_result[g_result_num++] = g_shown;
+    }
+
+    dirty_add(g_ink.x0, g_ink.y0, g_ink.x1, g_ink.y1);
+    dirty_add(0, 0, SEG_MAX * 28 - 1, 27);
+    dirty_flush();
+    g_ink.x0 = 0xFFFF;
+    g_preview_num = 0;
+    prep_clear();
+    return 1;
+}
+
+/**
+ * @brief       ѵڻ(ͬ main.c)
+ * @param       p: 
+ * @retval      
+ */
+static void canvas_clip(uint16_t p[2])
+{
+    p[0] = (p[0] < PREP_X0 + 1) ? PREP_X0 + 1 : (p[0] > PREP_X0 + PREP_W - 2) ? PREP_X0 + PREP_W - 2 : p[0];
+    p[1] = (p[1] < PREP_Y0 + 1) ? PREP_Y0 + 1 : (p[1] > PREP_Y0 + PREP_H - 2) ? PREP_Y0 + PREP_H - 2 : p[1];
+}
+
+/**
+ * @brief       īդ(ͬ main.c)
+ * @param       t  : 
+ * @param       pts: ĵ
+ * @param       n  : 
+ * @retval      
+ */
+static void stroke_ink(uint8_t t, uint16_t pts[][2], uint8_t n)
+{
+    uint8_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        canvas_clip(pts[i]);
+        lcd_draw_bline_join(prevpos[t][0], prevpos[t][1], lastpos[t][0], lastpos[t][1], pts[i][0], pts[i][1], 10, POINT_COLOR_TBL[t]);
+        ink_add(pts[i][0], pts[i][1], 10);
+        prep_add(lastpos[t][0], lastpos[t][1], pts[i][0], pts[i][1]);
+        g_w_lines++;
+        prevpos[t][0] = lastpos[t][0];
+        prevpos[t][1] = lastpos[t][1];
+        lastpos[t][0] = pts[i][0];
+        lastpos[t][1] = pts[i][1];
+    }
+}
+
+/**
+ * @brief       ʱī(ͬ main.c)
+ * @param       t: 
+ * @retval      
+ */
+static void stroke_ghost_erase(uint8_t t)
+{
+    uint16_t (*g)[2] = g_ghost[t];
+
+    if (g[0][0] == 0xFFFF)
+    {
+        return;
+    }
+
+    lcd_draw_bline(g[0][0], g[0][1], g[1][0], g[1][1], 10, WHITE);
+    lcd_draw_bline_join(g[0][0], g[0][1], g[1][0], g[1][1], g[2][0], g[2][1], 10, WHITE);
+
+    if (prevpos[t][0] != 0xFFFF)
+    {
+        lcd_draw_bline(prevpos[t][0], prevpos[t][1], lastpos[t][0], lastpos[t][1], 10, POINT_COLOR_TBL[t]);
+    }
+    else
+    {
+        lcd_draw_bline(lastpos[t][0], lastpos[t][1], lastpos[t][0], lastpos[t][1], 10, POINT_COLOR_TBL[t]);
+    }
+
+    g[0][0] = 0xFFFF;
+}
+
+/**
+ * @brief       ʱī(ͬ main.c)
+ * @param       t: 
+ * @retval      
+ */
+static void stroke_ghost_draw(uint8_t t)
+{
+    uint16_t (*g)[2] = g_ghost[t];
+
+    g[0][0] = lastpos[t][0];
+    g[0][1] = lastpos[t][1];
+    stroke_last(&g_stroke[t], &g[1][0], &g[1][1]);
+    stroke_predict(&g_stroke[t], STROKE_PREDICT_MS, &g[2][0], &g[2][1]);
+    canvas_clip(g[1]);
+    canvas_clip(g[2]);
+    lcd_draw_bline_join(prevpos[t][0], prevpos[t][1], g[0][0], g[0][1], g[1][0], g[1][1], 10, POINT_COLOR_TBL[t]);
+    lcd_draw_bline_join(g[0][0], g[0][1], g[1][0], g[1][1], g[2][0], g[2][1], 10, POINT_COLOR_TBL[t]);
+    ink_add(g[1][0], g[1][1], 10);
+    ink_add(g[2][0], g[2][1], 10);
+}
+
+/**
+ * @brief       һδɨ + (main.c  touch_task/render_task)
+ * @param       f : ɨ
+ * @param       t0: ɨ迪ʼʱ()
+ * @retval      bit0, ˱ʻ; bit1, ˻;
+ */
+static uint8_t replay_scan(const tprec_frame_t *f, uint32_t t0)
+{
+    static uint8_t down = 0;
+    uint16_t pts[STROKE_CURVE_MAX][2];
+    uint16_t x, y;
+    uint8_t t, n;
+    uint8_t drawn = 0;
+    uint8_t ink = 0;
+
+    for (t = 0; t < TPREC_PT_MAX; t++)
+    {
+        if (f->mask & (1 << t))
+        {
+            x = f->x[t];
+            y = f->y[t];
+            down |= 1 << t;
+        }
+        else if (down & (1 << t))       /* ɿ */
+        {
+            down &= ~(1 << t);
+
+            if (lastpos[t][0] != 0xFFFF)
+            {
+                stroke_ghost_erase(t);
+                n = stroke_end(&g_stroke[t], pts);
+                g_w_strokes++;
+                stroke_ink(t, pts, n);
+                drawn = 1;
+            }
+
+            lastpos[t][0] = 0xFFFF;
+            continue;
+        }
+        else
+        {
+            continue;
+        }
+
+        if (x > PREP_X0 && x < PREP_X0 + PREP_W - 1 && y > PREP_Y0 && y < PREP_Y0 + PREP_H - 1)
+        {
+            if (lastpos[t][0] == 0xFFFF)
+            {
+                stroke_begin(&g_stroke[t], x, y);
+                lastpos[t][0] = x;
+                lastpos[t][1] = y;
+                prevpos[t][0] = 0xFFFF;
+                ink_add(x, y, 10);
+                prep_add(x, y, x, y);
+                g_w_lines++;
+            }
+            else
+            {
+                n = stroke_add(&g_stroke[t], x, y, (t0 - g_stroke_t0[t]) / (SystemCoreClock / 1000000), pts);
+                g_w_strokes++;
+                stroke_ghost_erase(t);
+                stroke_ink(t, pts, n);
+            }
+
+            g_stroke_t0[t] = t0;
+            stroke_ghost_draw(t);
+            drawn = 1;
+        }
+
+        if (x > (lcddev.width - 24) && y < 20)
+        {
+            ink |= clear_canvas();
+        }
+    }
+
+    return drawn | (ink << 1);
+}
+
+/**
+ * @brief       28x28Ԥ(ͬ main.c  prep_preview)
+ * @param       s  : ڼ
+ * @param       img: 28x28Ҷ, NULL ʱɿհ
+ * @retval      
+ */
+static void replay_preview(uint8_t s, const uint8_t *img)
+{
+    uint16_t i;
+    uint8_t v;
+
+    lcd_set_window(s * 28, 0, 28, 28);
+    lcd_write_ram_prepare();
+    LCD_BUS_ADD(28 * 28);
+
+    for (i = 0; i < 28 * 28; i++)
+    {
+        v = img ? 255 - img[i] : 255;
+        LCD_WR_RAM(((v >> 3) << 11) | ((v >> 2) << 5) | (v >> 3));
+    }
+}
+
+/**
+ * @brief       (main.c  infer_task, ָ + CNN)
+ * @param       
+ * @retval      
+ */
+static void replay_infer(void)
+{
+    uint8_t n, s, i;
+
+    n = prep_segment();
+    g_res.count = n;
+    memset(g_res.prob, 0, sizeof(g_res.prob));
+    g_w_infers++;
+
+    for (s = 0; s < n; s++)
+    {
+        prep_run(s, g_in);
+        replay_preview(s, prep_image());
+        nn_ref_run(g_in, g_res.prob, g_scratch);
+        g_res.num[s] = 0;
+
+        for (i = 1; i < NN_OUT_NUM; i++)
+        {
+            g_res.num[s] = (g_res.prob[i] > g_res.prob[g_res.num[s]]) ? i : g_res.num[s];
+        }
+
+        g_res.conf[s] = g_res.prob[g_res.num[s]];
+    }
+
+    for (; s < g_preview_num; s++)
+    {
+        replay_preview(s, NULL);
+    }
+
+    g_preview_num = n;
+    g_w_digits += n;
+}
+
+/**
+ * @brief       ʾ(main.c  display_task)
+ * @param       
+ * @retval      
+ */
+static void replay_display(void)
+{
+    uint32_t value = 0;
+    uint8_t i;
+
+    panel_update(g_res.prob, g_res.num, g_res.conf, g_res.count);
+    bar_commit();
+    dirty_flush();
+
+    for (i = 0; i < g_res.count; i++)
+    {
+        value = value * 10 + g_res.num[i];
+    }
+
+    g_shown = g_res.count ? value * 8 + g_res.count : 0xFFFFFFFF;
+}
+
+/**
+ * @brief       һ׶, ϵ
+ * @param       stage: ׶
+ * @param       f    : ɨ(ֻ REPLAY_RENDER )
+ * @param       t0   : ɨʱ
+ * @retval      REPLAY_RENDER ʱΪ replay_scan ķֵ, Ϊ0; д *cyc
+ */
+static uint8_t replay_stage(uint8_t stage, const tprec_frame_t *f, uint32_t t0, uint64_t *cyc)
+{
+    uint32_t bus = g_lcd_bus_writes;
+    uint32_t lines = g_w_lines, strokes = g_w_strokes, digits = g_w_digits;
+    uint32_t h = host_cycles();
+    uint8_t ret = 0;
+
+    switch (stage)
+    {
+        case REPLAY_RENDER:
+            ret = replay_scan(f, t0);
+            break;
+
+        case REPLAY_INFER:
+            replay_infer();
+            break;
+
+        case REPLAY_DISPLAY:
+            replay_display();
+            break;
+
+        default:
+            break;
+    }
+
+    g_host[stage] += host_cycles() - h;
+    bus = g_lcd_bus_writes - bus;
+    g_w_bus[stage] += bus;
+    *cyc = (uint64_t)bus * REPLAY_CYC_BUS + (uint64_t)(g_w_lines - lines) * REPLAY_CYC_PREP
+           + (uint64_t)(g_w_strokes - strokes) * REPLAY_CYC_STROKE;
+
+    if (stage == REPLAY_TOUCH)
+    {
+        *cyc = REPLAY_CYC_SCAN;
+    }
+    else if (stage == REPLAY_INFER)
+    {
+        digits = g_w_digits - digits;
+        *cyc += REPLAY_CYC_SEG + (uint64_t)digits * (REPLAY_CYC_RUN + (uint64_t)g_net_macc * REPLAY_CYC_MACC);
+    }
+
+    g_busy[stage] += *cyc;
+    return ret;
+}
+
+/**
+ * @brief       һӳ
+ * @param       buf: 
+ * @param       num: 
+ * @param       cyc: ӳ()
+ * @retval      
+ */
+static void replay_lat(uint32_t *buf, uint32_t *num, uint64_t cyc)
+{
+    if (*num < REPLAY_EVT_MAX)
+    {
+        buf[(*num)++] = (cyc > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32_t)cyc;
+    }
+}
+
+/* +ʾ(Э, ȼڴͻ) */
+static uint8_t g_lp_state = 0;          /* 0, ; 1, ; 2, ʾ */
+static uint64_t g_lp_end = 0;           /* ǰ׶νʱ */
+static uint64_t g_lp_free = 0;          /* һʾʱ */
+static uint32_t g_lp_mark = 0;          /* ʼʱеĴ¼ */
+static uint8_t g_ink_pending = 0;       /* ,  */
+static uint64_t g_hp_end = 0;           /* ͻæʱ */
+
+/**
+ * @brief       +ʾеʱ t(һɨ)
+ * @param       t: ʱ()
+ * @retval      
+ */
+static void replay_advance(uint64_t t)
+{
+    uint64_t cyc, start;
+
+    while (1)
+    {
+        if (g_lp_state == 0)
+        {
+            start = (g_lp_free > g_hp_end) ? g_lp_free : g_hp_end;
+
+            if (g_ink_pending == 0 || start >= t)
+            {
+                return;
+            }
+
+            g_ink_pending = 0;                  /* ʼʱȡĿ */
+            g_lp_mark = g_evt_num;
+            replay_stage(REPLAY_INFER, NULL, 0, &cyc);
+            g_lp_state = 1;
+            g_lp_end = start + cyc;
+        }
+
+        if (g_lp_end > t)                       /* һɨʱ */
+        {
+            return;
+        }
+
+        if (g_lp_state == 1)
+        {
+            replay_stage(REPLAY_DISPLAY, NULL, 0, &cyc);
+            g_lp_state = 2;
+            g_lp_end += cyc;
+            continue;
+        }
+
+        for (; g_evt_done < g_lp_mark; g_evt_done++)    /* νĴ¼ */
+        {
+            replay_lat(g_lat_e2e, &g_lat_e2e_num, g_lp_end - g_evt[g_evt_done % REPLAY_EVT_MAX]);
+        }
+
+        g_lp_state = 0;
+        g_lp_free = g_lp_end;
+    }
+}
+
+/**
+ * @brief       ʱ t һɨ: ͻռ
+ * @param       f: ɨ
+ * @param       t: ʱ()
+ * @retval      
+ */
+static void replay_frame(const tprec_frame_t *f, uint64_t t)
+{
+    uint64_t s = (t > g_hp_end) ? t : g_hp_end;     /* һλûں */
+    uint64_t c0, c1;
+    uint8_t r;
+
+    replay_advance(t);
+    replay_stage(REPLAY_TOUCH, NULL, 0, &c0);
+    r = replay_stage(REPLAY_RENDER, f, (uint32_t)s, &c1);
+    g_hp_end = s + c0 + c1;
+    g_w_scans++;
+
+    if (g_lp_state && g_lp_end > s)             /* ռ */
+    {
+        g_lp_end += c0 + c1;
+    }
+
+    if (r & 1)
+    {
+        replay_lat(g_lat_ink, &g_lat_ink_num, g_hp_end - t);
+        g_evt[g_evt_num++ % REPLAY_EVT_MAX] = t;
+    }
+
+    g_ink_pending |= (r != 0);
+}
+
+/**
+ * @brief       ȽϺ(qsort)
+ */
+static int replay_cmp(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief       һӳٵ n/p50/p95/max(ms)
+ * @param       name: 
+ * @param       buf : (ᱻ)
+ * @param       num : 
+ * @retval      
+ */
+static void replay_print_lat(const char *name, uint32_t *buf, uint32_t num)
+{
+    const double ms = 1000.0 / HOST_CLOCK;
+
+    if (num == 0)
+    {
+        printf("%-8s %6u\n", name, 0);
+        return;
+    }
+
+    qsort(buf, num, sizeof(uint32_t), replay_cmp);
+    printf("%-8s %6u %8.2f %8.2f %8.2f %8.2f\n", name, num, buf[0] * ms, buf[num / 2] * ms,
+           buf[(uint32_t)(num * 0.95)] * ms, buf[num - 1] * ms);
+}
+
+/**
+ * @brief       ϳɹ켣: һ֡
+ * @param       mask: µĴ
+ * @param       x, y: 0
+ * @retval      
+ */
+static void replay_put(uint8_t mask, uint16_t x, uint16_t y)
+{
+    tprec_frame_t f;
+
+    if (g_trace_len + TPREC_FRAME_MAX > REPLAY_TRACE_MAX)
+    {
+        return;
+    }
+
+    memset(&f, 0, sizeof(f));
+    f.mask = mask;
+    f.x[0] = x;
+    f.y[0] = y;
+    g_trace_len += tprec_encode(&g_trace[g_trace_len], g_trace_gap + HOST_PERIOD_US, &f);
+    g_trace_gap = 0;
+}
+
+/**
+ * @brief       ϳɹ켣: ÿд num , дһ RST
+ * @param       num: ÿֵı
+ * @retval      
+ */
+static void replay_synth(uint32_t num)
+{
+    uint32_t i, k;
+    uint8_t d, pen = 0;
+
+    g_trace_len = tprec_header(g_trace, lcddev.width, lcddev.height);
+    g_trace_gap = 0;
+
+    for (k = 0; k < num; k++)
+    {
+        for (d = 0; d < 10; d++)
+        {
+            g_pt_num = 0;
+            host_digit(d, host_rand(0.3, 0.9) * PREP_H, PREP_X0 + 1, PREP_X0 + PREP_W - 2, HOST_YLO, HOST_YHI);
+
+            for (i = 0; i < g_pt_num; i++)
+            {
+                if (g_pt[i][0] == 0xFFFF)
+                {
+                    if (pen)
+                    {
+                        replay_put(0, 0, 0);
+                        g_trace_gap = REPLAY_GAP_STROKE;
+                    }
+
+                    pen = 0;
+                }
+                else
+                {
+                    replay_put(1, g_pt[i][0], g_pt[i][1]);
+                    pen = 1;
+                }
+            }
+
+            if (pen)
+            {
+                replay_put(0, 0, 0);
+                pen = 0;
+            }
+
+            g_trace_gap = REPLAY_GAP_DIGIT;
+            replay_put(1, lcddev.width - 12, 8);    /*  RST */
+            replay_put(0, 0, 0);
+            g_trace_gap = REPLAY_GAP_STROKE;
+
+            if (g_label_num < REPLAY_RESULT_MAX)
+            {
+                g_label[g_label_num++] = d;
+            }
+        }
+    }
+}
+
+/**
+ * @brief       켣ļ
+ * @param       name: ļ
+ * @retval      0, ɹ; 1, 򲻿̫;
+ */
+static uint8_t replay_load(const char *name)
+{
+    FILE *f = fopen(name, "rb");
+
+    if (f == NULL)
+    {
+        return 1;
+    }
+
+    g_trace_len = fread(g_trace, 1, REPLAY_TRACE_MAX, f);
+    fclose(f);
+    return (g_trace_len == REPLAY_TRACE_MAX);
+}
+
+int main(int argc, char *argv[])
+{
+    tprec_reader_t rd;
+    tprec_frame_t f;
+    const char *in = NULL, *out = NULL;
+    uint32_t num = 3, i, frames = 0, ok = 0, h, wall;
+    uint64_t t = 0;
+    uint16_t w, hgt;
+    uint8_t st;
+    int a;
+
+    for (a = 1; a < argc; a++)
+    {
+        if (strcmp(argv[a], "-n") == 0 && a + 1 < argc)
+        {
+            num = (uint32_t)atoi(argv[++a]);
+        }
+        else if (strcmp(argv[a], "-o") == 0 && a + 1 < argc)
+        {
+            out = argv[++a];
+        }
+        else
+        {
+            in = argv[a];
+        }
+    }
+
+    if (lcd_sim_init(REPLAY_LCD_ID))
+    {
+        return 2;
+    }
+
+    lcd_init();
+    dirty_init(WHITE);
+    dirty_layer_add(dialog_paint);
+    panel_init();
+    memset(lastpos, 0xFF, sizeof(lastpos));
+    memset(g_ghost, 0xFF, sizeof(g_ghost));
+    dirty_add_all();
+    dirty_flush();
+    prep_clear();
+
+    for (i = 0; i < NN_LAYER_NUM; i++)
+    {
+        g_net_macc += g_nn_layer[i].macc;
+    }
+
+    srand(7);
+
+    if (in ? replay_load(in) : (replay_synth(num), 0))
+    {
+        fprintf(stderr, "cannot read %s\n", in);
+        return 2;
+    }
+
+    if (out)
+    {
+        FILE *fo = fopen(out, "wb");
+
+        if (fo == NULL || fwrite(g_trace, 1, g_trace_len, fo) != g_trace_len)
+        {
+            fprintf(stderr, "cannot write %s\n", out);
+            return 2;
+        }
+
+        fclose(fo);
+
+        if (g_trace_len > TPREC_BUF_SIZE)
+        {
+            fprintf(stderr, "%s: %u bytes, larger than the board replay buffer (TPREC_BUF_SIZE %u)\n",
+                    out, g_trace_len, TPREC_BUF_SIZE);
+        }
+    }
+
+    if (tprec_open(&rd, g_trace, g_trace_len, &w, &hgt) || w != lcddev.width || hgt != lcddev.height)
+    {
+        fprintf(stderr, "not a %ux%u touch trace\n", lcddev.width, lcddev.height);
+        return 2;
+    }
+
+    g_ink_pending = 1;                  /*  main.c һһ,  */
+    h = host_cycles();
+
+    while (tprec_next(&rd, &f) == 0)
+    {
+        t = (uint64_t)f.t * (HOST_CLOCK / 1000000);
+        replay_frame(&f, t);
+        frames++;
+    }
+
+    replay_advance(~0ull);
+    wall = host_cycles() - h;
+    t = (t > g_lp_free) ? t : g_lp_free;
+
+    printf("trace: %u bytes, %u frames, %.2f s, %u scans drew ink, %u stroke_add/end, %u prep lines\n",
+           g_trace_len, frames, t / (double)HOST_CLOCK, g_evt_num, g_w_strokes, g_w_lines);
+    printf("work:  %u inferences, %u digits, %.1f M MACs, bus writes render %llu infer %llu display %llu\n",
+           g_w_infers, g_w_digits, (double)g_w_digits * g_net_macc / 1e6, (unsigned long long)g_w_bus[REPLAY_RENDER],
+           (unsigned long long)g_w_bus[REPLAY_INFER], (unsigned long long)g_w_bus[REPLAY_DISPLAY]);
+    printf("\nlatency (model, ms)  n      min      p50      p95      max\n");
+    replay_print_lat("ink", g_lat_ink, g_lat_ink_num);
+    replay_print_lat("e2e", g_lat_e2e, g_lat_e2e_num);
+    printf("\nload (model):");
+
+    for (st = 0; st < REPLAY_STAGE_NUM; st++)
+    {
+        printf("  %s %.1f%%", g_stage_name[st], t ? 100.0 * g_busy[st] / t : 0.0);
+    }
+
+    printf("\nthroughput (model): %.1f scans/s, %.2f results/s, %.1f ms per inference\n",
+           t ? g_w_scans * (double)HOST_CLOCK / t : 0.0, t ? g_w_infers * (double)HOST_CLOCK / t : 0.0,
+           g_w_infers ? g_busy[REPLAY_INFER] * 1000.0 / HOST_CLOCK / g_w_infers : 0.0);
+
+    if (g_label_num)
+    {
+        for (i = 0; i < g_label_num && i < g_result_num; i++)
+        {
+            ok += (g_result[i] == g_label[i] * 8u + 1);
+        }
+
+        printf("results: %u/%u digits recognized before RST\n", ok, g_label_num);
+    }
+    else
+    {
+        printf("results before RST:");
+
+        for (i = 0; i < g_result_num; i++)
+        {
+            if (g_result[i] == 0xFFFFFFFF)
+            {
+                printf(" -");
+            }
+            else
+            {
+                printf(" %u", g_result[i] / 8);
+            }
+        }
+
+        printf("\n");
+    }
+
+    printf("\nhost: %.1f ms for %.2f s of touch (%.0fx real time), per stage", wall * 1000.0 / HOST_CLOCK,
+           t / (double)HOST_CLOCK, wall ? (double)t / wall : 0.0);
+
+    for (st = 0; st < REPLAY_STAGE_NUM; st++)
+    {
+        printf(" %s %.1f", g_stage_name[st], g_host[st] * 1000.0 / HOST_CLOCK);
+    }
+
+    printf(" ms\n");
+    return 0;
+}
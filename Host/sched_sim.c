@@ -0,0 +1,246 @@
+/**
+ ****************************************************************************************************
+ * @file        sched_sim.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       sched.c : ú main.c ͬͼLinuxϼȺͽֹʱ
+ ****************************************************************************************************
+ * @attention
+ *
+ * (ڲֿĿ¼):
+ *   gcc -O2 -DHOST_SIM -ICore/Inc -IHost Host/sched_sim.c Host/host_sim.c Core/Src/sched.c -o sched_sim
+ * :
+ *   ./sched_sim [] [ms]
+ *
+ * ȼкͽֹʱ main.c һ, ÿĹæģ(ʱȡʵ).
+ * ûж: æȺͿʱǷ20msTIM2ͷŵ, Լ"PendSV"Ƿ񱻹,
+ * ֱ sched_isr(), Чͬڿռѭ.
+ * ʱȱ, гʱ򷵻1.
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdlib.h>
+#include "sched.h"
+
+
+#define TASK_TOUCH      0
+#define TASK_RENDER     1
+#define TASK_LOG        2
+#define TASK_DISPLAY    3
+#define TASK_INFER      4
+
+typedef struct
+{
+    uint16_t x;
+    uint16_t y;
+    uint8_t id;
+    uint8_t down;
+} sim_touch_t;
+
+static sched_queue_t g_q_touch;
+static sim_touch_t g_q_touch_buf[16];
+static sched_queue_t g_q_ink;
+static uint8_t g_q_ink_buf[4];
+static sched_queue_t g_q_result;
+static uint8_t g_q_result_buf[2];
+
+static volatile uint8_t g_sim_pend = 0;     /* "PendSV" */
+static uint8_t g_sim_in_pendsv = 0;
+static uint8_t g_sim_in_tim2 = 0;
+static uint32_t g_sim_next_tim2;            /* һTIM2жϵʱ() */
+static uint32_t g_sim_infer_us = 60000;
+static uint32_t g_sim_strokes = 0;          /* ʣµıʻ */
+static uint32_t g_sim_infers = 0;
+
+/**
+ * @brief       PendSVûо
+ * @param       
+ * @retval      
+ */
+static void sim_pendsv(void)
+{
+    if (g_sim_pend && !g_sim_in_pendsv && !g_sim_in_tim2)
+    {
+        g_sim_in_pendsv = 1;
+        g_sim_pend = 0;
+        sched_isr();
+        g_sim_in_pendsv = 0;
+    }
+}
+
+/**
+ * @brief       ģж: ʱͷŴ(TIM2), ȻPendSV
+ * @param       
+ * @retval      
+ */
+static void sim_irq(void)
+{
+    if (!g_sim_in_tim2 && (int32_t)(host_cycles() - g_sim_next_tim2) >= 0)
+    {
+        g_sim_in_tim2 = 1;
+        g_sim_next_tim2 += HOST_CLOCK / 50;
+        sched_release(TASK_TOUCH);
+        g_sim_in_tim2 = 0;
+    }
+
+    sim_pendsv();
+}
+
+/* Ӳһ, ѭPendSVϽ */
+void sched_port_pend(void)
+{
+    g_sim_pend = 1;
+    sim_pendsv();
+}
+
+void sched_port_idle(void)
+{
+    sim_irq();
+}
+
+/**
+ * @brief       æһʱ, ڼ"ж"
+ * @param       us: ΢
+ * @retval      
+ */
+static void sim_busy(uint32_t us)
+{
+    uint32_t start = host_cycles();
+    uint32_t cycles = us * (HOST_CLOCK / 1000000);
+
+    while (host_cycles() - start < cycles)
+    {
+        sim_irq();
+    }
+}
+
+static void touch_task(void *arg)
+{
+    static uint8_t down = 0;
+    sim_touch_t msg = {200, 200, 0, 1};
+
+    UNUSED(arg);
+    sim_busy(150 + rand() % 100);       /* GT9xxx  */
+
+    if (g_sim_strokes)
+    {
+        g_sim_strokes--;
+        down = 1;
+        sched_queue_put(&g_q_touch, &msg);
+    }
+    else if (down)
+    {
+        down = 0;
+        msg.down = 0;
+        sched_queue_put(&g_q_touch, &msg);
+    }
+    else if (rand() % 50 == 0)          /* ƽÿ뿪ʼһ */
+    {
+        g_sim_strokes = 10 + rand() % 30;
+    }
+}
+
+static void render_task(void *arg)
+{
+    sim_touch_t msg;
+    uint8_t drawn = 0;
+
+    UNUSED(arg);
+
+    while (sched_queue_get(&g_q_touch, &msg) == 0)
+    {
+        if (msg.down)
+        {
+            sim_busy(900 + rand() % 600);   /* lcd_draw_bline + prep_add */
+            drawn = 1;
+        }
+    }
+
+    if (drawn)
+    {
+        sched_queue_put(&g_q_ink, &drawn);
+    }
+}
+
+static void log_task(void *arg)
+{
+    UNUSED(arg);
+    sched_poll();
+}
+
+static void display_task(void *arg)
+{
+    uint8_t num;
+    int i;
+
+    UNUSED(arg);
+
+    if (sched_queue_get(&g_q_result, &num))
+    {
+        return;
+    }
+
+    for (i = 0; i < 11; i++)
+    {
+        sched_lock();
+        sim_busy(1500);                 /* lcd_show_string */
+        sched_unlock();
+    }
+}
+
+static void infer_task(void *arg)
+{
+    uint8_t ink = 0;
+    uint8_t num = 0;
+
+    UNUSED(arg);
+
+    while (sched_queue_get(&g_q_ink, NULL) == 0)
+    {
+        ink = 1;
+    }
+
+    if (ink)
+    {
+        sched_lock();
+        sim_busy(5);                    /*  */
+        sched_unlock();
+        sim_busy(g_sim_infer_us);       /* ai_network_run */
+        g_sim_infers++;
+        sched_queue_put(&g_q_result, &num);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t seconds = (argc > 1) ? atoi(argv[1]) : 5;
+    uint32_t end;
+    uint32_t misses;
+
+    g_sim_infer_us = ((argc > 2) ? atoi(argv[2]) : 60) * 1000;
+
+    sched_init();
+    sched_queue_init(&g_q_touch, g_q_touch_buf, sizeof(sim_touch_t), 16, TASK_RENDER);
+    sched_queue_init(&g_q_ink, g_q_ink_buf, 1, 4, TASK_INFER);
+    sched_queue_init(&g_q_result, g_q_result_buf, 1, 2, TASK_DISPLAY);
+    sched_create(TASK_TOUCH, "touch", touch_task, NULL, 20, 5000, SCHED_EXT);
+    sched_create(TASK_RENDER, "render", render_task, NULL, 0, 20000, 0);
+    sched_create(TASK_LOG, "log", log_task, NULL, 10, 0, 0);
+    sched_create(TASK_DISPLAY, "display", display_task, NULL, 0, 0, 0);
+    sched_create(TASK_INFER, "infer", infer_task, NULL, 20, 0, 0);
+
+    g_sim_next_tim2 = host_cycles() + HOST_CLOCK / 50;
+    end = HAL_GetTick() + seconds * 1000;
+
+    while ((int32_t)(HAL_GetTick() - end) < 0)
+    {
+        sched_run();
+    }
+
+    misses = sched_get(TASK_TOUCH)->misses;     /* ͳ, ȡ */
+    sched_report();
+    printf("inferences %u, touch misses %u, touch queue drops %u\n",
+           g_sim_infers, misses, (unsigned)g_q_touch.drops);
+    return misses != 0;
+}
@@ -0,0 +1,280 @@
+/**
+ ****************************************************************************************************
+ * @file        strip_host.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʶ: ͷָ𴰿ڵȽʶʺÿֵĳ˼Ӵ
+ ****************************************************************************************************
+ * @attention
+ *
+ * (ڲֿĿ¼):
+ *   gcc -O2 -DHOST_SIM -ICore/Inc -IHost -IMiddlewares/ST/AI/Inc -IX-CUBE-AI/App Host/strip_host.c
+ *       Host/digit_sim.c Host/host_sim.c Core/Src/stroke.c Core/Src/prep.c Core/Src/seg.c Core/Src/strip.c
+ *       Core/Src/nn_ref.c X-CUBE-AI/App/network_data_params.c -lm -o strip_host
+ * :
+ *   ./strip_host [ÿּ, Ĭ500]
+ *
+ * ȼ28(һ)ʱ nn_ref_strip  nn_ref_run һ.
+ * Ȼ2~4λ(digit_sim.h), дһ(λ´ HOST_JITTER), ּ:
+ *   spaced:  prep_host һ, ÿλԼǸ, λ֮ 2*HOST_GAP
+ *   tight : ص HOST_TIGHT , ־һ
+ * ͬһʻֱ
+ *   seg   : prep_segment + ÿ prep_run/nn_ref_run(ڵ)
+ *   window: ͬһÿ4һ28x28ڵ nn_ref_run (ڱϲ0), ͬ.
+ *           ֻõߵĴ, ֻЩ, ˼Ӱÿڶ
+ *   strip : prep_strip + strip_run, ÿڶȫ / ֻõõĴ(gate)
+ * ͳԵı, Լƽÿʶֵĳ˼Ӵ.
+ * һ3λʱ: nn_ref_strip Ͱ nn_ref_run.
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdlib.h>
+#include "strip.h"
+#include "digit_sim.h"
+
+
+#define HOST_GAP            16          /* spaced: ÿĿ(, ʻ) */
+#define HOST_TIGHT          24          /* tight: ص */
+#define HOST_JITTER         0.15        /* ͬһλ´ķΧ(ָ߶ȵı) */
+#define HOST_REPEAT         20          /* ʱظ */
+
+static float g_in[NN_IN_H * NN_IN_W];
+static float g_host_scratch[STRIP_SCRATCH / sizeof(float) + 1];
+static float g_ref_scratch[NN_REF_SCRATCH / sizeof(float)];
+
+/**
+ * @brief       ʶ
+ * @param       in  : 28x28
+ * @param       conf: , ΪNULL
+ * @retval      
+ */
+static uint8_t host_classify(const float *in, float *conf)
+{
+    float out[NN_OUT_NUM];
+    uint8_t i, m = 0;
+
+    nn_ref_run(in, out, g_ref_scratch);
+
+    for (i = 1; i < NN_OUT_NUM; i++)
+    {
+        m = (out[i] > out[m]) ? i : m;
+    }
+
+    if (conf)
+    {
+        *conf = out[m];
+    }
+
+    return m;
+}
+
+/**
+ * @brief       28ʱ͵һ
+ * @param       
+ * @retval      
+ */
+static float host_check(void)
+{
+    float ref[NN_OUT_NUM], out[NN_OUT_NUM], err = 0, e;
+    uint8_t img[NN_IN_H * NN_IN_W];
+    uint8_t d, i;
+
+    for (d = 0; d < 10; d++)
+    {
+        g_pt_num = 0;
+        host_digit(d, 0.6 * PREP_H, PREP_X0 + 40, PREP_X0 + 300, HOST_YLO, HOST_YHI);
+        prep_clear();
+        host_feed(prep_add);
+        prep_segment();
+        prep_run(0, g_in);
+        memcpy(img, prep_image(), sizeof(img));
+        nn_ref_run(g_in, ref, g_ref_scratch);
+        nn_ref_strip(img, NN_IN_W, NULL, &out, g_host_scratch);
+
+        for (i = 0; i < NN_OUT_NUM; i++)
+        {
+            e = (out[i] > ref[i]) ? out[i] - ref[i] : ref[i] - out[i];
+            err = (e > err) ? e : err;
+        }
+    }
+
+    return err;
+}
+
+/**
+ * @brief       𴰿ڵ:  strip_run(gated=1) Ĵڻɵĸ, ٽ
+ * @param       r: strip_run Ľ, ɵĽ
+ * @retval      
+ */
+static void host_window(strip_result_t *r)
+{
+    const uint8_t *img = strip_image(g_host_scratch);
+    float *p;
+    uint16_t k, x, y;
+
+    for (k = 0; k < r->pos; k++)
+    {
+        p = (float *)strip_prob(g_host_scratch, k);
+
+        if (p[0] + p[1] + p[2] + p[3] + p[4] + p[5] + p[6] + p[7] + p[8] + p[9] == 0)  /* ûõĴ */
+        {
+            continue;
+        }
+
+        for (y = 0; y < NN_IN_H; y++)
+        {
+            for (x = 0; x < NN_IN_W; x++)
+            {
+                g_in[y * NN_IN_W + x] = img[y * r->w + k * NN_STRIP_STEP + x] * (1.0f / 255);
+            }
+        }
+
+        nn_ref_run(g_in, p, g_ref_scratch);
+    }
+
+    strip_decode(g_host_scratch, r);
+}
+
+/**
+ * @brief       ֵǷһ
+ * @param       r  : 
+ * @param       dig: ֵ
+ * @param       n  : λ
+ * @retval      1, һ
+ */
+static uint8_t host_same(const strip_result_t *r, const uint8_t *dig, uint8_t n)
+{
+    uint8_t k, all = (r->count == n);
+
+    for (k = 0; all && k < n; k++)
+    {
+        all &= (r->num[k] == dig[k]);
+    }
+
+    return all;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t num = (argc > 1) ? (uint32_t)atoi(argv[1]) : 500;
+    uint32_t win = nn_ref_strip_macc(NN_IN_W, 1);
+    uint32_t i, t, c_strip, c_ref, mode;
+    uint8_t n, k, s, all, dig[4];
+    double slot, h, lo, hi, y;
+    double ok_seg, ok_win, ok_strip, ok_gate, mac_seg, mac_strip, mac_gate, mac_win;
+    double out_seg, out_strip, pos, heads;
+    strip_result_t r, rg;
+    uint16_t w;
+
+    srand(1);
+    printf("strip w=28 vs nn_ref_run: max error %g\n", host_check());
+    printf("MACs: window %u, strip per 4 px %u, head %u\n\n", (unsigned)win,
+           (unsigned)(nn_ref_strip_macc(NN_IN_W + NN_STRIP_STEP, 0) - nn_ref_strip_macc(NN_IN_W, 0)),
+           (unsigned)(nn_ref_strip_macc(NN_IN_W, 1) - nn_ref_strip_macc(NN_IN_W, 0)));
+    printf("%-7s %-10s %8s %14s\n", "spacing", "method", "numbers", "MACs/digit");
+
+    for (mode = 0; mode < 2; mode++)
+    {
+        ok_seg = ok_win = ok_strip = ok_gate = mac_seg = mac_strip = mac_gate = mac_win = 0;
+        out_seg = out_strip = pos = heads = 0;
+
+        for (i = 0; i < num; i++)
+        {
+            n = 2 + rand() % 3;
+            slot = (PREP_W - 2.0) / n;
+            h = host_rand(0.3, 0.6) * PREP_H;
+            h = (h > (slot - 2 * HOST_GAP) / 1.05) ? (slot - 2 * HOST_GAP) / 1.05 : h;
+            y = host_rand(HOST_YLO, HOST_YHI - (1 + HOST_JITTER) * h);
+            g_pt_num = 0;
+
+            for (k = 0; k < n; k++)
+            {
+                dig[k] = rand() % 10;
+                lo = PREP_X0 + 1 + k * slot + (mode ? -HOST_TIGHT / 2 : HOST_GAP);
+                hi = PREP_X0 + 1 + (k + 1) * slot - (mode ? -HOST_TIGHT / 2 : HOST_GAP);
+                lo = (lo < PREP_X0 + 1) ? PREP_X0 + 1 : lo;
+                hi = (hi > PREP_X0 + PREP_W - 2) ? PREP_X0 + PREP_W - 2 : hi;
+                host_digit(dig[k], h, lo, hi, y, y + (1 + HOST_JITTER) * h);
+            }
+
+            prep_clear();
+            host_feed(prep_add);
+
+            s = prep_segment();                 /* ָ */
+            all = (s == n);
+
+            for (k = 0; k < s; k++)
+            {
+                prep_run(k, g_in);
+                all &= (k < n && host_classify(g_in, NULL) == dig[k]);
+            }
+
+            ok_seg += all;
+            out_seg += s;
+            mac_seg += (double)win * s;
+
+            w = prep_strip(strip_image(g_host_scratch), STRIP_W_MAX);   /*  */
+            strip_run(g_host_scratch, w, 0, &r);
+            ok_strip += host_same(&r, dig, n);
+            strip_run(g_host_scratch, w, 1, &rg);
+
+            for (k = 0, all = host_same(&rg, dig, n); k < rg.count; k++)
+            {
+                all &= (rg.conf[k] == r.conf[k]);               /* ÿڶʱȫһ */
+            }
+
+            ok_gate += all;
+            host_window(&rg);
+            ok_win += host_same(&rg, dig, n);
+            out_strip += r.count;
+            mac_strip += r.macc;
+            mac_gate += rg.macc;
+            mac_win += (double)win * r.pos;
+            pos += r.pos;
+            heads += rg.heads;
+        }
+
+        printf("%-7s %-10s %7.1f%% %14.0f\n", mode ? "tight" : "spaced", "seg", 100 * ok_seg / num, mac_seg / out_seg);
+        printf("%-7s %-10s %7.1f%% %14.0f\n", "", "window", 100 * ok_win / num, mac_win / out_strip);
+        printf("%-7s %-10s %7.1f%% %14.0f\n", "", "strip", 100 * ok_strip / num, mac_strip / out_strip);
+        printf("%-7s %-10s %7.1f%% %14.0f   (head on %.1f of %.1f windows)\n", "", "strip gate",
+               100 * ok_gate / num, mac_gate / out_strip, heads / num, pos / num);
+    }
+
+    /* ʱ: һ3λ */
+    g_pt_num = 0;
+    slot = (PREP_W - 2.0) / 3;
+
+    for (k = 0; k < 3; k++)
+    {
+        host_digit(k + 1, 0.5 * PREP_H, PREP_X0 + 1 + k * slot + HOST_GAP, PREP_X0 + 1 + (k + 1) * slot - HOST_GAP,
+                   PREP_Y0 + 100, PREP_Y0 + 100 + 0.5 * PREP_H);
+    }
+
+    prep_clear();
+    host_feed(prep_add);
+    w = prep_strip(strip_image(g_host_scratch), STRIP_W_MAX);
+    t = host_cycles();
+
+    for (i = 0; i < HOST_REPEAT; i++)
+    {
+        strip_run(g_host_scratch, w, 0, &r);
+    }
+
+    c_strip = (host_cycles() - t) / HOST_REPEAT;
+    prep_segment();
+    prep_run(0, g_in);
+    t = host_cycles();
+
+    for (i = 0; i < HOST_REPEAT; i++)
+    {
+        host_classify(g_in, NULL);
+    }
+
+    c_ref = (host_cycles() - t) / HOST_REPEAT;
+    printf("\ncost (host, %u MHz cycles), \"123\", strip %u px, %u windows:\n", HOST_CLOCK / 1000000, w, r.pos);
+    printf("  strip_run    %10u  (%u digits)\n", c_strip, r.count);
+    printf("  nn_ref_run   %10u  x %u windows = %u\n", c_ref, r.pos, c_ref * r.pos);
+    return 0;
+}
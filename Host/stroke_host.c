@@ -0,0 +1,516 @@
+/**
+ ****************************************************************************************************
+ * @file        stroke_host.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       ʻ: ڹ켣֪ӳ١ī
+ ****************************************************************************************************
+ * @attention
+ *
+ * (ڲֿĿ¼):
+ *   gcc -O2 -DHOST_SIM -ICore/Inc -IHost Host/stroke_host.c Core/Src/stroke.c -lm -o stroke_host
+ * :
+ *   ./stroke_host                 õĺϳɱʻ(֪ʵ켣, 50Hz, )
+ *   ./stroke_host trace.txt       ¼ƵĹ켣, ÿ " x y", һ "up" ʾ̧
+ *
+ * Ƚִ: raw(ԭ, ֱòֱ), euro(1-euro ˲), predict(˲
+ * STROKE_PREDICT_MS). ʵ켣: ϳɱʻ; ¼ƵĹ켣ûֵ, òߴ.
+ *
+ *   lat    ֪ӳ(ms): Ļīĩ(ʼ)Ӧʵ켣϶ǰλ. ʼڲ
+ *          HOST_PIPE_MS , ֵһβ, ȿ; ֻͳٶ > 200/
+ *          ʱ, ʾǰ.
+ *   jitter ֹ100msʱʼʵλõľ()
+ *   path   ˶ʱʼ۵ӳٺʵ켣ľ(), ƹͷ
+ *   ink    ī()ʵ켣ƽ/(): raw  euro ֱ, curve 
+ *          Catmull-Rom ֵī
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "stroke.h"
+
+
+#define HOST_PERIOD_MS      20          /* TIM2 ɨ */
+#define HOST_NOISE          1.2         /* ϳɱʻĲ(, ׼) */
+#define HOST_HOLD_MS        200         /* ϳɱʻʺȾֹʱ */
+#define HOST_SAMPLE_MAX     512         /* һ */
+#define HOST_INK_MAX        (HOST_SAMPLE_MAX * STROKE_CURVE_MAX)
+#define HOST_MOVING         200.0       /* /, ӳ */
+#define HOST_PIPE_MS        6           /* ʱ(ɨ+,  trace ) */
+#define HOST_LOOK_NUM       4           /* β֮俴αʼ */
+#define HOST_LAT_MAX        150         /* ӳҵmsǰ, ҪС"0"һȦ(300ms), βغϴҵһȦ */
+
+/* һ */
+typedef struct
+{
+    uint32_t num;
+    double t[HOST_SAMPLE_MAX];          /* ʱ(ms) */
+    uint16_t x[HOST_SAMPLE_MAX];        /*  */
+    uint16_t y[HOST_SAMPLE_MAX];
+    double tx[HOST_SAMPLE_MAX];         /* ʵ(¼ƵĹ켣ǲ) */
+    double ty[HOST_SAMPLE_MAX];
+    uint8_t shape;                      /* ϳɱʻ״, 0xFF ʾ¼ƵĹ켣 */
+    double dur;                         /* ϳɱʻ˶ʱ(ms) */
+} host_stroke_t;
+
+/* һִͳ */
+typedef struct
+{
+    double lat[HOST_SAMPLE_MAX * 12 * HOST_LOOK_NUM];
+    uint32_t lat_num;
+    double still_sq;
+    uint32_t still_num;
+    double path_sq;
+    uint32_t path_num;
+} host_stat_t;
+
+/* ī */
+typedef struct
+{
+    double sum;
+    double max;
+    uint32_t num;
+} host_ink_t;
+
+static host_stroke_t g_host_s;
+static host_stat_t g_host_stat[3];      /* raw, euro, predict */
+static host_ink_t g_host_ink[3];        /* raw, euro, curve */
+static double g_host_ink_pt[3][HOST_INK_MAX][2];
+static uint32_t g_host_ink_num[3];
+static uint32_t g_host_seed = 1;
+
+/**
+ * @brief       ظα(ÿнͬ)
+ * @param       
+ * @retval      [0, 1)
+ */
+static double host_rand(void)
+{
+    g_host_seed = g_host_seed * 1103515245u + 12345u;
+    return ((g_host_seed >> 8) & 0xFFFFFF) / 16777216.0;
+}
+
+/**
+ * @brief       ֲ̬
+ * @param       sigma: ׼
+ * @retval      
+ */
+static double host_noise(double sigma)
+{
+    double u = host_rand() + 1e-12, v = host_rand();
+
+    return sigma * sqrt(-2 * log(u)) * cos(2 * M_PI * v);
+}
+
+/**
+ * @brief       ϳɱʻʵλ
+ * @param       shape: ״
+ * @param       u    :  0~1
+ * @param       x,y  : 
+ * @retval      
+ */
+static void host_shape(uint8_t shape, double u, double *x, double *y)
+{
+    double a;
+
+    switch (shape)
+    {
+        case 0:                         /* "0": Բ, ӶʱһȦ */
+            a = M_PI / 2 + 2 * M_PI * u;
+            *x = 240 + 90 * cos(a);
+            *y = 240 - 130 * sin(a);
+            break;
+
+        case 1:                         /* "2": ϰԲ, б, ױ */
+            if (u < 0.45)
+            {
+                a = M_PI - M_PI * 1.25 * (u / 0.45);
+                *x = 240 + 70 * cos(a);
+                *y = 170 - 70 * sin(a);
+            }
+            else if (u < 0.75)
+            {
+                a = (u - 0.45) / 0.30;
+                *x = (240 + 49.5) * (1 - a) + 160 * a;     /* ӻյ(-45)бŵ½ */
+                *y = (170 + 49.5) * (1 - a) + 330 * a;
+            }
+            else
+            {
+                *x = 160 + 170 * (u - 0.75) / 0.25;
+                *y = 330;
+            }
+            break;
+
+        default:                        /* "S"ο˦ */
+            *x = 110 + 260 * u;
+            *y = 240 + 110 * sin(2 * M_PI * u);
+            break;
+    }
+}
+
+/**
+ * @brief       һʺϳɱʻ: Ⱦֹ HOST_HOLD_MS,  dur 뻭
+ * @param       s    : ʻ
+ * @param       shape: ״
+ * @param       dur  : ˶ʱ(ms)
+ * @retval      
+ */
+static void host_synth(host_stroke_t *s, uint8_t shape, double dur)
+{
+    double t, u, x, y;
+
+    s->num = 0;
+    s->shape = shape;
+    s->dur = dur;
+
+    for (t = 0; t <= HOST_HOLD_MS + dur && s->num < HOST_SAMPLE_MAX; t += HOST_PERIOD_MS + host_noise(0.3))
+    {
+        u = (t < HOST_HOLD_MS) ? 0 : (t - HOST_HOLD_MS) / dur;
+        u = (u > 1) ? 1 : u;
+        u = u * u * (3 - 2 * u);        /* ʼ, ձʼ */
+        host_shape(shape, u, &x, &y);
+        s->t[s->num] = t;
+        s->tx[s->num] = x;
+        s->ty[s->num] = y;
+        s->x[s->num] = (uint16_t)lround(x + host_noise(HOST_NOISE));
+        s->y[s->num] = (uint16_t)lround(y + host_noise(HOST_NOISE));
+        s->num++;
+    }
+}
+
+/**
+ * @brief       ʵ켣ʱ t λ
+ * @param       s  : ʻ
+ * @param       t  : ʱ(ms), Χȡ
+ * @param       x,y: 
+ * @retval      
+ */
+static void host_truth(const host_stroke_t *s, double t, double *x, double *y)
+{
+    double u;
+    uint32_t i;
+
+    if (s->shape != 0xFF)
+    {
+        u = (t < HOST_HOLD_MS) ? 0 : (t - HOST_HOLD_MS) / s->dur;
+        u = (u > 1) ? 1 : u;
+        u = u * u * (3 - 2 * u);
+        host_shape(s->shape, u, x, y);
+        return;
+    }
+
+    for (i = 1; i < s->num - 1 && s->t[i] < t; i++);
+
+    u = (t - s->t[i - 1]) / (s->t[i] - s->t[i - 1]);
+    u = (u < 0) ? 0 : (u > 1) ? 1 : u;
+    *x = s->tx[i - 1] + (s->tx[i] - s->tx[i - 1]) * u;
+    *y = s->ty[i - 1] + (s->ty[i] - s->ty[i - 1]) * u;
+}
+
+/**
+ * @brief       㵽߶εľ
+ * @param       px,py: 
+ * @param       a,b  : ߶
+ * @retval      
+ */
+static double host_seg_dist(double px, double py, const double *a, const double *b)
+{
+    double dx = b[0] - a[0], dy = b[1] - a[1], l = dx * dx + dy * dy, u = 0;
+
+    if (l > 0)
+    {
+        u = ((px - a[0]) * dx + (py - a[1]) * dy) / l;
+        u = (u < 0) ? 0 : (u > 1) ? 1 : u;
+    }
+
+    dx = a[0] + u * dx - px;
+    dy = a[1] + u * dy - py;
+    return sqrt(dx * dx + dy * dy);
+}
+
+/**
+ * @brief       һ۱ʼ: ʵ켣ʱ, ͵ǰʱ̵Ĳӳ
+ * @param       st : ͳ
+ * @param       s  : ʻ
+ * @param       now: ǰʱ(ms)
+ * @param       x,y: ʼ
+ * @retval      
+ */
+static void host_look(host_stat_t *st, const host_stroke_t *s, double now, double x, double y)
+{
+    double best = 1e9, lat = 0, d, tau, x0, y0, x1, y1;
+
+    host_truth(s, now - 100, &x0, &y0);
+    host_truth(s, now + 1, &x1, &y1);
+
+    if (hypot(x1 - x0, y1 - y0) < 0.1)  /* Ѿֹ100ms */
+    {
+        host_truth(s, now, &x0, &y0);
+        st->still_sq += (x - x0) * (x - x0) + (y - y0) * (y - y0);
+        st->still_num++;
+        return;
+    }
+
+    host_truth(s, now - 1, &x0, &y0);
+    d = hypot(x1 - x0, y1 - y0) * 500;  /* ٶ(/) */
+
+    if (d < HOST_MOVING)                /* ձʵٶ: ӳû */
+    {
+        return;
+    }
+
+    for (tau = -100; tau <= HOST_LAT_MAX; tau += 0.5)
+    {
+        host_truth(s, now - tau, &x0, &y0);
+        d = hypot(x - x0, y - y0);
+
+        if (d < best)
+        {
+            best = d;
+            lat = tau;
+        }
+    }
+
+    st->lat[st->lat_num++] = lat;
+    st->path_sq += best * best;
+    st->path_num++;
+}
+
+/**
+ * @brief       һʼ: k HOST_PIPE_MS , һֱʾһ,
+ *              ڼȿ HOST_LOOK_NUM 
+ * @param       st : ͳ
+ * @param       s  : ʻ
+ * @param       k  : ڼ
+ * @param       x,y: ʼ
+ * @retval      
+ */
+static void host_tip(host_stat_t *st, const host_stroke_t *s, uint32_t k, double x, double y)
+{
+    double span = (k + 1 < s->num) ? s->t[k + 1] - s->t[k] : HOST_PERIOD_MS;
+    uint8_t i;
+
+    for (i = 0; i < HOST_LOOK_NUM; i++)
+    {
+        host_look(st, s, s->t[k] + HOST_PIPE_MS + span * i / HOST_LOOK_NUM, x, y);
+    }
+}
+
+/**
+ * @brief       īһ
+ * @param       i  : ī
+ * @param       x,y: 
+ * @retval      
+ */
+static void host_ink_add(uint8_t i, double x, double y)
+{
+    if (g_host_ink_num[i] < HOST_INK_MAX)
+    {
+        g_host_ink_pt[i][g_host_ink_num[i]][0] = x;
+        g_host_ink_pt[i][g_host_ink_num[i]][1] = y;
+        g_host_ink_num[i]++;
+    }
+}
+
+/**
+ * @brief       һʻī: ʵ켣ÿ1msȡһ, īߵľ
+ * @param       s: ʻ
+ * @retval      
+ */
+static void host_ink_done(const host_stroke_t *s)
+{
+    double t, x, y, d, best;
+    uint32_t i, j;
+
+    for (i = 0; i < 3; i++)
+    {
+        for (t = s->t[0]; t <= s->t[s->num - 1]; t += 1)
+        {
+            host_truth(s, t, &x, &y);
+            best = 1e9;
+
+            for (j = 0; j + 1 < g_host_ink_num[i]; j++)
+            {
+                d = host_seg_dist(x, y, g_host_ink_pt[i][j], g_host_ink_pt[i][j + 1]);
+                best = (d < best) ? d : best;
+            }
+
+            if (g_host_ink_num[i] > 1)
+            {
+                g_host_ink[i].sum += best;
+                g_host_ink[i].max = (best > g_host_ink[i].max) ? best : g_host_ink[i].max;
+                g_host_ink[i].num++;
+            }
+        }
+
+        g_host_ink_num[i] = 0;
+    }
+}
+
+/**
+ * @brief       һ, ִͬʱͳ
+ * @param       s: ʻ
+ * @retval      
+ */
+static void host_run(const host_stroke_t *s)
+{
+    uint16_t out[STROKE_CURVE_MAX][2];
+    stroke_t st;
+    uint16_t x, y;
+    uint32_t k;
+    uint8_t n, i;
+
+    if (s->num < 2)
+    {
+        return;
+    }
+
+    for (k = 0; k < s->num; k++)
+    {
+        if (k == 0)
+        {
+            stroke_begin(&st, s->x[0], s->y[0]);
+            n = 0;
+            host_ink_add(2, s->x[0], s->y[0]);
+        }
+        else
+        {
+            n = stroke_add(&st, s->x[k], s->y[k], (uint32_t)lround((s->t[k] - s->t[k - 1]) * 1000), out);
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            host_ink_add(2, out[i][0], out[i][1]);
+        }
+
+        host_tip(&g_host_stat[0], s, k, s->x[k], s->y[k]);
+        host_ink_add(0, s->x[k], s->y[k]);
+        stroke_last(&st, &x, &y);
+        host_tip(&g_host_stat[1], s, k, x, y);
+        host_ink_add(1, x, y);
+        stroke_predict(&st, STROKE_PREDICT_MS, &x, &y);
+        host_tip(&g_host_stat[2], s, k, x, y);
+    }
+
+    n = stroke_end(&st, out);
+
+    for (i = 0; i < n; i++)
+    {
+        host_ink_add(2, out[i][0], out[i][1]);
+    }
+
+    host_ink_done(s);
+}
+
+/**
+ * @brief       qsort ȽϺ
+ */
+static int host_cmp(const void *a, const void *b)
+{
+    double d = *(const double *)a - *(const double *)b;
+
+    return (d > 0) - (d < 0);
+}
+
+/**
+ * @brief       ¼ƵĹ켣, ÿһʴһ
+ * @param       name: ļ
+ * @retval      0, ɹ; 1, 򲻿;
+ */
+static uint8_t host_load(const char *name)
+{
+    FILE *f = fopen(name, "r");
+    char line[128];
+    double t;
+    unsigned x, y;
+
+    if (f == NULL)
+    {
+        return 1;
+    }
+
+    g_host_s.num = 0;
+    g_host_s.shape = 0xFF;
+
+    while (fgets(line, sizeof(line), f))
+    {
+        if (sscanf(line, "%lf %u %u", &t, &x, &y) == 3 && g_host_s.num < HOST_SAMPLE_MAX)
+        {
+            g_host_s.t[g_host_s.num] = t;
+            g_host_s.x[g_host_s.num] = (uint16_t)x;
+            g_host_s.y[g_host_s.num] = (uint16_t)y;
+            g_host_s.tx[g_host_s.num] = x;
+            g_host_s.ty[g_host_s.num] = y;
+            g_host_s.num++;
+        }
+        else if (strncmp(line, "up", 2) == 0)
+        {
+            host_run(&g_host_s);
+            g_host_s.num = 0;
+        }
+    }
+
+    host_run(&g_host_s);
+    fclose(f);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    static const char *name[3] = {"raw", "euro", "predict"};
+    static const char *ink[3] = {"raw", "euro", "curve"};
+    static const double dur[] = {900, 600, 400, 300};
+    host_stat_t *st;
+    double mean;
+    uint32_t i, j, s;
+
+    if (argc > 1)
+    {
+        if (host_load(argv[1]))
+        {
+            printf("cannot open %s\n", argv[1]);
+            return 2;
+        }
+    }
+    else
+    {
+        for (s = 0; s < 3; s++)
+        {
+            for (j = 0; j < sizeof(dur) / sizeof(dur[0]); j++)
+            {
+                host_synth(&g_host_s, s, dur[j]);
+                host_run(&g_host_s);
+            }
+        }
+    }
+
+    printf("%-8s %8s %8s %8s %8s %8s\n", "tip", "lat", "lat_p95", "lat_max", "jitter", "path");
+
+    for (i = 0; i < 3; i++)
+    {
+        st = &g_host_stat[i];
+        qsort(st->lat, st->lat_num, sizeof(double), host_cmp);
+
+        for (j = 0, mean = 0; j < st->lat_num; j++)
+        {
+            mean += st->lat[j];
+        }
+
+        mean = st->lat_num ? mean / st->lat_num : 0;
+        printf("%-8s %8.1f %8.1f %8.1f %8.2f %8.2f\n", name[i], mean,
+               st->lat_num ? st->lat[st->lat_num * 95 / 100] : 0, st->lat_num ? st->lat[st->lat_num - 1] : 0,
+               st->still_num ? sqrt(st->still_sq / st->still_num) : 0,
+               st->path_num ? sqrt(st->path_sq / st->path_num) : 0);
+    }
+
+    printf("%-8s %8s %8s\n", "ink", "mean", "max");
+
+    for (i = 0; i < 3; i++)
+    {
+        printf("%-8s %8.2f %8.2f\n", ink[i], g_host_ink[i].num ? g_host_ink[i].sum / g_host_ink[i].num : 0, g_host_ink[i].max);
+    }
+
+    return 0;
+}
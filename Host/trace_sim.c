@@ -0,0 +1,128 @@
+/**
+ ****************************************************************************************************
+ * @file        trace_sim.c
+ * @version     V1.0
+ * @date        2026-10-18
+ * @brief       trace.c : ϵʱģⴥжϺѭ, ӳٱ
+ ****************************************************************************************************
+ * @attention
+ *
+ * (ڲֿĿ¼):
+ *   gcc -O2 -DHOST_SIM -ICore/Inc -IHost Host/trace_sim.c Host/host_sim.c Core/Src/trace.c -o trace_sim
+ * :
+ *   ./trace_sim [] [ms]
+ *
+ * ûж, "ÿν׶νʱǷһ20ms"ģTIM2ռ,
+ * ׶æģʱ, ʱȡ԰ϵʵֵ, òʱ.
+ *
+ ****************************************************************************************************
+ */
+
+#include <stdlib.h>
+#include "trace.h"
+
+
+static uint32_t g_sim_next_touch;   /* һδжϵʱ() */
+static uint32_t g_sim_touching;     /* ʣıʻ */
+
+/**
+ * @brief       æһʱ, ڼ䰴50Hz봥ж
+ * @param       us: ΢
+ * @retval      
+ */
+static void sim_busy(uint32_t us);
+
+/**
+ * @brief       һTIM2ж: ɨ败, бʻʱ߲
+ * @param       
+ * @retval      
+ */
+static void sim_touch_isr(void)
+{
+    uint8_t drawn = 0;
+
+    TRACE_BEGIN(TOUCH_SCAN);
+    sim_busy(180 + rand() % 40);        /* GT9xxx  */
+    TRACE_END(TOUCH_SCAN);
+
+    if (g_sim_touching)
+    {
+        TRACE_BEGIN(DRAW_LINE);
+        sim_busy(900 + rand() % 600);   /* lcd_draw_bline 㻭Բ */
+        TRACE_END(DRAW_LINE);
+
+        TRACE_BEGIN(PROCESS);
+        sim_busy(20 + rand() % 10);
+        TRACE_END(PROCESS);
+
+        g_sim_touching--;
+        drawn = 1;
+    }
+    else if (rand() % 50 == 0)          /* ƽÿ뿪ʼһ */
+    {
+        g_sim_touching = 10 + rand() % 30;
+    }
+
+    if (drawn)
+    {
+        TRACE_TOUCH(TOUCH_SCAN);
+    }
+}
+
+static void sim_busy(uint32_t us)
+{
+    uint32_t start = host_cycles();
+    uint32_t cycles = us * (HOST_CLOCK / 1000000);
+    static uint8_t in_isr = 0;
+
+    while (host_cycles() - start < cycles)
+    {
+        if (!in_isr && (int32_t)(host_cycles() - g_sim_next_touch) >= 0)
+        {
+            in_isr = 1;
+            g_sim_next_touch += HOST_CLOCK / 50;
+            sim_touch_isr();
+            in_isr = 0;
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t seconds = (argc > 1) ? atoi(argv[1]) : 5;
+    uint32_t infer_ms = (argc > 2) ? atoi(argv[2]) : 60;
+    uint32_t end;
+    int i;
+
+    trace_init();
+    g_sim_next_touch = host_cycles();
+    end = HAL_GetTick() + seconds * 1000;
+
+    while ((int32_t)(HAL_GetTick() - end) < 0)
+    {
+        TRACE_FRAME_BEGIN();
+
+        TRACE_BEGIN(AI_RUN);
+        sim_busy(infer_ms * 1000);
+        TRACE_END(AI_RUN);
+
+        TRACE_BEGIN(ARGMAX);
+        sim_busy(1);
+        TRACE_END(ARGMAX);
+
+        TRACE_BEGIN(SHOW_TEXT);
+
+        for (i = 0; i < 11; i++)
+        {
+            sim_busy(1500);             /* lcd_show_string д32 */
+        }
+
+        TRACE_END(SHOW_TEXT);
+        TRACE_FRAME_END();
+        trace_poll();
+    }
+
+    trace_poll();
+    trace_report();
+    return 0;
+}
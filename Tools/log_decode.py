@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""USART1 日志解码
+
+把串口上的文本行和 LOG_BIN 二进制记录(见 Core/Inc/log.h)分开, 二进制记录按
+Core/Inc/log_ids.h 里的格式串还原成文本. 只依赖标准库.
+
+用法:
+    python3 log_decode.py /dev/ttyUSB0            # 直接读串口(115200 8N1)
+    python3 log_decode.py capture.bin             # 解码抓包文件
+    python3 log_decode.py -                       # 从stdin读
+    python3 log_decode.py --clock 168000000 ...   # 时间戳换算成微秒
+    python3 log_decode.py capture.bin --touch a.tpr   # 另外把触摸录制(TOUCH_REC)存成轨迹文件
+
+触摸轨迹的格式见 Core/Inc/tprec.h, 可以用 Host/replay_host 回放, 或者 proto_client.py --replay 传回板上.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+LOG_BIN_SYNC = 0xA5
+LOG_BIN_SIZE = 24
+
+TPR_VERSION = 1
+TPR_PT_MAX = 5
+TPR_DT_US = 100
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_IDS = os.path.join(HERE, "..", "Core", "Inc", "log_ids.h")
+
+
+def load_ids(path):
+    """解析 log_ids.h, 返回按ID排列的 (名字, 格式串) 列表"""
+    ids = []
+    pat = re.compile(r'^\s*LOG_ID\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+    with open(path, "rb") as f:
+        for line in f.read().decode("gbk", "replace").splitlines():
+            m = pat.match(line)
+            if m:
+                ids.append((m.group(1), m.group(2)))
+    return ids
+
+
+def format_record(fmt, args):
+    """按设备端 log_format 的规则格式化: %d %u %x %X %c %f %%, 支持0填充和宽度"""
+    out = []
+    it = iter(args)
+    for m in re.finditer(r"%(0?)(\d*)([duxXcf%])|[^%]+|%", fmt):
+        if not m.group(0).startswith("%") or m.group(3) is None:
+            out.append(m.group(0))
+            continue
+        conv = m.group(3)
+        if conv == "%":
+            out.append("%")
+            continue
+        v = next(it, 0)
+        spec = "%" + m.group(1) + m.group(2)
+        if conv == "d":
+            out.append((spec + "d") % struct.unpack("<i", struct.pack("<I", v))[0])
+        elif conv in "uxX":
+            out.append((spec + conv) % v)
+        elif conv == "c":
+            out.append(chr(v & 0xFF))
+        else:
+            out.append("%.6f" % struct.unpack("<f", struct.pack("<I", v))[0])
+    return "".join(out)
+
+
+class TouchTrace:
+    """收集 TOUCH_REC 记录, 写成 .tpr(见 tprec.h)"""
+
+    def __init__(self, width, height, clock):
+        self.width = width
+        self.height = height
+        self.clock = clock or 168000000
+        self.frames = bytearray()
+        self.count = 0
+        self.last_ts = None
+        self.last_seq = None
+        self.lost = 0
+
+    def add(self, ts, payload):
+        mask = payload[0] & 0x1F
+        seq = payload[0] >> 5
+        if self.last_seq is not None and seq != (self.last_seq + 1) & 7:
+            self.lost += (seq - self.last_seq - 1) & 7
+        self.last_seq = seq
+        dt = 0 if self.last_ts is None else ((ts - self.last_ts) & 0xFFFFFFFF) * 1e6 / self.clock
+        self.last_ts = ts
+        self.frames += struct.pack("<HB", min(int(dt / TPR_DT_US + 0.5), 0xFFFF), mask)
+        for i in range(TPR_PT_MAX):
+            if mask & (1 << i):
+                self.frames += payload[1 + i * 3:4 + i * 3]
+        self.count += 1
+
+    def save(self, path):
+        with open(path, "wb") as f:
+            f.write(b"TPR" + struct.pack("<BHH", TPR_VERSION, self.width, self.height))
+            f.write(self.frames)
+
+
+class Decoder:
+    def __init__(self, ids, clock=0, touch=None):
+        self.ids = ids
+        self.clock = clock
+        self.touch = touch
+        self.buf = bytearray()
+        self.text = bytearray()
+        self.bad = 0
+
+    def feed(self, data):
+        """输入一段原始字节, 返回解码出来的行"""
+        self.buf += data
+        lines = []
+        while self.buf:
+            b = self.buf[0]
+            if b != LOG_BIN_SYNC:
+                del self.buf[0]
+                if b == 0x0A:
+                    lines.append(self.text.decode("gbk", "replace").rstrip("\r"))
+                    self.text.clear()
+                else:
+                    self.text.append(b)
+                continue
+            if len(self.buf) < LOG_BIN_SIZE:
+                break
+            rec = bytes(self.buf[:LOG_BIN_SIZE])
+            chk = 0
+            for c in rec[1:LOG_BIN_SIZE - 1]:
+                chk ^= c
+            if chk != rec[LOG_BIN_SIZE - 1]:
+                # 校验失败, 当作普通字节处理, 从下一个字节重新同步
+                self.bad += 1
+                del self.buf[0]
+                continue
+            del self.buf[:LOG_BIN_SIZE]
+            lines.append(self.record(rec))
+        return lines
+
+    def record(self, rec):
+        rid, ts, a0, a1, a2, a3 = struct.unpack("<HIIIII", rec[1:LOG_BIN_SIZE - 1])
+        if self.clock:
+            stamp = "[%12.1fus]" % (ts * 1e6 / self.clock)
+        else:
+            stamp = "[%10u]" % ts
+        if rid < len(self.ids):
+            name, fmt = self.ids[rid]
+            if name == "TOUCH_REC" and self.touch is not None:
+                self.touch.add(ts, rec[7:LOG_BIN_SIZE - 1])
+            return "%s %s: %s" % (stamp, name, format_record(fmt, (a0, a1, a2, a3)))
+        return "%s ID%d: %08x %08x %08x %08x" % (stamp, rid, a0, a1, a2, a3)
+
+
+def open_input(path):
+    if path == "-":
+        return sys.stdin.buffer
+    f = open(path, "rb", buffering=0)
+    if os.isatty(f.fileno()):
+        import termios
+        import tty
+        tty.setraw(f.fileno())
+        attr = termios.tcgetattr(f.fileno())
+        attr[4] = attr[5] = termios.B115200
+        termios.tcsetattr(f.fileno(), termios.TCSANOW, attr)
+    return f
+
+
+def main():
+    ap = argparse.ArgumentParser(description="decode USART1 log stream")
+    ap.add_argument("input", help="serial device, capture file or -")
+    ap.add_argument("--ids", default=DEFAULT_IDS, help="path to log_ids.h")
+    ap.add_argument("--clock", type=int, default=0, help="CPU clock in Hz, print timestamps in us")
+    ap.add_argument("--touch", help="also write TOUCH_REC records to this .tpr trace")
+    ap.add_argument("--lcd", default="480x800", help="LCD size the trace was recorded on (lcddev width x height)")
+    args = ap.parse_args()
+
+    touch = None
+    if args.touch:
+        w, h = (int(v) for v in args.lcd.lower().split("x"))
+        touch = TouchTrace(w, h, args.clock)
+    dec = Decoder(load_ids(args.ids), args.clock, touch)
+    f = open_input(args.input)
+    try:
+        while True:
+            data = f.read(256)
+            if not data:
+                break
+            for line in dec.feed(data):
+                print(line, flush=True)
+    except KeyboardInterrupt:
+        pass
+    if dec.text:
+        print(dec.text.decode("gbk", "replace"))
+    if dec.bad:
+        print("checksum errors: %d" % dec.bad, file=sys.stderr)
+    if touch is not None:
+        touch.save(args.touch)
+        print("touch: %d frames -> %s%s" % (touch.count, args.touch,
+              ", %d frames lost (log buffer full)" % touch.lost if touch.lost else ""), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
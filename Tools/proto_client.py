@@ -0,0 +1,224 @@
+#!/usr/bin/env python3
+"""推理协议的主机端客户端(帧格式见 Core/Inc/proto.h)
+
+用法:
+    python3 proto_client.py /dev/ttyUSB0 --ping
+    python3 proto_client.py /dev/ttyUSB0 --image digit.raw          # 784字节灰度图
+    python3 proto_client.py /dev/ttyUSB0 --idx t10k-images-idx3-ubyte --bench 100
+    python3 proto_client.py /tmp/ttyMNIST --bench 200 --window 4 --verify-sim
+    python3 proto_client.py /dev/ttyUSB0 --replay a.tpr         # 触摸轨迹传到板上回放, 打印trace报告
+
+--window 是不等应答连续发送的帧数, 不超过设备的 PROTO_FRAME_NUM 时不会出现 busy.
+"""
+
+import argparse
+import os
+import random
+import select
+import struct
+import sys
+import time
+
+import proto_common as pc
+
+
+class Client:
+    def __init__(self, fd, timeout=2.0):
+        self.fd = fd
+        self.timeout = timeout
+        self.parser = pc.FrameParser(max_payload=64)
+        self.seq = 0
+        self.backlog = []
+
+    def send(self, ftype, payload=b""):
+        seq = self.seq
+        self.seq = (self.seq + 1) & 0xFF
+        os.write(self.fd, pc.pack_frame(ftype, seq, payload))
+        return seq
+
+    def recv(self, timeout=None):
+        """等待下一个应答帧, 返回 (type, seq, payload) 或 None(超时)"""
+        deadline = time.monotonic() + (self.timeout if timeout is None else timeout)
+        while not self.backlog:
+            left = deadline - time.monotonic()
+            if left <= 0:
+                return None
+            r, _, _ = select.select([self.fd], [], [], left)
+            if r:
+                self.backlog += self.parser.feed(os.read(self.fd, 4096))
+        return self.backlog.pop(0)
+
+    def take_text(self):
+        text = bytes(self.parser.other)
+        self.parser.other.clear()
+        return text
+
+
+def load_images(args):
+    if args.image:
+        with open(args.image, "rb") as f:
+            data = f.read()
+        return [data[i:i + 784] for i in range(0, len(data) - 783, 784)]
+    if args.idx:
+        with open(args.idx, "rb") as f:
+            magic, count, rows, cols = struct.unpack(">IIII", f.read(16))
+            if magic != 0x803 or rows * cols != 784:
+                raise SystemExit("not an idx3 28x28 image file")
+            return [f.read(784) for _ in range(count)]
+    rnd = random.Random(1)
+    return [bytes(rnd.randrange(256) for _ in range(784)) for _ in range(16)]
+
+
+def do_ping(cli):
+    t = time.monotonic()
+    seq = cli.send(pc.T_PING, b"ping")
+    fr = cli.recv()
+    if fr is None:
+        print("ping: timeout")
+        return 1
+    ftype, rseq, payload = fr
+    if ftype != (pc.T_PING | pc.T_ACK) or rseq != seq:
+        print("ping: unexpected reply type=%02x seq=%d" % (ftype, rseq))
+        return 1
+    ver, nframe, maxp, clock = struct.unpack(pc.PING_FMT, payload)
+    print("ping: %.1f ms, version %d, %d frames in flight, max payload %d, clock %d Hz"
+          % ((time.monotonic() - t) * 1000, ver, nframe, maxp, clock))
+    return 0
+
+
+def tpr_duration(data):
+    """轨迹的时长(秒), 格式见 Core/Inc/tprec.h"""
+    pos, t = 8, 0
+    while pos + 3 <= len(data):
+        dt, mask = struct.unpack_from("<HB", data, pos)
+        t += dt * 100
+        pos += 3 + 3 * bin(mask & 0x1F).count("1")
+    return t / 1e6
+
+
+def do_replay(cli, path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:3] != b"TPR":
+        print("replay: %s is not a touch trace" % path)
+        return 1
+    if len(data) > pc.TRACE_BUF:
+        print("replay: %d bytes, device buffer is %d" % (len(data), pc.TRACE_BUF))
+        return 1
+    step = pc.MAX_PAYLOAD - 2
+    for off in range(0, len(data), step):
+        seq = cli.send(pc.T_TRACE, struct.pack("<H", off) + data[off:off + step])
+        fr = cli.recv()
+        if fr is None or fr[1] != seq or fr[0] != (pc.T_TRACE | pc.T_ACK):
+            print("replay: upload failed at offset %d (%s)" % (off, "timeout" if fr is None else "type=%02x" % fr[0]))
+            return 1
+    duration = tpr_duration(data)
+    print("replay: %d bytes uploaded, %.1f s of touch" % (struct.unpack("<I", fr[2])[0], duration))
+
+    # 控制台命令和帧共用串口, 放完设备输出 "tp: replay done" 和 trace 报告
+    cli.take_text()
+    os.write(cli.fd, b"tp play\r\n")
+    text = b""
+    deadline = time.monotonic() + duration + 5
+    while time.monotonic() < deadline:
+        cli.recv(timeout=0.5)
+        text += cli.take_text()
+        if b"replay done" in text:
+            deadline = min(deadline, time.monotonic() + 1.0)    # 再收1秒报告
+    sys.stdout.write(text.decode("gbk", "replace"))
+    if b"replay done" not in text:
+        print("replay: no report from device")
+        return 1
+    return 0
+
+
+def do_bench(cli, images, count, window, verify_sim, verbose):
+    sent = {}           # seq -> (send time, image)
+    lat = []
+    cycles = []
+    errors = {}
+    bad = 0
+    next_img = 0
+    done = 0
+    t0 = time.monotonic()
+
+    while done < count:
+        while len(sent) < window and next_img < count:
+            img = images[next_img % len(images)]
+            seq = cli.send(pc.T_INFER, img)
+            sent[seq] = (time.monotonic(), img)
+            next_img += 1
+        fr = cli.recv()
+        if fr is None:
+            print("timeout, %d frames outstanding" % len(sent))
+            errors["timeout"] = errors.get("timeout", 0) + len(sent)
+            done += len(sent)
+            sent.clear()
+            continue
+        ftype, seq, payload = fr
+        if seq not in sent:
+            bad += 1
+            continue
+        t, img = sent.pop(seq)
+        done += 1
+        if ftype == pc.T_ERR:
+            name = pc.ERR_NAME.get(payload[0], str(payload[0]))
+            errors[name] = errors.get(name, 0) + 1
+            continue
+        if ftype != (pc.T_INFER | pc.T_ACK):
+            bad += 1
+            continue
+        res = struct.unpack(pc.RESULT_FMT, payload)
+        lat.append(time.monotonic() - t)
+        cycles.append(res[1])
+        if verify_sim and res[0] != sum(img) % 10:
+            bad += 1
+        if verbose:
+            print("seq %3d -> %d (p=%.3f, %u cycles)" % (seq, res[0], res[2 + res[0]], res[1]))
+
+    elapsed = time.monotonic() - t0
+    lat.sort()
+    print("%d frames in %.2f s: %.2f frames/s, window %d" % (count, elapsed, len(lat) / elapsed, window))
+    if lat:
+        print("latency ms: min %.1f  p50 %.1f  p95 %.1f  max %.1f" % (
+            lat[0] * 1000, lat[len(lat) // 2] * 1000, lat[int(len(lat) * 0.95)] * 1000, lat[-1] * 1000))
+        print("device cycles: avg %d" % (sum(cycles) // len(cycles)))
+    if errors:
+        print("errors: " + ", ".join("%s=%d" % kv for kv in sorted(errors.items())))
+    print("mismatched replies: %d, crc errors seen: %d" % (bad, cli.parser.crc_err))
+    return 1 if bad else 0
+
+
+def main():
+    ap = argparse.ArgumentParser(description="host client for the USART1 inference protocol")
+    ap.add_argument("port", help="serial device or pty")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--ping", action="store_true")
+    ap.add_argument("--image", help="raw 784-byte image file(s), concatenated")
+    ap.add_argument("--idx", help="MNIST idx3-ubyte image file")
+    ap.add_argument("--bench", type=int, default=0, help="number of frames to send")
+    ap.add_argument("--window", type=int, default=pc.FRAME_NUM, help="frames in flight")
+    ap.add_argument("--timeout", type=float, default=2.0)
+    ap.add_argument("--verify-sim", action="store_true", help="check results against proto_sim.py")
+    ap.add_argument("--replay", help="upload a .tpr touch trace and replay it on the device")
+    ap.add_argument("--log", action="store_true", help="print non-frame bytes (device log)")
+    ap.add_argument("-v", "--verbose", action="store_true")
+    args = ap.parse_args()
+
+    cli = Client(pc.open_serial(args.port, args.baud), args.timeout)
+    ret = 0
+    if args.ping:
+        ret |= do_ping(cli)
+    images = load_images(args)
+    count = args.bench or (len(images) if (args.image or args.idx) and not args.ping else 0)
+    if count:
+        ret |= do_bench(cli, images, count, max(1, args.window), args.verify_sim, args.verbose or count <= 10)
+    if args.replay:
+        ret |= do_replay(cli, args.replay)
+    if args.log:
+        sys.stdout.write(cli.take_text().decode("gbk", "replace"))
+    return ret
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,116 @@
+"""USART1 二进制推理协议的主机端公共部分(帧格式见 Core/Inc/proto.h)
+
+只依赖标准库, 被 proto_client.py 和 proto_sim.py 共用.
+"""
+
+import os
+import struct
+
+SOF = b"\xaa\x55"
+HDR_SIZE = 4
+MAX_PAYLOAD = 784
+FRAME_NUM = 4
+
+T_PING = 0x01
+T_INFER = 0x02
+T_TRACE = 0x03                  # 2字节偏移 + 一段触摸轨迹(Core/Inc/tprec.h), 应答4字节已收长度
+T_ACK = 0x80
+T_ERR = 0xFF
+
+E_CRC = 1
+E_LEN = 2
+E_BUSY = 3
+E_TYPE = 4
+ERR_NAME = {E_CRC: "crc", E_LEN: "len", E_BUSY: "busy", E_TYPE: "type"}
+
+PING_FMT = "<BBHI"              # version, frame_num, max_payload, clock
+RESULT_FMT = "<B3xI10f"         # result, cycles, prob[10]
+TRACE_BUF = 4096                # TPREC_BUF_SIZE
+
+
+def _crc_table():
+    table = []
+    for i in range(256):
+        c = i << 24
+        for _ in range(8):
+            c = ((c << 1) ^ 0x04C11DB7) if c & 0x80000000 else (c << 1)
+        table.append(c & 0xFFFFFFFF)
+    return table
+
+
+_TABLE = _crc_table()
+
+
+def crc32_stm32(data):
+    """和STM32 CRC外设一致: 按小端32位字输入, 每个字高字节先算, 尾部补0"""
+    data = bytes(data)
+    if len(data) & 3:
+        data += b"\0" * (4 - (len(data) & 3))
+    crc = 0xFFFFFFFF
+    for i in range(0, len(data), 4):
+        for b in (data[i + 3], data[i + 2], data[i + 1], data[i]):
+            crc = ((crc << 8) & 0xFFFFFFFF) ^ _TABLE[(crc >> 24) ^ b]
+    return crc
+
+
+def pack_frame(ftype, seq, payload=b""):
+    body = struct.pack("<BBH", ftype, seq & 0xFF, len(payload)) + bytes(payload)
+    return SOF + body + struct.pack("<I", crc32_stm32(body))
+
+
+class FrameParser:
+    """从字节流里找帧, 帧以外的字节(日志文本/二进制日志)放进 self.other"""
+
+    def __init__(self, max_payload=MAX_PAYLOAD):
+        self.buf = bytearray()
+        self.other = bytearray()
+        self.max_payload = max_payload
+        self.crc_err = 0
+
+    def feed(self, data):
+        """输入字节, 返回 [(type, seq, payload, crc_ok)]"""
+        self.buf += data
+        frames = []
+        while True:
+            i = self.buf.find(SOF)
+            if i < 0:
+                keep = 1 if self.buf.endswith(SOF[:1]) else 0
+                self.other += self.buf[:len(self.buf) - keep]
+                del self.buf[:len(self.buf) - keep]
+                return frames
+            self.other += self.buf[:i]
+            del self.buf[:i]
+            if len(self.buf) < 2 + HDR_SIZE:
+                return frames
+            ftype, seq, length = struct.unpack_from("<BBH", self.buf, 2)
+            if length > self.max_payload:
+                self.other += self.buf[:1]
+                del self.buf[:1]
+                continue
+            total = 2 + HDR_SIZE + length + 4
+            if len(self.buf) < total:
+                return frames
+            body = bytes(self.buf[2:2 + HDR_SIZE + length])
+            (crc,) = struct.unpack_from("<I", self.buf, total - 4)
+            if crc32_stm32(body) != crc:
+                # 可能是日志里碰巧出现的0xAA 0x55, 跳过一个字节重新找
+                self.crc_err += 1
+                self.other += self.buf[:1]
+                del self.buf[:1]
+                continue
+            del self.buf[:total]
+            frames.append((ftype, seq, body[HDR_SIZE:]))
+
+
+def open_serial(path, baud=115200):
+    """以原始模式打开串口或pty, 返回文件描述符"""
+    import termios
+    import tty
+    fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+    if os.isatty(fd):
+        tty.setraw(fd)
+        attr = termios.tcgetattr(fd)
+        speed = getattr(termios, "B%d" % baud, termios.B115200)
+        attr[4] = attr[5] = speed
+        termios.tcsetattr(fd, termios.TCSANOW, attr)
+    return fd
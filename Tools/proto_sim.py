@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+"""推理协议的设备替身: 在pty上模拟板子, 用来在Linux上测协议和吞吐
+
+模拟的内容和 Core/Src/proto.c 一致: 最多缓存 FRAME_NUM 帧, 缓存满回 E_BUSY, CRC错回 E_CRC;
+按波特率限速收发, 每帧推理耗时 --infer-ms. 推理结果是假的: 数字 = 像素和 % 10,
+proto_client.py --verify-sim 可以据此检查应答有没有对错帧.
+
+用法:
+    python3 proto_sim.py --link /tmp/ttyMNIST &
+    python3 proto_client.py /tmp/ttyMNIST --bench 200 --window 4 --verify-sim
+"""
+
+import argparse
+import os
+import queue
+import struct
+import sys
+import threading
+import time
+
+import proto_common as pc
+
+
+class Device:
+    def __init__(self, fd, baud, infer_ms, clock):
+        self.fd = fd
+        self.byte_time = 10.0 / baud
+        self.infer_ms = infer_ms
+        self.clock = clock
+        self.frames = queue.Queue()
+        self.pending = 0
+        self.lock = threading.Lock()
+        self.tx_lock = threading.Lock()
+        self.trace = bytearray()
+
+    def send(self, ftype, seq, payload=b""):
+        data = pc.pack_frame(ftype, seq, payload)
+        with self.tx_lock:
+            os.write(self.fd, data)
+            time.sleep(len(data) * self.byte_time)
+
+    def rx_loop(self):
+        feed = self._make_feed()
+        while True:
+            try:
+                data = os.read(self.fd, 4096)
+            except OSError:
+                return
+            if not data:
+                return
+            time.sleep(len(data) * self.byte_time)
+            feed(data)
+
+    def _make_feed(self):
+        # 和设备一样, CRC错的帧也要回NAK, 所以这里自己解析帧头
+        buf = bytearray()
+
+        def feed(data):
+            buf.extend(data)
+            while True:
+                i = buf.find(pc.SOF)
+                if i < 0:
+                    del buf[:max(0, len(buf) - 1)]
+                    return
+                del buf[:i]
+                if len(buf) < 2 + pc.HDR_SIZE:
+                    return
+                ftype, seq, length = struct.unpack_from("<BBH", buf, 2)
+                if length > pc.MAX_PAYLOAD:
+                    self.send(pc.T_ERR, seq, bytes([pc.E_LEN]))
+                    del buf[:2]
+                    continue
+                total = 2 + pc.HDR_SIZE + length + 4
+                if len(buf) < total:
+                    return
+                body = bytes(buf[2:total - 4])
+                (crc,) = struct.unpack_from("<I", buf, total - 4)
+                del buf[:total]
+                with self.lock:
+                    full = self.pending >= pc.FRAME_NUM
+                    if not full:
+                        self.pending += 1
+                if full:
+                    self.send(pc.T_ERR, seq, bytes([pc.E_BUSY]))
+                    continue
+                self.frames.put((ftype, seq, body[pc.HDR_SIZE:], pc.crc32_stm32(body) == crc))
+
+        return feed
+
+    def work_loop(self):
+        while True:
+            ftype, seq, payload, ok = self.frames.get()
+            if not ok:
+                reply = (pc.T_ERR, bytes([pc.E_CRC]))
+            elif ftype == pc.T_PING:
+                reply = (pc.T_PING | pc.T_ACK,
+                         struct.pack(pc.PING_FMT, 1, pc.FRAME_NUM, pc.MAX_PAYLOAD, self.clock))
+            elif ftype == pc.T_INFER and len(payload) == pc.MAX_PAYLOAD:
+                time.sleep(self.infer_ms / 1000.0)
+                digit = sum(payload) % 10
+                prob = [0.1 / 9] * 10
+                prob[digit] = 0.9
+                cycles = int(self.infer_ms * self.clock / 1000)
+                reply = (pc.T_INFER | pc.T_ACK, struct.pack(pc.RESULT_FMT, digit, cycles, *prob))
+            elif ftype == pc.T_INFER:
+                reply = (pc.T_ERR, bytes([pc.E_LEN]))
+            elif ftype == pc.T_TRACE and len(payload) >= 2:
+                # 和 tprec_load 一样: 偏移0重新开始, 否则必须接着上一段
+                (off,) = struct.unpack_from("<H", payload)
+                if off == 0:
+                    self.trace.clear()
+                if off != len(self.trace) or off + len(payload) - 2 > pc.TRACE_BUF:
+                    reply = (pc.T_ERR, bytes([pc.E_LEN]))
+                else:
+                    self.trace += payload[2:]
+                    reply = (pc.T_TRACE | pc.T_ACK, struct.pack("<I", len(self.trace)))
+            else:
+                reply = (pc.T_ERR, bytes([pc.E_TYPE]))
+            # 和 proto_poll 一样, 先释放帧缓存再发应答
+            with self.lock:
+                self.pending -= 1
+            self.send(reply[0], seq, reply[1])
+
+def main():
+    ap = argparse.ArgumentParser(description="pty stand-in for the inference protocol device")
+    ap.add_argument("--link", help="create a symlink to the pty slave")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--infer-ms", type=float, default=60.0, help="simulated inference time")
+    ap.add_argument("--clock", type=int, default=168000000)
+    args = ap.parse_args()
+
+    master, slave = os.openpty()
+    import tty
+    tty.setraw(slave)
+    name = os.ttyname(slave)
+    if args.link:
+        if os.path.lexists(args.link):
+            os.unlink(args.link)
+        os.symlink(name, args.link)
+        name = args.link
+    print("device on %s" % name, flush=True)
+
+    dev = Device(master, args.baud, args.infer_ms, args.clock)
+    threading.Thread(target=dev.work_loop, daemon=True).start()
+    try:
+        dev.rx_loop()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if args.link and os.path.islink(args.link):
+            os.unlink(args.link)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())